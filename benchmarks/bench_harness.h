@@ -0,0 +1,161 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+/*
+벤치마크 공통 하네스:
+- 고정 시드 난수 생성기 (실행마다 동일한 입력 보장)
+- 워밍업 실행 후 반복 측정
+- 실행 시간의 min / median / p99 보고
+- C와 C++ 양쪽에서 사용 가능한 헤더 전용 구현
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BENCH_SEED 0x2545F4914F6CDD1DULL   // 모든 벤치마크가 공유하는 고정 시드
+#define BENCH_DEFAULT_WARMUP 3
+#define BENCH_DEFAULT_RUNS 21
+
+/* 고정 시드 난수 생성기 (xorshift64*) */
+typedef struct {
+    uint64_t state;
+} BenchRng;
+
+static inline void bench_rng_init(BenchRng* rng, uint64_t seed) {
+    rng->state = seed ? seed : BENCH_SEED;
+}
+
+static inline uint64_t bench_rng_next(BenchRng* rng) {
+    uint64_t x = rng->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    rng->state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+/* [0, bound) 범위의 난수 */
+static inline uint32_t bench_rng_range(BenchRng* rng, uint32_t bound) {
+    return bound ? (uint32_t)(bench_rng_next(rng) % bound) : 0;
+}
+
+/* 단조 증가 시계 (나노초) */
+static inline uint64_t bench_now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/* 최적화로 측정 대상 연산이 제거되지 않도록 결과를 흡수 */
+static volatile uint64_t bench_sink;
+
+static inline void bench_consume(uint64_t value) {
+    bench_sink += value;
+}
+
+/* 벤치마크 설정
+ * - setup: 매 실행 전에 호출 (측정 제외)
+ * - run: 측정 대상
+ * - teardown: 매 실행 후에 호출 (측정 제외)
+ */
+typedef struct {
+    const char* name;
+    int warmup_runs;
+    int measured_runs;
+    size_t ops_per_run;   // ns/op 계산용 (0이면 생략)
+    void* context;
+    void (*setup)(void* context);
+    void (*run)(void* context);
+    void (*teardown)(void* context);
+} BenchCase;
+
+typedef struct {
+    uint64_t min_ns;
+    uint64_t median_ns;
+    uint64_t p99_ns;
+} BenchStats;
+
+static int bench_compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static inline void bench_print_header(const char* title) {
+    printf("\n=== %s ===\n", title);
+    printf("%-46s %12s %12s %12s %10s\n", "case", "min(us)", "median(us)", "p99(us)", "ns/op");
+}
+
+/* 단일 케이스 실행 및 결과 출력 */
+static inline BenchStats bench_run(const BenchCase* bc) {
+    BenchStats stats = { 0, 0, 0 };
+    int runs = bc->measured_runs > 0 ? bc->measured_runs : BENCH_DEFAULT_RUNS;
+    uint64_t* samples = (uint64_t*)malloc((size_t)runs * sizeof(uint64_t));
+    if (!samples) {
+        fprintf(stderr, "%s: 메모리 할당 실패\n", bc->name);
+        return stats;
+    }
+
+    for (int i = 0; i < bc->warmup_runs; i++) {
+        if (bc->setup) bc->setup(bc->context);
+        bc->run(bc->context);
+        if (bc->teardown) bc->teardown(bc->context);
+    }
+
+    for (int i = 0; i < runs; i++) {
+        if (bc->setup) bc->setup(bc->context);
+        uint64_t start = bench_now_ns();
+        bc->run(bc->context);
+        samples[i] = bench_now_ns() - start;
+        if (bc->teardown) bc->teardown(bc->context);
+    }
+
+    qsort(samples, (size_t)runs, sizeof(uint64_t), bench_compare_u64);
+    stats.min_ns = samples[0];
+    stats.median_ns = samples[runs / 2];
+    stats.p99_ns = samples[(size_t)((runs - 1) * 99 / 100)];
+    free(samples);
+
+    printf("%-46s %12.1f %12.1f %12.1f", bc->name,
+        stats.min_ns / 1e3, stats.median_ns / 1e3, stats.p99_ns / 1e3);
+    if (bc->ops_per_run > 0) {
+        printf(" %10.2f", (double)stats.median_ns / (double)bc->ops_per_run);
+    }
+    printf("\n");
+
+    return stats;
+}
+
+/* 명령행에서 측정 횟수를 덮어쓸 수 있도록 지원 (예: bench_sort 50) */
+static inline int bench_runs_from_args(int argc, char** argv) {
+    if (argc > 1) {
+        int runs = atoi(argv[1]);
+        if (runs > 0) return runs;
+    }
+    return BENCH_DEFAULT_RUNS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_HARNESS_H
@@ -0,0 +1,103 @@
+#include "bench_harness.h"
+#include "adjacency_list.h"
+
+/*
+인접 리스트 그래프(28) 벤치마크:
+- 그래프 생성 (V개의 빈 리스트)
+- 무작위 간선 E개 추가
+- 간선 존재 여부 조회 E회
+- 모든 정점의 차수 계산
+- 간선 E개 제거
+*/
+
+#define V 100
+#define E 2000
+
+typedef struct {
+    ListGraph* graph;
+    int src[E];
+    int dest[E];
+    int weight[E];
+} Context;
+
+static void add_edges(Context* ctx) {
+    for (int i = 0; i < E; i++) {
+        lgraph_add_edge(ctx->graph, ctx->src[i], ctx->dest[i], ctx->weight[i], false);
+    }
+}
+
+static void setup_empty(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->graph = lgraph_create(V);
+}
+
+static void setup_filled(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->graph = lgraph_create(V);
+    add_edges(ctx);
+}
+
+static void teardown(void* p) {
+    Context* ctx = (Context*)p;
+    lgraph_destroy(ctx->graph);
+    ctx->graph = NULL;
+}
+
+static void run_create(void* p) {
+    ListGraph* graph = lgraph_create(V);
+    bench_consume((uint64_t)graph->num_vertices);
+    lgraph_destroy(graph);
+    (void)p;
+}
+
+static void run_add_edges(void* p) {
+    add_edges((Context*)p);
+}
+
+static void run_has_edge(void* p) {
+    Context* ctx = (Context*)p;
+    for (int i = 0; i < E; i++) {
+        bench_consume(lgraph_has_edge(ctx->graph, ctx->dest[i], ctx->src[i]));
+    }
+}
+
+static void run_degree(void* p) {
+    Context* ctx = (Context*)p;
+    for (int v = 0; v < V; v++) {
+        bench_consume((uint64_t)lgraph_degree(ctx->graph, v));
+    }
+}
+
+static void run_remove_edges(void* p) {
+    Context* ctx = (Context*)p;
+    for (int i = 0; i < E; i++) {
+        bench_consume(lgraph_remove_edge(ctx->graph, ctx->src[i], ctx->dest[i], false));
+    }
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_rng_init(&rng, BENCH_SEED);
+    for (int i = 0; i < E; i++) {
+        ctx.src[i] = (int)bench_rng_range(&rng, V);
+        ctx.dest[i] = (int)bench_rng_range(&rng, V);
+        ctx.weight[i] = 1 + (int)bench_rng_range(&rng, 100);
+    }
+
+    BenchCase cases[] = {
+        { "adjacency_list/create",      BENCH_DEFAULT_WARMUP, runs, 1, &ctx, NULL,         run_create,       NULL },
+        { "adjacency_list/add_edge",    BENCH_DEFAULT_WARMUP, runs, E, &ctx, setup_empty,  run_add_edges,    teardown },
+        { "adjacency_list/has_edge",    BENCH_DEFAULT_WARMUP, runs, E, &ctx, setup_filled, run_has_edge,     teardown },
+        { "adjacency_list/degree",      BENCH_DEFAULT_WARMUP, runs, V, &ctx, setup_filled, run_degree,       teardown },
+        { "adjacency_list/remove_edge", BENCH_DEFAULT_WARMUP, runs, E, &ctx, setup_filled, run_remove_edges, teardown },
+    };
+
+    bench_print_header("Adjacency List ListGraph (V = 100, E = 2000)");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include "bench_harness.h"
+#include "array_stack.h"
+
+/*
+배열 기반 스택(04) 벤치마크:
+- push N회 (재할당 포함)
+- push/pop 교대 (용량 경계 부근의 축소/확장 반복)
+- push N회 후 pop N회
+- 축소 경계 부근 진동 (크기 255 ~ 513 반복): 축소 정책별 재할당 비용 비교
+*/
+
+#define N 100000
+#define OSC_FILL 1024   // 진동 전 채우는 요소 수 (용량 1024)
+#define OSC_LOW 255     // 25% 미만 → 기본 정책에서는 512로 축소
+#define OSC_HIGH 513    // 512 초과 → 다시 1024로 확장
+#define OSC_CYCLES 200
+#define OSC_OPS (OSC_FILL + OSC_CYCLES * 2 * (OSC_HIGH - OSC_LOW))
+
+typedef struct {
+    ArrayStack* stack;
+    ArrayStackElement values[N];
+} Context;
+
+static void setup(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->stack = astack_create();
+}
+
+static void setup_with_policy(Context* ctx, ArrayStackGrowthPolicy growth, ArrayStackShrinkPolicy shrink) {
+    ArrayStackPolicy policy = { growth, shrink, 0 };
+    ctx->stack = astack_create_with_policy(&policy);
+}
+
+static void setup_never_shrink(void* p) {
+    setup_with_policy((Context*)p, ASTACK_GROWTH_GEOMETRIC, ASTACK_SHRINK_NEVER);
+}
+
+static void setup_hysteresis(void* p) {
+    setup_with_policy((Context*)p, ASTACK_GROWTH_GEOMETRIC, ASTACK_SHRINK_HYSTERESIS);
+}
+
+static void setup_half_growth(void* p) {
+    setup_with_policy((Context*)p, ASTACK_GROWTH_HALF, ASTACK_SHRINK_QUARTER);
+}
+
+static void teardown(void* p) {
+    Context* ctx = (Context*)p;
+    astack_destroy(ctx->stack);
+    ctx->stack = NULL;
+}
+
+static void run_push(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        astack_push(ctx->stack, ctx->values[i]);
+    }
+    bench_consume(astack_size(ctx->stack));
+}
+
+static void run_push_pop_interleaved(void* p) {
+    Context* ctx = (Context*)p;
+    ArrayStackElement value;
+    for (size_t i = 0; i < N; i++) {
+        astack_push(ctx->stack, ctx->values[i]);
+        astack_pop(ctx->stack, &value);
+        bench_consume((uint64_t)value);
+    }
+}
+
+static void run_push_then_pop(void* p) {
+    Context* ctx = (Context*)p;
+    ArrayStackElement value;
+    for (size_t i = 0; i < N; i++) {
+        astack_push(ctx->stack, ctx->values[i]);
+    }
+    while (astack_pop(ctx->stack, &value) == ASTACK_OK) {
+        bench_consume((uint64_t)value);
+    }
+}
+
+static void run_oscillate(void* p) {
+    Context* ctx = (Context*)p;
+    ArrayStackElement value;
+    for (size_t i = 0; i < OSC_FILL; i++) {
+        astack_push(ctx->stack, ctx->values[i]);
+    }
+    for (size_t cycle = 0; cycle < OSC_CYCLES; cycle++) {
+        while (astack_size(ctx->stack) > OSC_LOW) {
+            astack_pop(ctx->stack, &value);
+        }
+        while (astack_size(ctx->stack) < OSC_HIGH) {
+            astack_push(ctx->stack, ctx->values[astack_size(ctx->stack)]);
+        }
+    }
+    bench_consume(astack_size(ctx->stack));
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < N; i++) {
+        ctx.values[i] = (ArrayStackElement)bench_rng_range(&rng, 1000000);
+    }
+
+    BenchCase cases[] = {
+        { "array_stack/push",                   BENCH_DEFAULT_WARMUP, runs, N,       &ctx, setup,              run_push,                 teardown },
+        { "array_stack/push_pop_interleaved",   BENCH_DEFAULT_WARMUP, runs, 2 * N,   &ctx, setup,              run_push_pop_interleaved, teardown },
+        { "array_stack/push_then_pop",          BENCH_DEFAULT_WARMUP, runs, 2 * N,   &ctx, setup,              run_push_then_pop,        teardown },
+        { "array_stack/half_growth/push",       BENCH_DEFAULT_WARMUP, runs, N,       &ctx, setup_half_growth,  run_push,                 teardown },
+        { "array_stack/oscillate",              BENCH_DEFAULT_WARMUP, runs, OSC_OPS, &ctx, setup,              run_oscillate,            teardown },
+        { "array_stack/never_shrink/oscillate", BENCH_DEFAULT_WARMUP, runs, OSC_OPS, &ctx, setup_never_shrink, run_oscillate,            teardown },
+        { "array_stack/hysteresis/oscillate",   BENCH_DEFAULT_WARMUP, runs, OSC_OPS, &ctx, setup_hysteresis,   run_oscillate,            teardown },
+    };
+
+    bench_print_header("Array ArrayStack (N = 100000)");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
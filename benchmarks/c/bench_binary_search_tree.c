@@ -0,0 +1,154 @@
+#include "bench_harness.h"
+#include "binary_search_tree.h"
+
+/*
+이진 탐색 트리(09) 벤치마크:
+- 무작위 값 N개 삽입 (노드 할당 포함)
+- 정렬된 값 SORTED_N개 삽입 (편향 트리, 높이 = SORTED_N, 재귀 구현이면 스택이 넘치는 입력)
+- 무작위 트리에서 검색 / rank / select / lower_bound / count_range 각 N회
+- 삽입을 노드 풀 모드와 malloc 모드로 반복하여 할당 비용 비교
+*/
+
+#define N 100000
+#define SORTED_N 20000      // 편향 트리 삽입은 O(n^2)이므로 작은 크기 사용
+#define KEY_RANGE 1000000
+
+typedef struct {
+    BSTree* tree;
+    NodeAllocMode mode;
+    BstKey values[N];
+    BstKey queries[N];
+} Context;
+
+static void setup(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->tree = bst_create_ex(ctx->mode, 0);
+}
+
+static void setup_pooled(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->mode = NODE_ALLOC_POOL;
+    setup(p);
+}
+
+static void setup_malloc(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->mode = NODE_ALLOC_MALLOC;
+    setup(p);
+}
+
+// 조회 벤치마크용: 무작위 값으로 채운 트리
+static void setup_filled(void* p) {
+    Context* ctx = (Context*)p;
+    setup_pooled(p);
+    for (size_t i = 0; i < N; i++) {
+        bst_insert(ctx->tree, ctx->values[i]);
+    }
+}
+
+static void teardown(void* p) {
+    Context* ctx = (Context*)p;
+    bst_destroy(ctx->tree);
+    ctx->tree = NULL;
+}
+
+static void run_insert_random(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        bst_insert(ctx->tree, ctx->values[i]);
+    }
+    bench_consume(bst_size(ctx->tree));
+}
+
+static void run_insert_delete(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        bst_insert(ctx->tree, ctx->values[i]);
+    }
+    for (size_t i = 0; i < N; i++) {
+        bst_delete(ctx->tree, ctx->values[i]);
+    }
+    bench_consume(bst_size(ctx->tree));
+}
+
+static void run_insert_sorted(void* p) {
+    Context* ctx = (Context*)p;
+    for (BstKey i = 0; i < SORTED_N; i++) {
+        bst_insert(ctx->tree, i);
+    }
+    bench_consume(bst_height(ctx->tree));
+}
+
+static void run_search(void* p) {
+    Context* ctx = (Context*)p;
+    uint64_t found = 0;
+    for (size_t i = 0; i < N; i++) {
+        found += bst_search(ctx->tree, ctx->queries[i]);
+    }
+    bench_consume(found);
+}
+
+static void run_rank(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        bench_consume(bst_rank(ctx->tree, ctx->queries[i]));
+    }
+}
+
+static void run_select(void* p) {
+    Context* ctx = (Context*)p;
+    size_t size = bst_size(ctx->tree);
+    BstKey value;
+    for (size_t i = 0; i < N; i++) {
+        bst_select(ctx->tree, (size_t)ctx->queries[i] % size, &value);
+        bench_consume((uint64_t)value);
+    }
+}
+
+static void run_lower_bound(void* p) {
+    Context* ctx = (Context*)p;
+    BstKey value = 0;
+    for (size_t i = 0; i < N; i++) {
+        bst_lower_bound(ctx->tree, ctx->queries[i], &value);
+        bench_consume((uint64_t)value);
+    }
+}
+
+static void run_count_range(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        BstKey low = ctx->queries[i];
+        bench_consume(bst_count_range(ctx->tree, low, low + KEY_RANGE / 100));
+    }
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < N; i++) {
+        ctx.values[i] = (BstKey)bench_rng_range(&rng, KEY_RANGE);
+        ctx.queries[i] = (BstKey)bench_rng_range(&rng, KEY_RANGE);
+    }
+
+    BenchCase cases[] = {
+        { "bst/malloc_insert_random",  BENCH_DEFAULT_WARMUP, runs, N,        &ctx, setup_malloc, run_insert_random, teardown },
+        { "bst/pooled_insert_random",  BENCH_DEFAULT_WARMUP, runs, N,        &ctx, setup_pooled, run_insert_random, teardown },
+        { "bst/malloc_insert_delete",  BENCH_DEFAULT_WARMUP, runs, 2 * N,    &ctx, setup_malloc, run_insert_delete, teardown },
+        { "bst/pooled_insert_delete",  BENCH_DEFAULT_WARMUP, runs, 2 * N,    &ctx, setup_pooled, run_insert_delete, teardown },
+        { "bst/pooled_insert_sorted",  BENCH_DEFAULT_WARMUP, runs, SORTED_N, &ctx, setup_pooled, run_insert_sorted, teardown },
+        { "bst/search",                BENCH_DEFAULT_WARMUP, runs, N,        &ctx, setup_filled, run_search,        teardown },
+        { "bst/rank",                  BENCH_DEFAULT_WARMUP, runs, N,        &ctx, setup_filled, run_rank,          teardown },
+        { "bst/select",                BENCH_DEFAULT_WARMUP, runs, N,        &ctx, setup_filled, run_select,        teardown },
+        { "bst/lower_bound",           BENCH_DEFAULT_WARMUP, runs, N,        &ctx, setup_filled, run_lower_bound,   teardown },
+        { "bst/count_range",           BENCH_DEFAULT_WARMUP, runs, N,        &ctx, setup_filled, run_count_range,   teardown },
+    };
+
+    bench_print_header("Binary Search Tree (N = 100000)");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
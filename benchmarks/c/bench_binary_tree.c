@@ -0,0 +1,159 @@
+#include <stdlib.h>
+#include "bench_harness.h"
+#include "binary_tree.h"
+
+/*
+이진 트리(08) 동결 배치 벤치마크: 검색
+- 정렬된 키 n개로 균형 잡힌 포인터 트리를 btree_insert_left/right로 만들고 (BFS 순서로 할당)
+  같은 트리를 Eytzinger / vEB 배열로 동결
+- 크기: L2 안 (2^15 - 1), L2 초과 (2^20 - 1), L3 초과 (2^22 - 1, 포인터 노드 약 128MB)
+- 검색 키는 [0, 2n) 균등 분포 (키는 홀수만 있으므로 절반은 실패)
+- throughput: 서로 독립인 검색 Q회 (여러 검색의 캐시 미스가 겹칠 수 있음)
+- latency: 이전 검색 결과에 따라 다음 검색 키가 정해짐 (검색 한 번의 지연)
+- 포인터 트리는 BFS 순서로 연속 할당되므로 포인터 쪽에 유리한 조건
+  (삽입/삭제가 반복된 실제 트리는 노드가 더 흩어짐)
+*/
+
+#define Q 200000
+#define DEFAULT_RUNS 5
+
+typedef struct {
+    const BinaryTree* tree;
+    const FrozenTree* frozen;
+    const BTreeData* queries;
+} Context;
+
+/* 정렬된 키로 균형 잡힌 포인터 트리 생성 (BFS 순서로 삽입) */
+typedef struct {
+    BTreeNode* node;
+    size_t low;     // node 의 서브트리가 차지하는 키 구간 [low, high)
+    size_t high;
+} BuildItem;
+
+static BinaryTree* build_pointer_tree(const BTreeData* keys, size_t n) {
+    BinaryTree* tree = btree_create();
+    BuildItem* queue = (BuildItem*)malloc(n * sizeof(BuildItem));
+    size_t head = 0;
+    size_t tail = 0;
+
+    btree_insert_left(tree, NULL, keys[n / 2]);
+    queue[tail++] = (BuildItem){ tree->root, 0, n };
+    while (head < tail) {
+        BuildItem item = queue[head++];
+        size_t mid = item.low + (item.high - item.low) / 2;
+        if (item.low < mid) {
+            size_t left_mid = item.low + (mid - item.low) / 2;
+            btree_insert_left(tree, item.node, keys[left_mid]);
+            queue[tail++] = (BuildItem){ item.node->left, item.low, mid };
+        }
+        if (mid + 1 < item.high) {
+            size_t right_mid = mid + 1 + (item.high - mid - 1) / 2;
+            btree_insert_right(tree, item.node, keys[right_mid]);
+            queue[tail++] = (BuildItem){ item.node->right, mid + 1, item.high };
+        }
+    }
+    free(queue);
+    return tree;
+}
+
+/* 포인터 트리 하강 (동결 전 방식) */
+static bool pointer_search(const BinaryTree* tree, BTreeData data) {
+    const BTreeNode* node = tree->root;
+    while (node != NULL) {
+        if (data < node->data) {
+            node = node->left;
+        }
+        else if (data > node->data) {
+            node = node->right;
+        }
+        else {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void run_pointer(void* p) {
+    Context* ctx = (Context*)p;
+    uint64_t found = 0;
+    for (size_t i = 0; i < Q; i++) {
+        found += pointer_search(ctx->tree, ctx->queries[i]);
+    }
+    bench_consume(found);
+}
+
+static void run_frozen(void* p) {
+    Context* ctx = (Context*)p;
+    uint64_t found = 0;
+    for (size_t i = 0; i < Q; i++) {
+        found += frozen_search(ctx->frozen, ctx->queries[i]);
+    }
+    bench_consume(found);
+}
+
+static void run_pointer_latency(void* p) {
+    Context* ctx = (Context*)p;
+    size_t found = 0;
+    for (size_t i = 0; i < Q; i++) {
+        found += pointer_search(ctx->tree, ctx->queries[(i + found) % Q]);
+    }
+    bench_consume(found);
+}
+
+static void run_frozen_latency(void* p) {
+    Context* ctx = (Context*)p;
+    size_t found = 0;
+    for (size_t i = 0; i < Q; i++) {
+        found += frozen_search(ctx->frozen, ctx->queries[(i + found) % Q]);
+    }
+    bench_consume(found);
+}
+
+int main(int argc, char** argv) {
+    static const size_t sizes[] = { ((size_t)1 << 15) - 1, ((size_t)1 << 20) - 1, ((size_t)1 << 22) - 1 };
+    static BTreeData queries[Q];
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+    char title[96];
+    BenchRng rng;
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t n = sizes[s];
+        BTreeData* keys = (BTreeData*)malloc(n * sizeof(BTreeData));
+        for (size_t i = 0; i < n; i++) {
+            keys[i] = (BTreeData)(2 * i + 1);
+        }
+        bench_rng_init(&rng, BENCH_SEED);
+        for (size_t i = 0; i < Q; i++) {
+            queries[i] = (BTreeData)bench_rng_range(&rng, (uint32_t)(2 * n));
+        }
+
+        BinaryTree* tree = build_pointer_tree(keys, n);
+        FrozenTree* eytzinger = btree_freeze(tree, FROZEN_LAYOUT_EYTZINGER);
+        FrozenTree* veb = btree_freeze(tree, FROZEN_LAYOUT_VEB);
+        Context pointer_ctx = { tree, NULL, queries };
+        Context eytzinger_ctx = { tree, eytzinger, queries };
+        Context veb_ctx = { tree, veb, queries };
+
+        BenchCase cases[] = {
+            { "pointer/throughput",   1, runs, Q, &pointer_ctx,   NULL, run_pointer,         NULL },
+            { "eytzinger/throughput", 1, runs, Q, &eytzinger_ctx, NULL, run_frozen,          NULL },
+            { "veb/throughput",       1, runs, Q, &veb_ctx,       NULL, run_frozen,          NULL },
+            { "pointer/latency",      1, runs, Q, &pointer_ctx,   NULL, run_pointer_latency, NULL },
+            { "eytzinger/latency",    1, runs, Q, &eytzinger_ctx, NULL, run_frozen_latency,  NULL },
+            { "veb/latency",          1, runs, Q, &veb_ctx,       NULL, run_frozen_latency,  NULL },
+        };
+
+        snprintf(title, sizeof(title), "Binary tree search (n = %zu, pointer nodes ~%zu MB)",
+                 n, n * sizeof(BTreeNode) / (1024 * 1024));
+        bench_print_header(title);
+        for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+            bench_run(&cases[i]);
+        }
+
+        frozen_destroy(veb);
+        frozen_destroy(eytzinger);
+        btree_destroy(tree);
+        free(keys);
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "bench_harness.h"
+#include "chaining_hash_table.h"
+
+/*
+체이닝 해시 테이블(25) 벤치마크:
+- 빈 테이블에 N개 삽입 (재해싱 포함)
+- 존재하는 키 조회 / 존재하지 않는 키 조회
+- 전체 키 삭제
+*/
+
+#define N 50000
+#define KEY_LEN 16
+
+typedef struct {
+    ChainedHashTable* table;
+    char keys[N][KEY_LEN];
+    char missing[N][KEY_LEN];
+} Context;
+
+static void fill(Context* ctx) {
+    for (size_t i = 0; i < N; i++) {
+        chash_insert(ctx->table, ctx->keys[i], (int)i);
+    }
+}
+
+static void setup_empty(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->table = chash_create(7);
+}
+
+static void setup_filled(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->table = chash_create(7);
+    fill(ctx);
+}
+
+static void teardown(void* p) {
+    Context* ctx = (Context*)p;
+    chash_destroy(ctx->table);
+    ctx->table = NULL;
+}
+
+static void run_insert(void* p) {
+    fill((Context*)p);
+}
+
+static void run_get_hit(void* p) {
+    Context* ctx = (Context*)p;
+    int value;
+    for (size_t i = 0; i < N; i++) {
+        if (chash_get(ctx->table, ctx->keys[i], &value)) {
+            bench_consume((uint64_t)value);
+        }
+    }
+}
+
+static void run_get_miss(void* p) {
+    Context* ctx = (Context*)p;
+    int value;
+    for (size_t i = 0; i < N; i++) {
+        bench_consume(chash_get(ctx->table, ctx->missing[i], &value));
+    }
+}
+
+static void run_remove(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        bench_consume(chash_remove(ctx->table, ctx->keys[i]));
+    }
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    // 키는 고정 시드로 생성하며 hit/miss 집합이 겹치지 않도록 접두어를 구분
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < N; i++) {
+        snprintf(ctx.keys[i], KEY_LEN, "k%08x%zu", bench_rng_range(&rng, 0xFFFFFFFFu), i);
+        snprintf(ctx.missing[i], KEY_LEN, "m%08x%zu", bench_rng_range(&rng, 0xFFFFFFFFu), i);
+    }
+
+    BenchCase cases[] = {
+        { "chaining_hash_table/insert",   BENCH_DEFAULT_WARMUP, runs, N, &ctx, setup_empty,  run_insert,   teardown },
+        { "chaining_hash_table/get_hit",  BENCH_DEFAULT_WARMUP, runs, N, &ctx, setup_filled, run_get_hit,  teardown },
+        { "chaining_hash_table/get_miss", BENCH_DEFAULT_WARMUP, runs, N, &ctx, setup_filled, run_get_miss, teardown },
+        { "chaining_hash_table/remove",   BENCH_DEFAULT_WARMUP, runs, N, &ctx, setup_filled, run_remove,   teardown },
+    };
+
+    bench_print_header("Chaining Hash Table (N = 50000)");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,144 @@
+#include "bench_harness.h"
+#include "circular_queue.h"
+
+/*
+원형 큐(06) 벤치마크:
+- enqueue N회 (재할당 포함)
+- enqueue/dequeue 교대 (front/rear 순환)
+- enqueue N회 후 dequeue N회
+- enqueue_n / dequeue_n: BATCH개씩 묶어서 삽입/삭제 (memcpy 최대 2회)
+- 감긴(wrap) 큐 전체 합산: dequeue로 하나씩 꺼내기 vs peek_regions로 제자리 읽기 후 discard
+*/
+
+#define N 100000
+#define BATCH 64
+
+typedef struct {
+    CircularQueue* queue;
+    CircularQueueElement values[N];
+} Context;
+
+static void setup(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->queue = cqueue_create();
+}
+
+/* front가 배열 중간에 오도록 채워 두 구간으로 나뉜 큐 */
+static void setup_wrapped(void* p) {
+    Context* ctx = (Context*)p;
+    CircularQueueElement value;
+    ctx->queue = cqueue_create();
+    cqueue_enqueue_n(ctx->queue, ctx->values, N);
+    for (size_t i = 0; i < N / 2; i++) {
+        cqueue_dequeue(ctx->queue, &value);
+    }
+    cqueue_enqueue_n(ctx->queue, ctx->values, N / 2);
+}
+
+static void teardown(void* p) {
+    Context* ctx = (Context*)p;
+    cqueue_destroy(ctx->queue);
+    ctx->queue = NULL;
+}
+
+static void run_enqueue(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        cqueue_enqueue(ctx->queue, ctx->values[i]);
+    }
+    bench_consume(cqueue_size(ctx->queue));
+}
+
+static void run_enqueue_dequeue_interleaved(void* p) {
+    Context* ctx = (Context*)p;
+    CircularQueueElement value;
+    for (size_t i = 0; i < N; i++) {
+        cqueue_enqueue(ctx->queue, ctx->values[i]);
+        cqueue_dequeue(ctx->queue, &value);
+        bench_consume((uint64_t)value);
+    }
+}
+
+static void run_enqueue_then_dequeue(void* p) {
+    Context* ctx = (Context*)p;
+    CircularQueueElement value;
+    for (size_t i = 0; i < N; i++) {
+        cqueue_enqueue(ctx->queue, ctx->values[i]);
+    }
+    while (cqueue_dequeue(ctx->queue, &value) == CQUEUE_OK) {
+        bench_consume((uint64_t)value);
+    }
+}
+
+static void run_enqueue_n(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i += BATCH) {
+        size_t count = N - i < BATCH ? N - i : BATCH;
+        cqueue_enqueue_n(ctx->queue, ctx->values + i, count);
+    }
+    bench_consume(cqueue_size(ctx->queue));
+}
+
+static void run_enqueue_n_then_dequeue_n(void* p) {
+    Context* ctx = (Context*)p;
+    CircularQueueElement out[BATCH];
+    size_t count;
+    for (size_t i = 0; i < N; i += BATCH) {
+        count = N - i < BATCH ? N - i : BATCH;
+        cqueue_enqueue_n(ctx->queue, ctx->values + i, count);
+    }
+    while ((count = cqueue_dequeue_n(ctx->queue, out, BATCH)) > 0) {
+        bench_consume((uint64_t)out[count - 1]);
+    }
+}
+
+static void run_sum_dequeue(void* p) {
+    Context* ctx = (Context*)p;
+    CircularQueueElement value;
+    uint64_t sum = 0;
+    while (cqueue_dequeue(ctx->queue, &value) == CQUEUE_OK) {
+        sum += (uint64_t)value;
+    }
+    bench_consume(sum);
+}
+
+static void run_sum_peek_regions(void* p) {
+    Context* ctx = (Context*)p;
+    CircularQueueRegion regions[2];
+    uint64_t sum = 0;
+    size_t region_count = cqueue_peek_regions(ctx->queue, regions);
+    for (size_t r = 0; r < region_count; r++) {
+        for (size_t i = 0; i < regions[r].count; i++) {
+            sum += (uint64_t)regions[r].data[i];
+        }
+    }
+    cqueue_discard(ctx->queue, cqueue_size(ctx->queue));
+    bench_consume(sum);
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < N; i++) {
+        ctx.values[i] = (CircularQueueElement)bench_rng_range(&rng, 1000000);
+    }
+
+    BenchCase cases[] = {
+        { "circular_queue/enqueue",                     BENCH_DEFAULT_WARMUP, runs, N,     &ctx, setup,         run_enqueue,                     teardown },
+        { "circular_queue/enqueue_dequeue_interleaved", BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup,         run_enqueue_dequeue_interleaved, teardown },
+        { "circular_queue/enqueue_then_dequeue",        BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup,         run_enqueue_then_dequeue,        teardown },
+        { "circular_queue/enqueue_n_batch_64",          BENCH_DEFAULT_WARMUP, runs, N,     &ctx, setup,         run_enqueue_n,                   teardown },
+        { "circular_queue/enqueue_n_then_dequeue_n_64", BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup,         run_enqueue_n_then_dequeue_n,    teardown },
+        { "circular_queue/wrapped_sum_dequeue",         BENCH_DEFAULT_WARMUP, runs, N,     &ctx, setup_wrapped, run_sum_dequeue,                 teardown },
+        { "circular_queue/wrapped_sum_peek_regions",    BENCH_DEFAULT_WARMUP, runs, N,     &ctx, setup_wrapped, run_sum_peek_regions,            teardown },
+    };
+
+    bench_print_header("Circular Queue (N = 100000)");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include "bench_harness.h"
+#include "dynamic_programming.h"
+
+/*
+동적 계획법(43~45) 벤치마크:
+- 피보나치: 재귀 / 메모이제이션 / 타뷸레이션 / 공간 최적화
+- LCS: 무작위 문자열 두 개에 대한 테이블 계산 및 역추적
+- 배낭 문제: 무작위 물건 집합에 대한 테이블 계산 및 역추적
+*/
+
+#define FIB_RECURSIVE_N 27
+#define FIB_N 90
+#define FIB_REPEAT 1000
+#define LCS_LEN 1000
+#define KNAPSACK_ITEMS 200
+#define KNAPSACK_CAPACITY 2000
+
+typedef struct {
+    char str1[LCS_LEN + 1];
+    char str2[LCS_LEN + 1];
+    Item items[KNAPSACK_ITEMS];
+    char item_names[KNAPSACK_ITEMS][8];
+} Context;
+
+static void run_fib_recursive(void* p) {
+    bench_consume((uint64_t)fib_recursive(FIB_RECURSIVE_N, false));
+    (void)p;
+}
+
+static void setup_memoization(void* p) {
+    init_memoization(FIB_N + 1);
+    (void)p;
+}
+
+static void teardown_memoization(void* p) {
+    cleanup_memoization();
+    (void)p;
+}
+
+static void run_fib_memoization(void* p) {
+    bench_consume((uint64_t)fib_memoization(FIB_N, false));
+    (void)p;
+}
+
+static void run_fib_tabulation(void* p) {
+    for (int i = 0; i < FIB_REPEAT; i++) {
+        bench_consume((uint64_t)fib_tabulation(FIB_N, false));
+    }
+    (void)p;
+}
+
+static void run_fib_optimized(void* p) {
+    for (int i = 0; i < FIB_REPEAT; i++) {
+        bench_consume((uint64_t)fib_optimized(FIB_N, false));
+    }
+    (void)p;
+}
+
+static void run_lcs(void* p) {
+    Context* ctx = (Context*)p;
+    LCSTable* table = compute_lcs(ctx->str1, ctx->str2, false);
+    LCSResult* result = get_lcs_result(table, ctx->str1, ctx->str2);
+    bench_consume((uint64_t)result->length);
+    destroy_lcs_result(result);
+    destroy_lcs_table(table);
+}
+
+static void run_knapsack(void* p) {
+    Context* ctx = (Context*)p;
+    KnapsackResult* result = solve_knapsack(ctx->items, KNAPSACK_ITEMS, KNAPSACK_CAPACITY, false);
+    bench_consume((uint64_t)result->maxValue);
+    destroy_knapsack_result(result);
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_rng_init(&rng, BENCH_SEED);
+    for (int i = 0; i < LCS_LEN; i++) {
+        ctx.str1[i] = (char)('A' + bench_rng_range(&rng, 4));
+        ctx.str2[i] = (char)('A' + bench_rng_range(&rng, 4));
+    }
+    ctx.str1[LCS_LEN] = '\0';
+    ctx.str2[LCS_LEN] = '\0';
+
+    for (int i = 0; i < KNAPSACK_ITEMS; i++) {
+        snprintf(ctx.item_names[i], sizeof(ctx.item_names[i]), "I%d", i);
+        ctx.items[i].weight = 1 + (int)bench_rng_range(&rng, 100);
+        ctx.items[i].value = 1 + (int)bench_rng_range(&rng, 500);
+        ctx.items[i].name = ctx.item_names[i];
+    }
+
+    BenchCase cases[] = {
+        { "fib/recursive(n=27)",         BENCH_DEFAULT_WARMUP, runs, 1,                                          &ctx, NULL,              run_fib_recursive,   NULL },
+        { "fib/memoization(n=90)",       BENCH_DEFAULT_WARMUP, runs, 1,                                          &ctx, setup_memoization, run_fib_memoization, teardown_memoization },
+        { "fib/tabulation(n=90)",        BENCH_DEFAULT_WARMUP, runs, FIB_REPEAT,                                 &ctx, NULL,              run_fib_tabulation,  NULL },
+        { "fib/optimized(n=90)",         BENCH_DEFAULT_WARMUP, runs, FIB_REPEAT,                                 &ctx, NULL,              run_fib_optimized,   NULL },
+        { "lcs/1000x1000",               BENCH_DEFAULT_WARMUP, runs, (size_t)LCS_LEN * LCS_LEN,                  &ctx, NULL,              run_lcs,             NULL },
+        { "knapsack/200_items_cap_2000", BENCH_DEFAULT_WARMUP, runs, (size_t)KNAPSACK_ITEMS * KNAPSACK_CAPACITY, &ctx, NULL,              run_knapsack,        NULL },
+    };
+
+    bench_print_header("Dynamic Programming");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
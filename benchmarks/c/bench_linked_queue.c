@@ -0,0 +1,88 @@
+#include "bench_harness.h"
+#include "linked_queue.h"
+
+/*
+연결 리스트 기반 큐(07) 벤치마크:
+- enqueue N회 (노드 할당 포함)
+- enqueue/dequeue 교대 (front/rear 순환)
+- enqueue N회 후 dequeue N회
+- 같은 연산을 노드 풀 모드(NODE_ALLOC_POOL)로 반복하여 malloc/free 비용 비교
+*/
+
+#define N 100000
+
+typedef struct {
+    LinkedQueue* queue;
+    LinkedQueueElement values[N];
+} Context;
+
+static void setup(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->queue = lqueue_create();
+}
+
+static void setup_pooled(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->queue = lqueue_create_ex(NODE_ALLOC_POOL, 0);
+}
+
+static void teardown(void* p) {
+    Context* ctx = (Context*)p;
+    lqueue_destroy(ctx->queue);
+    ctx->queue = NULL;
+}
+
+static void run_enqueue(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        lqueue_enqueue(ctx->queue, ctx->values[i]);
+    }
+    bench_consume(lqueue_size(ctx->queue));
+}
+
+static void run_enqueue_dequeue_interleaved(void* p) {
+    Context* ctx = (Context*)p;
+    LinkedQueueElement value;
+    for (size_t i = 0; i < N; i++) {
+        lqueue_enqueue(ctx->queue, ctx->values[i]);
+        lqueue_dequeue(ctx->queue, &value);
+        bench_consume((uint64_t)value);
+    }
+}
+
+static void run_enqueue_then_dequeue(void* p) {
+    Context* ctx = (Context*)p;
+    LinkedQueueElement value;
+    for (size_t i = 0; i < N; i++) {
+        lqueue_enqueue(ctx->queue, ctx->values[i]);
+    }
+    while (lqueue_dequeue(ctx->queue, &value) == LQUEUE_OK) {
+        bench_consume((uint64_t)value);
+    }
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < N; i++) {
+        ctx.values[i] = (LinkedQueueElement)bench_rng_range(&rng, 1000000);
+    }
+
+    BenchCase cases[] = {
+        { "linked_queue/enqueue",                            BENCH_DEFAULT_WARMUP, runs, N,     &ctx, setup,        run_enqueue,                     teardown },
+        { "linked_queue/enqueue_dequeue_interleaved",        BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup,        run_enqueue_dequeue_interleaved, teardown },
+        { "linked_queue/enqueue_then_dequeue",               BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup,        run_enqueue_then_dequeue,        teardown },
+        { "linked_queue/pooled_enqueue",                     BENCH_DEFAULT_WARMUP, runs, N,     &ctx, setup_pooled, run_enqueue,                     teardown },
+        { "linked_queue/pooled_enqueue_dequeue_interleaved", BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup_pooled, run_enqueue_dequeue_interleaved, teardown },
+        { "linked_queue/pooled_enqueue_then_dequeue",        BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup_pooled, run_enqueue_then_dequeue,        teardown },
+    };
+
+    bench_print_header("Linked Queue (N = 100000)");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
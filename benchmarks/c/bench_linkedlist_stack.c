@@ -0,0 +1,88 @@
+#include "bench_harness.h"
+#include "linkedlist_stack.h"
+
+/*
+연결 리스트 기반 스택(05) 벤치마크:
+- push N회 (노드 할당 포함)
+- push/pop 교대 (노드 할당/해제 반복)
+- push N회 후 pop N회
+- 같은 연산을 노드 풀 모드(NODE_ALLOC_POOL)로 반복하여 malloc/free 비용 비교
+*/
+
+#define N 100000
+
+typedef struct {
+    LinkedStack* stack;
+    LinkedStackElement values[N];
+} Context;
+
+static void setup(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->stack = lstack_create();
+}
+
+static void setup_pooled(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->stack = lstack_create_ex(NODE_ALLOC_POOL, 0);
+}
+
+static void teardown(void* p) {
+    Context* ctx = (Context*)p;
+    lstack_destroy(ctx->stack);
+    ctx->stack = NULL;
+}
+
+static void run_push(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        lstack_push(ctx->stack, ctx->values[i]);
+    }
+    bench_consume(lstack_size(ctx->stack));
+}
+
+static void run_push_pop_interleaved(void* p) {
+    Context* ctx = (Context*)p;
+    LinkedStackElement value;
+    for (size_t i = 0; i < N; i++) {
+        lstack_push(ctx->stack, ctx->values[i]);
+        lstack_pop(ctx->stack, &value);
+        bench_consume((uint64_t)value);
+    }
+}
+
+static void run_push_then_pop(void* p) {
+    Context* ctx = (Context*)p;
+    LinkedStackElement value;
+    for (size_t i = 0; i < N; i++) {
+        lstack_push(ctx->stack, ctx->values[i]);
+    }
+    while (lstack_pop(ctx->stack, &value) == LSTACK_OK) {
+        bench_consume((uint64_t)value);
+    }
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < N; i++) {
+        ctx.values[i] = (LinkedStackElement)bench_rng_range(&rng, 1000000);
+    }
+
+    BenchCase cases[] = {
+        { "linkedlist_stack/push",                        BENCH_DEFAULT_WARMUP, runs, N,     &ctx, setup,        run_push,                 teardown },
+        { "linkedlist_stack/push_pop_interleaved",        BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup,        run_push_pop_interleaved, teardown },
+        { "linkedlist_stack/push_then_pop",               BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup,        run_push_then_pop,        teardown },
+        { "linkedlist_stack/pooled_push",                 BENCH_DEFAULT_WARMUP, runs, N,     &ctx, setup_pooled, run_push,                 teardown },
+        { "linkedlist_stack/pooled_push_pop_interleaved", BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup_pooled, run_push_pop_interleaved, teardown },
+        { "linkedlist_stack/pooled_push_then_pop",        BENCH_DEFAULT_WARMUP, runs, 2 * N, &ctx, setup_pooled, run_push_then_pop,        teardown },
+    };
+
+    bench_print_header("Linked List LinkedStack (N = 100000)");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
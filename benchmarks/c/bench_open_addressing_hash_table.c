@@ -0,0 +1,110 @@
+#include "bench_harness.h"
+#include "open_addressing_hash_table.h"
+
+/*
+개방 주소법 해시 테이블(26) 벤치마크:
+- 선형/이차/이중 해싱 세 가지 탐사 방식을 동일한 키 집합으로 비교
+- 빈 테이블에 N개 삽입 (재해싱 포함)
+- 존재하는 키 조회 / 존재하지 않는 키 조회
+- 전체 키 삭제
+*/
+
+#define N 50000
+#define KEY_LEN 16
+
+typedef struct {
+    OpenHashTable* table;
+    ProbeType type;
+    char keys[N][KEY_LEN];
+    char missing[N][KEY_LEN];
+} Context;
+
+static void fill(Context* ctx) {
+    for (size_t i = 0; i < N; i++) {
+        ohash_insert(ctx->table, ctx->keys[i], (int)i);
+    }
+}
+
+static void setup_empty(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->table = ohash_create(7, ctx->type);
+}
+
+static void setup_filled(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->table = ohash_create(7, ctx->type);
+    fill(ctx);
+}
+
+static void teardown(void* p) {
+    Context* ctx = (Context*)p;
+    ohash_destroy(ctx->table);
+    ctx->table = NULL;
+}
+
+static void run_insert(void* p) {
+    fill((Context*)p);
+}
+
+static void run_get_hit(void* p) {
+    Context* ctx = (Context*)p;
+    int value;
+    for (size_t i = 0; i < N; i++) {
+        if (ohash_get(ctx->table, ctx->keys[i], &value)) {
+            bench_consume((uint64_t)value);
+        }
+    }
+}
+
+static void run_get_miss(void* p) {
+    Context* ctx = (Context*)p;
+    int value;
+    for (size_t i = 0; i < N; i++) {
+        bench_consume(ohash_get(ctx->table, ctx->missing[i], &value));
+    }
+}
+
+static void run_remove(void* p) {
+    Context* ctx = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        bench_consume(ohash_remove(ctx->table, ctx->keys[i]));
+    }
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    // 키는 고정 시드로 생성하며 hit/miss 집합이 겹치지 않도록 접두어를 구분
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < N; i++) {
+        snprintf(ctx.keys[i], KEY_LEN, "k%08x%zu", bench_rng_range(&rng, 0xFFFFFFFFu), i);
+        snprintf(ctx.missing[i], KEY_LEN, "m%08x%zu", bench_rng_range(&rng, 0xFFFFFFFFu), i);
+    }
+
+    const ProbeType types[] = { PROBE_LINEAR, PROBE_QUADRATIC, PROBE_DOUBLE_HASH };
+    const char* probe_names[] = { "linear", "quadratic", "double_hash" };
+    char names[4][64];
+
+    bench_print_header("Open Addressing Hash Table (N = 50000)");
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+        const char* probe = probe_names[t];
+        ctx.type = types[t];
+        snprintf(names[0], sizeof(names[0]), "open_addressing/%s/insert", probe);
+        snprintf(names[1], sizeof(names[1]), "open_addressing/%s/get_hit", probe);
+        snprintf(names[2], sizeof(names[2]), "open_addressing/%s/get_miss", probe);
+        snprintf(names[3], sizeof(names[3]), "open_addressing/%s/remove", probe);
+
+        BenchCase cases[] = {
+            { names[0], BENCH_DEFAULT_WARMUP, runs, N, &ctx, setup_empty,  run_insert,   teardown },
+            { names[1], BENCH_DEFAULT_WARMUP, runs, N, &ctx, setup_filled, run_get_hit,  teardown },
+            { names[2], BENCH_DEFAULT_WARMUP, runs, N, &ctx, setup_filled, run_get_miss, teardown },
+            { names[3], BENCH_DEFAULT_WARMUP, runs, N, &ctx, setup_filled, run_remove,   teardown },
+        };
+        for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+            bench_run(&cases[i]);
+        }
+    }
+    return 0;
+}
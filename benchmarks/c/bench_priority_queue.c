@@ -0,0 +1,86 @@
+#include "bench_harness.h"
+#include "priority_queue.h"
+
+/*
+우선순위 큐(22)와 최대 힙(23) 벤치마크:
+- 두 구현 모두 고정 크기 배열(100)을 사용하므로
+  "가득 채운 뒤 모두 꺼내기"를 ROUNDS회 반복하여 측정
+- 22: 비정렬 배열 기반 (삽입 O(1), 삭제 O(n))
+- 23: 이진 힙 기반 (삽입/삭제 O(log n))
+*/
+
+#define ROUNDS 1000
+#define FILL MAX_QUEUE_SIZE
+
+typedef struct {
+    PriorityQueue queue;
+    MaxHeap heap;
+    PriorityQueueElement values[ROUNDS][FILL];
+} Context;
+
+static void run_queue_max(void* p) {
+    Context* ctx = (Context*)p;
+    PriorityQueueElement value;
+    for (int r = 0; r < ROUNDS; r++) {
+        pqueue_init(&ctx->queue);
+        for (int i = 0; i < FILL; i++) {
+            pqueue_insert_max(&ctx->queue, ctx->values[r][i]);
+        }
+        while (pqueue_remove_max(&ctx->queue, &value)) {
+            bench_consume((uint64_t)value);
+        }
+    }
+}
+
+static void run_queue_min(void* p) {
+    Context* ctx = (Context*)p;
+    PriorityQueueElement value;
+    for (int r = 0; r < ROUNDS; r++) {
+        pqueue_init(&ctx->queue);
+        for (int i = 0; i < FILL; i++) {
+            pqueue_insert_min(&ctx->queue, ctx->values[r][i]);
+        }
+        while (pqueue_remove_min(&ctx->queue, &value)) {
+            bench_consume((uint64_t)value);
+        }
+    }
+}
+
+static void run_heap(void* p) {
+    Context* ctx = (Context*)p;
+    PriorityQueueElement value;
+    for (int r = 0; r < ROUNDS; r++) {
+        maxheap_init(&ctx->heap);
+        for (int i = 0; i < FILL; i++) {
+            maxheap_insert(&ctx->heap, ctx->values[r][i]);
+        }
+        while (maxheap_delete_max(&ctx->heap, &value)) {
+            bench_consume((uint64_t)value);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    static Context ctx;
+    BenchRng rng;
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_rng_init(&rng, BENCH_SEED);
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < FILL; i++) {
+            ctx.values[r][i] = (PriorityQueueElement)bench_rng_range(&rng, 1000000);
+        }
+    }
+
+    BenchCase cases[] = {
+        { "priority_queue/insert_remove_max", BENCH_DEFAULT_WARMUP, runs, 2 * ROUNDS * FILL, &ctx, NULL, run_queue_max, NULL },
+        { "priority_queue/insert_remove_min", BENCH_DEFAULT_WARMUP, runs, 2 * ROUNDS * FILL, &ctx, NULL, run_queue_min, NULL },
+        { "max_heap/insert_delete_max",       BENCH_DEFAULT_WARMUP, runs, 2 * ROUNDS * FILL, &ctx, NULL, run_heap,      NULL },
+    };
+
+    bench_print_header("Priority Queue vs Max Heap (100 x 1000 rounds)");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+    return 0;
+}
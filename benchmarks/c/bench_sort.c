@@ -0,0 +1,142 @@
+#include "bench_harness.h"
+#include "sort.h"
+
+/*
+정렬 알고리즘(12~17, 40) 벤치마크:
+- 입력 분포: 무작위 / 정렬됨 / 역순 / 중복 다수
+- O(n^2) 알고리즘은 SMALL_N, O(n log n) 알고리즘은 LARGE_N으로 측정
+- 매 실행마다 원본 입력을 작업 버퍼로 복사 (복사 시간은 측정 제외)
+*/
+
+#define SMALL_N 2000
+#define LARGE_N 100000
+
+typedef enum {
+    INPUT_RANDOM,
+    INPUT_SORTED,
+    INPUT_REVERSED,
+    INPUT_FEW_UNIQUE,
+    INPUT_KIND_COUNT
+} InputKind;
+
+static const char* input_names[INPUT_KIND_COUNT] = { "random", "sorted", "reversed", "few_unique" };
+
+typedef void (*SortFunction)(SortElement arr[], size_t size);
+
+typedef struct {
+    const char* name;
+    SortFunction sort;
+    bool quadratic;
+} SortEntry;
+
+/* 분할 정복 병합 정렬(40)은 (배열, left, right, 출력 여부) 형태이므로 어댑터 사용 */
+static void merge_sort_divide_conquer(SortElement arr[], size_t size) {
+    if (size > 1) {
+        merge_sort(arr, 0, (int)size - 1, false);
+    }
+}
+
+static const SortEntry sorts[] = {
+    { "bubble_sort_basic",          bubble_sort_basic,            true },
+    { "bubble_sort_optimized",      bubble_sort_optimized,        true },
+    { "insertion_sort",             insertion_sort,               true },
+    { "binary_insertion_sort",      binary_insertion_sort,        true },
+    { "selection_sort",             selection_sort,               true },
+    { "selection_sort_optimized",   selection_sort_optimized,     true },
+    { "quick_sort_lomuto",          quick_sort_lomuto_wrapper,    false },
+    { "quick_sort_hoare",           quick_sort_hoare_wrapper,     false },
+    { "merge_sort_basic",           merge_sort_basic,             false },
+    { "merge_sort_optimized",       merge_sort_optimized,         false },
+    { "merge_sort_iterative",       merge_sort_iterative_wrapper, false },
+    { "merge_sort_divide_conquer",  merge_sort_divide_conquer,    false },
+    { "heap_sort_basic",            heap_sort_basic,              false },
+    { "heap_sort_optimized",        heap_sort_optimized,          false },
+};
+
+typedef struct {
+    SortFunction sort;
+    const SortElement* source;
+    SortElement* work;
+    size_t size;
+} Context;
+
+static void generate_input(SortElement* arr, size_t size, InputKind kind) {
+    BenchRng rng;
+    bench_rng_init(&rng, BENCH_SEED);
+
+    for (size_t i = 0; i < size; i++) {
+        switch (kind) {
+        case INPUT_RANDOM:     arr[i] = (SortElement)bench_rng_range(&rng, 1000000); break;
+        case INPUT_SORTED:     arr[i] = (SortElement)i; break;
+        case INPUT_REVERSED:   arr[i] = (SortElement)(size - i); break;
+        case INPUT_FEW_UNIQUE: arr[i] = (SortElement)bench_rng_range(&rng, 16); break;
+        default:               arr[i] = 0; break;
+        }
+    }
+}
+
+static void setup(void* p) {
+    Context* ctx = (Context*)p;
+    memcpy(ctx->work, ctx->source, ctx->size * sizeof(SortElement));
+}
+
+static void run_sort(void* p) {
+    Context* ctx = (Context*)p;
+    ctx->sort(ctx->work, ctx->size);
+}
+
+/* 정렬 결과 검증 (측정 외) */
+static bool is_sorted(const SortElement* arr, size_t size) {
+    for (size_t i = 1; i < size; i++) {
+        if (arr[i - 1] > arr[i]) return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int runs = bench_runs_from_args(argc, argv);
+    SortElement* inputs[INPUT_KIND_COUNT];
+    SortElement* work = (SortElement*)malloc(LARGE_N * sizeof(SortElement));
+    char name[96];
+
+    for (int k = 0; k < INPUT_KIND_COUNT; k++) {
+        inputs[k] = (SortElement*)malloc(LARGE_N * sizeof(SortElement));
+        if (!inputs[k] || !work) {
+            fprintf(stderr, "메모리 할당 실패\n");
+            return 1;
+        }
+    }
+
+    for (int quadratic = 1; quadratic >= 0; quadratic--) {
+        size_t size = quadratic ? SMALL_N : LARGE_N;
+        snprintf(name, sizeof(name), "%s sorts (N = %zu)", quadratic ? "O(n^2)" : "O(n log n)", size);
+        bench_print_header(name);
+
+        for (int k = 0; k < INPUT_KIND_COUNT; k++) {
+            generate_input(inputs[k], size, (InputKind)k);
+        }
+
+        for (size_t s = 0; s < sizeof(sorts) / sizeof(sorts[0]); s++) {
+            if (sorts[s].quadratic != (quadratic == 1)) continue;
+
+            for (int k = 0; k < INPUT_KIND_COUNT; k++) {
+                Context ctx = { sorts[s].sort, inputs[k], work, size };
+                snprintf(name, sizeof(name), "%s/%s", sorts[s].name, input_names[k]);
+
+                BenchCase bc = { name, BENCH_DEFAULT_WARMUP, runs, size, &ctx, setup, run_sort, NULL };
+                bench_run(&bc);
+
+                if (!is_sorted(work, size)) {
+                    fprintf(stderr, "%s: 정렬 결과가 올바르지 않습니다\n", name);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    for (int k = 0; k < INPUT_KIND_COUNT; k++) {
+        free(inputs[k]);
+    }
+    free(work);
+    return 0;
+}
@@ -0,0 +1,180 @@
+#include <math.h>
+#include "bench_harness.h"
+#include "binary_search_tree.h"
+#include "splay_tree.h"
+#include "sequential_search.h"
+
+/*
+스플레이 트리(60) 벤치마크: 접근이 치우친 키 검색
+- 서로 다른 키 N개를 같은 순서로 이진 탐색 트리(09), 스플레이 트리, 배열에 넣음
+  * 삽입 순서: 무작위(균형에 가까운 트리), 오름차순(이진 탐색 트리가 한 줄로 편향)
+- 검색 Q회: 균등 분포와 Zipf 분포(s = 0.99, 1.2) 순위를 무작위 키에 대응
+  (인기 키가 트리/배열의 어디에 있는지는 삽입 순서와 무관)
+- 비교 대상: 이진 탐색 트리 bst_search, splay_search, 전진이동법 sequential_search_mtf(19)
+- 검색이 구조를 바꾸므로 측정마다 setup에서 다시 만듦
+- 편향 트리 케이스가 느리므로 기본 측정 횟수는 DEFAULT_RUNS
+*/
+
+#define N 10000
+#define Q 100000
+#define SKEW_COUNT 3
+#define DEFAULT_RUNS 5
+
+typedef struct {
+    BSTree* bst;
+    SplayTree* splay;
+    BstKey array[N];
+    BstKey keys[N];                       // 무작위 삽입 순서
+    BstKey sorted_keys[N];                // 오름차순 삽입 순서
+    BstKey queries[SKEW_COUNT][Q];        // 분포별 검색 키
+    const BstKey* order;                  // 이번 케이스의 삽입 순서
+    const BstKey* current;                // 이번 케이스의 검색 키
+} Context;
+
+static Context ctx;
+
+/* Zipf 분포 검색 키 생성
+ * - 순위 r (1 ~ N)의 확률이 1 / r^s 에 비례, 누적 분포에서 이진 탐색으로 추출
+ * - s = 0 이면 균등 분포
+ */
+static void generate_zipf(BstKey* out, double s, BenchRng* rng) {
+    static double cdf[N];
+    static BstKey by_rank[N];
+    double total = 0.0;
+
+    for (size_t i = 0; i < N; i++) {
+        total += 1.0 / pow((double)(i + 1), s);
+        cdf[i] = total;
+        by_rank[i] = ctx.keys[i];
+    }
+    // 순위와 키 대응을 섞음 (Fisher-Yates)
+    for (size_t i = N - 1; i > 0; i--) {
+        size_t j = bench_rng_range(rng, (uint32_t)(i + 1));
+        BstKey temp = by_rank[i];
+        by_rank[i] = by_rank[j];
+        by_rank[j] = temp;
+    }
+    for (size_t q = 0; q < Q; q++) {
+        double u = (double)(bench_rng_next(rng) >> 11) / 9007199254740992.0 * total;
+        size_t low = 0;
+        size_t high = N - 1;
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (cdf[mid] < u) {
+                low = mid + 1;
+            }
+            else {
+                high = mid;
+            }
+        }
+        out[q] = by_rank[low];
+    }
+}
+
+static void setup_bst(void* p) {
+    Context* c = (Context*)p;
+    c->bst = bst_create();
+    for (size_t i = 0; i < N; i++) {
+        bst_insert(c->bst, c->order[i]);
+    }
+}
+
+static void teardown_bst(void* p) {
+    Context* c = (Context*)p;
+    bst_destroy(c->bst);
+    c->bst = NULL;
+}
+
+static void setup_splay(void* p) {
+    Context* c = (Context*)p;
+    c->splay = splay_create();
+    for (size_t i = 0; i < N; i++) {
+        splay_insert(c->splay, c->order[i]);
+    }
+}
+
+static void teardown_splay(void* p) {
+    Context* c = (Context*)p;
+    splay_destroy(c->splay);
+    c->splay = NULL;
+}
+
+static void setup_array(void* p) {
+    Context* c = (Context*)p;
+    for (size_t i = 0; i < N; i++) {
+        c->array[i] = c->order[i];
+    }
+}
+
+static void run_bst_search(void* p) {
+    Context* c = (Context*)p;
+    uint64_t found = 0;
+    for (size_t i = 0; i < Q; i++) {
+        found += bst_search(c->bst, c->current[i]);
+    }
+    bench_consume(found);
+}
+
+static void run_splay_search(void* p) {
+    Context* c = (Context*)p;
+    uint64_t found = 0;
+    for (size_t i = 0; i < Q; i++) {
+        found += splay_search(c->splay, c->current[i]);
+    }
+    bench_consume(found);
+}
+
+static void run_mtf_search(void* p) {
+    Context* c = (Context*)p;
+    uint64_t found = 0;
+    for (size_t i = 0; i < Q; i++) {
+        found += sequential_search_mtf(c->array, N, c->current[i]) == 0;
+    }
+    bench_consume(found);
+}
+
+int main(int argc, char** argv) {
+    static const char* skew_names[SKEW_COUNT] = { "uniform", "zipf_0.99", "zipf_1.2" };
+    static const double skews[SKEW_COUNT] = { 0.0, 0.99, 1.2 };
+    static const char* order_names[2] = { "random_insert", "sorted_insert" };
+    BenchRng rng;
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+    char name[64];
+
+    // 서로 다른 키 (키 공간을 N칸으로 나누고 칸마다 하나씩 뽑음, 무작위 순서는 섞어서 만듦)
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < N; i++) {
+        ctx.sorted_keys[i] = (BstKey)(i * 100 + bench_rng_range(&rng, 100));
+        ctx.keys[i] = ctx.sorted_keys[i];
+    }
+    for (size_t i = N - 1; i > 0; i--) {
+        size_t j = bench_rng_range(&rng, (uint32_t)(i + 1));
+        BstKey temp = ctx.keys[i];
+        ctx.keys[i] = ctx.keys[j];
+        ctx.keys[j] = temp;
+    }
+    for (size_t s = 0; s < SKEW_COUNT; s++) {
+        generate_zipf(ctx.queries[s], skews[s], &rng);
+    }
+
+    bench_print_header("Skewed key lookups (N = 10000 keys, Q = 100000 lookups)");
+    for (size_t o = 0; o < 2; o++) {
+        ctx.order = o == 0 ? ctx.keys : ctx.sorted_keys;
+        for (size_t s = 0; s < SKEW_COUNT; s++) {
+            ctx.current = ctx.queries[s];
+
+            BenchCase cases[] = {
+                { "bst",                   BENCH_DEFAULT_WARMUP, runs, Q, &ctx, setup_bst,   run_bst_search,   teardown_bst },
+                { "splay",                 BENCH_DEFAULT_WARMUP, runs, Q, &ctx, setup_splay, run_splay_search, teardown_splay },
+                { "mtf",                   BENCH_DEFAULT_WARMUP, runs, Q, &ctx, setup_array, run_mtf_search,   NULL },
+            };
+
+            for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+                snprintf(name, sizeof(name), "%s/%s/%s", cases[i].name, order_names[o], skew_names[s]);
+                cases[i].name = name;
+                bench_run(&cases[i]);
+            }
+        }
+    }
+    return 0;
+}
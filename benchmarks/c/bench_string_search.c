@@ -0,0 +1,108 @@
+#include "bench_harness.h"
+#include "string_search.h"
+
+/*
+문자열 탐색(35~38) 벤치마크:
+- 무작위 텍스트 (알파벳 4개 / 26개)에서 고정 패턴 탐색
+- 최악 입력: "aaa...a" 텍스트에서 "aa...ab" 패턴 탐색
+- 모든 알고리즘의 발견 횟수가 일치하는지 측정 외에서 검증
+*/
+
+#define TEXT_LEN 200000
+#define PATTERN_LEN 12
+
+typedef SearchResult* (*SearchFunction)(const char* text, const char* pattern, bool print_steps);
+
+typedef struct {
+    const char* name;
+    SearchFunction search;
+} SearchEntry;
+
+static const SearchEntry searches[] = {
+    { "brute_force", brute_force_search },
+    { "kmp",         kmp_search },
+    { "boyer_moore", boyer_moore_search },
+    { "rabin_karp",  rabin_karp_search },
+};
+
+typedef struct {
+    SearchFunction search;
+    const char* text;
+    const char* pattern;
+    int found;
+} Context;
+
+static void run_search(void* p) {
+    Context* ctx = (Context*)p;
+    SearchResult* result = ctx->search(ctx->text, ctx->pattern, false);
+    ctx->found = result ? result->count : -1;
+    destroy_result(result);
+}
+
+/* 고정 시드로 alphabet_size 종류의 문자만 사용하는 텍스트 생성 */
+static void generate_text(char* text, size_t length, int alphabet_size) {
+    BenchRng rng;
+    bench_rng_init(&rng, BENCH_SEED);
+    for (size_t i = 0; i < length; i++) {
+        text[i] = (char)('a' + bench_rng_range(&rng, (uint32_t)alphabet_size));
+    }
+    text[length] = '\0';
+}
+
+int main(int argc, char** argv) {
+    int runs = bench_runs_from_args(argc, argv);
+    char* text = (char*)malloc(TEXT_LEN + 1);
+    char pattern[PATTERN_LEN + 1];
+    char name[96];
+
+    if (!text) {
+        fprintf(stderr, "메모리 할당 실패\n");
+        return 1;
+    }
+
+    const struct {
+        const char* label;
+        int alphabet_size;   // 0이면 최악 입력
+    } scenarios[] = {
+        { "dna",        4 },
+        { "alpha26",    26 },
+        { "worst_case", 0 },
+    };
+
+    bench_print_header("String Search (text = 200000, pattern = 12)");
+    for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        if (scenarios[s].alphabet_size > 0) {
+            generate_text(text, TEXT_LEN, scenarios[s].alphabet_size);
+            // 텍스트 중간의 부분 문자열을 패턴으로 사용하여 최소 한 번은 발견되도록 함
+            memcpy(pattern, text + TEXT_LEN / 2, PATTERN_LEN);
+        }
+        else {
+            memset(text, 'a', TEXT_LEN);
+            text[TEXT_LEN] = '\0';
+            memset(pattern, 'a', PATTERN_LEN - 1);
+            pattern[PATTERN_LEN - 1] = 'b';
+        }
+        pattern[PATTERN_LEN] = '\0';
+
+        int expected = -1;
+        for (size_t a = 0; a < sizeof(searches) / sizeof(searches[0]); a++) {
+            Context ctx = { searches[a].search, text, pattern, 0 };
+            snprintf(name, sizeof(name), "%s/%s", searches[a].name, scenarios[s].label);
+
+            BenchCase bc = { name, BENCH_DEFAULT_WARMUP, runs, TEXT_LEN, &ctx, NULL, run_search, NULL };
+            bench_run(&bc);
+
+            if (expected < 0) {
+                expected = ctx.found;
+            }
+            else if (ctx.found != expected) {
+                fprintf(stderr, "%s: 발견 횟수 불일치 (%d != %d)\n", name, ctx.found, expected);
+                free(text);
+                return 1;
+            }
+        }
+    }
+
+    free(text);
+    return 0;
+}
@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "bench_harness.h"
+#include "linked_queue.h"
+#include "channel.hpp"
+
+/*
+블로킹 채널 벤치마크:
+- throughput: 생산자 P개 / 소비자 C개가 TOTAL개를 전달하는 시간
+  (P:C = 1:1, N:1, N:N, N = max(코어 수, 4))
+- 기존 방식: 연결 리스트 큐(07)를 뮤텍스로 보호하고 소비자는 비어있으면 POLL_INTERVAL 동안 잠듦
+  (생산자는 QUEUE_CAPACITY를 넘으면 양보하며 대기)
+- Channel은 요소 단위(enqueue/dequeue)와 BATCH개 묶음(enqueue_batch/dequeue_batch) 비교
+- wake-up latency: 비어있는 큐에서 소비자가 기다리는 동안 생산자가 값을 넣고,
+  넣기 직전부터 소비자가 받을 때까지의 시간 (p50/p99/max)
+*/
+
+#define TOTAL (1 << 20)
+#define QUEUE_CAPACITY 1024
+#define BATCH 64
+#define WAKE_ROUNDS 2000                        // wake-up latency 측정 횟수
+#define POLL_INTERVAL std::chrono::microseconds(50)
+#define PRODUCER_PAUSE std::chrono::microseconds(200)   // 소비자가 확실히 잠들도록 넣기 전에 쉬는 시간
+#define DEFAULT_RUNS 7
+
+// 기존 방식: 연결 리스트 큐(07) + 뮤텍스, 소비자는 잠깐씩 잠들며 확인 (sleep-poll)
+class PollingLinkedQueue {
+private:
+    std::mutex mutex_;
+    LinkedQueue* queue_;
+
+public:
+    explicit PollingLinkedQueue(size_t = 0) : queue_(lqueue_create()) {}
+    ~PollingLinkedQueue() { lqueue_destroy(queue_); }
+
+    bool enqueue(int value) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (lqueue_size(queue_) < QUEUE_CAPACITY) {
+                    return lqueue_enqueue(queue_, value) == LQUEUE_OK;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    bool dequeue(int& value) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (lqueue_dequeue(queue_, &value) == LQUEUE_OK) {
+                    return true;
+                }
+            }
+            std::this_thread::sleep_for(POLL_INTERVAL);
+        }
+    }
+};
+
+// 요소 단위 전달
+struct SingleOps {
+    template<typename Queue>
+    static void produce(Queue& queue, int first, int count) {
+        for (int i = 0; i < count; i++) {
+            queue.enqueue(first + i);
+        }
+    }
+
+    template<typename Queue>
+    static uint64_t consume(Queue& queue, int count) {
+        uint64_t sum = 0;
+        int value = 0;
+        for (int i = 0; i < count; i++) {
+            if (!queue.dequeue(value)) {
+                break;      // 닫힌 채널 (벤치마크 중에는 닫지 않음)
+            }
+            sum += (uint64_t)value;
+        }
+        return sum;
+    }
+};
+
+// BATCH개 묶음 전달 (Channel 전용)
+struct BatchOps {
+    template<typename Queue>
+    static void produce(Queue& queue, int first, int count) {
+        int values[BATCH];
+        for (int next = 0; next < count; next += BATCH) {
+            int n = std::min(BATCH, count - next);
+            for (int i = 0; i < n; i++) {
+                values[i] = first + next + i;
+            }
+            queue.enqueue_batch(values, (size_t)n);
+        }
+    }
+
+    template<typename Queue>
+    static uint64_t consume(Queue& queue, int count) {
+        uint64_t sum = 0;
+        int values[BATCH];
+        int received = 0;
+        while (received < count) {
+            size_t n = queue.dequeue_batch(values, (size_t)std::min(BATCH, count - received));
+            if (n == 0) {
+                break;      // 닫힌 채널
+            }
+            for (size_t i = 0; i < n; i++) {
+                sum += (uint64_t)values[i];
+            }
+            received += (int)n;
+        }
+        return sum;
+    }
+};
+
+template<typename Queue>
+struct Context {
+    Queue* queue;
+    int producers;
+    int consumers;
+};
+
+template<typename Queue>
+static void setup(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    ctx->queue = new Queue(QUEUE_CAPACITY);
+}
+
+template<typename Queue>
+static void teardown(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    delete ctx->queue;
+    ctx->queue = nullptr;
+}
+
+template<typename Queue, typename Ops>
+static void run_transfer(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    const int per_producer = TOTAL / ctx->producers;
+    const int per_consumer = TOTAL / ctx->consumers;
+    std::vector<std::thread> workers;
+    std::vector<uint64_t> sums(ctx->consumers * 8, 0);  // 스레드별 합계 (캐시 라인 분리)
+
+    for (int t = 0; t < ctx->producers; t++) {
+        workers.emplace_back([ctx, t, per_producer] {
+            Ops::produce(*ctx->queue, t * per_producer, per_producer);
+        });
+    }
+    for (int t = 0; t < ctx->consumers; t++) {
+        workers.emplace_back([ctx, t, per_consumer, &sums] {
+            sums[t * 8] = Ops::consume(*ctx->queue, per_consumer);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (uint64_t sum : sums) {
+        bench_consume(sum);
+    }
+}
+
+template<typename Queue, typename Ops>
+static void bench_config(const std::string& name, int producers, int consumers, int runs) {
+    static Context<Queue> ctx;
+    ctx.producers = producers;
+    ctx.consumers = consumers;
+
+    std::string case_name = name + "/p" + std::to_string(producers) + "_c" + std::to_string(consumers);
+    BenchCase bench = { case_name.c_str(), 1, runs, TOTAL, &ctx, setup<Queue>, run_transfer<Queue, Ops>, teardown<Queue> };
+    bench_run(&bench);
+}
+
+static void bench_all(int producers, int consumers, int runs) {
+    bench_config<PollingLinkedQueue, SingleOps>("polling_linked_queue", producers, consumers, runs);
+    bench_config<Channel<int>, SingleOps>("channel/single", producers, consumers, runs);
+    bench_config<Channel<int>, BatchOps>("channel/batch_" + std::to_string(BATCH), producers, consumers, runs);
+}
+
+// 잠든 소비자가 값을 받기까지 걸린 시간 분포 출력
+template<typename Queue>
+static void report_wake_latency(const char* name) {
+    Queue queue(QUEUE_CAPACITY);
+    std::vector<uint64_t> sent_at(WAKE_ROUNDS);
+    std::vector<uint64_t> samples(WAKE_ROUNDS);
+
+    std::thread consumer([&] {
+        int value = 0;
+        for (int i = 0; i < WAKE_ROUNDS; i++) {
+            if (!queue.dequeue(value)) {
+                break;
+            }
+            samples[value] = bench_now_ns() - sent_at[value];
+        }
+    });
+
+    for (int i = 0; i < WAKE_ROUNDS; i++) {
+        std::this_thread::sleep_for(PRODUCER_PAUSE);
+        sent_at[i] = bench_now_ns();
+        queue.enqueue(i);
+    }
+    consumer.join();
+
+    std::sort(samples.begin(), samples.end());
+    printf("%-40s %10llu %10llu %10llu\n", name,
+           (unsigned long long)samples[samples.size() / 2],
+           (unsigned long long)samples[samples.size() * 99 / 100],
+           (unsigned long long)samples.back());
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+    int max_threads = std::max(4, (int)std::thread::hardware_concurrency());
+
+    std::string title = "Blocking channel transfer (" + std::to_string(std::thread::hardware_concurrency()) + " cores)";
+    bench_print_header(title.c_str());
+    bench_all(1, 1, runs);
+    bench_all(max_threads, 1, runs);            // fan-in
+    bench_all(max_threads, max_threads, runs);
+
+    printf("\nwake-up latency (ns, %d rounds, producer pauses %lld us)\n", WAKE_ROUNDS,
+           (long long)std::chrono::duration_cast<std::chrono::microseconds>(PRODUCER_PAUSE).count());
+    printf("%-40s %10s %10s %10s\n", "case", "p50", "p99", "max");
+    report_wake_latency<PollingLinkedQueue>("polling_linked_queue");
+    report_wake_latency<Channel<int>>("channel");
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench_harness.h"
+#include "linked_stack.hpp"
+#include "concurrent_linked_stack.hpp"
+#include "elimination_backoff_stack.hpp"
+
+/*
+다중 스레드 push/pop 처리량 벤치마크:
+- 스레드 수 1, 2, 4, ... 최대 max(코어 수, 16) (코어 수를 넘는 구간은 과다 구독 상태)
+- push_pop: 각 스레드가 push 후 pop을 반복
+- mixed: 각 스레드가 무작위로 push 또는 pop (50/50)
+- 전체 연산 수는 스레드 수와 무관하게 고정
+- 뮤텍스로 감싼 LinkedStack, lock-free ConcurrentLinkedStack(Treiber + 해저드 포인터),
+  EliminationBackoffStack(Treiber + 소거 배열) 비교
+*/
+
+#define TOTAL_PAIRS (1 << 20)   // 실행 한 번의 push/pop 쌍 수
+#define PREFILL 1024            // 시작 시 미리 넣어 두는 요소 수 (빈 스택 경합 완화)
+#define DEFAULT_RUNS 7
+
+// 기존 방식: 모든 연산을 뮤텍스 하나로 직렬화
+class MutexLinkedStack {
+private:
+    std::mutex mutex_;
+    LinkedStack<int> stack_;
+
+public:
+    void push(int value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stack_.push(value);
+    }
+
+    bool try_pop(int& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stack_.empty()) {
+            return false;
+        }
+        value = stack_.pop_value();
+        return true;
+    }
+};
+
+template<typename Stack>
+struct Context {
+    Stack* stack;
+    int threads;
+};
+
+template<typename Stack>
+static void setup(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    ctx->stack = new Stack();
+    for (int i = 0; i < PREFILL; i++) {
+        ctx->stack->push(i);
+    }
+}
+
+template<typename Stack>
+static void teardown(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    delete ctx->stack;
+    ctx->stack = nullptr;
+}
+
+template<typename Stack>
+static void run_push_pop(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    const int pairs_per_thread = TOTAL_PAIRS / ctx->threads;
+    std::vector<std::thread> workers;
+    std::vector<uint64_t> sums(ctx->threads * 8, 0);  // 스레드별 합계 (캐시 라인 분리)
+
+    for (int t = 0; t < ctx->threads; t++) {
+        workers.emplace_back([ctx, t, pairs_per_thread, &sums] {
+            uint64_t sum = 0;
+            int value;
+            for (int i = 0; i < pairs_per_thread; i++) {
+                ctx->stack->push(i);
+                if (ctx->stack->try_pop(value)) {
+                    sum += (uint64_t)value;
+                }
+            }
+            sums[t * 8] = sum;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (uint64_t sum : sums) {
+        bench_consume(sum);
+    }
+}
+
+template<typename Stack>
+static void run_mixed(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    const int ops_per_thread = 2 * (TOTAL_PAIRS / ctx->threads);
+    std::vector<std::thread> workers;
+    std::vector<uint64_t> sums(ctx->threads * 8, 0);  // 스레드별 합계 (캐시 라인 분리)
+
+    for (int t = 0; t < ctx->threads; t++) {
+        workers.emplace_back([ctx, t, ops_per_thread, &sums] {
+            BenchRng rng;
+            bench_rng_init(&rng, BENCH_SEED + (uint64_t)t);
+            uint64_t sum = 0;
+            int value;
+            for (int i = 0; i < ops_per_thread; i++) {
+                if (bench_rng_next(&rng) & 1) {
+                    ctx->stack->push(i);
+                } else if (ctx->stack->try_pop(value)) {
+                    sum += (uint64_t)value;
+                }
+            }
+            sums[t * 8] = sum;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (uint64_t sum : sums) {
+        bench_consume(sum);
+    }
+}
+
+template<typename Stack>
+static void bench_threads(const std::string& name, int threads, int runs) {
+    static Context<Stack> ctx;
+    ctx.threads = threads;
+
+    std::string push_pop_name = name + "/push_pop/threads_" + std::to_string(threads);
+    std::string mixed_name = name + "/mixed_50_50/threads_" + std::to_string(threads);
+    size_t ops = 2 * (size_t)(TOTAL_PAIRS / threads) * threads;
+    BenchCase cases[] = {
+        { push_pop_name.c_str(), 1, runs, ops, &ctx, setup<Stack>, run_push_pop<Stack>, teardown<Stack> },
+        { mixed_name.c_str(),    1, runs, ops, &ctx, setup<Stack>, run_mixed<Stack>,    teardown<Stack> },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+    int max_threads = std::max(16, (int)std::thread::hardware_concurrency());
+
+    std::string title = "Concurrent Stack push/pop (" + std::to_string(std::thread::hardware_concurrency()) + " cores)";
+    bench_print_header(title.c_str());
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        bench_threads<MutexLinkedStack>("mutex_linked_stack", threads, runs);
+        bench_threads<ConcurrentLinkedStack<int>>("treiber_stack", threads, runs);
+        bench_threads<EliminationBackoffStack<int>>("elimination_stack", threads, runs);
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "bench_harness.h"
+#include "circular_queue.h"
+#include "mpmc_bounded_queue.hpp"
+
+/*
+다중 생산자/다중 소비자 큐 처리량 벤치마크:
+- 생산자 P개 / 소비자 C개 (P = C = 1, 2, 4, ... 최대 max(코어 수, 4)), 이어서 fan-in (N:1), fan-out (1:N)
+- 전체 전달 요소 수는 스레드 수와 무관하게 고정 (TOTAL)
+- 뮤텍스로 감싼 원형 큐(06, 용량을 QUEUE_CAPACITY로 제한),
+  MpmcBoundedQueue의 try_* (실패 시 스핀 후 양보), 블로킹 push/pop 비교
+*/
+
+#define TOTAL (1 << 20)
+#define QUEUE_CAPACITY 1024
+#define DEFAULT_RUNS 7
+
+// 기존 방식: 원형 큐(06)를 뮤텍스 하나로 보호
+class MutexCircularQueue {
+private:
+    std::mutex mutex_;
+    CircularQueue* queue_;
+
+public:
+    MutexCircularQueue() : queue_(cqueue_create()) {}
+    ~MutexCircularQueue() { cqueue_destroy(queue_); }
+
+    bool try_push(int value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cqueue_size(queue_) >= QUEUE_CAPACITY) {
+            return false;
+        }
+        return cqueue_enqueue(queue_, value) == CQUEUE_OK;
+    }
+
+    bool try_pop(int& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cqueue_dequeue(queue_, &value) == CQUEUE_OK;
+    }
+};
+
+// 상대 스레드를 기다리는 동안 잠시 스핀 후 양보
+static inline void backoff(int& spins) {
+    if (++spins > 64) {
+        std::this_thread::yield();
+        spins = 0;
+    }
+}
+
+// try_* 를 성공할 때까지 반복
+struct TryOps {
+    template<typename Queue>
+    static void push(Queue& queue, int value) {
+        int spins = 0;
+        while (!queue.try_push(value)) {
+            backoff(spins);
+        }
+    }
+
+    template<typename Queue>
+    static void pop(Queue& queue, int& value) {
+        int spins = 0;
+        while (!queue.try_pop(value)) {
+            backoff(spins);
+        }
+    }
+};
+
+// 블로킹 push/pop
+struct BlockingOps {
+    template<typename Queue>
+    static void push(Queue& queue, int value) {
+        queue.push(value);
+    }
+
+    template<typename Queue>
+    static void pop(Queue& queue, int& value) {
+        queue.pop(value);
+    }
+};
+
+template<typename Queue>
+struct Context {
+    Queue* queue;
+    int producers;
+    int consumers;
+};
+
+template<typename Queue>
+static void setup(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    if constexpr (std::is_same_v<Queue, MutexCircularQueue>) {
+        ctx->queue = new Queue();
+    } else {
+        ctx->queue = new Queue(QUEUE_CAPACITY);
+    }
+}
+
+template<typename Queue>
+static void teardown(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    delete ctx->queue;
+    ctx->queue = nullptr;
+}
+
+template<typename Queue, typename Ops>
+static void run_transfer(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    const int per_producer = TOTAL / ctx->producers;
+    const int per_consumer = TOTAL / ctx->consumers;
+    std::vector<std::thread> workers;
+    std::vector<uint64_t> sums(ctx->consumers * 8, 0);  // 스레드별 합계 (캐시 라인 분리)
+
+    for (int t = 0; t < ctx->producers; t++) {
+        workers.emplace_back([ctx, t, per_producer] {
+            for (int i = 0; i < per_producer; i++) {
+                Ops::push(*ctx->queue, t * per_producer + i);
+            }
+        });
+    }
+    for (int t = 0; t < ctx->consumers; t++) {
+        workers.emplace_back([ctx, t, per_consumer, &sums] {
+            uint64_t sum = 0;
+            int value;
+            for (int i = 0; i < per_consumer; i++) {
+                Ops::pop(*ctx->queue, value);
+                sum += (uint64_t)value;
+            }
+            sums[t * 8] = sum;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (uint64_t sum : sums) {
+        bench_consume(sum);
+    }
+}
+
+template<typename Queue, typename Ops>
+static void bench_config(const std::string& name, int producers, int consumers, int runs) {
+    static Context<Queue> ctx;
+    ctx.producers = producers;
+    ctx.consumers = consumers;
+
+    std::string case_name = name + "/p" + std::to_string(producers) + "_c" + std::to_string(consumers);
+    BenchCase bench = { case_name.c_str(), 1, runs, TOTAL, &ctx, setup<Queue>, run_transfer<Queue, Ops>, teardown<Queue> };
+    bench_run(&bench);
+}
+
+static void bench_all(int producers, int consumers, int runs) {
+    bench_config<MutexCircularQueue, TryOps>("mutex_circular_queue", producers, consumers, runs);
+    bench_config<MpmcBoundedQueue<int>, TryOps>("mpmc_queue/try", producers, consumers, runs);
+    bench_config<MpmcBoundedQueue<int>, BlockingOps>("mpmc_queue/blocking", producers, consumers, runs);
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+    int max_threads = std::max(4, (int)std::thread::hardware_concurrency());
+
+    std::string title = "MPMC queue transfer (" + std::to_string(std::thread::hardware_concurrency()) + " cores)";
+    bench_print_header(title.c_str());
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        bench_all(threads, threads, runs);
+    }
+    bench_all(max_threads, 1, runs);    // fan-in
+    bench_all(1, max_threads, runs);    // fan-out
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+#include "bench_harness.h"
+#include "array_stack.hpp"
+#include "linked_stack.hpp"
+#include "segmented_stack.hpp"
+
+/*
+세그먼트 스택 벤치마크 (ArrayStack, LinkedStack 대비):
+- push N회 / push N회 후 pop N회 (N = 4,194,304)
+- 블록 경계 진동: 경계 바로 아래에서 push/pop 반복 (세그먼트 캐시 효과)
+- push 한 번의 최대 지연: ArrayStack은 확장 시 전체 복사로 지연이 튐
+*/
+
+#define N (1 << 22)
+#define BOUNDARY_OPS 1000000
+#define DEFAULT_RUNS 7
+
+template<typename Stack>
+struct Context {
+    std::unique_ptr<Stack> stack;
+    size_t boundary;    // 블록 경계 진동 시 채워 둘 요소 수
+};
+
+template<typename Stack>
+static void setup(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    ctx->stack = std::make_unique<Stack>();
+}
+
+template<typename Stack>
+static void setup_boundary(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    ctx->stack = std::make_unique<Stack>();
+    for (size_t i = 0; i < ctx->boundary; i++) {
+        ctx->stack->push((int)i);
+    }
+}
+
+template<typename Stack>
+static void teardown(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    ctx->stack.reset();
+}
+
+template<typename Stack>
+static void run_push(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    for (int i = 0; i < N; i++) {
+        ctx->stack->push(i);
+    }
+    bench_consume(ctx->stack->size());
+}
+
+template<typename Stack>
+static void run_push_then_pop(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    uint64_t sum = 0;
+    for (int i = 0; i < N; i++) {
+        ctx->stack->push(i);
+    }
+    while (!ctx->stack->empty()) {
+        sum += (uint64_t)ctx->stack->pop_value();
+    }
+    bench_consume(sum);
+}
+
+// 경계를 넘나드는 push 2회 / pop 2회 반복
+template<typename Stack>
+static void run_boundary(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    uint64_t sum = 0;
+    for (int i = 0; i < BOUNDARY_OPS / 4; i++) {
+        ctx->stack->push(i);
+        ctx->stack->push(i);
+        sum += (uint64_t)ctx->stack->pop_value();
+        sum += (uint64_t)ctx->stack->pop_value();
+    }
+    bench_consume(sum);
+}
+
+// push 한 번씩 시간을 재어 최대 지연 측정
+template<typename Stack>
+static uint64_t max_push_latency_ns() {
+    Stack stack;
+    uint64_t worst = 0;
+    for (int i = 0; i < N; i++) {
+        uint64_t start = bench_now_ns();
+        stack.push(i);
+        uint64_t elapsed = bench_now_ns() - start;
+        if (elapsed > worst) {
+            worst = elapsed;
+        }
+    }
+    bench_consume(stack.size());
+    return worst;
+}
+
+template<typename Stack>
+static void bench_stack(const std::string& name, size_t boundary, int runs) {
+    static Context<Stack> ctx;
+    ctx.boundary = boundary;
+
+    std::string push_name = name + "/push";
+    std::string push_pop_name = name + "/push_then_pop";
+    std::string boundary_name = name + "/boundary_oscillate";
+    BenchCase cases[] = {
+        { push_name.c_str(),     1, runs, N,            &ctx, setup<Stack>,          run_push<Stack>,          teardown<Stack> },
+        { push_pop_name.c_str(), 1, runs, 2 * N,        &ctx, setup<Stack>,          run_push_then_pop<Stack>, teardown<Stack> },
+        { boundary_name.c_str(), 1, runs, BOUNDARY_OPS, &ctx, setup_boundary<Stack>, run_boundary<Stack>,      teardown<Stack> },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+
+    // 경계 직전까지 채워 둠 (ArrayStack: 용량 2^k, SegmentedStack: 세그먼트 합 8 + 16 + ... = 2^k - 8)
+    bench_print_header("Segmented Stack (N = 4194304)");
+    bench_stack<ArrayStack<int>>("array_stack", (1 << 16) - 1, runs);
+    bench_stack<LinkedStack<int>>("linked_stack", (1 << 16) - 1, runs);
+    bench_stack<SegmentedStack<int>>("segmented_stack", (1 << 16) - 9, runs);
+
+    // 노드 수백만 개를 해제한 직후의 큰 할당은 malloc 내부 정리 비용을 떠안으므로 LinkedStack을 마지막에 측정
+    printf("\nmax single push latency (N = %d)\n", N);
+    printf("%-40s %10llu ns\n", "array_stack", (unsigned long long)max_push_latency_ns<ArrayStack<int>>());
+    printf("%-40s %10llu ns\n", "segmented_stack", (unsigned long long)max_push_latency_ns<SegmentedStack<int>>());
+    printf("%-40s %10llu ns\n", "linked_stack", (unsigned long long)max_push_latency_ns<LinkedStack<int>>());
+    return 0;
+}
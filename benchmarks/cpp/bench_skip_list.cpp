@@ -0,0 +1,96 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include "bench_harness.h"
+#include "single_linked_list.hpp"
+#include "skip_list.hpp"
+
+/*
+스킵 리스트 위치 접근 벤치마크 (SingleLinkedList 대비):
+- 무작위 위치 at()
+- 무작위 위치 insert_after() 후 remove_at() (크기 유지)
+- 크기 10^5, 10^6, 10^7
+- 단일 연결 리스트는 연산마다 O(n)이므로 연산 수를 줄여 측정하고 ns/op로 비교
+*/
+
+#define SKIP_OPS 100000
+#define DEFAULT_RUNS 5
+
+template<typename List>
+struct Context {
+    List* list;
+    std::vector<size_t> positions;  // 미리 뽑아 둔 무작위 위치
+};
+
+template<typename List>
+static void run_at(void* p) {
+    Context<List>* ctx = (Context<List>*)p;
+    uint64_t sum = 0;
+    for (size_t position : ctx->positions) {
+        sum += (uint64_t)ctx->list->at(position);
+    }
+    bench_consume(sum);
+}
+
+template<typename List>
+static void run_insert_remove(void* p) {
+    Context<List>* ctx = (Context<List>*)p;
+    for (size_t position : ctx->positions) {
+        ctx->list->insert_after(position, (int)position);
+        ctx->list->remove_at(position + 1);
+    }
+    bench_consume(ctx->list->size());
+}
+
+template<typename List>
+static void bench_list(const std::string& name, List& list, size_t n, size_t ops, int runs) {
+    static Context<List> ctx;
+    BenchRng rng;
+    bench_rng_init(&rng, BENCH_SEED);
+
+    ctx.list = &list;
+    ctx.positions.clear();
+    for (size_t i = 0; i < ops; i++) {
+        ctx.positions.push_back((size_t)(bench_rng_next(&rng) % n));
+    }
+
+    std::string at_name = name + "/at";
+    std::string insert_name = name + "/insert_after+remove_at";
+    BenchCase cases[] = {
+        { at_name.c_str(),     1, runs, ops,     &ctx, NULL, run_at<List>,            NULL },
+        { insert_name.c_str(), 1, runs, 2 * ops, &ctx, NULL, run_insert_remove<List>, NULL },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+    const size_t sizes[] = { 100000, 1000000, 10000000 };
+
+    for (size_t n : sizes) {
+        std::string title = "Skip List vs Single Linked List (N = " + std::to_string(n) + ")";
+        bench_print_header(title.c_str());
+
+        // 크기별로 하나씩만 만들어 메모리 사용량을 제한
+        {
+            auto skip = std::make_unique<SkipList<int>>();
+            for (size_t i = 0; i < n; i++) {
+                skip->push_back((int)i);
+            }
+            bench_list("skip_list", *skip, n, SKIP_OPS, runs);
+        }
+        {
+            auto single = std::make_unique<SingleLinkedList<int>>();
+            for (size_t i = 0; i < n; i++) {
+                single->push_back((int)i);
+            }
+            // 연산 하나가 평균 n/2 노드를 따라가므로 전체 이동 수가 약 10^7이 되도록 조절
+            size_t ops = 20000000 / n;
+            bench_list("single_list", *single, n, ops, runs);
+        }
+    }
+    return 0;
+}
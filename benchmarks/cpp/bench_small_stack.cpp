@@ -0,0 +1,74 @@
+#include <string>
+#include <vector>
+#include "bench_harness.h"
+#include "array_stack.hpp"
+#include "small_array_stack.hpp"
+
+/*
+작은 스택 반복 생성 벤치마크 (파서/DFS 패턴):
+- 작업마다 스택을 새로 만들고, 무작위 깊이(1~48)까지 push 후 모두 pop
+- 깊은 작업(깊이 1~1000)은 인라인 슬롯을 넘겨 힙으로 옮겨가는 경로 확인
+- ArrayStack(힙 배열, 기본 생성 + 축소 재할당)과 SmallArrayStack(인라인 64슬롯) 비교
+*/
+
+#define TASKS 100000
+#define SHALLOW_DEPTH 48
+#define DEEP_DEPTH 1000
+
+struct Context {
+    std::vector<int> depths;    // 미리 뽑아 둔 작업별 깊이
+    size_t total_ops;           // 전체 push + pop 수
+};
+
+template<typename Stack>
+static void run_tasks(void* p) {
+    Context* ctx = (Context*)p;
+    uint64_t sum = 0;
+    for (int depth : ctx->depths) {
+        Stack stack;
+        for (int i = 0; i < depth; i++) {
+            stack.push(i);
+        }
+        while (!stack.empty()) {
+            sum += (uint64_t)stack.pop_value();
+        }
+    }
+    bench_consume(sum);
+}
+
+static void make_depths(Context& ctx, int max_depth) {
+    BenchRng rng;
+    bench_rng_init(&rng, BENCH_SEED);
+    ctx.depths.clear();
+    ctx.total_ops = 0;
+    for (size_t i = 0; i < TASKS; i++) {
+        int depth = 1 + (int)bench_rng_range(&rng, (uint32_t)max_depth);
+        ctx.depths.push_back(depth);
+        ctx.total_ops += 2 * (size_t)depth;
+    }
+}
+
+static void bench_depth(const char* label, int max_depth, int runs) {
+    static Context ctx;
+    make_depths(ctx, max_depth);
+
+    std::string array_name = std::string("array_stack/") + label;
+    std::string small_name = std::string("small_array_stack/") + label;
+    BenchCase cases[] = {
+        { array_name.c_str(), BENCH_DEFAULT_WARMUP, runs, ctx.total_ops, &ctx, NULL, run_tasks<ArrayStack<int>>,      NULL },
+        { small_name.c_str(), BENCH_DEFAULT_WARMUP, runs, ctx.total_ops, &ctx, NULL, run_tasks<SmallArrayStack<int>>, NULL },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = bench_runs_from_args(argc, argv);
+
+    bench_print_header("Small Stack Tasks (100000 tasks)");
+    bench_depth("shallow_1-48", SHALLOW_DEPTH, runs);
+    bench_depth("deep_1-1000", DEEP_DEPTH, runs);
+    return 0;
+}
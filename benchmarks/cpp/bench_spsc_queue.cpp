@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "bench_harness.h"
+#include "circular_queue.h"
+#include "spsc_ring_buffer.hpp"
+
+/*
+생산자 1 / 소비자 1 스레드 큐 벤치마크:
+- throughput: 생산자가 TOTAL개를 넣고 소비자가 모두 꺼낼 때까지의 시간
+- throughput_batch: BATCH개씩 묶어서 넣고 꺼냄
+- ping_pong: 두 큐로 값을 주고받는 왕복 (왕복 지연의 p50/p99도 따로 출력)
+- 뮤텍스로 감싼 원형 큐(06, 용량을 RING_CAPACITY로 제한)와 SpscRingBuffer 비교
+- 대기 중에는 잠시 스핀 후 양보 (코어가 적은 환경에서도 상대 스레드가 진행하도록)
+*/
+
+#define TOTAL (1 << 22)         // throughput 실행 한 번에 전달하는 요소 수
+#define RING_CAPACITY 1024
+#define BATCH 64
+#define ROUNDS 100000           // ping_pong 왕복 수
+#define DEFAULT_RUNS 7
+
+// 기존 방식: 원형 큐(06)를 뮤텍스 하나로 보호
+class MutexCircularQueue {
+private:
+    std::mutex mutex_;
+    CircularQueue* queue_;
+
+public:
+    MutexCircularQueue() : queue_(cqueue_create()) {}
+    ~MutexCircularQueue() { cqueue_destroy(queue_); }
+
+    bool try_push(int value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cqueue_size(queue_) >= RING_CAPACITY) {
+            return false;
+        }
+        return cqueue_enqueue(queue_, value) == CQUEUE_OK;
+    }
+
+    bool try_pop(int& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cqueue_dequeue(queue_, &value) == CQUEUE_OK;
+    }
+
+    size_t try_push_n(const int* values, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t n = std::min(count, RING_CAPACITY - cqueue_size(queue_));
+        for (size_t i = 0; i < n; i++) {
+            cqueue_enqueue(queue_, values[i]);
+        }
+        return n;
+    }
+
+    size_t try_pop_n(int* out, size_t max_count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t n = 0;
+        while (n < max_count && cqueue_dequeue(queue_, &out[n]) == CQUEUE_OK) {
+            n++;
+        }
+        return n;
+    }
+};
+
+// 상대 스레드를 기다리는 동안 잠시 스핀 후 양보
+static inline void backoff(int& spins) {
+    if (++spins > 64) {
+        std::this_thread::yield();
+        spins = 0;
+    }
+}
+
+template<typename Queue>
+struct Context {
+    Queue* forward;     // 생산자 → 소비자
+    Queue* backward;    // ping_pong 응답용
+};
+
+template<typename Queue>
+static Queue* make_queue() {
+    if constexpr (std::is_same_v<Queue, MutexCircularQueue>) {
+        return new Queue();
+    } else {
+        return new Queue(RING_CAPACITY);
+    }
+}
+
+template<typename Queue>
+static void setup(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    ctx->forward = make_queue<Queue>();
+    ctx->backward = make_queue<Queue>();
+}
+
+template<typename Queue>
+static void teardown(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    delete ctx->forward;
+    delete ctx->backward;
+    ctx->forward = nullptr;
+    ctx->backward = nullptr;
+}
+
+template<typename Queue>
+static void run_throughput(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    std::thread producer([ctx] {
+        int spins = 0;
+        for (int i = 0; i < TOTAL; i++) {
+            while (!ctx->forward->try_push(i)) {
+                backoff(spins);
+            }
+        }
+    });
+
+    uint64_t sum = 0;
+    int spins = 0;
+    int value;
+    for (int received = 0; received < TOTAL; received++) {
+        while (!ctx->forward->try_pop(value)) {
+            backoff(spins);
+        }
+        sum += (uint64_t)value;
+    }
+    producer.join();
+    bench_consume(sum);
+}
+
+template<typename Queue>
+static void run_throughput_batch(void* p) {
+    Context<Queue>* ctx = (Context<Queue>*)p;
+    std::thread producer([ctx] {
+        int values[BATCH];
+        int spins = 0;
+        int next = 0;
+        while (next < TOTAL) {
+            int count = std::min(BATCH, TOTAL - next);
+            for (int i = 0; i < count; i++) {
+                values[i] = next + i;
+            }
+            int sent = 0;
+            while (sent < count) {
+                size_t n = ctx->forward->try_push_n(values + sent, (size_t)(count - sent));
+                if (n == 0) {
+                    backoff(spins);
+                }
+                sent += (int)n;
+            }
+            next += count;
+        }
+    });
+
+    uint64_t sum = 0;
+    int values[BATCH];
+    int spins = 0;
+    int received = 0;
+    while (received < TOTAL) {
+        size_t n = ctx->forward->try_pop_n(values, BATCH);
+        if (n == 0) {
+            backoff(spins);
+        }
+        for (size_t i = 0; i < n; i++) {
+            sum += (uint64_t)values[i];
+        }
+        received += (int)n;
+    }
+    producer.join();
+    bench_consume(sum);
+}
+
+// 왕복 ROUNDS회, samples가 있으면 왕복마다 걸린 시간을 기록
+template<typename Queue>
+static void ping_pong(Context<Queue>* ctx, std::vector<uint64_t>* samples) {
+    std::thread echo([ctx] {
+        int spins = 0;
+        int value;
+        for (int i = 0; i < ROUNDS; i++) {
+            while (!ctx->forward->try_pop(value)) {
+                backoff(spins);
+            }
+            while (!ctx->backward->try_push(value)) {
+                backoff(spins);
+            }
+        }
+    });
+
+    uint64_t sum = 0;
+    int spins = 0;
+    int value;
+    for (int i = 0; i < ROUNDS; i++) {
+        uint64_t start = samples ? bench_now_ns() : 0;
+        while (!ctx->forward->try_push(i)) {
+            backoff(spins);
+        }
+        while (!ctx->backward->try_pop(value)) {
+            backoff(spins);
+        }
+        if (samples) {
+            samples->push_back(bench_now_ns() - start);
+        }
+        sum += (uint64_t)value;
+    }
+    echo.join();
+    bench_consume(sum);
+}
+
+template<typename Queue>
+static void run_ping_pong(void* p) {
+    ping_pong((Context<Queue>*)p, nullptr);
+}
+
+template<typename Queue>
+static void bench_queue(const std::string& name, int runs) {
+    static Context<Queue> ctx;
+
+    std::string throughput_name = name + "/throughput";
+    std::string batch_name = name + "/throughput_batch_" + std::to_string(BATCH);
+    std::string ping_pong_name = name + "/ping_pong";
+    BenchCase cases[] = {
+        { throughput_name.c_str(), 1, runs, TOTAL,  &ctx, setup<Queue>, run_throughput<Queue>,       teardown<Queue> },
+        { batch_name.c_str(),      1, runs, TOTAL,  &ctx, setup<Queue>, run_throughput_batch<Queue>, teardown<Queue> },
+        { ping_pong_name.c_str(),  1, runs, ROUNDS, &ctx, setup<Queue>, run_ping_pong<Queue>,        teardown<Queue> },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+}
+
+// 왕복 지연 분포 출력
+template<typename Queue>
+static void report_round_trip(const char* name) {
+    Context<Queue> ctx;
+    std::vector<uint64_t> samples;
+    samples.reserve(ROUNDS);
+
+    setup<Queue>(&ctx);
+    ping_pong(&ctx, &samples);
+    teardown<Queue>(&ctx);
+
+    std::sort(samples.begin(), samples.end());
+    printf("%-40s %10llu %10llu %10llu\n", name,
+           (unsigned long long)samples[samples.size() / 2],
+           (unsigned long long)samples[samples.size() * 99 / 100],
+           (unsigned long long)samples.back());
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+
+    std::string title = "SPSC queue, 1 producer / 1 consumer (" +
+                        std::to_string(std::thread::hardware_concurrency()) + " cores)";
+    bench_print_header(title.c_str());
+    bench_queue<MutexCircularQueue>("mutex_circular_queue", runs);
+    bench_queue<SpscRingBuffer<int>>("spsc_ring_buffer", runs);
+
+    printf("\nround trip latency (ns, %d rounds)\n", ROUNDS);
+    printf("%-40s %10s %10s %10s\n", "case", "p50", "p99", "max");
+    report_round_trip<MutexCircularQueue>("mutex_circular_queue");
+    report_round_trip<SpscRingBuffer<int>>("spsc_ring_buffer");
+    return 0;
+}
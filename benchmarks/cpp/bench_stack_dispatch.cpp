@@ -0,0 +1,111 @@
+#include <string>
+#include <type_traits>
+#include "bench_harness.h"
+#include "container_traits.hpp"
+#include "array_stack.hpp"
+#include "linked_stack.hpp"
+#include "segmented_stack.hpp"
+#include "any_stack.hpp"
+
+/*
+호출 방식별 push/pop 처리량 벤치마크 (같은 스택, 같은 작업):
+- static: 구체 타입을 템플릿 인자로 받아 직접 호출 (final 클래스이므로 인라인 가능)
+- virtual: IStack<int>& 를 통한 가상 호출
+- any: AnyStack<int> 타입 소거 래퍼를 통한 호출
+- fill_drain: N개 push 후 모두 pop (N = 1,048,576)
+- shallow: 깊이 2 이내에서 push/peek/pop 반복 (호출 비용이 지배적)
+*/
+
+#define N (1 << 20)
+#define SHALLOW_OPS (1 << 22)
+#define DEFAULT_RUNS 7
+
+template<typename Stack>
+struct Context {
+    Stack* stack;           // 정적 호출용 (구체 타입)
+    IStack<int>* base;      // 가상 호출용 (같은 객체를 인터페이스로 참조)
+    AnyStack<int>* any;     // 타입 소거 래퍼 (별도 객체)
+};
+
+// 스택 연산을 제공하는 아무 타입이나 받는 일반 알고리즘
+template<typename S, typename = std::enable_if_t<is_stack_v<S>>>
+static uint64_t fill_drain(S& stack) {
+    uint64_t sum = 0;
+    for (int i = 0; i < N; i++) {
+        stack.push(i);
+    }
+    while (!stack.empty()) {
+        sum += (uint64_t)stack.pop_value();
+    }
+    return sum;
+}
+
+template<typename S, typename = std::enable_if_t<is_stack_v<S>>>
+static uint64_t shallow(S& stack) {
+    uint64_t sum = 0;
+    for (int i = 0; i < SHALLOW_OPS / 4; i++) {
+        stack.push(i);
+        stack.push(i + 1);
+        sum += (uint64_t)stack.peek();
+        stack.pop();
+        sum += (uint64_t)stack.pop_value();
+    }
+    return sum;
+}
+
+template<typename Stack>
+static void setup(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    ctx->stack = new Stack();
+    ctx->base = ctx->stack;
+    ctx->any = new AnyStack<int>(std::in_place_type<Stack>);
+}
+
+template<typename Stack>
+static void teardown(void* p) {
+    Context<Stack>* ctx = (Context<Stack>*)p;
+    delete ctx->stack;
+    delete ctx->any;
+    ctx->stack = nullptr;
+    ctx->base = nullptr;
+    ctx->any = nullptr;
+}
+
+template<typename Stack> static void run_fill_static(void* p)   { bench_consume(fill_drain(*((Context<Stack>*)p)->stack)); }
+template<typename Stack> static void run_fill_virtual(void* p)  { bench_consume(fill_drain(*((Context<Stack>*)p)->base)); }
+template<typename Stack> static void run_fill_any(void* p)      { bench_consume(fill_drain(*((Context<Stack>*)p)->any)); }
+template<typename Stack> static void run_shallow_static(void* p)  { bench_consume(shallow(*((Context<Stack>*)p)->stack)); }
+template<typename Stack> static void run_shallow_virtual(void* p) { bench_consume(shallow(*((Context<Stack>*)p)->base)); }
+template<typename Stack> static void run_shallow_any(void* p)     { bench_consume(shallow(*((Context<Stack>*)p)->any)); }
+
+template<typename Stack>
+static void bench_stack(const std::string& name, int runs) {
+    static Context<Stack> ctx;
+
+    std::string names[] = {
+        name + "/fill_drain/static", name + "/fill_drain/virtual", name + "/fill_drain/any",
+        name + "/shallow/static",    name + "/shallow/virtual",    name + "/shallow/any",
+    };
+    BenchCase cases[] = {
+        { names[0].c_str(), 1, runs, 2 * N,       &ctx, setup<Stack>, run_fill_static<Stack>,     teardown<Stack> },
+        { names[1].c_str(), 1, runs, 2 * N,       &ctx, setup<Stack>, run_fill_virtual<Stack>,    teardown<Stack> },
+        { names[2].c_str(), 1, runs, 2 * N,       &ctx, setup<Stack>, run_fill_any<Stack>,        teardown<Stack> },
+        { names[3].c_str(), 1, runs, SHALLOW_OPS, &ctx, setup<Stack>, run_shallow_static<Stack>,  teardown<Stack> },
+        { names[4].c_str(), 1, runs, SHALLOW_OPS, &ctx, setup<Stack>, run_shallow_virtual<Stack>, teardown<Stack> },
+        { names[5].c_str(), 1, runs, SHALLOW_OPS, &ctx, setup<Stack>, run_shallow_any<Stack>,     teardown<Stack> },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+
+    bench_print_header("Stack dispatch: static vs virtual vs type-erased");
+    bench_stack<ArrayStack<int>>("array_stack", runs);
+    bench_stack<LinkedStack<int>>("linked_stack", runs);
+    bench_stack<SegmentedStack<int>>("segmented_stack", runs);
+    return 0;
+}
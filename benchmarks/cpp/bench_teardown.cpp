@@ -0,0 +1,105 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include "bench_harness.h"
+#include "slab_allocator.hpp"
+#include "single_linked_list.hpp"
+#include "double_linked_list.hpp"
+#include "linked_stack.hpp"
+
+/*
+대용량 컨테이너 생성/해제 스트레스 벤치마크:
+- 1,000만 개 요소 삽입 (build)
+- 소멸자로 전체 해제 (destroy): 노드 수와 무관하게 재귀 없이 끝나야 함
+- clear()로 비우기 (clear): SlabAllocator는 청크 단위로 O(1) 일괄 반환
+- 노드마다 new/delete 하는 std::allocator와 SlabAllocator 비교
+*/
+
+#define N 10000000
+#define DEFAULT_RUNS 3   // 실행 한 번이 수백 ms이므로 기본 측정 횟수를 줄임
+
+template<typename Container>
+struct Context {
+    std::unique_ptr<Container> container;
+};
+
+template<typename Container>
+static void fill(Container& container) {
+    for (int i = 0; i < N; i++) {
+        if constexpr (std::is_base_of_v<IStack<int>, Container>) {
+            container.push(i);
+        } else {
+            container.push_back(i);
+        }
+    }
+}
+
+template<typename Container>
+static void setup_empty(void* p) {
+    Context<Container>* ctx = (Context<Container>*)p;
+    ctx->container = std::make_unique<Container>();
+}
+
+template<typename Container>
+static void setup_filled(void* p) {
+    Context<Container>* ctx = (Context<Container>*)p;
+    ctx->container = std::make_unique<Container>();
+    fill(*ctx->container);
+}
+
+template<typename Container>
+static void teardown(void* p) {
+    Context<Container>* ctx = (Context<Container>*)p;
+    ctx->container.reset();
+}
+
+template<typename Container>
+static void run_build(void* p) {
+    Context<Container>* ctx = (Context<Container>*)p;
+    fill(*ctx->container);
+    bench_consume(ctx->container->size());
+}
+
+template<typename Container>
+static void run_destroy(void* p) {
+    Context<Container>* ctx = (Context<Container>*)p;
+    ctx->container.reset();
+}
+
+template<typename Container>
+static void run_clear(void* p) {
+    Context<Container>* ctx = (Context<Container>*)p;
+    ctx->container->clear();
+    bench_consume(ctx->container->size());
+}
+
+template<typename Container>
+static void bench_container(const std::string& name, int runs) {
+    static Context<Container> ctx;
+    std::string build_name = name + "/build";
+    std::string destroy_name = name + "/destroy";
+    std::string clear_name = name + "/clear";
+
+    BenchCase cases[] = {
+        { build_name.c_str(),   1, runs, N, &ctx, setup_empty<Container>,  run_build<Container>,   teardown<Container> },
+        { destroy_name.c_str(), 1, runs, N, &ctx, setup_filled<Container>, run_destroy<Container>, teardown<Container> },
+        { clear_name.c_str(),   1, runs, N, &ctx, setup_filled<Container>, run_clear<Container>,   teardown<Container> },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bench_run(&cases[i]);
+    }
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+
+    bench_print_header("Container Teardown Stress (N = 10000000)");
+    bench_container<SingleLinkedList<int>>("single_list/std_allocator", runs);
+    bench_container<SingleLinkedList<int, SlabAllocator<int>>>("single_list/slab", runs);
+    bench_container<DoubleLinkedList<int>>("double_list/std_allocator", runs);
+    bench_container<DoubleLinkedList<int, SlabAllocator<int>>>("double_list/slab", runs);
+    bench_container<LinkedStack<int>>("linked_stack/std_allocator", runs);
+    bench_container<LinkedStack<int, SlabAllocator<int>>>("linked_stack/slab", runs);
+    return 0;
+}
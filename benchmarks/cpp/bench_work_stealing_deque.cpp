@@ -0,0 +1,295 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench_harness.h"
+#include "work_stealing_deque.hpp"
+
+/*
+작업 훔치기 덱 벤치마크:
+- owner_push_pop: 스레드 하나가 TOTAL개를 push 한 뒤 모두 pop (동기화 비용만 측정)
+- steal_heavy: owner가 TOTAL개를 push 하는 동안 thief들이 위쪽에서 계속 훔쳐감
+- fork_join: 배열 구간 합을 재귀적으로 반씩 나누는 작업 (GRAIN 이하가 되면 직접 계산)
+  작업 스레드마다 덱을 두고 비면 다른 덱에서 훔치는 방식과,
+  모든 스레드가 뮤텍스로 보호된 std::deque 하나를 공유하는 방식 비교
+- 스레드 수는 1, 2, 4, ... 최대 max(코어 수, 4)
+*/
+
+#define TOTAL (1 << 20)
+#define FORK_JOIN_SIZE (1 << 22)    // fork_join 배열 크기
+#define GRAIN 1024                  // fork_join에서 더 나누지 않는 구간 크기
+#define DEFAULT_RUNS 7
+
+// 비교 대상: 양쪽 끝을 뮤텍스 하나로 보호하는 std::deque
+template<typename T>
+class MutexDeque {
+private:
+    std::mutex mutex_;
+    std::deque<T> deque_;
+
+public:
+    explicit MutexDeque(size_t = 0) {}
+
+    void push(T value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        deque_.push_back(value);
+    }
+
+    bool try_pop(T& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (deque_.empty()) {
+            return false;
+        }
+        value = deque_.back();
+        deque_.pop_back();
+        return true;
+    }
+
+    bool try_steal(T& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (deque_.empty()) {
+            return false;
+        }
+        value = deque_.front();
+        deque_.pop_front();
+        return true;
+    }
+};
+
+// 상대 스레드를 기다리는 동안 잠시 스핀 후 양보
+static inline void backoff(int& spins) {
+    if (++spins > 64) {
+        std::this_thread::yield();
+        spins = 0;
+    }
+}
+
+/* ---------------- owner_push_pop / steal_heavy ---------------- */
+
+template<typename Deque>
+struct Context {
+    Deque* deque;
+    int thieves;
+};
+
+template<typename Deque>
+static void setup(void* p) {
+    Context<Deque>* ctx = (Context<Deque>*)p;
+    ctx->deque = new Deque(1024);
+}
+
+template<typename Deque>
+static void teardown(void* p) {
+    Context<Deque>* ctx = (Context<Deque>*)p;
+    delete ctx->deque;
+    ctx->deque = nullptr;
+}
+
+template<typename Deque>
+static void run_owner_push_pop(void* p) {
+    Context<Deque>* ctx = (Context<Deque>*)p;
+    uint64_t sum = 0;
+    int value;
+    for (int i = 0; i < TOTAL; i++) {
+        ctx->deque->push(i);
+    }
+    while (ctx->deque->try_pop(value)) {
+        sum += (uint64_t)value;
+    }
+    bench_consume(sum);
+}
+
+template<typename Deque>
+static void run_steal_heavy(void* p) {
+    Context<Deque>* ctx = (Context<Deque>*)p;
+    std::atomic<int> taken(0);
+    std::vector<uint64_t> sums(ctx->thieves * 8, 0);    // 스레드별 합계 (캐시 라인 분리)
+    std::vector<std::thread> thieves;
+
+    for (int t = 0; t < ctx->thieves; t++) {
+        thieves.emplace_back([ctx, t, &taken, &sums] {
+            uint64_t sum = 0;
+            int spins = 0;
+            int value;
+            while (taken.load(std::memory_order_relaxed) < TOTAL) {
+                if (ctx->deque->try_steal(value)) {
+                    sum += (uint64_t)value;
+                    taken.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    backoff(spins);
+                }
+            }
+            sums[t * 8] = sum;
+        });
+    }
+
+    // owner는 모두 push 한 뒤 남은 것을 함께 비움
+    uint64_t sum = 0;
+    int value;
+    for (int i = 0; i < TOTAL; i++) {
+        ctx->deque->push(i);
+    }
+    while (taken.load(std::memory_order_relaxed) < TOTAL) {
+        if (ctx->deque->try_pop(value)) {
+            sum += (uint64_t)value;
+            taken.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    for (uint64_t s : sums) {
+        sum += s;
+    }
+    bench_consume(sum);
+}
+
+/* ---------------- fork_join ---------------- */
+
+// 분할 작업 (원자 변수로 담을 수 있도록 8바이트)
+struct Range {
+    uint32_t begin;
+    uint32_t end;
+};
+
+static std::vector<uint32_t> g_values;
+
+// 작업 스레드마다 덱 하나 (Shared 이면 모든 스레드가 0번 덱을 공유)
+template<typename Deque, bool Shared>
+struct ForkJoinContext {
+    std::vector<std::unique_ptr<Deque>> deques;
+    int workers;
+};
+
+template<typename Deque, bool Shared>
+static void setup_fork_join(void* p) {
+    ForkJoinContext<Deque, Shared>* ctx = (ForkJoinContext<Deque, Shared>*)p;
+    int count = Shared ? 1 : ctx->workers;
+    ctx->deques.clear();
+    for (int i = 0; i < count; i++) {
+        ctx->deques.push_back(std::make_unique<Deque>(1024));
+    }
+}
+
+template<typename Deque, bool Shared>
+static void teardown_fork_join(void* p) {
+    ForkJoinContext<Deque, Shared>* ctx = (ForkJoinContext<Deque, Shared>*)p;
+    ctx->deques.clear();
+}
+
+template<typename Deque, bool Shared>
+static void run_fork_join(void* p) {
+    ForkJoinContext<Deque, Shared>* ctx = (ForkJoinContext<Deque, Shared>*)p;
+    std::atomic<uint64_t> remaining(FORK_JOIN_SIZE);   // 아직 합산하지 않은 요소 수
+    std::atomic<uint64_t> total(0);
+
+    ctx->deques[0]->push(Range{ 0, FORK_JOIN_SIZE });
+
+    auto worker = [ctx, &remaining, &total](int id) {
+        Deque& own = *ctx->deques[Shared ? 0 : id];
+        BenchRng rng;
+        bench_rng_init(&rng, BENCH_SEED + (uint64_t)id);
+        uint64_t sum = 0;
+        int spins = 0;
+        Range range;
+
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            bool found = own.try_pop(range);
+            if (!found && !Shared && ctx->workers > 1) {
+                int victim = (int)bench_rng_range(&rng, (uint32_t)ctx->workers);
+                found = victim != id && ctx->deques[victim]->try_steal(range);
+            }
+            if (!found) {
+                backoff(spins);
+                continue;
+            }
+
+            // 큰 구간은 오른쪽 절반을 덱에 넣고 왼쪽 절반을 계속 처리 (재귀 분할)
+            while (range.end - range.begin > GRAIN) {
+                uint32_t middle = range.begin + (range.end - range.begin) / 2;
+                own.push(Range{ middle, range.end });
+                range.end = middle;
+            }
+            uint64_t local = 0;
+            for (uint32_t i = range.begin; i < range.end; i++) {
+                local += g_values[i];
+            }
+            sum += local;
+            remaining.fetch_sub(range.end - range.begin, std::memory_order_release);
+        }
+        total.fetch_add(sum, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> threads;
+    for (int id = 1; id < ctx->workers; id++) {
+        threads.emplace_back(worker, id);
+    }
+    worker(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    bench_consume(total.load());
+}
+
+/* ---------------- 실행 ---------------- */
+
+template<typename Deque>
+static void bench_single(const std::string& name, int runs) {
+    static Context<Deque> ctx;
+    std::string case_name = name + "/owner_push_pop";
+    BenchCase bench = { case_name.c_str(), 1, runs, 2 * TOTAL, &ctx, setup<Deque>, run_owner_push_pop<Deque>, teardown<Deque> };
+    bench_run(&bench);
+}
+
+template<typename Deque>
+static void bench_steal(const std::string& name, int thieves, int runs) {
+    static Context<Deque> ctx;
+    ctx.thieves = thieves;
+    std::string case_name = name + "/steal_heavy_t" + std::to_string(thieves);
+    BenchCase bench = { case_name.c_str(), 1, runs, TOTAL, &ctx, setup<Deque>, run_steal_heavy<Deque>, teardown<Deque> };
+    bench_run(&bench);
+}
+
+template<typename Deque, bool Shared>
+static void bench_fork_join(const std::string& name, int workers, int runs) {
+    static ForkJoinContext<Deque, Shared> ctx;
+    ctx.workers = workers;
+    std::string case_name = name + "/fork_join_w" + std::to_string(workers);
+    BenchCase bench = { case_name.c_str(), 1, runs, FORK_JOIN_SIZE, &ctx,
+                        setup_fork_join<Deque, Shared>, run_fork_join<Deque, Shared>, teardown_fork_join<Deque, Shared> };
+    bench_run(&bench);
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? bench_runs_from_args(argc, argv) : DEFAULT_RUNS;
+    int max_threads = std::max(4, (int)std::thread::hardware_concurrency());
+
+    g_values.resize(FORK_JOIN_SIZE);
+    BenchRng rng;
+    bench_rng_init(&rng, BENCH_SEED);
+    for (uint32_t& value : g_values) {
+        value = bench_rng_range(&rng, 1000);
+    }
+
+    std::string title = "Work-stealing deque (" + std::to_string(std::thread::hardware_concurrency()) + " cores)";
+    bench_print_header(title.c_str());
+
+    bench_single<MutexDeque<int>>("mutex_deque", runs);
+    bench_single<WorkStealingDeque<int>>("work_stealing_deque", runs);
+
+    for (int thieves = 1; thieves <= max_threads; thieves *= 2) {
+        bench_steal<MutexDeque<int>>("mutex_deque", thieves, runs);
+        bench_steal<WorkStealingDeque<int>>("work_stealing_deque", thieves, runs);
+    }
+
+    for (int workers = 1; workers <= max_threads; workers *= 2) {
+        bench_fork_join<MutexDeque<Range>, true>("shared_mutex_deque", workers, runs);
+        bench_fork_join<WorkStealingDeque<Range>, false>("work_stealing_deque", workers, runs);
+    }
+    return 0;
+}
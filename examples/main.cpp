@@ -12,6 +12,9 @@
 
 Timer 클래스를 사용한 연산 시간 측정
 각 리스트 타입별 성능 비교
+노드 할당자별 성능 비교 (std::allocator / std::pmr / SlabAllocator)
+순회/인덱스 접근 비교 (노드형 리스트 vs 언롤드/인덱스 기반 리스트)
+큐/덱 성능 비교 (ArrayQueue, LinkedQueue, Deque vs std::queue, std::deque)
 
 
 실제 활용 예제
@@ -19,6 +22,7 @@ Timer 클래스를 사용한 연산 시간 측정
 다항식 계산: 단일 연결 리스트 활용
 명령어 히스토리: 원형 연결 리스트 활용
 양방향 데이터 탐색: 이중 연결 리스트 활용
+작업 목록 병합: 이동 삽입과 splice로 복사 없이 리스트 합치기
 
 
 주요 특징
@@ -29,11 +33,23 @@ Timer 클래스를 사용한 연산 시간 측정
 */
 
 #include <iostream>
+#include <algorithm>
 #include <chrono>
+#include <deque>
+#include <queue>
+#include <string>
 #include <vector>
+#include <memory_resource>
+#include "container_traits.hpp"
+#include "slab_allocator.hpp"
 #include "single_linked_list.hpp"
 #include "double_linked_list.hpp"
 #include "circular_linked_list.hpp"
+#include "unrolled_linked_list.hpp"
+#include "vector_double_linked_list.hpp"
+#include "array_queue.hpp"
+#include "linked_queue.hpp"
+#include "deque.hpp"
 
 /**
  * @brief 성능 측정을 위한 타이머 클래스
@@ -56,25 +72,192 @@ public:
 /**
  * @brief 리스트 성능 테스트 함수
  * 각각의 리스트에 대해 동일한 작업을 수행하고 시간을 측정
+ * 구체 타입으로 호출하므로 (리스트 클래스가 final) 가상 호출 없이 인라인됨
+ * @param args 리스트 생성자에 전달할 인자 (할당자 등)
  */
-template<typename List>
-void performanceTest(const std::string& list_name) {
+template<typename List, typename... Args>
+void performanceTest(const std::string& list_name, Args&&... args) {
+    static_assert(is_linked_list_v<List>, "List must provide the ILinkedList operations");
     std::cout << "\n=== " << list_name << " 성능 테스트 ===\n";
+    Timer timer;
+    {
+        List list(std::forward<Args>(args)...);
+
+        // 앞쪽 삽입 테스트
+        timer = Timer();
+        for (int i = 0; i < 10000; ++i) {
+            list.push_front(i);
+        }
+        std::cout << "10000개 앞쪽 삽입 시간: " << timer.elapsed() << "ms\n";
+
+        // 뒤쪽 삽입 테스트
+        timer = Timer();
+        for (int i = 0; i < 10000; ++i) {
+            list.push_back(i);
+        }
+        std::cout << "10000개 뒤쪽 삽입 시간: " << timer.elapsed() << "ms\n";
+
+        // 앞쪽 삭제 테스트 (노드 반환 비용)
+        timer = Timer();
+        for (int i = 0; i < 10000; ++i) {
+            list.pop_front();
+        }
+        std::cout << "10000개 앞쪽 삭제 시간: " << timer.elapsed() << "ms\n";
+
+        timer = Timer();
+    }  // 남은 노드는 리스트 소멸 시 해제
+    std::cout << "남은 10000개 노드 해제 시간: " << timer.elapsed() << "ms\n";
+}
+
+/**
+ * @brief 노드 할당 방식 비교
+ * 노드마다 new/delete 하는 기본 할당자와
+ * std::pmr 메모리 리소스, 슬랩 풀 할당자를 같은 작업으로 비교
+ */
+template<template<typename, typename> class List>
+void allocatorComparison(const std::string& list_name) {
+    performanceTest<List<int, std::allocator<int>>>(list_name + " (std::allocator)");
+
+    {
+        std::pmr::unsynchronized_pool_resource pool;
+        performanceTest<List<int, std::pmr::polymorphic_allocator<int>>>(
+            list_name + " (pmr::unsynchronized_pool_resource)", &pool);
+    }
+
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        performanceTest<List<int, std::pmr::polymorphic_allocator<int>>>(
+            list_name + " (pmr::monotonic_buffer_resource)", &arena);
+    }
+
+    performanceTest<List<int, SlabAllocator<int>>>(list_name + " (SlabAllocator)");
+}
+
+/**
+ * @brief 순회 및 인덱스 접근 성능 테스트
+ * 포인터 추적 비용이 지배적인 전체 순회와 at() 탐색을 측정
+ */
+template<typename List>
+void traversalTest(const std::string& list_name) {
+    const int COUNT = 100000;
+    const int LOOKUPS = 1000;
+
     List list;
+    for (int i = 0; i < COUNT; ++i) {
+        list.push_back(i);
+    }
+
+    std::cout << "\n=== " << list_name << " 순회 테스트 ===\n";
+
+    // 반복자 전체 순회
     Timer timer;
+    long long sum = 0;
+    for (int value : list) {
+        sum += value;
+    }
+    std::cout << COUNT << "개 반복자 순회 시간: " << timer.elapsed() << "ms (합계 " << sum << ")\n";
+
+    // for_each 전체 순회
+    timer = Timer();
+    sum = 0;
+    list.for_each([&sum](const int& value) { sum += value; });
+    std::cout << COUNT << "개 for_each 순회 시간: " << timer.elapsed() << "ms (합계 " << sum << ")\n";
 
-    // 앞쪽 삽입 테스트
-    for (int i = 0; i < 10000; ++i) {
-        list.push_front(i);
+    // 고르게 분포한 위치의 at() 탐색
+    timer = Timer();
+    sum = 0;
+    for (int i = 0; i < LOOKUPS; ++i) {
+        sum += list.at(static_cast<size_t>(i) * (COUNT / LOOKUPS));
     }
-    std::cout << "10000개 앞쪽 삽입 시간: " << timer.elapsed() << "ms\n";
+    std::cout << LOOKUPS << "회 at() 탐색 시간: " << timer.elapsed() << "ms (합계 " << sum << ")\n";
+}
+
+/**
+ * @brief 큐 성능 테스트 함수
+ * push/pop/front만 사용하므로 std::queue에도 그대로 적용 가능
+ * - 채운 뒤 비우기: 확장(재할당/블록 할당) 비용 포함
+ * - 일정 크기를 유지하며 넣고 빼기: 정상 상태의 링 버퍼/노드 재사용 비용
+ */
+template<typename Queue>
+void queuePerformanceTest(const std::string& queue_name) {
+    const int COUNT = 100000;
+    const int WINDOW = 1000;
+
+    std::cout << "\n=== " << queue_name << " 성능 테스트 ===\n";
+    Queue queue;
+    long long sum = 0;
+
+    // 채운 뒤 모두 꺼내기
+    Timer timer;
+    for (int i = 0; i < COUNT; ++i) {
+        queue.push(i);
+    }
+    std::cout << COUNT << "개 삽입 시간: " << timer.elapsed() << "ms\n";
 
-    // 뒤쪽 삽입 테스트
     timer = Timer();
-    for (int i = 0; i < 10000; ++i) {
-        list.push_back(i);
+    while (!queue.empty()) {
+        sum += queue.front();
+        queue.pop();
+    }
+    std::cout << COUNT << "개 삭제 시간: " << timer.elapsed() << "ms (합계 " << sum << ")\n";
+
+    // WINDOW개를 유지하며 하나씩 넣고 빼기
+    for (int i = 0; i < WINDOW; ++i) {
+        queue.push(i);
     }
-    std::cout << "10000개 뒤쪽 삽입 시간: " << timer.elapsed() << "ms\n";
+    timer = Timer();
+    sum = 0;
+    for (int i = 0; i < COUNT; ++i) {
+        queue.push(i);
+        sum += queue.front();
+        queue.pop();
+    }
+    std::cout << COUNT << "회 삽입/삭제 반복 시간: " << timer.elapsed() << "ms (합계 " << sum << ")\n";
+}
+
+/**
+ * @brief 덱 양방향 성능 테스트 함수
+ * 양쪽 끝 삽입/삭제와 인덱스 접근을 std::deque와 같은 이름으로 측정
+ */
+template<typename DequeType>
+void dequePerformanceTest(const std::string& deque_name) {
+    const int COUNT = 100000;
+
+    std::cout << "\n=== " << deque_name << " 양방향 성능 테스트 ===\n";
+    DequeType deque;
+
+    // 앞쪽/뒤쪽 번갈아 삽입
+    Timer timer;
+    for (int i = 0; i < COUNT; ++i) {
+        if (i % 2 == 0) {
+            deque.push_back(i);
+        } else {
+            deque.push_front(i);
+        }
+    }
+    std::cout << COUNT << "개 양쪽 삽입 시간: " << timer.elapsed() << "ms\n";
+
+    // 인덱스 순차 접근
+    timer = Timer();
+    long long sum = 0;
+    for (size_t i = 0; i < deque.size(); ++i) {
+        sum += deque[i];
+    }
+    std::cout << COUNT << "개 인덱스 접근 시간: " << timer.elapsed() << "ms (합계 " << sum << ")\n";
+
+    // 앞쪽/뒤쪽 번갈아 삭제
+    timer = Timer();
+    sum = 0;
+    for (int i = 0; i < COUNT; ++i) {
+        if (i % 2 == 0) {
+            sum += deque.back();
+            deque.pop_back();
+        } else {
+            sum += deque.front();
+            deque.pop_front();
+        }
+    }
+    std::cout << COUNT << "개 양쪽 삭제 시간: " << timer.elapsed() << "ms (합계 " << sum << ")\n";
 }
 
 /**
@@ -95,8 +278,9 @@ void polynomialExample() {
     int result = 0;
     int power = 1;
 
-    for (size_t i = 0; i < coefficients.size(); ++i) {
-        result += coefficients.at(i) * power;
+    // 반복자로 순회 (at(i) 반복은 매번 head부터 탐색하므로 O(n^2))
+    for (int coefficient : coefficients) {
+        result += coefficient * power;
         power *= x;
     }
 
@@ -147,25 +331,75 @@ void bidirectionalSearchExample() {
     }
 
     // 앞에서부터 5보다 큰 첫 번째 짝수 찾기
-    for (size_t i = 0; i < numbers.size(); ++i) {
-        int num = numbers.at(i);
-        if (num > 5 && num % 2 == 0) {
-            std::cout << "5보다 큰 첫 번째 짝수: " << num << "\n";
-            break;
-        }
+    auto first = std::find_if(numbers.begin(), numbers.end(),
+        [](int num) { return num > 5 && num % 2 == 0; });
+    if (first != numbers.end()) {
+        std::cout << "5보다 큰 첫 번째 짝수: " << *first << "\n";
+    }
+
+    // 뒤에서부터 5보다 작은 첫 번째 홀수 찾기 (역방향 반복자)
+    auto last = std::find_if(numbers.rbegin(), numbers.rend(),
+        [](int num) { return num < 5 && num % 2 == 1; });
+    if (last != numbers.rend()) {
+        std::cout << "뒤에서부터 5보다 작은 첫 번째 홀수: " << *last << "\n";
     }
 }
 
+/**
+ * @brief 실제 활용 예시 - 작업 목록 병합
+ * 문자열을 이동/제자리 생성으로 넣고, 두 목록을 splice로 노드째 합침
+ */
+void taskMergeExample() {
+    std::cout << "\n=== 작업 목록 병합 예제 ===\n";
+    DoubleLinkedList<std::string> today;
+    DoubleLinkedList<std::string> urgent;
+
+    // 임시 문자열은 복사 없이 이동되고, emplace는 노드 안에서 바로 생성
+    today.push_back(std::string("코드 리뷰"));
+    today.emplace_back("문서 작성");
+    today.append_range(std::vector<std::string>{ "회의 준비", "배포 확인" });
+
+    urgent.emplace_back("장애 대응");
+    urgent.emplace_back("보안 패치");
+
+    // 긴급 작업을 맨 앞에 연결 (노드 재연결만 하므로 O(1))
+    today.splice(today.begin(), urgent);
+    std::cout << "병합된 작업 목록 (긴급 목록 크기: " << urgent.size() << "):\n";
+    today.print();
+
+    // 앞에서부터 작업을 꺼내 처리 (문자열을 이동으로 꺼냄)
+    std::string next_task = today.pop_front_value();
+    std::cout << "처리할 작업: " << next_task << "\n";
+}
+
 int main() {
-    // 성능 테스트
-    performanceTest<SingleLinkedList<int>>("단일 연결 리스트");
-    performanceTest<DoubleLinkedList<int>>("이중 연결 리스트");
-    performanceTest<CircularLinkedList<int>>("원형 연결 리스트");
+    // 성능 테스트 (노드 할당자별 비교)
+    allocatorComparison<SingleLinkedList>("단일 연결 리스트");
+    allocatorComparison<DoubleLinkedList>("이중 연결 리스트");
+    allocatorComparison<CircularLinkedList>("원형 연결 리스트");
+    allocatorComparison<VectorDoubleLinkedList>("인덱스 기반 이중 연결 리스트");
+    performanceTest<UnrolledLinkedList<int>>("언롤드 연결 리스트");
+
+    // 순회 성능 비교 (블록당 여러 요소를 저장하면 방문 노드 수가 줄어듦)
+    traversalTest<SingleLinkedList<int>>("단일 연결 리스트");
+    traversalTest<DoubleLinkedList<int>>("이중 연결 리스트");
+    traversalTest<CircularLinkedList<int>>("원형 연결 리스트");
+    traversalTest<VectorDoubleLinkedList<int>>("인덱스 기반 이중 연결 리스트");
+    traversalTest<UnrolledLinkedList<int>>("언롤드 연결 리스트");
+
+    // 큐/덱 성능 비교 (표준 컨테이너와 같은 작업으로 비교)
+    queuePerformanceTest<ArrayQueue<int>>("배열 기반 원형 큐");
+    queuePerformanceTest<LinkedQueue<int>>("연결 리스트 기반 큐 (SlabAllocator)");
+    queuePerformanceTest<Deque<int>>("블록 기반 덱");
+    queuePerformanceTest<std::queue<int>>("std::queue");
+    dequePerformanceTest<Deque<int>>("블록 기반 덱");
+    dequePerformanceTest<std::deque<int>>("std::deque");
 
     // 실제 활용 예제
     polynomialExample();        // 다항식 계산 예제
     historyExample();          // 히스토리 관리 예제
     bidirectionalSearchExample(); // 양방향 탐색 예제
+    taskMergeExample();        // 작업 목록 병합 예제
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef ADJACENCY_LIST_H
+#define ADJACENCY_LIST_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 간선 노드 구조체
+typedef struct ListGraphNode {
+    int vertex;         // 도착 정점
+    int weight;         // 간선의 가중치
+    struct ListGraphNode* next;  // 다음 간선
+} ListGraphNode;
+
+// 인접 리스트 기반 그래프
+typedef struct {
+    int num_vertices;           // 정점의 개수
+    ListGraphNode** adj_list;           // 인접 리스트 배열
+} ListGraph;
+
+// 그래프 생성 및 해제
+ListGraph* lgraph_create(int vertices);
+void lgraph_destroy(ListGraph* graph);
+
+// 간선 조작
+bool lgraph_add_edge(ListGraph* graph, int src, int dest, int weight, bool directed);
+bool lgraph_remove_edge(ListGraph* graph, int src, int dest, bool directed);
+
+// 조회
+bool lgraph_has_edge(const ListGraph* graph, int src, int dest);
+int lgraph_degree(const ListGraph* graph, int vertex);
+
+// 출력
+void lgraph_print(const ListGraph* graph);
+void lgraph_info(const ListGraph* graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADJACENCY_LIST_H
@@ -0,0 +1,39 @@
+#ifndef ADJACENCY_MATRIX_H
+#define ADJACENCY_MATRIX_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAX_VERTICES 100
+#define INF 999999  // 무한대 값 (연결되지 않은 간선)
+
+// 인접 행렬 기반 그래프
+typedef struct {
+    int num_vertices;                         // 정점의 개수
+    int matrix[MAX_VERTICES][MAX_VERTICES];   // 인접 행렬
+} MatrixGraph;
+
+// 그래프 생성 및 해제
+MatrixGraph* mgraph_create(int vertices);
+void mgraph_destroy(MatrixGraph* graph);
+
+// 간선 조작
+bool mgraph_add_edge(MatrixGraph* graph, int src, int dest, int weight, bool directed);
+bool mgraph_remove_edge(MatrixGraph* graph, int src, int dest, bool directed);
+
+// 조회
+bool mgraph_has_edge(const MatrixGraph* graph, int src, int dest);
+int mgraph_degree(const MatrixGraph* graph, int vertex);
+
+// 출력
+void mgraph_print(const MatrixGraph* graph);
+void mgraph_info(const MatrixGraph* graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ADJACENCY_MATRIX_H
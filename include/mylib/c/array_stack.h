@@ -0,0 +1,89 @@
+#ifndef ARRAY_STACK_H
+#define ARRAY_STACK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int ArrayStackElement;
+
+/* 확장 정책: 가득 찼을 때 새 용량을 정하는 방식 */
+typedef enum {
+    ASTACK_GROWTH_GEOMETRIC,     // 2배 확장 (기본값)
+    ASTACK_GROWTH_HALF           // 1.5배 확장 (재할당은 늘지만 메모리 여유분이 적음)
+} ArrayStackGrowthPolicy;
+
+/* 축소 정책: pop/clear 시 용량을 줄이는 방식 */
+typedef enum {
+    ASTACK_SHRINK_QUARTER,       // 25% 미만이면 절반으로 축소, clear 시 초기 용량으로 (기본값)
+    ASTACK_SHRINK_NEVER,         // 축소하지 않음 (shrink_to_fit 으로만 반환)
+    ASTACK_SHRINK_HYSTERESIS     // 12.5% 미만이면 절반으로 축소 (확장/축소 경계 사이에 넓은 간격)
+} ArrayStackShrinkPolicy;
+
+/* 스택 생성 옵션 */
+typedef struct {
+    ArrayStackGrowthPolicy growth;   // 확장 정책
+    ArrayStackShrinkPolicy shrink;   // 축소 정책
+    size_t initial_capacity;    // 초기 용량 (0이면 기본값)
+} ArrayStackPolicy;
+
+/* 재할당 통계 (정책 튜닝용) */
+typedef struct {
+    size_t grow_count;          // 확장 재할당 횟수
+    size_t shrink_count;        // 축소 재할당 횟수
+    size_t elements_copied;     // 재할당 시 옮긴 요소 수 (누적)
+} ArrayStackResizeStats;
+
+// 스택 구조체 정의
+typedef struct {
+    ArrayStackElement* elements;  // 요소를 저장할 동적 배열
+    size_t size;           // 현재 저장된 요소의 수
+    size_t capacity;       // 현재 할당된 배열의 크기
+    ArrayStackPolicy policy;    // 확장/축소 정책
+    ArrayStackResizeStats stats; // 재할당 통계
+} ArrayStack;
+
+/* 오류 처리를 위한 열거형 정의
+ * - 스택 연산의 다양한 결과 상태를 표현
+ */
+typedef enum {
+    ASTACK_OK,
+    ASTACK_EMPTY,
+    ASTACK_FULL,
+    ASTACK_MEMORY_ERROR
+} ArrayStackResult;
+
+// 스택 생성 및 해제
+ArrayStack* astack_create(void);
+ArrayStack* astack_create_with_policy(const ArrayStackPolicy* policy);
+void astack_destroy(ArrayStack* stack);
+
+// 스택 상태 확인
+bool astack_is_empty(const ArrayStack* stack);
+bool astack_is_full(const ArrayStack* stack);
+size_t astack_size(const ArrayStack* stack);
+size_t astack_capacity(const ArrayStack* stack);
+
+// 데이터 삽입, 삭제 및 조회
+ArrayStackResult astack_push(ArrayStack* stack, ArrayStackElement value);
+ArrayStackResult astack_pop(ArrayStack* stack, ArrayStackElement* value);
+ArrayStackResult astack_peek(const ArrayStack* stack, ArrayStackElement* value);
+void astack_clear(ArrayStack* stack);
+
+// 용량 관리
+ArrayStackResult astack_reserve(ArrayStack* stack, size_t capacity);
+ArrayStackResult astack_shrink_to_fit(ArrayStack* stack);
+void astack_resize_stats(const ArrayStack* stack, ArrayStackResizeStats* stats);
+
+// 출력
+void astack_print(const ArrayStack* stack);
+void astack_status(const ArrayStack* stack);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARRAY_STACK_H
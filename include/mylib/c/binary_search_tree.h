@@ -0,0 +1,99 @@
+#ifndef BINARY_SEARCH_TREE_H
+#define BINARY_SEARCH_TREE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "node_pool.h"
+#include "tree_order.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int BstKey;
+
+// 노드 구조체 정의
+typedef struct BstNode {
+    BstKey data;             // 데이터
+    size_t size;               // 이 노드를 루트로 하는 서브트리의 노드 수 (순위 계산용)
+    struct BstNode* left;     // 왼쪽 자식 노드
+    struct BstNode* right;    // 오른쪽 자식 노드
+} BstNode;
+
+// 이진 탐색 트리 구조체 정의
+typedef struct {
+    BstNode* root;    // 루트 노드
+    size_t size;       // 전체 노드의 수
+    NodePool pool;     // 노드 할당자 (생성 시 선택한 방식)
+} BSTree;
+
+/* 오류 처리를 위한 열거형 정의 */
+typedef enum {
+    BST_OK,
+    BST_MEMORY_ERROR,
+    BST_EMPTY,
+    BST_NOT_FOUND,
+    BST_DUPLICATE,         // 이미 있는 값을 삽입
+    BST_OUT_OF_RANGE,      // 순위/백분위가 범위를 벗어남
+    BST_INVALID_ARGUMENT   // 병합 조건 위반 (키 순서 또는 노드 풀이 맞지 않음)
+} BstResult;
+
+/* 순회 커서
+ * - bst_cursor_next 를 부를 때마다 다음 노드 하나만 계산 (중간에 멈춰도 됨)
+ * - 재귀 대신 명시적 스택(깊이 우선) 또는 큐(레벨 순서)를 사용, 필요할 때만 힙에 할당
+ * - 순회 도중 트리를 수정하면 안 됨
+ */
+typedef struct {
+    const BstNode** items;     // 스택 또는 큐 (처음 넣을 때 할당)
+    size_t count;               // 스택 크기 / 큐의 끝
+    size_t head;                // 큐의 앞 (레벨 순서)
+    size_t capacity;
+    const BstNode* current;    // 다음에 방문하거나 내려갈 노드
+    const BstNode* last;       // 후위 순회에서 마지막으로 방문한 노드
+    TraversalOrder order;
+    BstResult status;          // 메모리 부족으로 중단되면 BST_MEMORY_ERROR
+} BstCursor;
+
+// 트리 생성 및 해제
+BSTree* bst_create(void);
+BSTree* bst_create_ex(NodeAllocMode mode, size_t nodes_per_slab);
+void bst_destroy(BSTree* tree);
+void bst_clear(BSTree* tree);
+
+// 트리 상태 확인
+bool bst_is_empty(const BSTree* tree);
+size_t bst_size(const BSTree* tree);
+size_t bst_height(const BSTree* tree);
+
+// 데이터 삽입, 삭제 및 검색
+BstResult bst_insert(BSTree* tree, BstKey data);
+BstResult bst_delete(BSTree* tree, BstKey data);
+bool bst_search(const BSTree* tree, BstKey data);
+BstResult bst_find_min(const BSTree* tree, BstKey* value);
+BstResult bst_find_max(const BSTree* tree, BstKey* value);
+
+// 순서 통계 (모두 O(높이))
+size_t bst_rank(const BSTree* tree, BstKey data);
+BstResult bst_select(const BSTree* tree, size_t k, BstKey* value);
+BstResult bst_percentile(const BSTree* tree, double percent, BstKey* value);
+BstResult bst_lower_bound(const BSTree* tree, BstKey data, BstKey* value);
+BstResult bst_upper_bound(const BSTree* tree, BstKey data, BstKey* value);
+size_t bst_count_range(const BSTree* tree, BstKey low, BstKey high);
+
+// 순회 커서
+void bst_cursor_init(BstCursor* cursor, const BSTree* tree, TraversalOrder order);
+const BstNode* bst_cursor_next(BstCursor* cursor);
+void bst_cursor_destroy(BstCursor* cursor);
+
+// 출력
+void bst_print_sorted(const BSTree* tree);
+void bst_print(const BSTree* tree);
+
+// 노드 풀 통계 (살아있는 슬랩 수 등)
+void bst_pool_stats(const BSTree* tree, NodePoolStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BINARY_SEARCH_TREE_H
@@ -0,0 +1,115 @@
+#ifndef BINARY_TREE_H
+#define BINARY_TREE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "tree_order.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int BTreeData;
+
+// 노드 구조체 정의
+typedef struct BTreeNode {
+    BTreeData data;             // 데이터
+    struct BTreeNode* left;     // 왼쪽 자식 노드
+    struct BTreeNode* right;    // 오른쪽 자식 노드
+} BTreeNode;
+
+// 이진 트리 구조체 정의
+typedef struct {
+    BTreeNode* root;    // 루트 노드
+    size_t size;       // 전체 노드의 수
+} BinaryTree;
+
+/* 오류 처리를 위한 열거형 정의 */
+typedef enum {
+    BTREE_OK,
+    BTREE_MEMORY_ERROR,
+    BTREE_EMPTY
+} BTreeResult;
+
+// 트리 생성 및 해제
+BinaryTree* btree_create(void);
+void btree_destroy(BinaryTree* tree);
+
+// 트리 상태 확인
+bool btree_is_empty(const BinaryTree* tree);
+int btree_height(const BinaryTree* tree);
+size_t btree_size(const BinaryTree* tree);
+
+// 노드 삽입
+BTreeResult btree_insert_left(BinaryTree* tree, BTreeNode* parent, BTreeData data);
+BTreeResult btree_insert_right(BinaryTree* tree, BTreeNode* parent, BTreeData data);
+
+// 순회 및 출력
+void btree_preorder(const BinaryTree* tree);
+void btree_inorder(const BinaryTree* tree);
+void btree_postorder(const BinaryTree* tree);
+void btree_print(const BinaryTree* tree);
+
+/* 순회 커서
+ * - btree_cursor_next 를 부를 때마다 다음 노드 하나만 계산 (중간에 멈춰도 됨)
+ * - 재귀 대신 명시적 스택(깊이 우선) 또는 큐(레벨 순서)를 사용, 필요할 때만 힙에 할당
+ * - 순회 도중 트리를 수정하면 안 됨
+ */
+typedef struct {
+    const BTreeNode** items;     // 스택 또는 큐 (처음 넣을 때 할당)
+    size_t count;               // 스택 크기 / 큐의 끝
+    size_t head;                // 큐의 앞 (레벨 순서)
+    size_t capacity;
+    const BTreeNode* current;    // 다음에 방문하거나 내려갈 노드
+    const BTreeNode* last;       // 후위 순회에서 마지막으로 방문한 노드
+    TraversalOrder order;
+    BTreeResult status;          // 메모리 부족으로 중단되면 BTREE_MEMORY_ERROR
+} BTreeCursor;
+
+// 순회 커서
+void btree_cursor_init(BTreeCursor* cursor, const BinaryTree* tree, TraversalOrder order);
+const BTreeNode* btree_cursor_next(BTreeCursor* cursor);
+void btree_cursor_destroy(BTreeCursor* cursor);
+void btree_level_order(const BinaryTree* tree);
+
+/* 동결(freeze)된 읽기 전용 트리의 배열 배치 방식 */
+typedef enum {
+    FROZEN_LAYOUT_EYTZINGER,    // BFS 순서 (i의 자식은 2i, 2i+1)
+    FROZEN_LAYOUT_VEB           // van Emde Boas 순서 (위/아래 절반 높이의 서브트리를 재귀적으로 연속 배치)
+} FrozenLayout;
+
+#define FROZEN_MAX_HEIGHT 64
+
+/* 동결된 트리
+ * - 원래 트리의 중위 순서를 완전 이진 트리 모양의 암시적 배열에 다시 배치 (포인터 없음)
+ * - 원래 트리의 모양(전위/후위 순서)은 보존하지 않음
+ * - 원래 트리의 중위 순서가 정렬되어 있으면(ordered) 검색이 O(log n) 하강
+ */
+typedef struct {
+    BTreeData* keys;         // 캐시 라인(64바이트)에 정렬된 키 배열
+    void* storage;          // keys 를 담고 있는 할당 블록 (해제용)
+    size_t size;            // 실제 키 수
+    size_t slots;           // 배열 칸 수 (vEB는 완전 포화 트리로 채움)
+    int height;             // 배열 트리의 높이 (레벨 수)
+    FrozenLayout layout;    // 배치 방식
+    bool ordered;           // 중위 순서가 오름차순인지 (검색 방식 결정)
+    // vEB 탐색 표 (깊이 d 노드가 속한 아래 서브트리 정보)
+    size_t top_size[FROZEN_MAX_HEIGHT];     // 위 서브트리의 노드 수
+    size_t bottom_size[FROZEN_MAX_HEIGHT];  // 아래 서브트리의 노드 수
+    int top_depth[FROZEN_MAX_HEIGHT];       // 위 서브트리 루트의 깊이
+} FrozenTree;
+
+// 동결 및 해제
+FrozenTree* btree_freeze(const BinaryTree* tree, FrozenLayout layout);
+void frozen_destroy(FrozenTree* frozen);
+
+// 동결된 트리 검색 및 순회
+bool frozen_search(const FrozenTree* frozen, BTreeData data);
+void frozen_inorder(const FrozenTree* frozen, void (*visit)(BTreeData data, void* context), void* context);
+void frozen_print(const FrozenTree* frozen);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BINARY_TREE_H
@@ -0,0 +1,48 @@
+#ifndef CHAINING_HASH_TABLE_H
+#define CHAINING_HASH_TABLE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    char* key;
+    int value;
+} KeyValuePair;
+
+typedef struct ChainedHashNode {
+    KeyValuePair data;
+    struct ChainedHashNode* next;
+} ChainedHashNode;
+
+typedef struct {
+    ChainedHashNode** buckets;       // 버킷 배열
+    size_t size;         // 현재 저장된 원소 수
+    size_t capacity;     // 해시 테이블 크기
+} ChainedHashTable;
+
+// 문자열 해시 함수 (djb2)
+unsigned long chash_function(const char* str);
+
+// 해시 테이블 생성 및 해제
+ChainedHashTable* chash_create(size_t initial_capacity);
+void chash_destroy(ChainedHashTable* table);
+
+// 삽입, 검색, 삭제 (평균 O(1))
+bool chash_insert(ChainedHashTable* table, const char* key, int value);
+bool chash_get(const ChainedHashTable* table, const char* key, int* value);
+bool chash_remove(ChainedHashTable* table, const char* key);
+
+// 상태 확인 및 출력
+double chash_load_factor(const ChainedHashTable* table);
+void chash_print(const ChainedHashTable* table);
+void chash_print_collision_stats(const ChainedHashTable* table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CHAINING_HASH_TABLE_H
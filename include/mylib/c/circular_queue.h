@@ -0,0 +1,73 @@
+#ifndef CIRCULAR_QUEUE_H
+#define CIRCULAR_QUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int CircularQueueElement;
+
+// 큐 구조체 정의
+typedef struct {
+    CircularQueueElement* elements;  // 요소를 저장할 동적 배열
+    size_t capacity;       // 큐의 최대 용량
+    size_t front;          // 첫 번째 요소의 인덱스
+    size_t rear;           // 마지막 요소 다음의 인덱스
+    size_t size;           // 현재 저장된 요소의 수
+} CircularQueue;
+
+/* 오류 처리를 위한 열거형 정의
+ * - 큐 연산의 다양한 결과 상태를 표현
+ */
+typedef enum {
+    CQUEUE_OK,
+    CQUEUE_EMPTY,
+    CQUEUE_FULL,
+    CQUEUE_MEMORY_ERROR
+} CircularQueueResult;
+
+/* 연속 구간 (큐 내부 배열을 직접 가리키는 읽기 전용 뷰)
+ * - 원형 배열이 끝에서 감겨 있으면 최대 2개로 나뉨
+ * - 다음 삽입/삭제/크기 변경 전까지만 유효
+ */
+typedef struct {
+    const CircularQueueElement* data;
+    size_t count;
+} CircularQueueRegion;
+
+// 큐 생성 및 해제
+CircularQueue* cqueue_create(void);
+void cqueue_destroy(CircularQueue* queue);
+
+// 큐 상태 확인
+bool cqueue_is_empty(const CircularQueue* queue);
+bool cqueue_is_full(const CircularQueue* queue);
+size_t cqueue_size(const CircularQueue* queue);
+size_t cqueue_capacity(const CircularQueue* queue);
+
+// 데이터 삽입, 삭제 및 조회
+CircularQueueResult cqueue_enqueue(CircularQueue* queue, CircularQueueElement value);
+CircularQueueResult cqueue_dequeue(CircularQueue* queue, CircularQueueElement* value);
+CircularQueueResult cqueue_peek(const CircularQueue* queue, CircularQueueElement* value);
+void cqueue_clear(CircularQueue* queue);
+
+// 대량 삽입/삭제 (memcpy 최대 2회) 및 복사 없는 조회
+// (cqueue_enqueue_n 의 values 는 큐 자신의 배열을 가리켜도 됨: 확장 전에 임시 배열로 복사)
+CircularQueueResult cqueue_enqueue_n(CircularQueue* queue, const CircularQueueElement* values, size_t count);
+size_t cqueue_dequeue_n(CircularQueue* queue, CircularQueueElement* out, size_t max_count);
+size_t cqueue_peek_regions(const CircularQueue* queue, CircularQueueRegion regions[2]);
+CircularQueueResult cqueue_discard(CircularQueue* queue, size_t count);
+CircularQueueResult cqueue_reserve(CircularQueue* queue, size_t capacity);
+
+// 출력
+void cqueue_print(const CircularQueue* queue);
+void cqueue_status(const CircularQueue* queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CIRCULAR_QUEUE_H
@@ -0,0 +1,80 @@
+#ifndef DYNAMIC_PROGRAMMING_H
+#define DYNAMIC_PROGRAMMING_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// === 피보나치 수열 (43_dynamic_programming_fibonacci.c) ===
+typedef struct {
+    long long* table;
+    int size;
+} FibTable;
+
+long long fib_recursive(int n, bool print_steps);
+
+// 메모이제이션 테이블은 fib_memoization 호출 전후로 초기화/해제해야 함
+void init_memoization(int size);
+void cleanup_memoization(void);
+long long fib_memoization(int n, bool print_steps);
+
+FibTable create_fib_table(int size);
+void cleanup_fib_table(FibTable* table);
+long long fib_tabulation(int n, bool print_steps);
+long long fib_optimized(int n, bool print_steps);
+
+// === 최장 공통 부분수열 (44_lcs_algorithm.c) ===
+typedef struct {
+    int** length;    // LCS 길이 테이블
+    char** path;     // 경로 추적용 방향 테이블
+    int rows;        // 행 수 (첫 번째 문자열 길이 + 1)
+    int cols;        // 열 수 (두 번째 문자열 길이 + 1)
+} LCSTable;
+
+typedef struct {
+    char* sequence;  // 실제 LCS 문자열
+    int length;      // LCS 길이
+} LCSResult;
+
+LCSTable* create_lcs_table(int rows, int cols);
+void destroy_lcs_table(LCSTable* table);
+void print_lcs_table(LCSTable* table, const char* str1, const char* str2);
+LCSTable* compute_lcs(const char* str1, const char* str2, bool print_steps);
+LCSResult* get_lcs_result(LCSTable* table, const char* str1, const char* str2);
+void destroy_lcs_result(LCSResult* result);
+void visualize_lcs(const char* str1, const char* str2, LCSResult* result);
+
+// === 0/1 배낭 문제 (45_knapsack_problem.c) ===
+typedef struct {
+    int weight;     // 무게
+    int value;      // 가치
+    char* name;     // 물건 이름
+} Item;
+
+typedef struct {
+    int** table;    // DP 테이블
+    bool** selected; // 선택된 물건 추적
+    int rows;       // 물건 수 + 1
+    int cols;       // 배낭 용량 + 1
+} KnapsackTable;
+
+typedef struct {
+    int maxValue;           // 최대 가치
+    bool* selectedItems;    // 선택된 물건들
+    int numSelected;        // 선택된 물건 수
+} KnapsackResult;
+
+KnapsackTable* create_knapsack_table(int numItems, int capacity);
+void destroy_knapsack_table(KnapsackTable* table);
+void print_knapsack_table(KnapsackTable* table, Item* items);
+KnapsackResult* solve_knapsack(Item* items, int numItems, int capacity, bool print_steps);
+void destroy_knapsack_result(KnapsackResult* result);
+void print_knapsack_result(KnapsackResult* result, Item* items, int numItems);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DYNAMIC_PROGRAMMING_H
@@ -0,0 +1,61 @@
+#ifndef LINKED_QUEUE_H
+#define LINKED_QUEUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "node_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int LinkedQueueElement;
+
+// 노드 구조체 정의
+typedef struct LinkedQueueNode {
+    LinkedQueueElement data;
+    struct LinkedQueueNode* next;
+} LinkedQueueNode;
+
+// 큐 구조체 정의
+typedef struct {
+    LinkedQueueNode* front;    // 첫 번째 노드를 가리키는 포인터
+    LinkedQueueNode* rear;     // 마지막 노드를 가리키는 포인터
+    size_t size;    // 현재 큐에 저장된 요소의 수
+    NodePool pool;  // 노드 할당자 (생성 시 선택한 방식)
+} LinkedQueue;
+
+/* 오류 처리를 위한 열거형 정의 */
+typedef enum {
+    LQUEUE_OK,
+    LQUEUE_EMPTY,
+    LQUEUE_MEMORY_ERROR
+} LinkedQueueResult;
+
+// 큐 생성 및 해제
+LinkedQueue* lqueue_create(void);
+LinkedQueue* lqueue_create_ex(NodeAllocMode mode, size_t nodes_per_slab);
+void lqueue_destroy(LinkedQueue* queue);
+
+// 큐 상태 확인
+bool lqueue_is_empty(const LinkedQueue* queue);
+size_t lqueue_size(const LinkedQueue* queue);
+
+// 데이터 삽입, 삭제 및 조회
+LinkedQueueResult lqueue_enqueue(LinkedQueue* queue, LinkedQueueElement data);
+LinkedQueueResult lqueue_dequeue(LinkedQueue* queue, LinkedQueueElement* data);
+LinkedQueueResult lqueue_peek(const LinkedQueue* queue, LinkedQueueElement* data);
+void lqueue_clear(LinkedQueue* queue);
+
+// 출력
+void lqueue_print(const LinkedQueue* queue);
+void lqueue_status(const LinkedQueue* queue);
+
+// 노드 풀 통계 (살아있는 슬랩 수 등)
+void lqueue_pool_stats(const LinkedQueue* queue, NodePoolStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LINKED_QUEUE_H
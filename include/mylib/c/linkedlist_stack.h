@@ -0,0 +1,62 @@
+#ifndef LINKEDLIST_STACK_H
+#define LINKEDLIST_STACK_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "node_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int LinkedStackElement;
+
+// 노드 구조체 정의
+typedef struct LinkedStackNode {
+    LinkedStackElement data;
+    struct LinkedStackNode* next;
+} LinkedStackNode;
+
+// 스택 구조체 정의
+typedef struct {
+    LinkedStackNode* top;      // 스택의 최상위 노드를 가리키는 포인터
+    size_t size;    // 현재 스택에 저장된 요소의 수
+    NodePool pool;  // 노드 할당자 (생성 시 선택한 방식)
+} LinkedStack;
+
+/* 오류 처리를 위한 열거형 정의
+ * - 스택 연산의 다양한 결과 상태를 표현
+ */
+typedef enum {
+    LSTACK_OK,
+    LSTACK_EMPTY,
+    LSTACK_MEMORY_ERROR
+} LinkedStackResult;
+
+// 스택 생성 및 해제
+LinkedStack* lstack_create(void);
+LinkedStack* lstack_create_ex(NodeAllocMode mode, size_t nodes_per_slab);
+void lstack_destroy(LinkedStack* stack);
+
+// 스택 상태 확인
+bool lstack_is_empty(const LinkedStack* stack);
+size_t lstack_size(const LinkedStack* stack);
+
+// 데이터 삽입, 삭제 및 조회
+LinkedStackResult lstack_push(LinkedStack* stack, LinkedStackElement value);
+LinkedStackResult lstack_pop(LinkedStack* stack, LinkedStackElement* value);
+LinkedStackResult lstack_peek(const LinkedStack* stack, LinkedStackElement* value);
+void lstack_clear(LinkedStack* stack);
+
+// 출력
+void lstack_print(const LinkedStack* stack);
+void lstack_status(const LinkedStack* stack);
+
+// 노드 풀 통계 (살아있는 슬랩 수 등)
+void lstack_pool_stats(const LinkedStack* stack, NodePoolStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LINKEDLIST_STACK_H
@@ -0,0 +1,175 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 노드 기반 컨테이너(연결 리스트, 스택, 큐)가 공유하는 노드 풀
+ * - 컨테이너마다 하나씩 가지며, 노드를 슬랩(노드 여러 개 묶음) 단위로 할당
+ * - 해제된 노드는 free list 에 넣어 두었다가 다음 할당에 재사용
+ * - 따라서 push/pop 이 반복되는 정상 상태에서는 malloc/free 호출이 없음
+ * - 슬랩은 컨테이너 초기화(clear) 또는 해제(destroy) 시 한꺼번에 반환
+ * - 헤더만으로 사용할 수 있도록 static inline 으로 구현
+ */
+
+/* 노드 할당 방식 (컨테이너 생성 시 선택) */
+typedef enum {
+    NODE_ALLOC_MALLOC,  // 노드마다 malloc/free (기본값)
+    NODE_ALLOC_POOL     // 슬랩 + free list 로 노드 재활용
+} NodeAllocMode;
+
+/* 슬랩 하나에 들어가는 기본 노드 수 */
+#define NODE_POOL_DEFAULT_NODES_PER_SLAB 256
+
+/* 슬랩 헤더
+ * - 슬랩끼리 연결하는 포인터
+ * - 뒤따르는 노드 배열의 정렬을 보장하기 위해 long double 과 공용체로 선언
+ */
+typedef union NodePoolSlab {
+    union NodePoolSlab* next;
+    long double align_;
+} NodePoolSlab;
+
+/* free list 에 들어간 노드 (노드 메모리를 링크로 재사용) */
+typedef struct NodePoolFree {
+    struct NodePoolFree* next;
+} NodePoolFree;
+
+/* 노드 풀 */
+typedef struct {
+    NodeAllocMode mode;     // 할당 방식
+    size_t node_size;       // 노드 하나의 크기 (포인터 크기 단위로 올림)
+    size_t nodes_per_slab;  // 슬랩 하나의 노드 수
+    NodePoolSlab* slabs;    // 할당된 슬랩 목록
+    NodePoolFree* free_list;// 재사용 대기 중인 노드 목록
+    size_t bump;            // 가장 최근 슬랩에서 아직 나눠주지 않은 노드 수
+    size_t live_slabs;      // 현재 살아있는 슬랩 수
+    size_t nodes_in_use;    // 현재 컨테이너가 사용 중인 노드 수
+} NodePool;
+
+/* 노드 풀 통계 */
+typedef struct {
+    size_t live_slabs;      // 현재 살아있는 슬랩 수
+    size_t nodes_per_slab;  // 슬랩 하나의 노드 수
+    size_t nodes_in_use;    // 사용 중인 노드 수
+    size_t nodes_free;      // 재사용 가능한 노드 수 (free list + 미사용 슬랩 영역)
+    size_t bytes_reserved;  // 슬랩이 차지하는 전체 바이트
+} NodePoolStats;
+
+/* 노드 풀 초기화
+ * - 매개변수: pool - 대상 풀, mode - 할당 방식,
+ *             node_size - 노드 크기, nodes_per_slab - 슬랩당 노드 수 (0이면 기본값)
+ */
+static inline void node_pool_init(NodePool* pool, NodeAllocMode mode,
+                                  size_t node_size, size_t nodes_per_slab) {
+    size_t align = sizeof(NodePoolFree);
+    if (node_size < sizeof(NodePoolFree)) {
+        node_size = sizeof(NodePoolFree);
+    }
+    pool->mode = mode;
+    pool->node_size = (node_size + align - 1) / align * align;
+    pool->nodes_per_slab = nodes_per_slab ? nodes_per_slab : NODE_POOL_DEFAULT_NODES_PER_SLAB;
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->bump = 0;
+    pool->live_slabs = 0;
+    pool->nodes_in_use = 0;
+}
+
+/* 노드 하나 할당
+ * - free list → 최근 슬랩의 남은 영역 → 새 슬랩 순서로 확보
+ * - 반환값: 노드 메모리 또는 실패 시 NULL
+ */
+static inline void* node_pool_alloc(NodePool* pool) {
+    void* node;
+
+    if (pool->mode == NODE_ALLOC_MALLOC) {
+        node = malloc(pool->node_size);
+        if (node != NULL) {
+            pool->nodes_in_use++;
+        }
+        return node;
+    }
+
+    if (pool->free_list != NULL) {
+        node = pool->free_list;
+        pool->free_list = pool->free_list->next;
+    }
+    else {
+        if (pool->bump == 0) {
+            NodePoolSlab* slab = (NodePoolSlab*)malloc(
+                sizeof(NodePoolSlab) + pool->node_size * pool->nodes_per_slab);
+            if (slab == NULL) {
+                return NULL;
+            }
+            slab->next = pool->slabs;
+            pool->slabs = slab;
+            pool->bump = pool->nodes_per_slab;
+            pool->live_slabs++;
+        }
+        // 슬랩의 앞쪽부터 순서대로 나눠줌 (인접 노드가 메모리상으로도 인접)
+        pool->bump--;
+        node = (char*)(pool->slabs + 1) +
+               pool->node_size * (pool->nodes_per_slab - pool->bump - 1);
+    }
+    pool->nodes_in_use++;
+    return node;
+}
+
+/* 노드 하나 반환
+ * - 풀 모드에서는 free list 앞에 넣기만 함 (O(1), free 호출 없음)
+ */
+static inline void node_pool_free(NodePool* pool, void* node) {
+    if (node == NULL) {
+        return;
+    }
+    pool->nodes_in_use--;
+    if (pool->mode == NODE_ALLOC_MALLOC) {
+        free(node);
+        return;
+    }
+    ((NodePoolFree*)node)->next = pool->free_list;
+    pool->free_list = (NodePoolFree*)node;
+}
+
+/* 모든 슬랩 반환
+ * - 풀 모드에서만 사용 가능 (노드를 하나씩 반환하지 않고 슬랩 수만큼만 free)
+ * - 호출 후 기존 노드 포인터는 모두 무효
+ */
+static inline void node_pool_release(NodePool* pool) {
+    NodePoolSlab* slab = pool->slabs;
+    while (slab != NULL) {
+        NodePoolSlab* next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    pool->slabs = NULL;
+    pool->free_list = NULL;
+    pool->bump = 0;
+    pool->live_slabs = 0;
+    pool->nodes_in_use = 0;
+}
+
+/* 노드 풀 통계 조회
+ * - 매개변수: pool - 대상 풀, stats - 결과를 저장할 구조체
+ */
+static inline void node_pool_get_stats(const NodePool* pool, NodePoolStats* stats) {
+    stats->live_slabs = pool->live_slabs;
+    stats->nodes_per_slab = pool->mode == NODE_ALLOC_POOL ? pool->nodes_per_slab : 0;
+    stats->nodes_in_use = pool->nodes_in_use;
+    stats->nodes_free = pool->mode == NODE_ALLOC_POOL
+        ? pool->live_slabs * pool->nodes_per_slab - pool->nodes_in_use
+        : 0;
+    stats->bytes_reserved = pool->live_slabs *
+        (sizeof(NodePoolSlab) + pool->node_size * pool->nodes_per_slab);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NODE_POOL_H
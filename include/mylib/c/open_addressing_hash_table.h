@@ -0,0 +1,54 @@
+#ifndef OPEN_ADDRESSING_HASH_TABLE_H
+#define OPEN_ADDRESSING_HASH_TABLE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 탐사 방식 열거형
+typedef enum {
+    PROBE_LINEAR,      // 선형 조사법: 다음 버킷으로 순차적 이동
+    PROBE_QUADRATIC,   // 이차 조사법: 제곱수만큼 이동
+    PROBE_DOUBLE_HASH  // 이중 해싱: 두 번째 해시 함수 사용
+} ProbeType;
+
+// 키-값 쌍을 저장하는 구조체
+typedef struct {
+    char* key;   // 키 (NULL: 빈 버킷, DELETED_NODE: 삭제된 버킷)
+    int value;   // 값
+} OpenHashEntry;
+
+// 해시 테이블 구조체
+typedef struct {
+    OpenHashEntry* entries;    // 엔트리 배열
+    size_t capacity;   // 테이블 크기
+    size_t size;       // 저장된 요소 수
+    size_t tombstones; // 삭제 표시 수
+    ProbeType type;    // 사용 중인 탐사 방식
+} OpenHashTable;
+
+// 해시 함수
+unsigned long ohash_function(const char* str);
+unsigned long ohash_function2(const char* str);
+
+// 해시 테이블 생성 및 해제
+OpenHashTable* ohash_create(size_t capacity, ProbeType type);
+void ohash_destroy(OpenHashTable* table);
+
+// 삽입, 검색, 삭제
+bool ohash_insert(OpenHashTable* table, const char* key, int value);
+bool ohash_get(const OpenHashTable* table, const char* key, int* value);
+bool ohash_remove(OpenHashTable* table, const char* key);
+
+// 출력
+void ohash_print(const OpenHashTable* table);
+const char* ohash_probe_type_to_string(ProbeType type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OPEN_ADDRESSING_HASH_TABLE_H
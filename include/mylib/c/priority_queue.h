@@ -0,0 +1,52 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int PriorityQueueElement;
+
+// === 배열 기반 단순 우선순위 큐 (22_priority_queue.c) ===
+#define MAX_QUEUE_SIZE 100
+
+typedef struct {
+    PriorityQueueElement elements[MAX_QUEUE_SIZE];
+    int size;
+} PriorityQueue;
+
+void pqueue_init(PriorityQueue* queue);
+bool pqueue_is_empty(const PriorityQueue* queue);
+bool pqueue_is_full(const PriorityQueue* queue);
+int pqueue_size(const PriorityQueue* queue);
+bool pqueue_insert_max(PriorityQueue* queue, PriorityQueueElement value);
+bool pqueue_insert_min(PriorityQueue* queue, PriorityQueueElement value);
+bool pqueue_remove_max(PriorityQueue* queue, PriorityQueueElement* value);
+bool pqueue_remove_min(PriorityQueue* queue, PriorityQueueElement* value);
+void pqueue_print(const PriorityQueue* queue, const char* name);
+
+// === 최대 힙 (23_max_heap.c) ===
+#define MAX_HEAP_SIZE 100
+
+typedef struct {
+    PriorityQueueElement elements[MAX_HEAP_SIZE];
+    int size;  // 힙의 현재 크기
+} MaxHeap;
+
+void maxheap_init(MaxHeap* heap);
+bool maxheap_is_empty(const MaxHeap* heap);
+bool maxheap_is_full(const MaxHeap* heap);
+int maxheap_size(const MaxHeap* heap);
+bool maxheap_insert(MaxHeap* heap, PriorityQueueElement value);
+bool maxheap_delete_max(MaxHeap* heap, PriorityQueueElement* value);
+bool maxheap_peek_max(const MaxHeap* heap, PriorityQueueElement* value);
+void maxheap_print(const MaxHeap* heap);
+bool maxheap_verify(const MaxHeap* heap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PRIORITY_QUEUE_H
@@ -0,0 +1,21 @@
+#ifndef SEQUENTIAL_SEARCH_H
+#define SEQUENTIAL_SEARCH_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int SearchElement;
+
+// === 순차 탐색 (19_sequential_search.c) ===
+int sequential_search_mtf(SearchElement arr[], size_t size, SearchElement key);
+int sequential_search_sentinel(SearchElement arr[], size_t size, SearchElement key);
+int sequential_search_basic(const SearchElement arr[], size_t size, SearchElement key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SEQUENTIAL_SEARCH_H
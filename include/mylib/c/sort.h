@@ -0,0 +1,57 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int SortElement;
+
+// === 버블 정렬 (12_bubble_sort.c) ===
+void bubble_sort_basic(SortElement arr[], size_t size);
+void bubble_sort_optimized(SortElement arr[], size_t size);
+
+// === 삽입 정렬 (13_insertion_sort.c) ===
+void insertion_sort(SortElement arr[], size_t size);
+void binary_insertion_sort(SortElement arr[], size_t size);
+
+// === 선택 정렬 (14_selection_sort.c) ===
+void selection_sort(SortElement arr[], size_t size);
+void selection_sort_optimized(SortElement arr[], size_t size);
+
+// === 퀵 정렬 (15_quick_sort.c) ===
+size_t median_of_three(SortElement arr[], size_t left, size_t right);
+size_t partition_lomuto(SortElement arr[], size_t left, size_t right);
+size_t partition_hoare(SortElement arr[], size_t left, size_t right);
+void quick_sort_lomuto(SortElement arr[], size_t left, size_t right);
+void quick_sort_hoare(SortElement arr[], size_t left, size_t right);
+void quick_sort_lomuto_wrapper(SortElement arr[], size_t size);
+void quick_sort_hoare_wrapper(SortElement arr[], size_t size);
+
+// === 병합 정렬 (16_merge_sort.c) ===
+void merge_sort_recursive(SortElement arr[], size_t left, size_t right, SortElement temp[]);
+void merge_sort_optimized_recursive(SortElement arr[], size_t left, size_t right, SortElement temp[]);
+void merge_sort_iterative(SortElement arr[], size_t size, SortElement temp[]);
+void merge_sort_basic(SortElement arr[], size_t size);
+void merge_sort_optimized(SortElement arr[], size_t size);
+void merge_sort_iterative_wrapper(SortElement arr[], size_t size);
+
+// === 힙 정렬 (17_heap_sort.c) ===
+void heapify_recursive(SortElement arr[], size_t size, size_t index);
+void heapify_iterative(SortElement arr[], size_t size, size_t index);
+void build_heap_bottom_up(SortElement arr[], size_t size,
+    void (*heapify)(SortElement[], size_t, size_t));
+void heap_sort_basic(SortElement arr[], size_t size);
+void heap_sort_optimized(SortElement arr[], size_t size);
+
+// === 분할 정복 병합 정렬 (40_merge_sort_using_divide_conquer.c) ===
+void merge_sort(int arr[], int left, int right, bool print_steps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SORT_H
@@ -0,0 +1,70 @@
+#ifndef SPLAY_TREE_H
+#define SPLAY_TREE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "node_pool.h"
+#include "binary_search_tree.h"     // BstKey, BstResult (09 이진 탐색 트리와 같은 키/결과 형식)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 스플레이 트리 노드
+typedef struct SplayNode {
+    BstKey data;              // 데이터
+    size_t size;                // 이 노드를 루트로 하는 서브트리의 노드 수 (split 후 크기 계산용)
+    struct SplayNode* left;     // 왼쪽 자식 노드
+    struct SplayNode* right;    // 오른쪽 자식 노드
+} SplayNode;
+
+/* 여러 트리가 함께 쓰는 노드 풀 (참조 횟수로 수명 관리)
+ * - 풀 모드에서 splay_split 으로 떼어낸 트리는 원래 트리와 같은 풀을 쓰고 owners 를 1 늘림
+ * - 트리를 해제할 때마다 owners 를 1 줄이고, 0이 되면 슬랩을 반환
+ *   따라서 분할한 두 트리를 어떤 순서로 해제해도 됨
+ */
+typedef struct {
+    NodePool nodes;     // 노드 풀
+    size_t owners;      // 이 풀을 쓰는 트리 수
+} SplayPool;
+
+// 스플레이 트리
+typedef struct {
+    SplayNode* root;    // 루트 노드 (가장 최근에 접근한 노드)
+    SplayPool* pool;    // 노드 할당에 사용하는 풀 (분할한 트리끼리 공유할 수 있음)
+} SplayTree;
+
+// 트리 생성 및 해제
+SplayTree* splay_create(void);
+SplayTree* splay_create_ex(NodeAllocMode mode, size_t nodes_per_slab);
+void splay_destroy(SplayTree* tree);
+void splay_clear(SplayTree* tree);
+
+// 트리 상태 확인
+bool splay_is_empty(const SplayTree* tree);
+size_t splay_size(const SplayTree* tree);
+size_t splay_height(const SplayTree* tree);
+
+// 데이터 삽입, 삭제 및 검색 (모두 접근한 노드를 루트로 끌어올리므로 트리가 바뀜)
+BstResult splay_insert(SplayTree* tree, BstKey data);
+BstResult splay_delete(SplayTree* tree, BstKey data);
+bool splay_search(SplayTree* tree, BstKey data);
+BstResult splay_find_min(SplayTree* tree, BstKey* value);
+BstResult splay_find_max(SplayTree* tree, BstKey* value);
+
+// 분할과 병합
+SplayTree* splay_split(SplayTree* tree, BstKey key);
+BstResult splay_join(SplayTree* left, SplayTree* right);
+
+// 출력
+void splay_print_sorted(const SplayTree* tree);
+void splay_print(const SplayTree* tree);
+
+// 노드 풀 통계 (풀을 공유하는 트리가 있으면 그 트리의 노드도 포함)
+void splay_pool_stats(const SplayTree* tree, NodePoolStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SPLAY_TREE_H
@@ -0,0 +1,75 @@
+#ifndef STRING_SEARCH_H
+#define STRING_SEARCH_H
+
+#include <stdlib.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 문자열 탐색 결과 저장을 위한 구조체
+ * - 네 가지 탐색 알고리즘(35~38)이 같은 결과 형식을 공유
+ */
+typedef struct {
+    int* positions;    // 발견된 위치들의 배열
+    int count;         // 발견된 총 횟수
+    int capacity;      // positions 배열의 크기
+} SearchResult;
+
+/* 검색 결과 초기화 */
+static inline SearchResult* create_result(int initial_capacity) {
+    SearchResult* result = (SearchResult*)malloc(sizeof(SearchResult));
+    if (!result) return NULL;
+
+    result->positions = (int*)malloc(initial_capacity * sizeof(int));
+    if (!result->positions) {
+        free(result);
+        return NULL;
+    }
+
+    result->count = 0;
+    result->capacity = initial_capacity;
+    return result;
+}
+
+/* 검색 결과에 새로운 위치 추가 */
+static inline void add_position(SearchResult* result, int position) {
+    if (result->count >= result->capacity) {
+        int new_capacity = result->capacity * 2;
+        int* new_positions = (int*)realloc(result->positions, new_capacity * sizeof(int));
+        if (!new_positions) return;
+
+        result->positions = new_positions;
+        result->capacity = new_capacity;
+    }
+
+    result->positions[result->count++] = position;
+}
+
+/* 검색 결과 메모리 해제 */
+static inline void destroy_result(SearchResult* result) {
+    if (result) {
+        free(result->positions);
+        free(result);
+    }
+}
+
+// === 고지식한 탐색 (35_brute_force_string_search.c) ===
+SearchResult* brute_force_search(const char* text, const char* pattern, bool print_steps);
+
+// === KMP 탐색 (36_kmp_string_search.c) ===
+void compute_failure_function(const char* pattern, int* failure, bool print_steps);
+SearchResult* kmp_search(const char* text, const char* pattern, bool print_steps);
+
+// === 보이어-무어 탐색 (37_boyer_moore_string_search.c) ===
+SearchResult* boyer_moore_search(const char* text, const char* pattern, bool print_steps);
+
+// === 라빈-카프 탐색 (38_rabin_karp_string_search.c) ===
+SearchResult* rabin_karp_search(const char* text, const char* pattern, bool print_steps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // STRING_SEARCH_H
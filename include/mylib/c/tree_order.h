@@ -0,0 +1,12 @@
+#ifndef TREE_ORDER_H
+#define TREE_ORDER_H
+
+/* 이진 트리 순회 순서 (binary_tree.h, binary_search_tree.h 의 순회 커서가 함께 사용) */
+typedef enum {
+    TRAVERSE_PREORDER,      // Root -> Left -> Right
+    TRAVERSE_INORDER,       // Left -> Root -> Right
+    TRAVERSE_POSTORDER,     // Left -> Right -> Root
+    TRAVERSE_LEVEL_ORDER    // 깊이 순서, 같은 깊이는 왼쪽부터
+} TraversalOrder;
+
+#endif // TREE_ORDER_H
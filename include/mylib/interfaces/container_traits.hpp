@@ -0,0 +1,73 @@
+#ifndef CONTAINER_TRAITS_HPP
+#define CONTAINER_TRAITS_HPP
+
+#include <cstddef>      // for size_t
+#include <type_traits>  // for std::void_t
+#include <utility>      // for std::declval
+
+/*
+정적 인터페이스 (가상 함수 없이 컴파일 시간에 확인)
+- IStack/ILinkedList와 같은 연산을 멤버로 가진 타입인지 판별
+- 상속 여부와 무관하므로 인터페이스를 구현하지 않은 타입도 조건을 만족하면 사용 가능
+- 템플릿 알고리즘은 구체 타입으로 호출하므로 (구체 클래스가 final이면) 가상 호출 없이 인라인됨
+- C++20 이상에서는 같은 조건을 concept로도 제공
+*/
+
+// 스택 요소 타입 (pop_value()의 반환 타입)
+template<typename Stack>
+using stack_value_t = std::decay_t<decltype(std::declval<Stack&>().pop_value())>;
+
+// 리스트 요소 타입 (pop_front_value()의 반환 타입)
+template<typename List>
+using list_value_t = std::decay_t<decltype(std::declval<List&>().pop_front_value())>;
+
+// IStack의 모든 연산을 제공하는 타입인지 판별
+template<typename Stack, typename = void>
+struct is_stack : std::false_type {};
+
+template<typename Stack>
+struct is_stack<Stack, std::void_t<
+    stack_value_t<Stack>,
+    decltype(std::declval<const Stack&>().empty()),
+    decltype(std::declval<const Stack&>().size()),
+    decltype(std::declval<const Stack&>().capacity()),
+    decltype(std::declval<Stack&>().push(std::declval<const stack_value_t<Stack>&>())),
+    decltype(std::declval<Stack&>().push(std::declval<stack_value_t<Stack>&&>())),
+    decltype(std::declval<Stack&>().pop()),
+    decltype(std::declval<Stack&>().peek()),
+    decltype(std::declval<const Stack&>().peek()),
+    decltype(std::declval<Stack&>().clear()),
+    decltype(std::declval<const Stack&>().print())>>
+    : std::true_type {};
+
+template<typename Stack>
+inline constexpr bool is_stack_v = is_stack<Stack>::value;
+
+// ILinkedList의 기본 연산(양끝 삽입, 앞쪽 삭제, 인덱스 접근)을 제공하는 타입인지 판별
+template<typename List, typename = void>
+struct is_linked_list : std::false_type {};
+
+template<typename List>
+struct is_linked_list<List, std::void_t<
+    list_value_t<List>,
+    decltype(std::declval<const List&>().empty()),
+    decltype(std::declval<const List&>().size()),
+    decltype(std::declval<List&>().push_front(std::declval<const list_value_t<List>&>())),
+    decltype(std::declval<List&>().push_back(std::declval<const list_value_t<List>&>())),
+    decltype(std::declval<List&>().pop_front()),
+    decltype(std::declval<List&>().at(std::declval<size_t>())),
+    decltype(std::declval<const List&>().print())>>
+    : std::true_type {};
+
+template<typename List>
+inline constexpr bool is_linked_list_v = is_linked_list<List>::value;
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+template<typename Stack>
+concept StackContainer = is_stack_v<Stack>;
+
+template<typename List>
+concept LinkedListContainer = is_linked_list_v<List>;
+#endif
+
+#endif // CONTAINER_TRAITS_HPP
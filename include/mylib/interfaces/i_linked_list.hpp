@@ -1,7 +1,8 @@
 #ifndef I_LINKED_LIST_HPP
 #define I_LINKED_LIST_HPP
 
-#include <cstddef>  // for size_t
+#include <cstddef>     // for size_t
+#include <functional>  // for std::function
 
 template<typename T>
 class ILinkedList {
@@ -13,19 +14,29 @@ public:
     [[nodiscard]] virtual bool empty() const = 0;
     [[nodiscard]] virtual size_t size() const = 0;
 
-    // 데이터 삽입
+    // 데이터 삽입 (rvalue 버전은 값을 복사하지 않고 이동)
+    // 구체 클래스는 제자리 생성(emplace_*)과 범위 삽입(append_range)도 제공
     virtual void push_front(const T& value) = 0;
+    virtual void push_front(T&& value) = 0;
     virtual void push_back(const T& value) = 0;
+    virtual void push_back(T&& value) = 0;
     virtual void insert_after(size_t index, const T& value) = 0;
+    virtual void insert_after(size_t index, T&& value) = 0;
 
     // 데이터 삭제
     virtual void pop_front() = 0;
+    virtual T pop_front_value() = 0;  // 맨 앞 요소를 이동으로 꺼내며 제거
     virtual void remove_at(size_t index) = 0;
 
     // 데이터 접근
     virtual T& at(size_t index) = 0;
     [[nodiscard]] virtual const T& at(size_t index) const = 0;
 
+    // 전체 순회 (인덱스 접근 없이 O(n))
+    // 구체 클래스는 begin()/end() 반복자도 제공하므로 타입을 알고 있다면 반복자를 사용
+    virtual void for_each(const std::function<void(T&)>& visit) = 0;
+    virtual void for_each(const std::function<void(const T&)>& visit) const = 0;
+
     // 출력
     virtual void print() const = 0;
 };
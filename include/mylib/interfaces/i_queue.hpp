@@ -0,0 +1,35 @@
+#ifndef I_QUEUE_HPP
+#define I_QUEUE_HPP
+
+#include <cstddef>
+
+template<typename T>
+class IQueue {
+public:
+    // 가상 소멸자
+    virtual ~IQueue() = default;
+
+    // 큐 상태 확인
+    [[nodiscard]] virtual bool empty() const = 0;
+    [[nodiscard]] virtual size_t size() const = 0;
+    [[nodiscard]] virtual size_t capacity() const = 0;
+
+    // 데이터 삽입 및 삭제 (rvalue 버전은 값을 복사하지 않고 이동)
+    // 구체 클래스는 제자리 생성(emplace)과 범위 삽입(push_range)도 제공
+    virtual void push(const T& value) = 0;  // 맨 뒤에 추가
+    virtual void push(T&& value) = 0;
+    virtual void pop() = 0;                 // 맨 앞 요소 제거
+    virtual T pop_value() = 0;              // 맨 앞 요소를 이동으로 꺼내며 제거
+
+    // 양끝 데이터 확인
+    virtual const T& front() const = 0;
+    virtual T& front() = 0;
+    virtual const T& back() const = 0;
+    virtual T& back() = 0;
+
+    // 큐 관리
+    virtual void clear() = 0;
+    virtual void print() const = 0;
+};
+
+#endif // I_QUEUE_HPP
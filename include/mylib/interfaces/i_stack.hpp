@@ -14,9 +14,12 @@ public:
     [[nodiscard]] virtual size_t size() const = 0;
     [[nodiscard]] virtual size_t capacity() const = 0;
 
-    // 데이터 삽입 및 삭제
+    // 데이터 삽입 및 삭제 (rvalue 버전은 값을 복사하지 않고 이동)
+    // 구체 클래스는 제자리 생성(emplace)과 범위 삽입(push_range)도 제공
     virtual void push(const T& value) = 0;
+    virtual void push(T&& value) = 0;
     virtual void pop() = 0;
+    virtual T pop_value() = 0;  // 최상단 요소를 이동으로 꺼내며 제거
 
     // 최상단 데이터 확인
     virtual const T& peek() const = 0;
@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "node_pool.h"
 
 // 데이터 타입 추상화를 위한 type definition (필요시 int부분을 교체)
 typedef int DataType;
@@ -15,12 +16,15 @@ typedef struct Node {
 typedef struct LinkedList {
 	Node* head; // 첫번째 노드(헤드)를 가리키는 포인터
 	size_t size; // 리스트의 크기(노드 개수)
+	NodePool pool; // 노드 할당자 (생성 시 malloc 방식 / 슬랩 풀 방식 선택)
 } LinkedList;
 
-/*  리스트 생성 및 초기화 함수
-	- 새로운 빈 연결 리스트를 생성하고 초기화
+/*  노드 할당 방식을 지정하여 리스트 생성
+	- NODE_ALLOC_POOL 이면 노드를 슬랩 단위로 받아오고 삭제된 노드는 free list 에 모아 재사용
+	  (삽입/삭제가 반복되는 정상 상태에서는 malloc/free 호출이 없음)
+	- 매개변수 : mode - 노드 할당 방식, nodes_per_slab - 슬랩당 노드 수 (0이면 기본값)
 	- 반환값 : 초기화된 LinkedList 구조체 */
-LinkedList* list_create(void) {
+LinkedList* list_create_ex(NodeAllocMode mode, size_t nodes_per_slab) {
 	LinkedList* list = (LinkedList*)malloc(sizeof(LinkedList)); //엠얼록함수는 void* 타입이므로 형변환 해줌.
 	if (list == NULL) { // 이거 없으면 널포인터 역참조 일어남 (없는 구조체에 list->head = NULL; 이런걸 하려하니까 크래시남)
 		puts("리스트 생성 실패");
@@ -28,17 +32,32 @@ LinkedList* list_create(void) {
 	}
 	list->head = NULL; // = (*list).head 와 완벽하게 일치함(->연산자는 역참조와 멤버 접근을 동시에 수행)
 	list->size = 0;
+	node_pool_init(&list->pool, mode, sizeof(Node), nodes_per_slab); // 노드 크기에 맞춰 풀 준비
 	return list; // 생성 성공시 포인터 반환
 }
 
+/*  리스트 생성 및 초기화 함수
+	- 새로운 빈 연결 리스트를 생성하고 초기화 (노드마다 malloc/free)
+	- 반환값 : 초기화된 LinkedList 구조체 */
+LinkedList* list_create(void) {
+	return list_create_ex(NODE_ALLOC_MALLOC, 0);
+}
+
+/*  리스트 크기 반환
+	- 매개변수 : list - 대상 리스트
+	- 반환값 : 노드 개수 */
+size_t list_size(const LinkedList* list) {
+	return list->size;
+}
+
 /*  새로운 노드 생성 함수
-	- 데이터를 담은 새로운 노드를 동적 할당(힙영역)
-	- 매개변수 : data >> 저장할 데이터 값
+	- 데이터를 담은 새로운 노드를 리스트의 노드 풀에서 할당(힙영역)
+	- 매개변수 : list >> 노드를 받아올 리스트, data >> 저장할 데이터 값
 	- 반환값 : 생성된 새 노드의 포인터 */
 
-// node_create(5); 이렇게 호출하면 파라미터에 5를 주고 노드의 data필드에 저장해서 데이터5를 가지는 새로운 노드가 생성되겠지.
-Node* node_create(DataType data) { // 새로운 노드가 생성될 때 노드의 data 필드에 저장될 값을 받아오는 것.
-	Node* new_node = (Node*)malloc(sizeof(Node));
+// node_create(list, 5); 이렇게 호출하면 파라미터에 5를 주고 노드의 data필드에 저장해서 데이터5를 가지는 새로운 노드가 생성되겠지.
+Node* node_create(LinkedList* list, DataType data) { // 새로운 노드가 생성될 때 노드의 data 필드에 저장될 값을 받아오는 것.
+	Node* new_node = (Node*)node_pool_alloc(&list->pool); // 풀 모드면 free list 에서 재사용, 아니면 malloc
 	if (new_node == NULL) {
 		return NULL;
 	}
@@ -49,9 +68,21 @@ Node* node_create(DataType data) { // 새로운 노드가 생성될 때 노드
 
 // 리스트를 지운다고 되는게 아니고 노드들이 각각 다 따로 메모리지정이 되어있으니 노드부터 지워주고 남은 빈 리스트를 지워야 됨.
 void list_destroy(LinkedList* list) {
-	// 리무브노드에서 노드의 메모리해제까지 만들고
-	// 이 함수에서는 리무브노드를 반복문으로 호출해서 노드를 싹 없애는 코드를 만들어주고
-	// 마지막에 free(list);
+	if (list == NULL) {
+		return;
+	}
+	if (list->pool.mode == NODE_ALLOC_POOL) { // 풀 모드면 노드를 하나씩 지울 필요 없이 슬랩만 통째로 반환
+		node_pool_release(&list->pool);
+	}
+	else {
+		Node* current = list->head;
+		while (current != NULL) { // 헤드부터 끝까지 하나씩 해제
+			Node* next = current->next; // 해제하기 전에 다음 노드 주소를 먼저 챙겨둠
+			node_pool_free(&list->pool, current);
+			current = next;
+		}
+	}
+	free(list); // 마지막에 빈 리스트 해제
 }
 
 /*  리스트의 맨 앞에 노드 삽입
@@ -59,7 +90,7 @@ void list_destroy(LinkedList* list) {
 	- 매개변수 : list - 대상 리스트, data - 저장할 데이터
 	- 반환값 : 성공 시 1, 실패 시 0 */
 int list_push_front(LinkedList* list, DataType data) {
-	Node* new_node = node_create(data); // 새로운 노드를 생성하고(Node형 구조체의 메모리 주소 저장할 곳 : new_node) 내용물을 받아옴
+	Node* new_node = node_create(list, data); // 새로운 노드를 생성하고(Node형 구조체의 메모리 주소 저장할 곳 : new_node) 내용물을 받아옴
 	if (new_node == NULL) { // 뉴노드 삽입 실패시
 		return 0; // 노드삽입 실패시 0반환
 	}
@@ -83,12 +114,12 @@ int list_push_front(LinkedList* list, DataType data) {
   - 반환값: 성공 시 1, 실패 시 0
 */
 int list_push_back(LinkedList* list, DataType data) {
-	Node* new_node = node_create(data); // 노드구조체포인터타입 뉴노드는 노드만드는 함수에 data를 넣어서 만들어옴
+	Node* new_node = node_create(list, data); // 노드구조체포인터타입 뉴노드는 노드만드는 함수에 data를 넣어서 만들어옴
 	if (new_node == NULL) {
 		return 0; // 못만들어왔으면 0반환
 	}
 	if (list->head == NULL) { // 리스트의 헤드가 없으면 (비어있으면)
-		list->head == new_node; // 여기서 만든 뉴노드가 헤드가 되겠지
+		list->head = new_node; // 여기서 만든 뉴노드가 헤드가 되겠지
 	}
 	else { // 리스트가 비어있지 않으면
 		Node* current = list->head; // 리스트의 원래 있던 헤드를 현재노드를 가리키는 포인터로 지정하고
@@ -103,20 +134,21 @@ int list_push_back(LinkedList* list, DataType data) {
 }
 /* 특정 위치 뒤에 노드 삽입
   - 지정된 노드 뒤에 새 노드를 삽입
-  - 매개변수: node - 삽입 위치 노드, data - 저장할 데이터
+  - 매개변수: list - 대상 리스트, node - 삽입 위치 노드, data - 저장할 데이터
   - 반환값: 성공 시 1, 실패 시 0
  */
-int list_insert_after(Node* node, DataType data) {
+int list_insert_after(LinkedList* list, Node* node, DataType data) {
 
 	if (node == NULL) { // 삽입할 위치(node) 유효성검사부터
 		return 0;
 	}
-	Node* new_node = node_create(data);
+	Node* new_node = node_create(list, data);
 	if (new_node == NULL) { // 노드생성 유효성검사
 		return 0;
 	}
 	new_node->next = node->next; // 원래 노드의 넥스트주소에 새노드의 넥스트주소를 대입 (뒤에 끼어든거지)
 	node->next = new_node; // 그래서 뒤에오게 된 것
+	list->size++; // 노드가 하나 늘었으니 크기도 늘려줌
 
 	return 1;
 }
@@ -165,19 +197,42 @@ int list_remove_target_node(LinkedList* list, size_t target) {
 	else { // 중간이나 마지막 노드를 삭제할 때(타겟 앞에 노드가 있다)
 		prev->next = current->next; // 삭제할 타겟의 다음노드와 앞노드의 next 연결
 	}
-	free(current); // 타겟 노드 메모리 해제
+	node_pool_free(&list->pool, current); // 타겟 노드 메모리 해제 (풀 모드면 free list 로 돌려보냄)
 	list->size--; // 하나 삭제하면 리스트의 크기--;
 	return 1; // 삭제 성공
 }
+/* 맨 앞 노드 삭제
+ * - 매개변수: list - 대상 리스트
+ * - 반환값: 성공 시 1, 실패(빈 리스트) 시 0
+ */
 int list_remove_head(LinkedList* list) {
-
+	return list_remove_target_node(list, 0); // 0번 인덱스 삭제와 같음 (O(1))
 }
-int list_remove_tail(LinkedList* list, Node* index) {
+/* 맨 뒤 노드 삭제
+ * - 매개변수: list - 대상 리스트
+ * - 반환값: 성공 시 1, 실패(빈 리스트) 시 0
+ */
+int list_remove_tail(LinkedList* list) {
+	if (list->size == 0) {
+		return 0;
+	}
+	return list_remove_target_node(list, list->size - 1); // 단일 연결이라 끝까지 순회해야 함 (O(n))
 }
+/* 노드 풀 통계 조회
+ * - 매개변수: list - 대상 리스트, stats - 결과를 저장할 구조체
+ */
+void list_pool_stats(const LinkedList* list, NodePoolStats* stats) {
+	node_pool_get_stats(&list->pool, stats);
+}
+
+#ifndef DS_LIBRARY_BUILD
 int main(void) {
 
-	// 리스트 생성
-	LinkedList* list = list_create();
+	// 리스트 생성 (슬랩당 노드 4개짜리 노드 풀 사용)
+	LinkedList* list = list_create_ex(NODE_ALLOC_POOL, 4);
+	if (list == NULL) {
+		return 1;
+	}
 
 	// 뒤에 노드 5개 추가 (0~4)
 	for (int i = 0; i < 5; i++) {
@@ -198,7 +253,7 @@ int main(void) {
 	// 세 번째 노드 뒤에 새 노드 삽입
 	printf("\n세번째 노드 뒤에 3000삽입\n");
 	Node* third_node = list_get_node(list, 2);
-	list_insert_after(third_node, 3000);
+	list_insert_after(list, third_node, 3000);
 
 	// 수정된 리스트 출력
 	printf("\n수정된 리스트 :\n");
@@ -207,6 +262,23 @@ int main(void) {
 		printf("list[%zu]: %d\n", i, current->data);
 	}
 
+	// 앞/뒤 노드 삭제 후 다시 삽입 (free list 에 돌아간 노드가 재사용되므로 슬랩 수는 그대로)
+	NodePoolStats stats;
+	list_pool_stats(list, &stats);
+	printf("\n삭제 전 슬랩 수: %zu (사용 중인 노드: %zu)\n", stats.live_slabs, stats.nodes_in_use);
+	list_remove_head(list);
+	list_remove_tail(list);
+	list_push_back(list, 7);
+	list_push_front(list, 8);
+	list_pool_stats(list, &stats);
+	printf("삭제/재삽입 후 슬랩 수: %zu (사용 중인 노드: %zu)\n", stats.live_slabs, stats.nodes_in_use);
+
+	printf("\n최종 리스트 :\n");
+	for (size_t i = 0; i < list_size(list); i++) {
+		Node* current = list_get_node(list, i);
+		printf("list[%zu]: %d\n", i, current->data);
+	}
+
 	// 리스트 메모리 해제
 	printf("\n리스트 메모리 해제\n");
 	list_destroy(list);
@@ -214,6 +286,7 @@ int main(void) {
 	return 0;
 
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -239,6 +312,8 @@ int main(void) {
 - 각 할당 후 NULL 체크로 메모리 부족 상황 처리
 - free()를 통한 적절한 메모리 해제
 - 메모리 누수 방지를 위한 체계적인 해제 로직
+- list_create_ex(NODE_ALLOC_POOL, ...) 로 생성하면 노드를 슬랩 단위로 할당하고
+  삭제된 노드를 free list 로 재사용 (정상 상태의 삽입/삭제에서 malloc/free 없음)
 4. 에러 처리
 -----------
 - 함수들은 작업 성공/실패를 나타내는 반환값 제공
@@ -250,7 +325,7 @@ int main(void) {
 - 생성: list_create(), node_create()
 - 삽입: list_push_front(), list_push_back(), list_insert_after()
 - 탐색: list_get_node()
-- 삭제: list_remove_node(), node_destroy()
+- 삭제: list_remove_target_node(), list_remove_head(), list_remove_tail()
 - 해제: list_destroy()
 6. 최적화 포인트
 ---------------
@@ -2,49 +2,50 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include "array_stack.h"
 
-// 스택의 기본 크기와 확장 비율 설정
+// 스택의 기본 크기와 축소 임계값 설정
 #define INITIAL_CAPACITY 8
-#define GROWTH_FACTOR 2
-#define SHRINK_THRESHOLD 0.25
+#define SHRINK_THRESHOLD 0.25       // ASTACK_SHRINK_QUARTER 축소 임계값
+#define HYSTERESIS_THRESHOLD 0.125  // ASTACK_SHRINK_HYSTERESIS 축소 임계값
 
-typedef int ElementType;
-
-// 스택 구조체 정의
-typedef struct {
-    ElementType* elements;  // 요소를 저장할 동적 배열
-    size_t size;           // 현재 저장된 요소의 수
-    size_t capacity;       // 현재 할당된 배열의 크기
-} Stack;
-
-/* 오류 처리를 위한 열거형 정의
- * - 스택 연산의 다양한 결과 상태를 표현
+/* 스택 생성 함수
+ * - 기본 정책(2배 확장, 25% 축소)으로 초기 크기의 스택을 생성
+ * - 반환값: 생성된 스택의 포인터 또는 실패 시 NULL
  */
-typedef enum {
-    STACK_OK,
-    STACK_EMPTY,
-    STACK_FULL,
-    STACK_MEMORY_ERROR
-} StackResult;
+ArrayStack* astack_create(void) {
+    ArrayStackPolicy policy = { ASTACK_GROWTH_GEOMETRIC, ASTACK_SHRINK_QUARTER, INITIAL_CAPACITY };
+    return astack_create_with_policy(&policy);
+}
 
-/* 스택 생성 함수
- * - 초기 크기의 스택을 동적으로 할당하고 초기화
+/* 정책을 지정하여 스택 생성
+ * - 매개변수: policy - 확장/축소 정책과 초기 용량 (NULL이면 기본 정책)
  * - 반환값: 생성된 스택의 포인터 또는 실패 시 NULL
  */
-Stack* stack_create(void) {
-    Stack* stack = (Stack*)malloc(sizeof(Stack));
+ArrayStack* astack_create_with_policy(const ArrayStackPolicy* policy) {
+    if (policy == NULL) {
+        return astack_create();
+    }
+
+    ArrayStack* stack = (ArrayStack*)malloc(sizeof(ArrayStack));
     if (stack == NULL) {
         return NULL;
     }
 
-    stack->elements = (ElementType*)malloc(INITIAL_CAPACITY * sizeof(ElementType));
+    stack->policy = *policy;
+    if (stack->policy.initial_capacity == 0) {
+        stack->policy.initial_capacity = INITIAL_CAPACITY;
+    }
+
+    stack->elements = (ArrayStackElement*)malloc(stack->policy.initial_capacity * sizeof(ArrayStackElement));
     if (stack->elements == NULL) {
         free(stack);
         return NULL;
     }
 
     stack->size = 0;
-    stack->capacity = INITIAL_CAPACITY;
+    stack->capacity = stack->policy.initial_capacity;
+    memset(&stack->stats, 0, sizeof(stack->stats));
     return stack;
 }
 
@@ -52,7 +53,7 @@ Stack* stack_create(void) {
  * - 매개변수: stack - 검사할 스택
  * - 반환값: 비어있으면 true, 아니면 false
  */
-bool stack_is_empty(const Stack* stack) {
+bool astack_is_empty(const ArrayStack* stack) {
     return (stack->size == 0);
 }
 
@@ -60,7 +61,7 @@ bool stack_is_empty(const Stack* stack) {
  * - 매개변수: stack - 검사할 스택
  * - 반환값: 가득 찼으면 true, 아니면 false
  */
-bool stack_is_full(const Stack* stack) {
+bool astack_is_full(const ArrayStack* stack) {
     return (stack->size == stack->capacity);
 }
 
@@ -68,7 +69,7 @@ bool stack_is_full(const Stack* stack) {
  * - 매개변수: stack - 대상 스택
  * - 반환값: 스택에 저장된 요소의 수
  */
-size_t stack_size(const Stack* stack) {
+size_t astack_size(const ArrayStack* stack) {
     return stack->size;
 }
 
@@ -76,7 +77,7 @@ size_t stack_size(const Stack* stack) {
  * - 매개변수: stack - 대상 스택
  * - 반환값: 스택의 현재 최대 용량
  */
-size_t stack_capacity(const Stack* stack) {
+size_t astack_capacity(const ArrayStack* stack) {
     return stack->capacity;
 }
 
@@ -84,85 +85,162 @@ size_t stack_capacity(const Stack* stack) {
  * - 매개변수: stack - 대상 스택, new_capacity - 새로운 용량
  * - 반환값: 성공 시 true, 실패 시 false
  */
-static bool stack_resize(Stack* stack, size_t new_capacity) {
-    ElementType* new_elements = (ElementType*)realloc(stack->elements,
-        new_capacity * sizeof(ElementType));
+static bool stack_resize(ArrayStack* stack, size_t new_capacity) {
+    ArrayStackElement* new_elements = (ArrayStackElement*)realloc(stack->elements,
+        new_capacity * sizeof(ArrayStackElement));
     if (new_elements == NULL) {
         return false;
     }
 
+    if (new_capacity > stack->capacity) {
+        stack->stats.grow_count++;
+    }
+    else {
+        stack->stats.shrink_count++;
+    }
+    stack->stats.elements_copied += stack->size;
     stack->elements = new_elements;
     stack->capacity = new_capacity;
     return true;
 }
 
+/* 확장 정책에 따른 다음 용량 계산
+ * - 매개변수: stack - 대상 스택, required - 최소로 필요한 용량
+ * - 반환값: 새 용량 (required 이상)
+ */
+static size_t stack_grow_capacity(const ArrayStack* stack, size_t required) {
+    size_t new_capacity = stack->capacity;
+    while (new_capacity < required) {
+        if (stack->policy.growth == ASTACK_GROWTH_HALF) {
+            new_capacity += new_capacity / 2 + 1;  // 작은 용량에서도 늘어나도록 +1
+        }
+        else {
+            new_capacity = new_capacity * 2 + (new_capacity == 0);
+        }
+    }
+    return new_capacity;
+}
+
+/* 축소 정책에 따라 pop 이후 용량 축소
+ * - 매개변수: stack - 대상 스택
+ */
+static void stack_maybe_shrink(ArrayStack* stack) {
+    double threshold;
+    switch (stack->policy.shrink) {
+    case ASTACK_SHRINK_QUARTER:
+        threshold = SHRINK_THRESHOLD;
+        break;
+    case ASTACK_SHRINK_HYSTERESIS:
+        // 절반으로 줄여도 25% 이하만 사용하므로, 다시 확장되려면 4배로 늘어나야 함
+        threshold = HYSTERESIS_THRESHOLD;
+        break;
+    default:
+        return;
+    }
+
+    if (stack->size < stack->capacity * threshold &&
+        stack->capacity > stack->policy.initial_capacity) {
+        size_t new_capacity = stack->capacity / 2;
+        if (new_capacity < stack->policy.initial_capacity) {
+            new_capacity = stack->policy.initial_capacity;
+        }
+        stack_resize(stack, new_capacity);  // 실패해도 계속 진행
+    }
+}
+
 /* 스택에 요소 추가 (push)
  * - 매개변수: stack - 대상 스택, value - 추가할 값
- * - 반환값: 연산 결과를 나타내는 StackResult
+ * - 반환값: 연산 결과를 나타내는 ArrayStackResult
  */
-StackResult stack_push(Stack* stack, ElementType value) {
-    if (stack_is_full(stack)) {
-        size_t new_capacity = stack->capacity * GROWTH_FACTOR;
+ArrayStackResult astack_push(ArrayStack* stack, ArrayStackElement value) {
+    if (astack_is_full(stack)) {
+        size_t new_capacity = stack_grow_capacity(stack, stack->size + 1);
         if (!stack_resize(stack, new_capacity)) {
-            return STACK_MEMORY_ERROR;
+            return ASTACK_MEMORY_ERROR;
         }
     }
 
     stack->elements[stack->size++] = value;
-    return STACK_OK;
+    return ASTACK_OK;
 }
 
 /* 스택에서 요소 제거 (pop)
  * - 매개변수: stack - 대상 스택, value - 제거된 값을 저장할 포인터
- * - 반환값: 연산 결과를 나타내는 StackResult
+ * - 반환값: 연산 결과를 나타내는 ArrayStackResult
  */
-StackResult stack_pop(Stack* stack, ElementType* value) {
-    if (stack_is_empty(stack)) {
-        return STACK_EMPTY;
+ArrayStackResult astack_pop(ArrayStack* stack, ArrayStackElement* value) {
+    if (astack_is_empty(stack)) {
+        return ASTACK_EMPTY;
     }
 
     *value = stack->elements[--stack->size];
 
-    // 스택 크기가 충분히 작아지면 배열 크기 축소
-    if (stack->size < stack->capacity * SHRINK_THRESHOLD &&
-        stack->capacity > INITIAL_CAPACITY) {
-        size_t new_capacity = stack->capacity / GROWTH_FACTOR;
-        if (new_capacity < INITIAL_CAPACITY) {
-            new_capacity = INITIAL_CAPACITY;
-        }
-        stack_resize(stack, new_capacity);  // 실패해도 계속 진행
-    }
+    // 스택 크기가 충분히 작아지면 정책에 따라 배열 크기 축소
+    stack_maybe_shrink(stack);
 
-    return STACK_OK;
+    return ASTACK_OK;
 }
 
 /* 스택의 맨 위 요소 확인 (peek)
  * - 매개변수: stack - 대상 스택, value - 값을 저장할 포인터
- * - 반환값: 연산 결과를 나타내는 StackResult
+ * - 반환값: 연산 결과를 나타내는 ArrayStackResult
  */
-StackResult stack_peek(const Stack* stack, ElementType* value) {
-    if (stack_is_empty(stack)) {
-        return STACK_EMPTY;
+ArrayStackResult astack_peek(const ArrayStack* stack, ArrayStackElement* value) {
+    if (astack_is_empty(stack)) {
+        return ASTACK_EMPTY;
     }
 
     *value = stack->elements[stack->size - 1];
-    return STACK_OK;
+    return ASTACK_OK;
 }
 
 /* 스택 초기화 (clear)
+ * - ASTACK_SHRINK_NEVER 정책이면 용량을 유지하고, 그 외에는 초기 용량으로 복귀
  * - 매개변수: stack - 초기화할 스택
  */
-void stack_clear(Stack* stack) {
+void astack_clear(ArrayStack* stack) {
     stack->size = 0;
-    if (stack->capacity > INITIAL_CAPACITY) {
-        stack_resize(stack, INITIAL_CAPACITY);  // 실패해도 계속 진행
+    if (stack->policy.shrink != ASTACK_SHRINK_NEVER &&
+        stack->capacity > stack->policy.initial_capacity) {
+        stack_resize(stack, stack->policy.initial_capacity);  // 실패해도 계속 진행
     }
 }
 
+/* 용량 미리 확보 (reserve)
+ * - 매개변수: stack - 대상 스택, capacity - 최소로 확보할 용량
+ * - 반환값: 연산 결과를 나타내는 ArrayStackResult
+ */
+ArrayStackResult astack_reserve(ArrayStack* stack, size_t capacity) {
+    if (capacity <= stack->capacity) {
+        return ASTACK_OK;
+    }
+    return stack_resize(stack, capacity) ? ASTACK_OK : ASTACK_MEMORY_ERROR;
+}
+
+/* 용량을 현재 크기에 맞춤 (shrink_to_fit)
+ * - 빈 스택은 요소 1개 분량만 남김 (realloc 크기 0 회피)
+ * - 매개변수: stack - 대상 스택
+ * - 반환값: 연산 결과를 나타내는 ArrayStackResult
+ */
+ArrayStackResult astack_shrink_to_fit(ArrayStack* stack) {
+    size_t new_capacity = stack->size > 0 ? stack->size : 1;
+    if (new_capacity >= stack->capacity) {
+        return ASTACK_OK;
+    }
+    return stack_resize(stack, new_capacity) ? ASTACK_OK : ASTACK_MEMORY_ERROR;
+}
+
+/* 재할당 통계 조회
+ * - 매개변수: stack - 대상 스택, stats - 결과를 저장할 구조체
+ */
+void astack_resize_stats(const ArrayStack* stack, ArrayStackResizeStats* stats) {
+    *stats = stack->stats;
+}
+
 /* 스택 메모리 해제
  * - 매개변수: stack - 해제할 스택
  */
-void stack_destroy(Stack* stack) {
+void astack_destroy(ArrayStack* stack) {
     free(stack->elements);
     free(stack);
 }
@@ -170,13 +248,13 @@ void stack_destroy(Stack* stack) {
 /* 스택의 모든 요소 출력
  * - 매개변수: stack - 출력할 스택
  */
-void stack_print(const Stack* stack) {
-    if (stack_is_empty(stack)) {
-        printf("Stack is empty\n");
+void astack_print(const ArrayStack* stack) {
+    if (astack_is_empty(stack)) {
+        printf("ArrayStack is empty\n");
         return;
     }
 
-    printf("Stack (size=%zu, capacity=%zu): ", stack->size, stack->capacity);
+    printf("ArrayStack (size=%zu, capacity=%zu): ", stack->size, stack->capacity);
     printf("TOP [ ");
     for (size_t i = stack->size; i > 0; i--) {
         printf("%d ", stack->elements[i - 1]);
@@ -187,19 +265,22 @@ void stack_print(const Stack* stack) {
 /* 스택의 상태 정보 출력
  * - 매개변수: stack - 상태를 확인할 스택
  */
-void stack_status(const Stack* stack) {
+void astack_status(const ArrayStack* stack) {
     printf("\nStack Status:\n");
     printf("- Size: %zu\n", stack->size);
     printf("- Capacity: %zu\n", stack->capacity);
-    printf("- Empty: %s\n", stack_is_empty(stack) ? "Yes" : "No");
-    printf("- Full: %s\n", stack_is_full(stack) ? "Yes" : "No");
+    printf("- Empty: %s\n", astack_is_empty(stack) ? "Yes" : "No");
+    printf("- Full: %s\n", astack_is_full(stack) ? "Yes" : "No");
     float usage = stack->size / (float)stack->capacity * 100;
     printf("- Usage: %.1f%%\n", usage);
+    printf("- Resizes: %zu grow, %zu shrink (%zu elements copied)\n",
+        stack->stats.grow_count, stack->stats.shrink_count, stack->stats.elements_copied);
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 함수 */
 void print_menu(void) {
-    printf("\n=== Array-based Stack Menu ===\n");
+    printf("\n=== Array-based ArrayStack Menu ===\n");
     printf("1. Push\n");
     printf("2. Pop\n");
     printf("3. Peek\n");
@@ -215,15 +296,15 @@ void print_menu(void) {
 /* 에러 메시지 출력 함수
  * - 매개변수: result - 스택 연산 결과
  */
-void print_error(StackResult result) {
+void print_error(ArrayStackResult result) {
     switch (result) {
-    case STACK_EMPTY:
-        printf("Error: Stack is empty\n");
+    case ASTACK_EMPTY:
+        printf("Error: ArrayStack is empty\n");
         break;
-    case STACK_FULL:
-        printf("Error: Stack is full\n");
+    case ASTACK_FULL:
+        printf("Error: ArrayStack is full\n");
         break;
-    case STACK_MEMORY_ERROR:
+    case ASTACK_MEMORY_ERROR:
         printf("Error: Memory allocation failed\n");
         break;
     default:
@@ -232,15 +313,15 @@ void print_error(StackResult result) {
 }
 
 int main(void) {
-    Stack* stack = stack_create();
+    ArrayStack* stack = astack_create();
     if (stack == NULL) {
         printf("Failed to create stack\n");
         return 1;
     }
 
     int choice;
-    ElementType value;
-    StackResult result;
+    ArrayStackElement value;
+    ArrayStackResult result;
 
     do {
         print_menu();
@@ -254,8 +335,8 @@ int main(void) {
         case 1:  // Push
             printf("Enter value to push: ");
             scanf("%d", &value);
-            result = stack_push(stack, value);
-            if (result == STACK_OK) {
+            result = astack_push(stack, value);
+            if (result == ASTACK_OK) {
                 printf("Successfully pushed %d\n", value);
             }
             else {
@@ -264,8 +345,8 @@ int main(void) {
             break;
 
         case 2:  // Pop
-            result = stack_pop(stack, &value);
-            if (result == STACK_OK) {
+            result = astack_pop(stack, &value);
+            if (result == ASTACK_OK) {
                 printf("Popped value: %d\n", value);
             }
             else {
@@ -274,8 +355,8 @@ int main(void) {
             break;
 
         case 3:  // Peek
-            result = stack_peek(stack, &value);
-            if (result == STACK_OK) {
+            result = astack_peek(stack, &value);
+            if (result == ASTACK_OK) {
                 printf("Top value: %d\n", value);
             }
             else {
@@ -284,24 +365,24 @@ int main(void) {
             break;
 
         case 4:  // Print stack
-            stack_print(stack);
+            astack_print(stack);
             break;
 
         case 5:  // Check if empty
-            printf("Stack is %sempty\n", stack_is_empty(stack) ? "" : "not ");
+            printf("ArrayStack is %sempty\n", astack_is_empty(stack) ? "" : "not ");
             break;
 
         case 6:  // Get size
-            printf("Stack size: %zu\n", stack_size(stack));
+            printf("ArrayStack size: %zu\n", astack_size(stack));
             break;
 
         case 7:  // Clear stack
-            stack_clear(stack);
-            printf("Stack cleared\n");
+            astack_clear(stack);
+            printf("ArrayStack cleared\n");
             break;
 
         case 8:  // Show stack status
-            stack_status(stack);
+            astack_status(stack);
             break;
 
         case 0:  // Exit
@@ -313,9 +394,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    stack_destroy(stack);
+    astack_destroy(stack);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -338,7 +420,7 @@ int main(void) {
 
 3. 핵심 데이터 구조
 ----------------
-Stack 구조체:
+ArrayStack 구조체:
 - elements: 요소 저장 배열
 - size: 현재 요소 수
 - capacity: 현재 용량
@@ -356,11 +438,13 @@ Stack 구조체:
 
 5. 메모리 관리 전략
 ----------------
-- 동적 크기 조정
-  * 성장 계수: 2배
-  * 축소 임계값: 25%
-- 초기 용량: 8
+- 동적 크기 조정 (astack_create_with_policy 로 선택)
+  * 확장 정책: 2배(기본) / 1.5배
+  * 축소 정책: 25% 미만 시 절반(기본) / 축소 안 함 / 12.5% 미만 시 절반(히스테리시스)
+- 초기 용량: 8 (정책으로 변경 가능)
 - 최소 용량 유지
+- reserve / shrink_to_fit 로 용량 직접 관리
+- 재할당 횟수와 복사한 요소 수를 통계로 제공
 
 6. 오류 처리
 ----------
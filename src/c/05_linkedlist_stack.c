@@ -2,36 +2,15 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
-
-typedef int ElementType;
-
-// 노드 구조체 정의
-typedef struct Node {
-    ElementType data;
-    struct Node* next;
-} Node;
-
-// 스택 구조체 정의
-typedef struct {
-    Node* top;      // 스택의 최상위 노드를 가리키는 포인터
-    size_t size;    // 현재 스택에 저장된 요소의 수
-} Stack;
-
-/* 오류 처리를 위한 열거형 정의
- * - 스택 연산의 다양한 결과 상태를 표현
- */
-typedef enum {
-    STACK_OK,
-    STACK_EMPTY,
-    STACK_MEMORY_ERROR
-} StackResult;
+#include "linkedlist_stack.h"
 
 /* 새로운 노드 생성
- * - 매개변수: data - 저장할 데이터
+ * - 스택의 노드 풀에서 노드를 할당 (풀 모드에서는 free list 재사용)
+ * - 매개변수: stack - 대상 스택, data - 저장할 데이터
  * - 반환값: 생성된 노드의 포인터 또는 실패 시 NULL
  */
-static Node* create_node(ElementType data) {
-    Node* newNode = (Node*)malloc(sizeof(Node));
+static LinkedStackNode* create_node(LinkedStack* stack, LinkedStackElement data) {
+    LinkedStackNode* newNode = (LinkedStackNode*)node_pool_alloc(&stack->pool);
     if (newNode == NULL) {
         return NULL;
     }
@@ -41,16 +20,27 @@ static Node* create_node(ElementType data) {
 }
 
 /* 스택 생성
- * - 새로운 빈 스택을 동적으로 할당하고 초기화
+ * - 노드마다 malloc/free 하는 기본 방식의 빈 스택 생성
+ * - 반환값: 생성된 스택의 포인터 또는 실패 시 NULL
+ */
+LinkedStack* lstack_create(void) {
+    return lstack_create_ex(NODE_ALLOC_MALLOC, 0);
+}
+
+/* 노드 할당 방식을 지정하여 스택 생성
+ * - NODE_ALLOC_POOL 이면 노드를 슬랩 단위로 할당하고 pop 된 노드를 재사용
+ *   (정상 상태의 push/pop 반복에서 malloc/free 호출 없음)
+ * - 매개변수: mode - 노드 할당 방식, nodes_per_slab - 슬랩당 노드 수 (0이면 기본값)
  * - 반환값: 생성된 스택의 포인터 또는 실패 시 NULL
  */
-Stack* stack_create(void) {
-    Stack* stack = (Stack*)malloc(sizeof(Stack));
+LinkedStack* lstack_create_ex(NodeAllocMode mode, size_t nodes_per_slab) {
+    LinkedStack* stack = (LinkedStack*)malloc(sizeof(LinkedStack));
     if (stack == NULL) {
         return NULL;
     }
     stack->top = NULL;
     stack->size = 0;
+    node_pool_init(&stack->pool, mode, sizeof(LinkedStackNode), nodes_per_slab);
     return stack;
 }
 
@@ -58,7 +48,7 @@ Stack* stack_create(void) {
  * - 매개변수: stack - 검사할 스택
  * - 반환값: 비어있으면 true, 아니면 false
  */
-bool stack_is_empty(const Stack* stack) {
+bool lstack_is_empty(const LinkedStack* stack) {
     return (stack->size == 0);
 }
 
@@ -66,85 +56,93 @@ bool stack_is_empty(const Stack* stack) {
  * - 매개변수: stack - 대상 스택
  * - 반환값: 스택에 저장된 요소의 수
  */
-size_t stack_size(const Stack* stack) {
+size_t lstack_size(const LinkedStack* stack) {
     return stack->size;
 }
 
 /* 스택에 요소 추가 (push)
  * - 매개변수: stack - 대상 스택, value - 추가할 값
- * - 반환값: 연산 결과를 나타내는 StackResult
+ * - 반환값: 연산 결과를 나타내는 LinkedStackResult
  */
-StackResult stack_push(Stack* stack, ElementType value) {
-    Node* newNode = create_node(value);
+LinkedStackResult lstack_push(LinkedStack* stack, LinkedStackElement value) {
+    LinkedStackNode* newNode = create_node(stack, value);
     if (newNode == NULL) {
-        return STACK_MEMORY_ERROR;
+        return LSTACK_MEMORY_ERROR;
     }
 
     newNode->next = stack->top;
     stack->top = newNode;
     stack->size++;
-    return STACK_OK;
+    return LSTACK_OK;
 }
 
 /* 스택에서 요소 제거 (pop)
  * - 매개변수: stack - 대상 스택, value - 제거된 값을 저장할 포인터
- * - 반환값: 연산 결과를 나타내는 StackResult
+ * - 반환값: 연산 결과를 나타내는 LinkedStackResult
  */
-StackResult stack_pop(Stack* stack, ElementType* value) {
-    if (stack_is_empty(stack)) {
-        return STACK_EMPTY;
+LinkedStackResult lstack_pop(LinkedStack* stack, LinkedStackElement* value) {
+    if (lstack_is_empty(stack)) {
+        return LSTACK_EMPTY;
     }
 
-    Node* temp = stack->top;
+    LinkedStackNode* temp = stack->top;
     *value = temp->data;
     stack->top = temp->next;
-    free(temp);
+    node_pool_free(&stack->pool, temp);
     stack->size--;
-    return STACK_OK;
+    return LSTACK_OK;
 }
 
 /* 스택의 맨 위 요소 확인 (peek)
  * - 매개변수: stack - 대상 스택, value - 값을 저장할 포인터
- * - 반환값: 연산 결과를 나타내는 StackResult
+ * - 반환값: 연산 결과를 나타내는 LinkedStackResult
  */
-StackResult stack_peek(const Stack* stack, ElementType* value) {
-    if (stack_is_empty(stack)) {
-        return STACK_EMPTY;
+LinkedStackResult lstack_peek(const LinkedStack* stack, LinkedStackElement* value) {
+    if (lstack_is_empty(stack)) {
+        return LSTACK_EMPTY;
     }
 
     *value = stack->top->data;
-    return STACK_OK;
+    return LSTACK_OK;
 }
 
 /* 스택 초기화 (clear)
+ * - 풀 모드에서는 노드를 하나씩 반환하지 않고 슬랩을 한꺼번에 해제
  * - 매개변수: stack - 초기화할 스택
  */
-void stack_clear(Stack* stack) {
-    ElementType dummy;
-    while (!stack_is_empty(stack)) {
-        stack_pop(stack, &dummy);
+void lstack_clear(LinkedStack* stack) {
+    if (stack->pool.mode == NODE_ALLOC_POOL) {
+        node_pool_release(&stack->pool);
+        stack->top = NULL;
+        stack->size = 0;
+        return;
+    }
+
+    LinkedStackElement dummy;
+    while (!lstack_is_empty(stack)) {
+        lstack_pop(stack, &dummy);
     }
 }
 
 /* 스택 메모리 해제
  * - 매개변수: stack - 해제할 스택
  */
-void stack_destroy(Stack* stack) {
-    stack_clear(stack);
+void lstack_destroy(LinkedStack* stack) {
+    lstack_clear(stack);
     free(stack);
 }
 
 /* 스택의 모든 요소 출력
  * - 매개변수: stack - 출력할 스택
  */
-void stack_print(const Stack* stack) {
-    if (stack_is_empty(stack)) {
-        printf("Stack is empty\n");
+void lstack_print(const LinkedStack* stack) {
+    if (lstack_is_empty(stack)) {
+        printf("LinkedStack is empty\n");
         return;
     }
 
-    printf("Stack (size=%zu): TOP [ ", stack->size);
-    Node* current = stack->top;
+    printf("LinkedStack (size=%zu): TOP [ ", stack->size);
+    LinkedStackNode* current = stack->top;
     while (current != NULL) {
         printf("%d ", current->data);
         current = current->next;
@@ -155,21 +153,37 @@ void stack_print(const Stack* stack) {
 /* 스택의 상태 정보 출력
  * - 매개변수: stack - 상태를 확인할 스택
  */
-void stack_status(const Stack* stack) {
+void lstack_status(const LinkedStack* stack) {
     printf("\nStack Status:\n");
     printf("- Size: %zu\n", stack->size);
-    printf("- Empty: %s\n", stack_is_empty(stack) ? "Yes" : "No");
+    printf("- Empty: %s\n", lstack_is_empty(stack) ? "Yes" : "No");
 
     // 메모리 사용량 계산 (대략적)
-    size_t stack_memory = sizeof(Stack);
-    size_t node_memory = sizeof(Node) * stack->size;
+    size_t stack_memory = sizeof(LinkedStack);
+    size_t node_memory = sizeof(LinkedStackNode) * stack->size;
     printf("- Memory usage: %zu bytes (overhead: %zu bytes, nodes: %zu bytes)\n",
         stack_memory + node_memory, stack_memory, node_memory);
+
+    if (stack->pool.mode == NODE_ALLOC_POOL) {
+        NodePoolStats stats;
+        lstack_pool_stats(stack, &stats);
+        printf("- LinkedStackNode pool: %zu live slabs x %zu nodes (in use: %zu, free: %zu, reserved: %zu bytes)\n",
+            stats.live_slabs, stats.nodes_per_slab, stats.nodes_in_use,
+            stats.nodes_free, stats.bytes_reserved);
+    }
+}
+
+/* 노드 풀 통계 조회
+ * - 매개변수: stack - 대상 스택, stats - 결과를 저장할 구조체
+ */
+void lstack_pool_stats(const LinkedStack* stack, NodePoolStats* stats) {
+    node_pool_get_stats(&stack->pool, stats);
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 함수 */
 void print_menu(void) {
-    printf("\n=== Linked List-based Stack Menu ===\n");
+    printf("\n=== Linked List-based LinkedStack Menu ===\n");
     printf("1. Push\n");
     printf("2. Pop\n");
     printf("3. Peek\n");
@@ -185,12 +199,12 @@ void print_menu(void) {
 /* 에러 메시지 출력 함수
  * - 매개변수: result - 스택 연산 결과
  */
-void print_error(StackResult result) {
+void print_error(LinkedStackResult result) {
     switch (result) {
-    case STACK_EMPTY:
-        printf("Error: Stack is empty\n");
+    case LSTACK_EMPTY:
+        printf("Error: LinkedStack is empty\n");
         break;
-    case STACK_MEMORY_ERROR:
+    case LSTACK_MEMORY_ERROR:
         printf("Error: Memory allocation failed\n");
         break;
     default:
@@ -199,15 +213,16 @@ void print_error(StackResult result) {
 }
 
 int main(void) {
-    Stack* stack = stack_create();
+    // 데모에서는 슬랩 동작을 확인하기 쉽도록 작은 슬랩의 노드 풀 사용
+    LinkedStack* stack = lstack_create_ex(NODE_ALLOC_POOL, 4);
     if (stack == NULL) {
         printf("Failed to create stack\n");
         return 1;
     }
 
     int choice;
-    ElementType value;
-    StackResult result;
+    LinkedStackElement value;
+    LinkedStackResult result;
 
     do {
         print_menu();
@@ -221,8 +236,8 @@ int main(void) {
         case 1:  // Push
             printf("Enter value to push: ");
             scanf("%d", &value);
-            result = stack_push(stack, value);
-            if (result == STACK_OK) {
+            result = lstack_push(stack, value);
+            if (result == LSTACK_OK) {
                 printf("Successfully pushed %d\n", value);
             }
             else {
@@ -231,8 +246,8 @@ int main(void) {
             break;
 
         case 2:  // Pop
-            result = stack_pop(stack, &value);
-            if (result == STACK_OK) {
+            result = lstack_pop(stack, &value);
+            if (result == LSTACK_OK) {
                 printf("Popped value: %d\n", value);
             }
             else {
@@ -241,8 +256,8 @@ int main(void) {
             break;
 
         case 3:  // Peek
-            result = stack_peek(stack, &value);
-            if (result == STACK_OK) {
+            result = lstack_peek(stack, &value);
+            if (result == LSTACK_OK) {
                 printf("Top value: %d\n", value);
             }
             else {
@@ -251,24 +266,24 @@ int main(void) {
             break;
 
         case 4:  // Print stack
-            stack_print(stack);
+            lstack_print(stack);
             break;
 
         case 5:  // Check if empty
-            printf("Stack is %sempty\n", stack_is_empty(stack) ? "" : "not ");
+            printf("LinkedStack is %sempty\n", lstack_is_empty(stack) ? "" : "not ");
             break;
 
         case 6:  // Get size
-            printf("Stack size: %zu\n", stack_size(stack));
+            printf("LinkedStack size: %zu\n", lstack_size(stack));
             break;
 
         case 7:  // Clear stack
-            stack_clear(stack);
-            printf("Stack cleared\n");
+            lstack_clear(stack);
+            printf("LinkedStack cleared\n");
             break;
 
         case 8:  // Show stack status
-            stack_status(stack);
+            lstack_status(stack);
             break;
 
         case 0:  // Exit
@@ -280,9 +295,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    stack_destroy(stack);
+    lstack_destroy(stack);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -312,11 +328,11 @@ int main(void) {
 
 3. 구현 특징
 ----------
-Node 구조체:
+LinkedStackNode 구조체:
 - data: 실제 데이터
 - next: 다음 노드 포인터
 
-Stack 구조체:
+LinkedStack 구조체:
 - top: 최상위 노드 포인터
 - size: 현재 요소 수
 
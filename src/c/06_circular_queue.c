@@ -1,43 +1,24 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
+#include "circular_queue.h"
 
 // 큐의 기본 크기 설정
 #define INITIAL_CAPACITY 8
 
-typedef int ElementType;
-
-// 큐 구조체 정의
-typedef struct {
-    ElementType* elements;  // 요소를 저장할 동적 배열
-    size_t capacity;       // 큐의 최대 용량
-    size_t front;          // 첫 번째 요소의 인덱스
-    size_t rear;           // 마지막 요소 다음의 인덱스
-    size_t size;           // 현재 저장된 요소의 수
-} CircularQueue;
-
-/* 오류 처리를 위한 열거형 정의
- * - 큐 연산의 다양한 결과 상태를 표현
- */
-typedef enum {
-    QUEUE_OK,
-    QUEUE_EMPTY,
-    QUEUE_FULL,
-    QUEUE_MEMORY_ERROR
-} QueueResult;
-
 /* 큐 생성 함수
  * - 초기 크기의 원형 큐를 동적으로 할당하고 초기화
  * - 반환값: 생성된 큐의 포인터 또는 실패 시 NULL
  */
-CircularQueue* queue_create(void) {
+CircularQueue* cqueue_create(void) {
     CircularQueue* queue = (CircularQueue*)malloc(sizeof(CircularQueue));
     if (queue == NULL) {
         return NULL;
     }
 
-    queue->elements = (ElementType*)malloc(INITIAL_CAPACITY * sizeof(ElementType));
+    queue->elements = (CircularQueueElement*)malloc(INITIAL_CAPACITY * sizeof(CircularQueueElement));
     if (queue->elements == NULL) {
         free(queue);
         return NULL;
@@ -54,7 +35,7 @@ CircularQueue* queue_create(void) {
  * - 매개변수: queue - 검사할 큐
  * - 반환값: 비어있으면 true, 아니면 false
  */
-bool queue_is_empty(const CircularQueue* queue) {
+bool cqueue_is_empty(const CircularQueue* queue) {
     return (queue->size == 0);
 }
 
@@ -62,7 +43,7 @@ bool queue_is_empty(const CircularQueue* queue) {
  * - 매개변수: queue - 검사할 큐
  * - 반환값: 가득 찼으면 true, 아니면 false
  */
-bool queue_is_full(const CircularQueue* queue) {
+bool cqueue_is_full(const CircularQueue* queue) {
     return (queue->size == queue->capacity);
 }
 
@@ -70,7 +51,7 @@ bool queue_is_full(const CircularQueue* queue) {
  * - 매개변수: queue - 대상 큐
  * - 반환값: 큐에 저장된 요소의 수
  */
-size_t queue_size(const CircularQueue* queue) {
+size_t cqueue_size(const CircularQueue* queue) {
     return queue->size;
 }
 
@@ -78,7 +59,7 @@ size_t queue_size(const CircularQueue* queue) {
  * - 매개변수: queue - 대상 큐
  * - 반환값: 큐의 최대 용량
  */
-size_t queue_capacity(const CircularQueue* queue) {
+size_t cqueue_capacity(const CircularQueue* queue) {
     return queue->capacity;
 }
 
@@ -90,92 +71,236 @@ static size_t next_position(size_t current, size_t capacity) {
     return (current + 1) % capacity;
 }
 
-/* 큐 확장
- * - 매개변수: queue - 대상 큐
+/* 앞에서부터 count개의 요소를 dest로 복사 (순서 유지)
+ * - 원형 배열이 감겨 있으면 [front, capacity)와 [0, ...) 두 구간을 memcpy 2회로 복사
+ * - 매개변수: queue - 대상 큐, dest - 복사할 배열, count - 복사할 요소 수 (size 이하)
+ */
+static void queue_copy_front(const CircularQueue* queue, CircularQueueElement* dest, size_t count) {
+    size_t first = queue->capacity - queue->front;
+    if (first > count) {
+        first = count;
+    }
+    if (first > 0) {
+        memcpy(dest, queue->elements + queue->front, first * sizeof(CircularQueueElement));
+    }
+    if (count > first) {
+        memcpy(dest + first, queue->elements, (count - first) * sizeof(CircularQueueElement));
+    }
+}
+
+/* 큐 크기 변경
+ * - 매개변수: queue - 대상 큐, new_capacity - 새 용량 (size 이상)
  * - 반환값: 성공 시 true, 실패 시 false
  */
-static bool queue_resize(CircularQueue* queue) {
-    size_t new_capacity = queue->capacity * 2;
-    ElementType* new_elements = (ElementType*)malloc(new_capacity * sizeof(ElementType));
+static bool queue_resize(CircularQueue* queue, size_t new_capacity) {
+    CircularQueueElement* new_elements = (CircularQueueElement*)malloc(new_capacity * sizeof(CircularQueueElement));
     if (new_elements == NULL) {
         return false;
     }
 
-    // 기존 요소들을 새 배열로 복사 (순서 유지)
-    size_t j = 0;
-    size_t i = queue->front;
-    for (size_t count = 0; count < queue->size; count++) {
-        new_elements[j] = queue->elements[i];
-        i = next_position(i, queue->capacity);
-        j++;
-    }
+    // 기존 요소들을 새 배열의 앞쪽으로 복사 (순서 유지)
+    queue_copy_front(queue, new_elements, queue->size);
 
     free(queue->elements);
     queue->elements = new_elements;
     queue->capacity = new_capacity;
     queue->front = 0;
-    queue->rear = queue->size;
+    queue->rear = queue->size % new_capacity;
     return true;
 }
 
 /* 큐에 요소 추가 (enqueue)
  * - 매개변수: queue - 대상 큐, value - 추가할 값
- * - 반환값: 연산 결과를 나타내는 QueueResult
+ * - 반환값: 연산 결과를 나타내는 CircularQueueResult
  */
-QueueResult queue_enqueue(CircularQueue* queue, ElementType value) {
-    if (queue_is_full(queue)) {
-        if (!queue_resize(queue)) {
-            return QUEUE_MEMORY_ERROR;
+CircularQueueResult cqueue_enqueue(CircularQueue* queue, CircularQueueElement value) {
+    if (cqueue_is_full(queue)) {
+        if (!queue_resize(queue, queue->capacity * 2)) {
+            return CQUEUE_MEMORY_ERROR;
         }
     }
 
     queue->elements[queue->rear] = value;
     queue->rear = next_position(queue->rear, queue->capacity);
     queue->size++;
-    return QUEUE_OK;
+    return CQUEUE_OK;
 }
 
 /* 큐에서 요소 제거 (dequeue)
  * - 매개변수: queue - 대상 큐, value - 제거된 값을 저장할 포인터
- * - 반환값: 연산 결과를 나타내는 QueueResult
+ * - 반환값: 연산 결과를 나타내는 CircularQueueResult
  */
-QueueResult queue_dequeue(CircularQueue* queue, ElementType* value) {
-    if (queue_is_empty(queue)) {
-        return QUEUE_EMPTY;
+CircularQueueResult cqueue_dequeue(CircularQueue* queue, CircularQueueElement* value) {
+    if (cqueue_is_empty(queue)) {
+        return CQUEUE_EMPTY;
     }
 
     *value = queue->elements[queue->front];
     queue->front = next_position(queue->front, queue->capacity);
     queue->size--;
-    return QUEUE_OK;
+    return CQUEUE_OK;
 }
 
 /* 큐의 맨 앞 요소 확인 (peek)
  * - 매개변수: queue - 대상 큐, value - 값을 저장할 포인터
- * - 반환값: 연산 결과를 나타내는 QueueResult
+ * - 반환값: 연산 결과를 나타내는 CircularQueueResult
  */
-QueueResult queue_peek(const CircularQueue* queue, ElementType* value) {
-    if (queue_is_empty(queue)) {
-        return QUEUE_EMPTY;
+CircularQueueResult cqueue_peek(const CircularQueue* queue, CircularQueueElement* value) {
+    if (cqueue_is_empty(queue)) {
+        return CQUEUE_EMPTY;
     }
 
     *value = queue->elements[queue->front];
-    return QUEUE_OK;
+    return CQUEUE_OK;
 }
 
 /* 큐 초기화 (clear)
  * - 매개변수: queue - 초기화할 큐
  */
-void queue_clear(CircularQueue* queue) {
+void cqueue_clear(CircularQueue* queue) {
     queue->front = 0;
     queue->rear = 0;
     queue->size = 0;
 }
 
+/* 용량 확보 (reserve)
+ * - 용량이 capacity 이상이 될 때까지 2배씩 늘림 (이미 충분하면 그대로)
+ * - 매개변수: queue - 대상 큐, capacity - 필요한 최소 용량
+ * - 반환값: 연산 결과를 나타내는 CircularQueueResult
+ */
+CircularQueueResult cqueue_reserve(CircularQueue* queue, size_t capacity) {
+    if (capacity <= queue->capacity) {
+        return CQUEUE_OK;
+    }
+
+    size_t new_capacity = queue->capacity;
+    while (new_capacity < capacity) {
+        if (new_capacity > SIZE_MAX / 2 / sizeof(CircularQueueElement)) {
+            return CQUEUE_MEMORY_ERROR;
+        }
+        new_capacity *= 2;
+    }
+    return queue_resize(queue, new_capacity) ? CQUEUE_OK : CQUEUE_MEMORY_ERROR;
+}
+
+/* 포인터가 큐의 요소 배열 안을 가리키는지 확인
+ * - 서로 다른 배열의 포인터는 대소 비교가 정의되지 않으므로 정수로 바꿔 비교
+ */
+static bool queue_contains_pointer(const CircularQueue* queue, const CircularQueueElement* pointer) {
+    uintptr_t begin = (uintptr_t)queue->elements;
+    uintptr_t end = (uintptr_t)(queue->elements + queue->capacity);
+    uintptr_t address = (uintptr_t)pointer;
+    return queue->elements != NULL && address >= begin && address < end;
+}
+
+/* 여러 요소를 한 번에 추가 (enqueue_n)
+ * - 공간이 부족하면 먼저 한 번만 확장한 뒤, 감기는 위치를 기준으로 memcpy 최대 2회
+ * - values 가 큐 자신의 배열(예: cqueue_peek_regions 로 얻은 구간)을 가리키면
+ *   확장이 그 배열을 해제하거나 복사 대상과 겹칠 수 있으므로 먼저 임시 배열로 복사
+ * - 전부 추가하거나 (CQUEUE_OK) 하나도 추가하지 않음 (CQUEUE_MEMORY_ERROR)
+ * - 매개변수: queue - 대상 큐, values - 추가할 값 배열, count - 요소 수
+ * - 반환값: 연산 결과를 나타내는 CircularQueueResult
+ */
+CircularQueueResult cqueue_enqueue_n(CircularQueue* queue, const CircularQueueElement* values, size_t count) {
+    CircularQueueElement* copy = NULL;
+
+    if (count == 0) {
+        return CQUEUE_OK;
+    }
+    if (count > SIZE_MAX - queue->size) {
+        return CQUEUE_MEMORY_ERROR;
+    }
+    if (queue_contains_pointer(queue, values)) {
+        if (count > SIZE_MAX / sizeof(CircularQueueElement)) {
+            return CQUEUE_MEMORY_ERROR;
+        }
+        copy = (CircularQueueElement*)malloc(count * sizeof(CircularQueueElement));
+        if (copy == NULL) {
+            return CQUEUE_MEMORY_ERROR;
+        }
+        memcpy(copy, values, count * sizeof(CircularQueueElement));
+        values = copy;
+    }
+    if (cqueue_reserve(queue, queue->size + count) != CQUEUE_OK) {
+        free(copy);
+        return CQUEUE_MEMORY_ERROR;
+    }
+
+    size_t first = queue->capacity - queue->rear;
+    if (first > count) {
+        first = count;
+    }
+    memcpy(queue->elements + queue->rear, values, first * sizeof(CircularQueueElement));
+    if (count > first) {
+        memcpy(queue->elements, values + first, (count - first) * sizeof(CircularQueueElement));
+    }
+
+    queue->rear = (queue->rear + count) % queue->capacity;
+    queue->size += count;
+    free(copy);
+    return CQUEUE_OK;
+}
+
+/* 여러 요소를 한 번에 꺼냄 (dequeue_n)
+ * - 매개변수: queue - 대상 큐, out - 꺼낸 값을 저장할 배열, max_count - 최대 요소 수
+ * - 반환값: 실제로 꺼낸 요소 수 (비어있으면 0)
+ */
+size_t cqueue_dequeue_n(CircularQueue* queue, CircularQueueElement* out, size_t max_count) {
+    size_t count = queue->size < max_count ? queue->size : max_count;
+    if (count == 0) {
+        return 0;
+    }
+
+    queue_copy_front(queue, out, count);
+    queue->front = (queue->front + count) % queue->capacity;
+    queue->size -= count;
+    return count;
+}
+
+/* 읽을 수 있는 연속 구간 조회 (복사 없음)
+ * - regions[0]은 front부터 배열 끝(또는 마지막 요소)까지, 감겨 있으면 regions[1]은 배열 처음부터
+ * - 처리한 요소는 queue_discard로 제거
+ * - 매개변수: queue - 대상 큐, regions - 구간을 저장할 배열 (2칸)
+ * - 반환값: 구간 수 (비어있으면 0, 최대 2)
+ */
+size_t cqueue_peek_regions(const CircularQueue* queue, CircularQueueRegion regions[2]) {
+    if (cqueue_is_empty(queue)) {
+        return 0;
+    }
+
+    size_t first = queue->capacity - queue->front;
+    if (first > queue->size) {
+        first = queue->size;
+    }
+    regions[0].data = queue->elements + queue->front;
+    regions[0].count = first;
+    if (queue->size == first) {
+        return 1;
+    }
+
+    regions[1].data = queue->elements;
+    regions[1].count = queue->size - first;
+    return 2;
+}
+
+/* 앞에서부터 count개의 요소를 값을 읽지 않고 제거
+ * - 매개변수: queue - 대상 큐, count - 제거할 요소 수
+ * - 반환값: 연산 결과를 나타내는 CircularQueueResult (요소가 부족하면 CQUEUE_EMPTY, 큐는 그대로)
+ */
+CircularQueueResult cqueue_discard(CircularQueue* queue, size_t count) {
+    if (count > queue->size) {
+        return CQUEUE_EMPTY;
+    }
+
+    queue->front = (queue->front + count) % queue->capacity;
+    queue->size -= count;
+    return CQUEUE_OK;
+}
+
 /* 큐 메모리 해제
  * - 매개변수: queue - 해제할 큐
  */
-void queue_destroy(CircularQueue* queue) {
+void cqueue_destroy(CircularQueue* queue) {
     free(queue->elements);
     free(queue);
 }
@@ -183,8 +308,8 @@ void queue_destroy(CircularQueue* queue) {
 /* 큐의 모든 요소 출력
  * - 매개변수: queue - 출력할 큐
  */
-void queue_print(const CircularQueue* queue) {
-    if (queue_is_empty(queue)) {
+void cqueue_print(const CircularQueue* queue) {
+    if (cqueue_is_empty(queue)) {
         printf("Queue is empty\n");
         return;
     }
@@ -203,14 +328,14 @@ void queue_print(const CircularQueue* queue) {
 /* 큐의 내부 상태 출력
  * - 매개변수: queue - 상태를 확인할 큐
  */
-void queue_status(const CircularQueue* queue) {
+void cqueue_status(const CircularQueue* queue) {
     printf("\nQueue Status:\n");
     printf("- Size: %zu\n", queue->size);
     printf("- Capacity: %zu\n", queue->capacity);
     printf("- Front Index: %zu\n", queue->front);
     printf("- Rear Index: %zu\n", queue->rear);
-    printf("- Empty: %s\n", queue_is_empty(queue) ? "Yes" : "No");
-    printf("- Full: %s\n", queue_is_full(queue) ? "Yes" : "No");
+    printf("- Empty: %s\n", cqueue_is_empty(queue) ? "Yes" : "No");
+    printf("- Full: %s\n", cqueue_is_full(queue) ? "Yes" : "No");
     float usage = (float)queue->size / queue->capacity * 100;
     printf("- Usage: %.1f%%\n", usage);
 
@@ -238,6 +363,7 @@ void queue_status(const CircularQueue* queue) {
     printf("]\n");
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 함수 */
 void print_menu(void) {
     printf("\n=== Circular Queue Menu ===\n");
@@ -250,6 +376,7 @@ void print_menu(void) {
     printf("7. Get size\n");
     printf("8. Clear queue\n");
     printf("9. Show queue status\n");
+    printf("10. Show contiguous regions\n");
     printf("0. Exit\n");
     printf("Choice: ");
 }
@@ -257,15 +384,15 @@ void print_menu(void) {
 /* 에러 메시지 출력 함수
  * - 매개변수: result - 큐 연산 결과
  */
-void print_error(QueueResult result) {
+void print_error(CircularQueueResult result) {
     switch (result) {
-    case QUEUE_EMPTY:
+    case CQUEUE_EMPTY:
         printf("Error: Queue is empty\n");
         break;
-    case QUEUE_FULL:
+    case CQUEUE_FULL:
         printf("Error: Queue is full\n");
         break;
-    case QUEUE_MEMORY_ERROR:
+    case CQUEUE_MEMORY_ERROR:
         printf("Error: Memory allocation failed\n");
         break;
     default:
@@ -274,15 +401,15 @@ void print_error(QueueResult result) {
 }
 
 int main(void) {
-    CircularQueue* queue = queue_create();
+    CircularQueue* queue = cqueue_create();
     if (queue == NULL) {
         printf("Failed to create queue\n");
         return 1;
     }
 
     int choice;
-    ElementType value;
-    QueueResult result;
+    CircularQueueElement value;
+    CircularQueueResult result;
 
     do {
         print_menu();
@@ -296,8 +423,8 @@ int main(void) {
         case 1:  // Enqueue
             printf("Enter value to enqueue: ");
             scanf("%d", &value);
-            result = queue_enqueue(queue, value);
-            if (result == QUEUE_OK) {
+            result = cqueue_enqueue(queue, value);
+            if (result == CQUEUE_OK) {
                 printf("Successfully enqueued %d\n", value);
             }
             else {
@@ -306,8 +433,8 @@ int main(void) {
             break;
 
         case 2:  // Dequeue
-            result = queue_dequeue(queue, &value);
-            if (result == QUEUE_OK) {
+            result = cqueue_dequeue(queue, &value);
+            if (result == CQUEUE_OK) {
                 printf("Dequeued value: %d\n", value);
             }
             else {
@@ -316,8 +443,8 @@ int main(void) {
             break;
 
         case 3:  // Peek
-            result = queue_peek(queue, &value);
-            if (result == QUEUE_OK) {
+            result = cqueue_peek(queue, &value);
+            if (result == CQUEUE_OK) {
                 printf("Front value: %d\n", value);
             }
             else {
@@ -326,29 +453,45 @@ int main(void) {
             break;
 
         case 4:  // Print queue
-            queue_print(queue);
+            cqueue_print(queue);
             break;
 
         case 5:  // Check if empty
-            printf("Queue is %sempty\n", queue_is_empty(queue) ? "" : "not ");
+            printf("Queue is %sempty\n", cqueue_is_empty(queue) ? "" : "not ");
             break;
 
         case 6:  // Check if full
-            printf("Queue is %sfull\n", queue_is_full(queue) ? "" : "not ");
+            printf("Queue is %sfull\n", cqueue_is_full(queue) ? "" : "not ");
             break;
 
         case 7:  // Get size
-            printf("Queue size: %zu\n", queue_size(queue));
+            printf("Queue size: %zu\n", cqueue_size(queue));
             break;
 
         case 8:  // Clear queue
-            queue_clear(queue);
+            cqueue_clear(queue);
             printf("Queue cleared\n");
             break;
 
         case 9:  // Show queue status
-            queue_status(queue);
+            cqueue_status(queue);
+            break;
+
+        case 10: {  // Show contiguous regions
+            CircularQueueRegion regions[2];
+            size_t region_count = cqueue_peek_regions(queue, regions);
+            if (region_count == 0) {
+                printf("Queue is empty\n");
+            }
+            for (size_t r = 0; r < region_count; r++) {
+                printf("Region %zu (%zu elements): [ ", r, regions[r].count);
+                for (size_t i = 0; i < regions[r].count; i++) {
+                    printf("%d ", regions[r].data[i]);
+                }
+                printf("]\n");
+            }
             break;
+        }
 
         case 0:  // Exit
             printf("Exiting program\n");
@@ -359,9 +502,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    queue_destroy(queue);
+    cqueue_destroy(queue);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -395,7 +539,13 @@ CircularQueue 구조체:
 - IsEmpty: O(1)
 - IsFull: O(1)
 - Clear: O(1)
-- Resize: O(n)
+- Resize: O(n) (감긴 두 구간을 memcpy 2회로 복사)
+
+대량 연산:
+- EnqueueN / DequeueN: O(k), memcpy 최대 2회
+  * EnqueueN 의 입력이 큐 자신의 배열이면 임시 배열로 한 번 더 복사 (확장 시 원본 해제 방지)
+- PeekRegions: O(1), 최대 2개의 연속 구간을 복사 없이 노출
+- Discard: O(1)
 
 4. 메모리 관리 전략
 ----------------
@@ -1,35 +1,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
-
-typedef int DataType;
-
-// 노드 구조체 정의
-typedef struct Node {
-    DataType data;
-    struct Node* next;
-} Node;
-
-// 큐 구조체 정의
-typedef struct {
-    Node* front;    // 첫 번째 노드를 가리키는 포인터
-    Node* rear;     // 마지막 노드를 가리키는 포인터
-    size_t size;    // 현재 큐에 저장된 요소의 수
-} LinkedQueue;
-
-/* 오류 처리를 위한 열거형 정의 */
-typedef enum {
-    QUEUE_OK,
-    QUEUE_EMPTY,
-    QUEUE_MEMORY_ERROR
-} QueueResult;
+#include "linked_queue.h"
 
 /* 새로운 노드 생성
- * - 매개변수: data - 저장할 데이터
+ * - 큐의 노드 풀에서 노드를 할당 (풀 모드에서는 free list 재사용)
+ * - 매개변수: queue - 대상 큐, data - 저장할 데이터
  * - 반환값: 생성된 노드의 포인터 또는 실패 시 NULL
  */
-static Node* node_create(DataType data) {
-    Node* new_node = (Node*)malloc(sizeof(Node));
+static LinkedQueueNode* node_create(LinkedQueue* queue, LinkedQueueElement data) {
+    LinkedQueueNode* new_node = (LinkedQueueNode*)node_pool_alloc(&queue->pool);
     if (new_node == NULL) {
         return NULL;
     }
@@ -39,10 +19,20 @@ static Node* node_create(DataType data) {
 }
 
 /* 큐 생성
- * - 새로운 빈 큐를 동적으로 할당하고 초기화
+ * - 노드마다 malloc/free 하는 기본 방식의 빈 큐 생성
  * - 반환값: 생성된 큐의 포인터 또는 실패 시 NULL
  */
-LinkedQueue* queue_create(void) {
+LinkedQueue* lqueue_create(void) {
+    return lqueue_create_ex(NODE_ALLOC_MALLOC, 0);
+}
+
+/* 노드 할당 방식을 지정하여 큐 생성
+ * - NODE_ALLOC_POOL 이면 노드를 슬랩 단위로 할당하고 dequeue 된 노드를 재사용
+ *   (정상 상태의 enqueue/dequeue 반복에서 malloc/free 호출 없음)
+ * - 매개변수: mode - 노드 할당 방식, nodes_per_slab - 슬랩당 노드 수 (0이면 기본값)
+ * - 반환값: 생성된 큐의 포인터 또는 실패 시 NULL
+ */
+LinkedQueue* lqueue_create_ex(NodeAllocMode mode, size_t nodes_per_slab) {
     LinkedQueue* queue = (LinkedQueue*)malloc(sizeof(LinkedQueue));
     if (queue == NULL) {
         return NULL;
@@ -50,6 +40,7 @@ LinkedQueue* queue_create(void) {
     queue->front = NULL;
     queue->rear = NULL;
     queue->size = 0;
+    node_pool_init(&queue->pool, mode, sizeof(LinkedQueueNode), nodes_per_slab);
     return queue;
 }
 
@@ -57,7 +48,7 @@ LinkedQueue* queue_create(void) {
  * - 매개변수: queue - 검사할 큐
  * - 반환값: 비어있으면 true, 아니면 false
  */
-bool queue_is_empty(const LinkedQueue* queue) {
+bool lqueue_is_empty(const LinkedQueue* queue) {
     return (queue->size == 0);
 }
 
@@ -65,21 +56,21 @@ bool queue_is_empty(const LinkedQueue* queue) {
  * - 매개변수: queue - 대상 큐
  * - 반환값: 큐에 저장된 요소의 수
  */
-size_t queue_size(const LinkedQueue* queue) {
+size_t lqueue_size(const LinkedQueue* queue) {
     return queue->size;
 }
 
 /* 큐에 요소 추가 (enqueue)
  * - 매개변수: queue - 대상 큐, data - 추가할 데이터
- * - 반환값: 연산 결과를 나타내는 QueueResult
+ * - 반환값: 연산 결과를 나타내는 LinkedQueueResult
  */
-QueueResult queue_enqueue(LinkedQueue* queue, DataType data) {
-    Node* new_node = node_create(data);
+LinkedQueueResult lqueue_enqueue(LinkedQueue* queue, LinkedQueueElement data) {
+    LinkedQueueNode* new_node = node_create(queue, data);
     if (new_node == NULL) {
-        return QUEUE_MEMORY_ERROR;
+        return LQUEUE_MEMORY_ERROR;
     }
 
-    if (queue_is_empty(queue)) {
+    if (lqueue_is_empty(queue)) {
         queue->front = new_node;
     }
     else {
@@ -87,19 +78,19 @@ QueueResult queue_enqueue(LinkedQueue* queue, DataType data) {
     }
     queue->rear = new_node;
     queue->size++;
-    return QUEUE_OK;
+    return LQUEUE_OK;
 }
 
 /* 큐에서 요소 제거 (dequeue)
  * - 매개변수: queue - 대상 큐, data - 제거된 데이터를 저장할 포인터
- * - 반환값: 연산 결과를 나타내는 QueueResult
+ * - 반환값: 연산 결과를 나타내는 LinkedQueueResult
  */
-QueueResult queue_dequeue(LinkedQueue* queue, DataType* data) {
-    if (queue_is_empty(queue)) {
-        return QUEUE_EMPTY;
+LinkedQueueResult lqueue_dequeue(LinkedQueue* queue, LinkedQueueElement* data) {
+    if (lqueue_is_empty(queue)) {
+        return LQUEUE_EMPTY;
     }
 
-    Node* temp = queue->front;
+    LinkedQueueNode* temp = queue->front;
     *data = temp->data;
     queue->front = temp->next;
 
@@ -107,53 +98,62 @@ QueueResult queue_dequeue(LinkedQueue* queue, DataType* data) {
         queue->rear = NULL;
     }
 
-    free(temp);
+    node_pool_free(&queue->pool, temp);
     queue->size--;
-    return QUEUE_OK;
+    return LQUEUE_OK;
 }
 
 /* 큐의 맨 앞 요소 확인 (peek)
  * - 매개변수: queue - 대상 큐, data - 데이터를 저장할 포인터
- * - 반환값: 연산 결과를 나타내는 QueueResult
+ * - 반환값: 연산 결과를 나타내는 LinkedQueueResult
  */
-QueueResult queue_peek(const LinkedQueue* queue, DataType* data) {
-    if (queue_is_empty(queue)) {
-        return QUEUE_EMPTY;
+LinkedQueueResult lqueue_peek(const LinkedQueue* queue, LinkedQueueElement* data) {
+    if (lqueue_is_empty(queue)) {
+        return LQUEUE_EMPTY;
     }
 
     *data = queue->front->data;
-    return QUEUE_OK;
+    return LQUEUE_OK;
 }
 
 /* 큐 초기화 (clear)
+ * - 풀 모드에서는 노드를 하나씩 반환하지 않고 슬랩을 한꺼번에 해제
  * - 매개변수: queue - 초기화할 큐
  */
-void queue_clear(LinkedQueue* queue) {
-    while (!queue_is_empty(queue)) {
-        DataType dummy;
-        queue_dequeue(queue, &dummy);
+void lqueue_clear(LinkedQueue* queue) {
+    if (queue->pool.mode == NODE_ALLOC_POOL) {
+        node_pool_release(&queue->pool);
+        queue->front = NULL;
+        queue->rear = NULL;
+        queue->size = 0;
+        return;
+    }
+
+    while (!lqueue_is_empty(queue)) {
+        LinkedQueueElement dummy;
+        lqueue_dequeue(queue, &dummy);
     }
 }
 
 /* 큐 메모리 해제
  * - 매개변수: queue - 해제할 큐
  */
-void queue_destroy(LinkedQueue* queue) {
-    queue_clear(queue);
+void lqueue_destroy(LinkedQueue* queue) {
+    lqueue_clear(queue);
     free(queue);
 }
 
 /* 큐의 모든 요소 출력
  * - 매개변수: queue - 출력할 큐
  */
-void queue_print(const LinkedQueue* queue) {
-    if (queue_is_empty(queue)) {
+void lqueue_print(const LinkedQueue* queue) {
+    if (lqueue_is_empty(queue)) {
         printf("Queue is empty\n");
         return;
     }
 
     printf("Queue (size=%zu): FRONT [ ", queue->size);
-    Node* current = queue->front;
+    LinkedQueueNode* current = queue->front;
     while (current != NULL) {
         printf("%d ", current->data);
         current = current->next;
@@ -164,23 +164,39 @@ void queue_print(const LinkedQueue* queue) {
 /* 큐의 상태 정보 출력
  * - 매개변수: queue - 상태를 확인할 큐
  */
-void queue_status(const LinkedQueue* queue) {
+void lqueue_status(const LinkedQueue* queue) {
     printf("\nQueue Status:\n");
     printf("- Size: %zu\n", queue->size);
-    printf("- Empty: %s\n", queue_is_empty(queue) ? "Yes" : "No");
+    printf("- Empty: %s\n", lqueue_is_empty(queue) ? "Yes" : "No");
 
     // 메모리 사용량 계산
     size_t queue_memory = sizeof(LinkedQueue);
-    size_t node_memory = sizeof(Node) * queue->size;
+    size_t node_memory = sizeof(LinkedQueueNode) * queue->size;
     printf("- Memory usage: %zu bytes (overhead: %zu bytes, nodes: %zu bytes)\n",
         queue_memory + node_memory, queue_memory, node_memory);
 
-    if (!queue_is_empty(queue)) {
+    if (!lqueue_is_empty(queue)) {
         printf("- Front value: %d\n", queue->front->data);
         printf("- Rear value: %d\n", queue->rear->data);
     }
+
+    if (queue->pool.mode == NODE_ALLOC_POOL) {
+        NodePoolStats stats;
+        lqueue_pool_stats(queue, &stats);
+        printf("- LinkedQueueNode pool: %zu live slabs x %zu nodes (in use: %zu, free: %zu, reserved: %zu bytes)\n",
+            stats.live_slabs, stats.nodes_per_slab, stats.nodes_in_use,
+            stats.nodes_free, stats.bytes_reserved);
+    }
+}
+
+/* 노드 풀 통계 조회
+ * - 매개변수: queue - 대상 큐, stats - 결과를 저장할 구조체
+ */
+void lqueue_pool_stats(const LinkedQueue* queue, NodePoolStats* stats) {
+    node_pool_get_stats(&queue->pool, stats);
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 함수 */
 void print_menu(void) {
     printf("\n=== Linked Queue Menu ===\n");
@@ -199,12 +215,12 @@ void print_menu(void) {
 /* 에러 메시지 출력 함수
  * - 매개변수: result - 큐 연산 결과
  */
-void print_error(QueueResult result) {
+void print_error(LinkedQueueResult result) {
     switch (result) {
-    case QUEUE_EMPTY:
+    case LQUEUE_EMPTY:
         printf("Error: Queue is empty\n");
         break;
-    case QUEUE_MEMORY_ERROR:
+    case LQUEUE_MEMORY_ERROR:
         printf("Error: Memory allocation failed\n");
         break;
     default:
@@ -213,15 +229,16 @@ void print_error(QueueResult result) {
 }
 
 int main(void) {
-    LinkedQueue* queue = queue_create();
+    // 데모에서는 슬랩 동작을 확인하기 쉽도록 작은 슬랩의 노드 풀 사용
+    LinkedQueue* queue = lqueue_create_ex(NODE_ALLOC_POOL, 4);
     if (queue == NULL) {
         printf("Failed to create queue\n");
         return 1;
     }
 
     int choice;
-    DataType value;
-    QueueResult result;
+    LinkedQueueElement value;
+    LinkedQueueResult result;
 
     do {
         print_menu();
@@ -235,8 +252,8 @@ int main(void) {
         case 1:  // Enqueue
             printf("Enter value to enqueue: ");
             scanf("%d", &value);
-            result = queue_enqueue(queue, value);
-            if (result == QUEUE_OK) {
+            result = lqueue_enqueue(queue, value);
+            if (result == LQUEUE_OK) {
                 printf("Successfully enqueued %d\n", value);
             }
             else {
@@ -245,8 +262,8 @@ int main(void) {
             break;
 
         case 2:  // Dequeue
-            result = queue_dequeue(queue, &value);
-            if (result == QUEUE_OK) {
+            result = lqueue_dequeue(queue, &value);
+            if (result == LQUEUE_OK) {
                 printf("Dequeued value: %d\n", value);
             }
             else {
@@ -255,8 +272,8 @@ int main(void) {
             break;
 
         case 3:  // Peek
-            result = queue_peek(queue, &value);
-            if (result == QUEUE_OK) {
+            result = lqueue_peek(queue, &value);
+            if (result == LQUEUE_OK) {
                 printf("Front value: %d\n", value);
             }
             else {
@@ -265,24 +282,24 @@ int main(void) {
             break;
 
         case 4:  // Print queue
-            queue_print(queue);
+            lqueue_print(queue);
             break;
 
         case 5:  // Check if empty
-            printf("Queue is %sempty\n", queue_is_empty(queue) ? "" : "not ");
+            printf("Queue is %sempty\n", lqueue_is_empty(queue) ? "" : "not ");
             break;
 
         case 6:  // Get size
-            printf("Queue size: %zu\n", queue_size(queue));
+            printf("Queue size: %zu\n", lqueue_size(queue));
             break;
 
         case 7:  // Clear queue
-            queue_clear(queue);
+            lqueue_clear(queue);
             printf("Queue cleared\n");
             break;
 
         case 8:  // Show queue status
-            queue_status(queue);
+            lqueue_status(queue);
             break;
 
         case 0:  // Exit
@@ -294,9 +311,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    queue_destroy(queue);
+    lqueue_destroy(queue);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -312,7 +330,7 @@ int main(void) {
 
 2. 구조체 설계
 -----------
-Node:
+LinkedQueueNode:
 - data: 저장할 데이터
 - next: 다음 노드 포인터
 
@@ -340,6 +358,8 @@ Peek: O(1)
 ---------------
 - 동적 할당 (malloc)
 - 적절한 해제 (free)
+- 노드 풀 모드 (lqueue_create_ex(NODE_ALLOC_POOL, ...)): 슬랩 단위 할당 +
+  free list 재사용, clear/destroy 시 슬랩 수만큼만 free
 - 메모리 누수 방지
 - NULL 포인터 처리
 
@@ -360,7 +380,7 @@ Peek: O(1)
 
 6. 구현 특징
 ----------
-- 타입 추상화 (DataType)
+- 타입 추상화 (LinkedQueueElement)
 - 오류 상태 열거형
 - 안전한 메모리 관리
 - 명확한 인터페이스
@@ -1,35 +1,62 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include "binary_tree.h"
+
+/* 소프트웨어 프리페치 (지원하지 않는 컴파일러에서는 아무 일도 하지 않음) */
+#if defined(__GNUC__) || defined(__clang__)
+#define TREE_PREFETCH(addr) __builtin_prefetch(addr)
+#elif defined(_MSC_VER)
+#include <xmmintrin.h>
+#define TREE_PREFETCH(addr) _mm_prefetch((const char*)(addr), _MM_HINT_T0)
+#else
+#define TREE_PREFETCH(addr) ((void)(addr))
+#endif
+
+#define FROZEN_PADDING INT_MAX      // vEB 배치에서 남는 칸 (중위 순서의 맨 뒤에 놓이는 최대값)
+#define CACHE_LINE 64
+
+/* 깊이를 함께 기록하는 명시적 스택 항목 (높이 계산/출력을 재귀 없이 처리) */
+typedef struct {
+    const BTreeNode* node;
+    int depth;
+} DepthItem;
 
-typedef int DataType;
-
-// 노드 구조체 정의
-typedef struct TreeNode {
-    DataType data;             // 데이터
-    struct TreeNode* left;     // 왼쪽 자식 노드
-    struct TreeNode* right;    // 오른쪽 자식 노드
-} TreeNode;
-
-// 이진 트리 구조체 정의
+/* 필요할 때 2배씩 늘어나는 깊이 스택 */
 typedef struct {
-    TreeNode* root;    // 루트 노드
-    size_t size;       // 전체 노드의 수
-} BinaryTree;
+    DepthItem* items;
+    size_t count;
+    size_t capacity;
+} DepthStack;
 
-/* 오류 처리를 위한 열거형 정의 */
-typedef enum {
-    TREE_OK,
-    TREE_MEMORY_ERROR,
-    TREE_EMPTY
-} TreeResult;
+/* 깊이 스택에 항목 추가
+ * - 반환값: 성공 시 true, 메모리 부족 시 false
+ */
+static bool depth_push(DepthStack* stack, const BTreeNode* node, int depth) {
+    if (stack->count == stack->capacity) {
+        size_t new_capacity = stack->capacity ? stack->capacity * 2 : 32;
+        DepthItem* items = (DepthItem*)realloc(stack->items, new_capacity * sizeof(DepthItem));
+        if (items == NULL) {
+            return false;
+        }
+        stack->items = items;
+        stack->capacity = new_capacity;
+    }
+    stack->items[stack->count].node = node;
+    stack->items[stack->count].depth = depth;
+    stack->count++;
+    return true;
+}
 
 /* 새로운 노드 생성
  * - 매개변수: data - 저장할 데이터
  * - 반환값: 생성된 노드의 포인터 또는 실패 시 NULL
  */
-static TreeNode* node_create(DataType data) {
-    TreeNode* new_node = (TreeNode*)malloc(sizeof(TreeNode));
+static BTreeNode* node_create(BTreeData data) {
+    BTreeNode* new_node = (BTreeNode*)malloc(sizeof(BTreeNode));
     if (new_node == NULL) {
         return NULL;
     }
@@ -43,7 +70,7 @@ static TreeNode* node_create(DataType data) {
  * - 새로운 빈 이진 트리를 동적으로 할당하고 초기화
  * - 반환값: 생성된 트리의 포인터 또는 실패 시 NULL
  */
-BinaryTree* tree_create(void) {
+BinaryTree* btree_create(void) {
     BinaryTree* tree = (BinaryTree*)malloc(sizeof(BinaryTree));
     if (tree == NULL) {
         return NULL;
@@ -57,166 +84,285 @@ BinaryTree* tree_create(void) {
  * - 매개변수: tree - 검사할 트리
  * - 반환값: 비어있으면 true, 아니면 false
  */
-bool tree_is_empty(const BinaryTree* tree) {
+bool btree_is_empty(const BinaryTree* tree) {
     return (tree->root == NULL);
 }
 
-/* 전위 순회 (내부 함수)
- * - Root -> Left -> Right 순서로 순회
+/* 커서의 스택/큐 끝에 노드 추가 (내부 함수)
+ * - 큐 앞쪽에 빈 칸이 있으면 먼저 당겨서 재사용, 없으면 2배로 늘림
+ * - 반환값: 성공 시 true, 메모리 부족 시 false (status 에 기록)
  */
-static void preorder_traversal(TreeNode* node) {
-    if (node != NULL) {
-        printf("%d ", node->data);      // 현재 노드 처리
-        preorder_traversal(node->left);  // 왼쪽 서브트리 순회
-        preorder_traversal(node->right); // 오른쪽 서브트리 순회
+static bool cursor_push(BTreeCursor* cursor, const BTreeNode* node) {
+    if (cursor->count == cursor->capacity) {
+        if (cursor->head > 0) {
+            memmove(cursor->items, cursor->items + cursor->head,
+                (cursor->count - cursor->head) * sizeof(BTreeNode*));
+            cursor->count -= cursor->head;
+            cursor->head = 0;
+        }
+        else {
+            size_t new_capacity = cursor->capacity ? cursor->capacity * 2 : 32;
+            const BTreeNode** items = (const BTreeNode**)realloc((void*)cursor->items, new_capacity * sizeof(BTreeNode*));
+            if (items == NULL) {
+                cursor->status = BTREE_MEMORY_ERROR;
+                return false;
+            }
+            cursor->items = items;
+            cursor->capacity = new_capacity;
+        }
     }
+    cursor->items[cursor->count++] = node;
+    return true;
 }
 
-/* 중위 순회 (내부 함수)
- * - Left -> Root -> Right 순서로 순회
+/* 순회 커서 초기화
+ * - 메모리를 할당하지 않음 (스택/큐는 처음 필요할 때 할당)
+ * - 매개변수: cursor - 초기화할 커서, tree - 순회할 트리, order - 순회 순서
  */
-static void inorder_traversal(TreeNode* node) {
-    if (node != NULL) {
-        inorder_traversal(node->left);   // 왼쪽 서브트리 순회
-        printf("%d ", node->data);       // 현재 노드 처리
-        inorder_traversal(node->right);  // 오른쪽 서브트리 순회
-    }
+void btree_cursor_init(BTreeCursor* cursor, const BinaryTree* tree, TraversalOrder order) {
+    cursor->items = NULL;
+    cursor->count = 0;
+    cursor->head = 0;
+    cursor->capacity = 0;
+    cursor->current = tree->root;
+    cursor->last = NULL;
+    cursor->order = order;
+    cursor->status = BTREE_OK;
 }
 
-/* 후위 순회 (내부 함수)
- * - Left -> Right -> Root 순서로 순회
+/* 다음 노드
+ * - 전위: 왼쪽으로 내려가면서 오른쪽 자식만 스택에 보관
+ * - 중위: 왼쪽 경로를 스택에 쌓고 하나 꺼낸 뒤 오른쪽 서브트리로 이동
+ * - 후위: 스택 맨 위 노드의 오른쪽 서브트리를 이미 방문했으면(last) 그 노드를 방문
+ * - 레벨 순서: 큐에서 꺼내고 자식을 넣음
+ * - 매개변수: cursor - 대상 커서
+ * - 반환값: 다음 노드 또는 끝(또는 메모리 부족)이면 NULL
  */
-static void postorder_traversal(TreeNode* node) {
-    if (node != NULL) {
-        postorder_traversal(node->left);  // 왼쪽 서브트리 순회
-        postorder_traversal(node->right); // 오른쪽 서브트리 순회
-        printf("%d ", node->data);        // 현재 노드 처리
+const BTreeNode* btree_cursor_next(BTreeCursor* cursor) {
+    const BTreeNode* node;
+
+    if (cursor->status != BTREE_OK) {
+        return NULL;
+    }
+
+    switch (cursor->order) {
+    case TRAVERSE_PREORDER:
+        node = cursor->current;
+        if (node == NULL) {
+            return NULL;
+        }
+        if (node->left != NULL) {
+            if (node->right != NULL && !cursor_push(cursor, node->right)) {
+                return NULL;
+            }
+            cursor->current = node->left;
+        }
+        else if (node->right != NULL) {
+            cursor->current = node->right;
+        }
+        else {
+            cursor->current = cursor->count > 0 ? cursor->items[--cursor->count] : NULL;
+        }
+        return node;
+
+    case TRAVERSE_INORDER:
+        while (cursor->current != NULL) {
+            if (!cursor_push(cursor, cursor->current)) {
+                return NULL;
+            }
+            cursor->current = cursor->current->left;
+        }
+        if (cursor->count == 0) {
+            return NULL;
+        }
+        node = cursor->items[--cursor->count];
+        cursor->current = node->right;
+        return node;
+
+    case TRAVERSE_POSTORDER:
+        for (;;) {
+            while (cursor->current != NULL) {
+                if (!cursor_push(cursor, cursor->current)) {
+                    return NULL;
+                }
+                cursor->current = cursor->current->left;
+            }
+            if (cursor->count == 0) {
+                return NULL;
+            }
+            node = cursor->items[cursor->count - 1];
+            if (node->right != NULL && cursor->last != node->right) {
+                cursor->current = node->right;
+            }
+            else {
+                cursor->count--;
+                cursor->last = node;
+                return node;
+            }
+        }
+
+    case TRAVERSE_LEVEL_ORDER:
+        if (cursor->current != NULL) {
+            node = cursor->current;     // 루트 (큐를 거치지 않음)
+            cursor->current = NULL;
+        }
+        else if (cursor->head < cursor->count) {
+            node = cursor->items[cursor->head++];
+        }
+        else {
+            return NULL;
+        }
+        if ((node->left != NULL && !cursor_push(cursor, node->left)) ||
+            (node->right != NULL && !cursor_push(cursor, node->right))) {
+            return NULL;
+        }
+        return node;
+
+    default:
+        return NULL;
     }
 }
 
-/* 전위 순회 (외부 인터페이스)
- * - 매개변수: tree - 순회할 트리
+/* 순회 커서 해제 (순회를 끝까지 하지 않았어도 호출)
+ * - 매개변수: cursor - 해제할 커서
+ */
+void btree_cursor_destroy(BTreeCursor* cursor) {
+    free((void*)cursor->items);
+    cursor->items = NULL;
+    cursor->count = cursor->head = cursor->capacity = 0;
+    cursor->current = NULL;
+}
+
+/* 순회 결과 출력 (내부 함수)
+ * - 매개변수: tree - 순회할 트리, order - 순회 순서, title - 앞에 출력할 제목
  */
-void tree_preorder(const BinaryTree* tree) {
-    if (tree_is_empty(tree)) {
+static void print_traversal(const BinaryTree* tree, TraversalOrder order, const char* title) {
+    if (btree_is_empty(tree)) {
         printf("Tree is empty\n");
         return;
     }
-    printf("Preorder traversal: ");
-    preorder_traversal(tree->root);
+
+    BTreeCursor cursor;
+    const BTreeNode* node;
+    btree_cursor_init(&cursor, tree, order);
+    printf("%s", title);
+    while ((node = btree_cursor_next(&cursor)) != NULL) {
+        printf("%d ", node->data);
+    }
     printf("\n");
+    if (cursor.status != BTREE_OK) {
+        printf("Error: Memory allocation failed\n");
+    }
+    btree_cursor_destroy(&cursor);
+}
+
+/* 전위 순회 (외부 인터페이스)
+ * - 매개변수: tree - 순회할 트리
+ */
+void btree_preorder(const BinaryTree* tree) {
+    print_traversal(tree, TRAVERSE_PREORDER, "Preorder traversal: ");
 }
 
 /* 중위 순회 (외부 인터페이스)
  * - 매개변수: tree - 순회할 트리
  */
-void tree_inorder(const BinaryTree* tree) {
-    if (tree_is_empty(tree)) {
-        printf("Tree is empty\n");
-        return;
-    }
-    printf("Inorder traversal: ");
-    inorder_traversal(tree->root);
-    printf("\n");
+void btree_inorder(const BinaryTree* tree) {
+    print_traversal(tree, TRAVERSE_INORDER, "Inorder traversal: ");
 }
 
 /* 후위 순회 (외부 인터페이스)
  * - 매개변수: tree - 순회할 트리
  */
-void tree_postorder(const BinaryTree* tree) {
-    if (tree_is_empty(tree)) {
-        printf("Tree is empty\n");
-        return;
-    }
-    printf("Postorder traversal: ");
-    postorder_traversal(tree->root);
-    printf("\n");
+void btree_postorder(const BinaryTree* tree) {
+    print_traversal(tree, TRAVERSE_POSTORDER, "Postorder traversal: ");
 }
 
-/* 노드의 높이 계산 (내부 함수)
- * - 매개변수: node - 높이를 계산할 노드
- * - 반환값: 해당 노드를 루트로 하는 서브트리의 높이
+/* 레벨 순서 순회 (외부 인터페이스)
+ * - 매개변수: tree - 순회할 트리
  */
-static int calculate_height(const TreeNode* node) {
-    if (node == NULL) {
-        return -1;
-    }
-    int left_height = calculate_height(node->left);
-    int right_height = calculate_height(node->right);
-    return (left_height > right_height ? left_height : right_height) + 1;
+void btree_level_order(const BinaryTree* tree) {
+    print_traversal(tree, TRAVERSE_LEVEL_ORDER, "Level-order traversal: ");
 }
 
 /* 트리의 높이 반환 (외부 인터페이스)
+ * - 깊이 스택으로 모든 노드를 방문 (재귀 없음, 한쪽으로 치우친 트리에서도 안전)
  * - 매개변수: tree - 높이를 계산할 트리
- * - 반환값: 트리의 높이
+ * - 반환값: 트리의 높이 (루트만 있으면 0, 빈 트리 또는 메모리 부족 시 -1)
  */
-int tree_height(const BinaryTree* tree) {
-    if (tree_is_empty(tree)) {
+int btree_height(const BinaryTree* tree) {
+    if (btree_is_empty(tree)) {
         return -1;
     }
-    return calculate_height(tree->root);
-}
 
-/* 노드의 개수 계산 (내부 함수)
- * - 매개변수: node - 개수를 계산할 노드
- * - 반환값: 해당 노드를 루트로 하는 서브트리의 노드 개수
- */
-static size_t count_nodes(const TreeNode* node) {
-    if (node == NULL) {
-        return 0;
+    DepthStack stack = { NULL, 0, 0 };
+    int height = 0;
+    if (!depth_push(&stack, tree->root, 0)) {
+        return -1;
     }
-    return 1 + count_nodes(node->left) + count_nodes(node->right);
+    while (stack.count > 0) {
+        DepthItem item = stack.items[--stack.count];
+        if (item.depth > height) {
+            height = item.depth;
+        }
+        if ((item.node->left != NULL && !depth_push(&stack, item.node->left, item.depth + 1)) ||
+            (item.node->right != NULL && !depth_push(&stack, item.node->right, item.depth + 1))) {
+            height = -1;
+            break;
+        }
+    }
+    free(stack.items);
+    return height;
 }
 
 /* 트리의 노드 개수 반환 (외부 인터페이스)
  * - 매개변수: tree - 노드 개수를 계산할 트리
  * - 반환값: 트리의 전체 노드 개수
  */
-size_t tree_size(const BinaryTree* tree) {
+size_t btree_size(const BinaryTree* tree) {
     return tree->size;
 }
 
-/* 트리 시각화를 위한 내부 함수
- * - 매개변수: node - 출력할 노드, level - 현재 레벨, prefix - 출력 접두사
- */
-static void print_tree_recursive(const TreeNode* node, int level, char* prefix) {
-    if (node == NULL) {
-        return;
-    }
-
-    printf("%s", prefix);
-    printf("%s", level ? "├── " : "");
-    printf("%d\n", node->data);
-
-    char new_prefix[256];
-    sprintf(new_prefix, "%s%s", prefix, level ? "│   " : "");
-
-    if (node->left || node->right) {
-        print_tree_recursive(node->left, 1, new_prefix);
-        print_tree_recursive(node->right, 1, new_prefix);
-    }
-}
-
 /* 트리 시각화 (외부 인터페이스)
+ * - 깊이 스택으로 전위 순서 출력 (재귀와 고정 크기 접두사 버퍼 없음)
  * - 매개변수: tree - 출력할 트리
  */
-void tree_print(const BinaryTree* tree) {
-    if (tree_is_empty(tree)) {
+void btree_print(const BinaryTree* tree) {
+    if (btree_is_empty(tree)) {
         printf("Tree is empty\n");
         return;
     }
+
+    DepthStack stack = { NULL, 0, 0 };
     printf("Binary Tree Structure:\n");
-    print_tree_recursive(tree->root, 0, "");
+    if (!depth_push(&stack, tree->root, 0)) {
+        printf("Error: Memory allocation failed\n");
+        return;
+    }
+    while (stack.count > 0) {
+        DepthItem item = stack.items[--stack.count];
+        for (int i = 1; i < item.depth; i++) {
+            printf("│   ");
+        }
+        printf("%s%d\n", item.depth ? "├── " : "", item.node->data);
+
+        // 왼쪽 서브트리를 먼저 출력하도록 오른쪽 자식을 먼저 넣음
+        if ((item.node->right != NULL && !depth_push(&stack, item.node->right, item.depth + 1)) ||
+            (item.node->left != NULL && !depth_push(&stack, item.node->left, item.depth + 1))) {
+            printf("Error: Memory allocation failed\n");
+            break;
+        }
+    }
+    free(stack.items);
 }
 
 /* 노드 삽입 (왼쪽 자식)
  * - 매개변수: parent - 부모 노드, data - 삽입할 데이터
- * - 반환값: 성공 시 TREE_OK, 실패 시 에러 코드
+ * - 반환값: 성공 시 BTREE_OK, 실패 시 에러 코드
  */
-TreeResult tree_insert_left(BinaryTree* tree, TreeNode* parent, DataType data) {
-    TreeNode* new_node = node_create(data);
+BTreeResult btree_insert_left(BinaryTree* tree, BTreeNode* parent, BTreeData data) {
+    BTreeNode* new_node = node_create(data);
     if (new_node == NULL) {
-        return TREE_MEMORY_ERROR;
+        return BTREE_MEMORY_ERROR;
     }
 
     if (parent == NULL) {
@@ -225,7 +371,7 @@ TreeResult tree_insert_left(BinaryTree* tree, TreeNode* parent, DataType data) {
         }
         else {
             free(new_node);
-            return TREE_MEMORY_ERROR;
+            return BTREE_MEMORY_ERROR;
         }
     }
     else {
@@ -236,17 +382,17 @@ TreeResult tree_insert_left(BinaryTree* tree, TreeNode* parent, DataType data) {
     }
 
     tree->size++;
-    return TREE_OK;
+    return BTREE_OK;
 }
 
 /* 노드 삽입 (오른쪽 자식)
  * - 매개변수: parent - 부모 노드, data - 삽입할 데이터
- * - 반환값: 성공 시 TREE_OK, 실패 시 에러 코드
+ * - 반환값: 성공 시 BTREE_OK, 실패 시 에러 코드
  */
-TreeResult tree_insert_right(BinaryTree* tree, TreeNode* parent, DataType data) {
-    TreeNode* new_node = node_create(data);
+BTreeResult btree_insert_right(BinaryTree* tree, BTreeNode* parent, BTreeData data) {
+    BTreeNode* new_node = node_create(data);
     if (new_node == NULL) {
-        return TREE_MEMORY_ERROR;
+        return BTREE_MEMORY_ERROR;
     }
 
     if (parent == NULL) {
@@ -255,7 +401,7 @@ TreeResult tree_insert_right(BinaryTree* tree, TreeNode* parent, DataType data)
         }
         else {
             free(new_node);
-            return TREE_MEMORY_ERROR;
+            return BTREE_MEMORY_ERROR;
         }
     }
     else {
@@ -266,31 +412,372 @@ TreeResult tree_insert_right(BinaryTree* tree, TreeNode* parent, DataType data)
     }
 
     tree->size++;
-    return TREE_OK;
+    return BTREE_OK;
 }
 
 /* 서브트리 삭제 (내부 함수)
+ * - 왼쪽 자식이 있으면 오른쪽 회전으로 끌어올리고, 없으면 현재 노드를 해제하고 오른쪽으로 이동
+ * - 추가 메모리와 재귀 없이 O(n) (한쪽으로 치우친 트리에서도 호출 스택 넘침 없음)
  * - 매개변수: node - 삭제할 서브트리의 루트 노드
  */
-static void delete_subtree(TreeNode* node) {
-    if (node == NULL) {
-        return;
+static void delete_subtree(BTreeNode* node) {
+    while (node != NULL) {
+        if (node->left != NULL) {
+            BTreeNode* left = node->left;
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        }
+        else {
+            BTreeNode* right = node->right;
+            free(node);
+            node = right;
+        }
     }
-    delete_subtree(node->left);
-    delete_subtree(node->right);
-    free(node);
 }
 
 /* 트리 메모리 해제
  * - 매개변수: tree - 해제할 트리
  */
-void tree_destroy(BinaryTree* tree) {
+void btree_destroy(BinaryTree* tree) {
     if (tree != NULL) {
         delete_subtree(tree->root);
         free(tree);
     }
 }
 
+/* 중위 순서 수집 (내부 함수)
+ * - 매개변수: tree - 대상 트리, out - tree->size 칸 이상의 배열, ordered - 오름차순 여부를 저장
+ * - 반환값: 성공 시 true, 메모리 부족 시 false
+ */
+static bool collect_inorder(const BinaryTree* tree, BTreeData* out, bool* ordered) {
+    BTreeCursor cursor;
+    const BTreeNode* node;
+    size_t count = 0;
+
+    *ordered = true;
+    btree_cursor_init(&cursor, tree, TRAVERSE_INORDER);
+    while ((node = btree_cursor_next(&cursor)) != NULL) {
+        if (count > 0 && out[count - 1] > node->data) {
+            *ordered = false;
+        }
+        out[count++] = node->data;
+    }
+    btree_cursor_destroy(&cursor);
+    return cursor.status == BTREE_OK;
+}
+
+/* Eytzinger 배치의 중위 순서 첫 위치 (1부터 시작, 가장 왼쪽 노드) */
+static size_t eytzinger_first(size_t n) {
+    size_t i = 1;
+    while (2 * i <= n) {
+        i = 2 * i;
+    }
+    return i;
+}
+
+/* Eytzinger 배치의 중위 순서 다음 위치 (끝이면 0)
+ * - 오른쪽 자식이 있으면 그 서브트리의 가장 왼쪽으로,
+ *   없으면 오른쪽 자식인 동안 올라간 뒤 부모로 (스택 없음)
+ */
+static size_t eytzinger_next(size_t i, size_t n) {
+    if (2 * i + 1 <= n) {
+        i = 2 * i + 1;
+        while (2 * i <= n) {
+            i = 2 * i;
+        }
+        return i;
+    }
+    while (i & 1) {
+        i >>= 1;
+    }
+    return i >> 1;
+}
+
+/* vEB 테이블 구성 (내부 함수)
+ * - 높이 height 인 서브트리를 위쪽 floor(height/2), 아래쪽 나머지 높이로 나누고
+ *   아래 서브트리 루트 깊이에 위/아래 서브트리 크기를 기록 (재귀 깊이는 log(높이))
+ */
+static void veb_build_tables(FrozenTree* frozen, int root_depth, int height) {
+    if (height <= 1) {
+        return;
+    }
+    int top_height = height / 2;
+    int bottom_height = height - top_height;
+    int depth = root_depth + top_height;
+
+    frozen->top_depth[depth] = root_depth;
+    frozen->top_size[depth] = ((size_t)1 << top_height) - 1;
+    frozen->bottom_size[depth] = ((size_t)1 << bottom_height) - 1;
+    veb_build_tables(frozen, root_depth, top_height);
+    veb_build_tables(frozen, depth, bottom_height);
+}
+
+/* vEB 배치에서 깊이 depth, BFS 번호 index 인 노드의 배열 위치
+ * - pos[]에는 루트부터 부모까지의 배열 위치가 들어있어야 함
+ * - 같은 아래 서브트리 안에서는 (index의 하위 비트)번째 아래 서브트리로 건너뜀
+ */
+static size_t veb_position(const FrozenTree* frozen, const size_t* pos, int depth, size_t index) {
+    size_t top = frozen->top_size[depth];
+    return pos[frozen->top_depth[depth]] + top + (index & top) * frozen->bottom_size[depth];
+}
+
+/* vEB 배치의 중위 순서 커서 (루트부터 현재 노드까지의 배열 위치를 기억) */
+typedef struct {
+    size_t pos[FROZEN_MAX_HEIGHT];
+    size_t index;       // BFS 번호 (1부터 시작)
+    int depth;          // 현재 깊이 (끝나면 -1)
+} VebCursor;
+
+/* 현재 노드에서 가장 왼쪽 잎까지 내려감 */
+static void veb_descend_left(const FrozenTree* frozen, VebCursor* cursor) {
+    while (cursor->depth < frozen->height - 1) {
+        cursor->index = 2 * cursor->index;
+        cursor->depth++;
+        cursor->pos[cursor->depth] = veb_position(frozen, cursor->pos, cursor->depth, cursor->index);
+    }
+}
+
+static void veb_first(const FrozenTree* frozen, VebCursor* cursor) {
+    cursor->pos[0] = 0;
+    cursor->index = 1;
+    cursor->depth = 0;
+    veb_descend_left(frozen, cursor);
+}
+
+/* 다음 중위 위치로 이동 (포화 트리이므로 잎이 아니면 항상 오른쪽 자식이 있음) */
+static void veb_next(const FrozenTree* frozen, VebCursor* cursor) {
+    if (cursor->depth < frozen->height - 1) {
+        cursor->index = 2 * cursor->index + 1;
+        cursor->depth++;
+        cursor->pos[cursor->depth] = veb_position(frozen, cursor->pos, cursor->depth, cursor->index);
+        veb_descend_left(frozen, cursor);
+        return;
+    }
+    while (cursor->index & 1) {
+        cursor->index >>= 1;
+        cursor->depth--;
+    }
+    cursor->index >>= 1;
+    cursor->depth--;
+}
+
+/* 트리 동결
+ * - 중위 순서를 수집하여 완전 이진 트리 모양의 암시적 배열로 다시 배치
+ *   * EYTZINGER: BFS 순서, 검색 경로의 4레벨 아래 16개 후손이 캐시 라인 하나에 모임
+ *   * VEB: 서브트리가 연속 구간에 모이므로 캐시/페이지 크기를 몰라도 블록 전송 수가 O(log_B n)
+ * - 동결 후 원래 트리를 수정해도 동결된 트리에는 반영되지 않음
+ * - 매개변수: tree - 원본 트리, layout - 배치 방식
+ * - 반환값: 동결된 트리 또는 실패 시 NULL
+ */
+FrozenTree* btree_freeze(const BinaryTree* tree, FrozenLayout layout) {
+    FrozenTree* frozen = (FrozenTree*)calloc(1, sizeof(FrozenTree));
+    if (frozen == NULL) {
+        return NULL;
+    }
+    frozen->layout = layout;
+    frozen->ordered = true;
+    if (btree_is_empty(tree)) {
+        return frozen;
+    }
+
+    size_t n = tree->size;
+    BTreeData* sorted = (BTreeData*)malloc(n * sizeof(BTreeData));
+    if (sorted == NULL || !collect_inorder(tree, sorted, &frozen->ordered)) {
+        free(sorted);
+        free(frozen);
+        return NULL;
+    }
+
+    int height = 0;
+    while (((size_t)1 << height) <= n) {
+        height++;
+    }
+    frozen->size = n;
+    frozen->height = height;
+    // Eytzinger는 1부터 시작하는 n칸, vEB는 포화 트리 2^h - 1칸
+    frozen->slots = layout == FROZEN_LAYOUT_EYTZINGER ? n + 1 : ((size_t)1 << height) - 1;
+
+    frozen->storage = malloc(frozen->slots * sizeof(BTreeData) + CACHE_LINE);
+    if (frozen->storage == NULL) {
+        free(sorted);
+        free(frozen);
+        return NULL;
+    }
+    frozen->keys = (BTreeData*)(((uintptr_t)frozen->storage + CACHE_LINE - 1) & ~(uintptr_t)(CACHE_LINE - 1));
+
+    if (layout == FROZEN_LAYOUT_EYTZINGER) {
+        size_t i = eytzinger_first(n);
+        for (size_t rank = 0; rank < n; rank++) {
+            frozen->keys[i] = sorted[rank];
+            i = eytzinger_next(i, n);
+        }
+    }
+    else {
+        VebCursor cursor;
+        veb_build_tables(frozen, 0, height);
+        veb_first(frozen, &cursor);
+        for (size_t rank = 0; rank < frozen->slots; rank++) {
+            frozen->keys[cursor.pos[cursor.depth]] = rank < n ? sorted[rank] : FROZEN_PADDING;
+            veb_next(frozen, &cursor);
+        }
+    }
+
+    free(sorted);
+    return frozen;
+}
+
+/* 동결된 트리 해제
+ * - 매개변수: frozen - 해제할 트리
+ */
+void frozen_destroy(FrozenTree* frozen) {
+    if (frozen != NULL) {
+        free(frozen->storage);
+        free(frozen);
+    }
+}
+
+/* 중위 순회 (방문 함수 호출)
+ * - 배열 번호만으로 다음 위치를 계산 (스택/재귀 없음)
+ * - 매개변수: frozen - 순회할 트리, visit - 방문 함수, context - 방문 함수에 넘길 값
+ */
+void frozen_inorder(const FrozenTree* frozen, void (*visit)(BTreeData data, void* context), void* context) {
+    if (frozen->size == 0) {
+        return;
+    }
+    if (frozen->layout == FROZEN_LAYOUT_EYTZINGER) {
+        for (size_t i = eytzinger_first(frozen->size); i != 0; i = eytzinger_next(i, frozen->size)) {
+            visit(frozen->keys[i], context);
+        }
+    }
+    else {
+        VebCursor cursor;
+        veb_first(frozen, &cursor);
+        for (size_t rank = 0; rank < frozen->size; rank++) {
+            visit(frozen->keys[cursor.pos[cursor.depth]], context);
+            veb_next(frozen, &cursor);
+        }
+    }
+}
+
+/* 정렬되지 않은 트리의 검색에 쓰는 방문 함수 */
+typedef struct {
+    BTreeData target;
+    bool found;
+} SearchContext;
+
+static void match_visit(BTreeData data, void* context) {
+    SearchContext* search = (SearchContext*)context;
+    if (data == search->target) {
+        search->found = true;
+    }
+}
+
+/* Eytzinger 검색
+ * - 분기 없이 i = 2i + (keys[i] < data) 로 내려간 뒤, 마지막으로 왼쪽으로 간 위치로 되돌아감
+ * - 4레벨 아래 후손 16개(캐시 라인 하나)를 미리 가져와 메모리 지연을 겹침
+ */
+static bool eytzinger_search(const FrozenTree* frozen, BTreeData data) {
+    const BTreeData* keys = frozen->keys;
+    size_t n = frozen->size;
+    size_t i = 1;
+
+    while (i <= n) {
+        if (16 * i <= n) {
+            TREE_PREFETCH(keys + 16 * i);
+        }
+        i = 2 * i + (keys[i] < data);
+    }
+    // 오른쪽으로 내려간 횟수(끝의 1 비트)만큼 되돌린 뒤 한 번 더 올라가면 lower bound
+    while (i & 1) {
+        i >>= 1;
+    }
+    i >>= 1;
+    return i != 0 && keys[i] == data;
+}
+
+/* vEB 검색
+ * - Eytzinger와 같은 분기 없는 하강, 배열 위치는 깊이별 표로 계산하여 경로(pos[])에 기록
+ * - 현재 키를 읽는 동안 두 자식 위치를 미리 가져옴 (형제는 아래 서브트리 하나만큼 떨어짐)
+ * - 끝나면 오른쪽으로 내려간 횟수만큼 되돌아가 경로에서 lower bound 위치를 얻음
+ * - 남는 칸(FROZEN_PADDING)은 중위 순서 번호가 size 이상이므로 결과에서 제외
+ */
+static bool veb_search(const FrozenTree* frozen, BTreeData data) {
+    const BTreeData* keys = frozen->keys;
+    size_t pos[FROZEN_MAX_HEIGHT];
+    size_t index = 1;
+    int depth;
+
+    pos[0] = 0;
+    for (depth = 0; depth < frozen->height - 1; depth++) {
+        size_t left = veb_position(frozen, pos, depth + 1, 2 * index);
+        size_t right = left + frozen->bottom_size[depth + 1];
+        TREE_PREFETCH(keys + left);
+        TREE_PREFETCH(keys + right);
+
+        size_t go_right = keys[pos[depth]] < data;
+        index = 2 * index + go_right;
+        pos[depth + 1] = go_right ? right : left;
+    }
+    index = 2 * index + (keys[pos[depth]] < data);
+    depth++;
+
+    while (index & 1) {
+        index >>= 1;
+        depth--;
+    }
+    index >>= 1;
+    depth--;
+    if (index == 0) {
+        return false;
+    }
+
+    // 포화 트리에서 BFS 번호로 중위 순서 번호 계산
+    size_t level_offset = index - ((size_t)1 << depth);
+    size_t rank = ((2 * level_offset + 1) << (frozen->height - 1 - depth)) - 1;
+    return rank < frozen->size && keys[pos[depth]] == data;
+}
+
+/* 동결된 트리 검색
+ * - 중위 순서가 정렬되어 있으면 배치에 맞는 O(log n) 하강, 아니면 중위 순회로 전체 비교
+ * - 매개변수: frozen - 대상 트리, data - 검색할 데이터
+ * - 반환값: 있으면 true, 없으면 false
+ */
+bool frozen_search(const FrozenTree* frozen, BTreeData data) {
+    if (frozen->size == 0) {
+        return false;
+    }
+    if (!frozen->ordered) {
+        SearchContext search = { data, false };
+        frozen_inorder(frozen, match_visit, &search);
+        return search.found;
+    }
+    return frozen->layout == FROZEN_LAYOUT_EYTZINGER
+        ? eytzinger_search(frozen, data)
+        : veb_search(frozen, data);
+}
+
+static void print_visit(BTreeData data, void* context) {
+    (void)context;
+    printf("%d ", data);
+}
+
+/* 동결된 트리 출력 (중위 순서)
+ * - 매개변수: frozen - 출력할 트리
+ */
+void frozen_print(const FrozenTree* frozen) {
+    if (frozen->size == 0) {
+        printf("Frozen tree is empty\n");
+        return;
+    }
+    printf("Frozen %s tree (size=%zu, height=%d, %s): ",
+        frozen->layout == FROZEN_LAYOUT_EYTZINGER ? "Eytzinger" : "vEB",
+        frozen->size, frozen->height, frozen->ordered ? "ordered" : "unordered");
+    frozen_inorder(frozen, print_visit, NULL);
+    printf("\n");
+}
+
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 함수 */
 void print_menu(void) {
     printf("\n=== Binary Tree Menu ===\n");
@@ -301,17 +788,18 @@ void print_menu(void) {
     printf("5. Get tree height\n");
     printf("6. Get number of nodes\n");
     printf("7. Clear tree\n");
+    printf("8. Freeze and search\n");
     printf("0. Exit\n");
     printf("Choice: ");
 }
 
 /* 에러 메시지 출력 함수 */
-void print_error(TreeResult result) {
+void print_error(BTreeResult result) {
     switch (result) {
-    case TREE_MEMORY_ERROR:
+    case BTREE_MEMORY_ERROR:
         printf("Error: Memory allocation failed\n");
         break;
-    case TREE_EMPTY:
+    case BTREE_EMPTY:
         printf("Error: Tree is empty\n");
         break;
     default:
@@ -322,24 +810,24 @@ void print_error(TreeResult result) {
 /* 테스트용 샘플 트리 생성 */
 void create_sample_tree(BinaryTree* tree) {
     // 루트 노드 생성
-    tree_insert_left(tree, NULL, 1);
-    TreeNode* root = tree->root;
+    btree_insert_left(tree, NULL, 1);
+    BTreeNode* root = tree->root;
 
     // 왼쪽 서브트리
-    tree_insert_left(tree, root, 2);
-    tree_insert_right(tree, root, 3);
+    btree_insert_left(tree, root, 2);
+    btree_insert_right(tree, root, 3);
 
     // 2의 자식들
-    tree_insert_left(tree, root->left, 4);
-    tree_insert_right(tree, root->left, 5);
+    btree_insert_left(tree, root->left, 4);
+    btree_insert_right(tree, root->left, 5);
 
     // 3의 자식들
-    tree_insert_left(tree, root->right, 6);
-    tree_insert_right(tree, root->right, 7);
+    btree_insert_left(tree, root->right, 6);
+    btree_insert_right(tree, root->right, 7);
 }
 
 int main(void) {
-    BinaryTree* tree = tree_create();
+    BinaryTree* tree = btree_create();
     if (tree == NULL) {
         printf("Failed to create tree\n");
         return 1;
@@ -350,8 +838,9 @@ int main(void) {
     printf("Sample binary tree created.\n");
 
     int choice;
-    DataType value;
-    TreeResult result;
+    BTreeData value;
+    BTreeResult result;
+    FrozenTree* frozen;
 
     do {
         print_menu();
@@ -367,8 +856,8 @@ int main(void) {
             scanf("%d", &value);
             // Note: In a real implementation, you would need to specify the parent node
             printf("Note: This is a simplified version. Using root as parent.\n");
-            result = tree_insert_left(tree, tree->root, value);
-            if (result == TREE_OK) {
+            result = btree_insert_left(tree, tree->root, value);
+            if (result == BTREE_OK) {
                 printf("Successfully inserted %d as left child\n", value);
             }
             else {
@@ -381,8 +870,8 @@ int main(void) {
             scanf("%d", &value);
             // Note: In a real implementation, you would need to specify the parent node
             printf("Note: This is a simplified version. Using root as parent.\n");
-            result = tree_insert_right(tree, tree->root, value);
-            if (result == TREE_OK) {
+            result = btree_insert_right(tree, tree->root, value);
+            if (result == BTREE_OK) {
                 printf("Successfully inserted %d as right child\n", value);
             }
             else {
@@ -391,29 +880,45 @@ int main(void) {
             break;
 
         case 3:  // Print tree
-            tree_print(tree);
+            btree_print(tree);
             break;
 
         case 4:  // Tree traversals
-            tree_preorder(tree);
-            tree_inorder(tree);
-            tree_postorder(tree);
+            btree_preorder(tree);
+            btree_inorder(tree);
+            btree_postorder(tree);
+            btree_level_order(tree);
             break;
 
         case 5:  // Get tree height
-            printf("Tree height: %d\n", tree_height(tree));
+            printf("Tree height: %d\n", btree_height(tree));
             break;
 
         case 6:  // Get number of nodes
-            printf("Number of nodes: %zu\n", tree_size(tree));
+            printf("Number of nodes: %zu\n", btree_size(tree));
             break;
 
         case 7:  // Clear tree
-            tree_destroy(tree);
-            tree = tree_create();
+            btree_destroy(tree);
+            tree = btree_create();
             printf("Tree cleared\n");
             break;
 
+        case 8:  // Freeze and search
+            printf("Enter value to search: ");
+            scanf("%d", &value);
+            for (int layout = FROZEN_LAYOUT_EYTZINGER; layout <= FROZEN_LAYOUT_VEB; layout++) {
+                frozen = btree_freeze(tree, (FrozenLayout)layout);
+                if (frozen == NULL) {
+                    print_error(BTREE_MEMORY_ERROR);
+                    break;
+                }
+                frozen_print(frozen);
+                printf("%s %d\n", frozen_search(frozen, value) ? "Found" : "Did not find", value);
+                frozen_destroy(frozen);
+            }
+            break;
+
         case 0:  // Exit
             printf("Exiting program\n");
             break;
@@ -423,9 +928,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    tree_destroy(tree);
+    btree_destroy(tree);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -441,7 +947,7 @@ int main(void) {
 
 2. 구조체 설계
 -----------
-TreeNode:
+BTreeNode:
 - data: 데이터
 - left: 왼쪽 자식 포인터
 - right: 오른쪽 자식 포인터
@@ -464,6 +970,21 @@ BinaryTree:
 - Left -> Right -> Root
 - 메모리 해제에 유용
 
+레벨 순서 순회 (Level order):
+- 깊이 순서, 같은 깊이는 왼쪽부터
+- 큐 사용 (최대 너비만큼 보관)
+
+순회 커서 (BTreeCursor):
+- btree_cursor_next 한 번에 노드 하나만 계산 → 필요한 만큼만 순회하고 멈출 수 있음
+- 재귀 대신 명시적 스택 (추가 메모리 O(높이)), 레벨 순서는 큐
+- 전위: 오른쪽 자식만 스택에 보관하고 왼쪽으로 내려감
+- 중위: 왼쪽 경로를 쌓고 하나 꺼낸 뒤 오른쪽 서브트리로
+- 후위: 스택 하나 + 마지막 방문 노드로 오른쪽 서브트리 방문 여부 판단
+- Morris 순회(추가 메모리 0)는 순회 중 트리 포인터를 잠시 바꾸므로 const 트리와
+  중간에 멈추는 커서에는 쓰지 않음
+- 출력 함수와 동결(중위 순서 수집)도 커서로 구현 → 깊은(한쪽으로 치우친) 트리에서도
+  호출 스택 넘침 없음
+
 4. 주요 연산과 복잡도
 -----------------
 삽입:
@@ -479,18 +1000,22 @@ BinaryTree:
 크기 계산:
 - O(1) (size 필드 이용)
 
+동결된 트리 검색:
+- O(log n), 중위 순서가 정렬된 경우 (아니면 O(n) 중위 순회)
+
 5. 메모리 관리
 -----------
 - 노드 단위 동적 할당
-- 재귀적 메모리 해제
+- 회전으로 트리를 펴면서 해제 (재귀와 추가 메모리 없음)
 - 메모리 누수 방지
 - 포인터 관리
 
 6. 구현 특징
 ----------
-- 재귀적 알고리즘 활용
-- 포인터 기반 구조
-- 타입 추상화 (DataType)
+- 반복문 기반 구현 (순회는 커서, 높이/출력은 깊이 스택, 해제는 회전)
+  * 한쪽으로 치우친 트리(높이 = n)에서도 호출 스택 넘침 없음
+- 포인터 기반 구조 (동결 후에는 배열 기반)
+- 타입 추상화 (BTreeData)
 - 에러 처리
 
 7. 시각화 기능
@@ -514,7 +1039,25 @@ BinaryTree:
 - 동적 메모리 관리
 - 트리 구조 이해
 
-10. 활용 분야
+10. 동결(freeze)과 캐시 친화적 배치
+------------------------------
+- 읽기 전용이 된 트리를 포인터 없는 배열로 다시 배치
+  * 중위 순서만 보존, 모양은 완전 이진 트리로 재구성 (높이 = floor(log2 n) + 1)
+  * 노드당 포인터 두 개(16바이트)와 malloc 헤더가 사라져 키만 연속 저장
+- Eytzinger (BFS) 배치
+  * i의 자식은 2i, 2i+1 (1부터 시작)
+  * 분기 없는 하강: i = 2i + (keys[i] < x)
+  * 16i ~ 16i+15 (4레벨 아래 후손)가 캐시 라인 하나 → 미리 가져오기(prefetch)로 지연을 겹침
+- van Emde Boas 배치
+  * 높이 h 트리를 위쪽 h/2 서브트리 하나와 아래쪽 서브트리들로 나누어 각각 연속 배치 (재귀)
+  * 블록 크기 B를 몰라도 검색당 블록 전송 O(log_B n) (cache-oblivious)
+  * 포화 트리로 채우고 남는 칸은 최대값으로 채움
+  * 깊이별 표(위/아래 서브트리 크기, 위 서브트리 루트 깊이)만으로 BFS 번호 → 배열 위치 계산
+- 포인터 트리와 비교
+  * 트리가 캐시보다 작으면 차이가 작음
+  * 캐시보다 크면 포인터 추적은 레벨마다 캐시 미스, 배열 배치는 미스 수와 지연이 줄어듦
+
+11. 활용 분야
 ----------
 - 파일 시스템
 - 구문 분석
@@ -1,56 +1,85 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include "binary_search_tree.h"
 
-typedef int DataType;
-
-// 노드 구조체 정의
-typedef struct TreeNode {
-    DataType data;             // 데이터
-    struct TreeNode* left;     // 왼쪽 자식 노드
-    struct TreeNode* right;    // 오른쪽 자식 노드
-} TreeNode;
+/* 순회용 명시적 스택 항목 (재귀 대신 사용하므로 편향 트리에서도 호출 스택이 넘치지 않음) */
+typedef struct {
+    const BstNode* node;
+    size_t depth;
+} TraversalItem;
 
-// 이진 탐색 트리 구조체 정의
+/* 필요할 때 2배씩 늘어나는 순회용 스택 */
 typedef struct {
-    TreeNode* root;    // 루트 노드
-    size_t size;       // 전체 노드의 수
-} BSTree;
-
-/* 오류 처리를 위한 열거형 정의 */
-typedef enum {
-    TREE_OK,
-    TREE_MEMORY_ERROR,
-    TREE_EMPTY,
-    TREE_NOT_FOUND
-} TreeResult;
+    TraversalItem* items;
+    size_t count;
+    size_t capacity;
+} TraversalStack;
+
+/* 스택에 항목 추가
+ * - 반환값: 성공 시 true, 메모리 부족 시 false
+ */
+static bool traversal_push(TraversalStack* stack, const BstNode* node, size_t depth) {
+    if (stack->count == stack->capacity) {
+        size_t new_capacity = stack->capacity ? stack->capacity * 2 : 32;
+        TraversalItem* items = (TraversalItem*)realloc(stack->items, new_capacity * sizeof(TraversalItem));
+        if (items == NULL) {
+            return false;
+        }
+        stack->items = items;
+        stack->capacity = new_capacity;
+    }
+    stack->items[stack->count].node = node;
+    stack->items[stack->count].depth = depth;
+    stack->count++;
+    return true;
+}
+
+/* 서브트리 크기 (빈 서브트리는 0) */
+static size_t subtree_size(const BstNode* node) {
+    return node ? node->size : 0;
+}
 
 /* 새로운 노드 생성
- * - 매개변수: data - 저장할 데이터
+ * - 트리의 노드 풀에서 노드를 할당 (풀 모드에서는 free list 재사용)
+ * - 매개변수: tree - 대상 트리, data - 저장할 데이터
  * - 반환값: 생성된 노드의 포인터 또는 실패 시 NULL
  */
-static TreeNode* node_create(DataType data) {
-    TreeNode* new_node = (TreeNode*)malloc(sizeof(TreeNode));
+static BstNode* node_create(BSTree* tree, BstKey data) {
+    BstNode* new_node = (BstNode*)node_pool_alloc(&tree->pool);
     if (new_node == NULL) {
         return NULL;
     }
     new_node->data = data;
+    new_node->size = 1;
     new_node->left = NULL;
     new_node->right = NULL;
     return new_node;
 }
 
 /* 트리 생성
- * - 새로운 빈 이진 탐색 트리를 동적으로 할당하고 초기화
+ * - 노드 풀(NODE_ALLOC_POOL)을 사용하는 빈 이진 탐색 트리 생성
+ *   (노드를 슬랩 단위로 할당하므로 대량 삽입 시 malloc 호출이 노드 수가 아닌 슬랩 수만큼)
  * - 반환값: 생성된 트리의 포인터 또는 실패 시 NULL
  */
-BSTree* tree_create(void) {
+BSTree* bst_create(void) {
+    return bst_create_ex(NODE_ALLOC_POOL, 0);
+}
+
+/* 노드 할당 방식을 지정하여 트리 생성
+ * - NODE_ALLOC_MALLOC 이면 노드마다 malloc/free
+ * - 매개변수: mode - 노드 할당 방식, nodes_per_slab - 슬랩당 노드 수 (0이면 기본값)
+ * - 반환값: 생성된 트리의 포인터 또는 실패 시 NULL
+ */
+BSTree* bst_create_ex(NodeAllocMode mode, size_t nodes_per_slab) {
     BSTree* tree = (BSTree*)malloc(sizeof(BSTree));
     if (tree == NULL) {
         return NULL;
     }
     tree->root = NULL;
     tree->size = 0;
+    node_pool_init(&tree->pool, mode, sizeof(BstNode), nodes_per_slab);
     return tree;
 }
 
@@ -58,267 +87,575 @@ BSTree* tree_create(void) {
  * - 매개변수: tree - 검사할 트리
  * - 반환값: 비어있으면 true, 아니면 false
  */
-bool tree_is_empty(const BSTree* tree) {
+bool bst_is_empty(const BSTree* tree) {
     return (tree->root == NULL);
 }
 
-/* 재귀적 노드 삽입 (내부 함수)
- * - 매개변수: node - 현재 노드, data - 삽입할 데이터
- * - 반환값: 삽입 후의 (서브)트리 루트 노드
+/* 트리의 크기 반환
+ * - 매개변수: tree - 대상 트리
+ * - 반환값: 트리의 노드 개수
  */
-static TreeNode* insert_recursive(TreeNode* node, DataType data) {
-    if (node == NULL) {
-        return node_create(data);
-    }
+size_t bst_size(const BSTree* tree) {
+    return tree->size;
+}
 
-    if (data < node->data) {
-        node->left = insert_recursive(node->left, data);
+/* 노드 삽입
+ * - 반복문으로 삽입 위치를 찾은 뒤, 같은 경로를 다시 내려가며 서브트리 크기를 1씩 증가
+ *   (중복 값이면 크기를 바꾸지 않도록 먼저 위치를 확정)
+ * - 매개변수: tree - 대상 트리, data - 삽입할 데이터
+ * - 반환값: 성공 시 BST_OK, 이미 있으면 BST_DUPLICATE, 실패 시 BST_MEMORY_ERROR
+ */
+BstResult bst_insert(BSTree* tree, BstKey data) {
+    BstNode** link = &tree->root;
+    while (*link != NULL) {
+        if (data < (*link)->data) {
+            link = &(*link)->left;
+        }
+        else if (data > (*link)->data) {
+            link = &(*link)->right;
+        }
+        else {
+            return BST_DUPLICATE;
+        }
     }
-    else if (data > node->data) {
-        node->right = insert_recursive(node->right, data);
+
+    BstNode* new_node = node_create(tree, data);
+    if (new_node == NULL) {
+        return BST_MEMORY_ERROR;
     }
 
-    return node;
+    // 루트부터 부모까지의 서브트리 크기 갱신
+    BstNode* current = tree->root;
+    while (current != NULL) {
+        current->size++;
+        current = data < current->data ? current->left : current->right;
+    }
+    *link = new_node;
+    tree->size++;
+    return BST_OK;
 }
 
-/* 노드 삽입 (외부 인터페이스)
- * - 매개변수: tree - 대상 트리, data - 삽입할 데이터
- * - 반환값: 성공 시 TREE_OK, 실패 시 에러 코드
+/* 노드 삭제
+ * - 반복문으로 대상을 찾은 뒤, 경로를 다시 내려가며 서브트리 크기를 1씩 감소
+ * - 두 자식이 모두 있으면 오른쪽 서브트리의 최소 노드(후계자)의 값을 옮겨오고 후계자를 제거
+ * - 매개변수: tree - 대상 트리, data - 삭제할 데이터
+ * - 반환값: 성공 시 BST_OK, 실패 시 에러 코드
  */
-TreeResult tree_insert(BSTree* tree, DataType data) {
-    TreeNode* new_root = insert_recursive(tree->root, data);
-    if (new_root == NULL && tree->root == NULL) {
-        return TREE_MEMORY_ERROR;
+BstResult bst_delete(BSTree* tree, BstKey data) {
+    if (bst_is_empty(tree)) {
+        return BST_EMPTY;
+    }
+    if (!bst_search(tree, data)) {
+        return BST_NOT_FOUND;
     }
 
-    if (tree->root == NULL) {
-        tree->root = new_root;
+    // 대상까지 내려가며 크기 감소
+    BstNode** link = &tree->root;
+    while ((*link)->data != data) {
+        (*link)->size--;
+        link = data < (*link)->data ? &(*link)->left : &(*link)->right;
     }
-    tree->size++;
-    return TREE_OK;
+
+    BstNode* target = *link;
+    if (target->left == NULL || target->right == NULL) {
+        // 경우 1, 2: 리프 노드이거나 한쪽 자식만 있으면 자식을 부모에 직접 연결
+        *link = target->left ? target->left : target->right;
+        node_pool_free(&tree->pool, target);
+    }
+    else {
+        // 경우 3: 후계자까지 내려가며 크기 감소 후 후계자를 떼어냄 (후계자는 왼쪽 자식이 없음)
+        target->size--;
+        BstNode** successor_link = &target->right;
+        while ((*successor_link)->left != NULL) {
+            (*successor_link)->size--;
+            successor_link = &(*successor_link)->left;
+        }
+        BstNode* successor = *successor_link;
+        target->data = successor->data;
+        *successor_link = successor->right;
+        node_pool_free(&tree->pool, successor);
+    }
+
+    tree->size--;
+    return BST_OK;
 }
 
-/* 최소값을 가진 노드 찾기 (내부 함수)
- * - 매개변수: node - 시작 노드
- * - 반환값: 최소값을 가진 노드의 포인터
+/* 노드 검색
+ * - 매개변수: tree - 대상 트리, data - 검색할 데이터
+ * - 반환값: 성공 시 true, 실패 시 false
  */
-static TreeNode* find_min_node(TreeNode* node) {
-    TreeNode* current = node;
-    while (current && current->left != NULL) {
-        current = current->left;
+bool bst_search(const BSTree* tree, BstKey data) {
+    const BstNode* current = tree->root;
+    while (current != NULL) {
+        if (data < current->data) {
+            current = current->left;
+        }
+        else if (data > current->data) {
+            current = current->right;
+        }
+        else {
+            return true;
+        }
     }
-    return current;
+    return false;
 }
 
-/* 노드 삭제 (내부 함수)
- * - 매개변수: node - 현재 노드, data - 삭제할 데이터
- * - 반환값: 삭제 후의 (서브)트리 루트 노드
+/* 최소값 찾기
+ * - 매개변수: tree - 대상 트리, value - 결과를 저장할 포인터
+ * - 반환값: 성공 시 BST_OK, 실패 시 에러 코드
  */
-static TreeNode* delete_recursive(TreeNode* node, DataType data, bool* success) {
-    if (node == NULL) {
-        *success = false;
-        return NULL;
+BstResult bst_find_min(const BSTree* tree, BstKey* value) {
+    if (bst_is_empty(tree)) {
+        return BST_EMPTY;
     }
 
-    if (data < node->data) {
-        node->left = delete_recursive(node->left, data, success);
+    const BstNode* current = tree->root;
+    while (current->left != NULL) {
+        current = current->left;
     }
-    else if (data > node->data) {
-        node->right = delete_recursive(node->right, data, success);
+    *value = current->data;
+    return BST_OK;
+}
+
+/* 최대값 찾기
+ * - 매개변수: tree - 대상 트리, value - 결과를 저장할 포인터
+ * - 반환값: 성공 시 BST_OK, 실패 시 에러 코드
+ */
+BstResult bst_find_max(const BSTree* tree, BstKey* value) {
+    if (bst_is_empty(tree)) {
+        return BST_EMPTY;
     }
-    else {
-        *success = true;
-        // 경우 1: 리프 노드
-        if (node->left == NULL && node->right == NULL) {
-            free(node);
-            return NULL;
+
+    const BstNode* current = tree->root;
+    while (current->right != NULL) {
+        current = current->right;
+    }
+    *value = current->data;
+    return BST_OK;
+}
+
+/* 순위 (data보다 작은 값의 개수)
+ * - 오른쪽으로 내려갈 때마다 왼쪽 서브트리와 현재 노드를 더함
+ * - 매개변수: tree - 대상 트리, data - 기준 값 (트리에 없어도 됨)
+ * - 반환값: data 미만인 요소 수 (data가 있으면 0부터 시작하는 그 위치)
+ */
+size_t bst_rank(const BSTree* tree, BstKey data) {
+    size_t rank = 0;
+    const BstNode* current = tree->root;
+    while (current != NULL) {
+        if (data <= current->data) {
+            current = current->left;
         }
-        // 경우 2: 한쪽 자식만 있는 경우
-        if (node->left == NULL) {
-            TreeNode* temp = node->right;
-            free(node);
-            return temp;
+        else {
+            rank += subtree_size(current->left) + 1;
+            current = current->right;
         }
-        if (node->right == NULL) {
-            TreeNode* temp = node->left;
-            free(node);
-            return temp;
+    }
+    return rank;
+}
+
+/* data 이하인 값의 개수 (내부 함수) */
+static size_t count_less_equal(const BSTree* tree, BstKey data) {
+    size_t count = 0;
+    const BstNode* current = tree->root;
+    while (current != NULL) {
+        if (data < current->data) {
+            current = current->left;
+        }
+        else {
+            count += subtree_size(current->left) + 1;
+            current = current->right;
         }
-        // 경우 3: 두 자식이 모두 있는 경우
-        TreeNode* temp = find_min_node(node->right);
-        node->data = temp->data;
-        node->right = delete_recursive(node->right, temp->data, success);
     }
-    return node;
+    return count;
 }
 
-/* 노드 삭제 (외부 인터페이스)
- * - 매개변수: tree - 대상 트리, data - 삭제할 데이터
- * - 반환값: 성공 시 TREE_OK, 실패 시 에러 코드
+/* k번째로 작은 값 찾기 (0부터 시작)
+ * - 왼쪽 서브트리 크기와 비교하여 한 방향으로만 내려감
+ * - 매개변수: tree - 대상 트리, k - 순위, value - 결과를 저장할 포인터
+ * - 반환값: 성공 시 BST_OK, 비어있으면 BST_EMPTY, k >= 크기이면 BST_OUT_OF_RANGE
  */
-TreeResult tree_delete(BSTree* tree, DataType data) {
-    if (tree_is_empty(tree)) {
-        return TREE_EMPTY;
+BstResult bst_select(const BSTree* tree, size_t k, BstKey* value) {
+    if (bst_is_empty(tree)) {
+        return BST_EMPTY;
+    }
+    if (k >= tree->size) {
+        return BST_OUT_OF_RANGE;
     }
 
-    bool success = false;
-    tree->root = delete_recursive(tree->root, data, &success);
-
-    if (success) {
-        tree->size--;
-        return TREE_OK;
+    const BstNode* current = tree->root;
+    for (;;) {
+        size_t left_size = subtree_size(current->left);
+        if (k < left_size) {
+            current = current->left;
+        }
+        else if (k == left_size) {
+            *value = current->data;
+            return BST_OK;
+        }
+        else {
+            k -= left_size + 1;
+            current = current->right;
+        }
     }
-    return TREE_NOT_FOUND;
 }
 
-/* 노드 검색 (내부 함수)
- * - 매개변수: node - 현재 노드, data - 검색할 데이터
- * - 반환값: 찾은 노드의 포인터 또는 NULL
+/* 백분위 값 찾기 (nearest-rank 방식)
+ * - 전체 n개 중 ceil(percent / 100 * n)번째 값 (0%는 최소값)
+ * - 매개변수: tree - 대상 트리, percent - 0 ~ 100, value - 결과를 저장할 포인터
+ * - 반환값: 성공 시 BST_OK, 비어있으면 BST_EMPTY, 범위 밖이면 BST_OUT_OF_RANGE
  */
-static TreeNode* search_recursive(TreeNode* node, DataType data) {
-    if (node == NULL || node->data == data) {
-        return node;
+BstResult bst_percentile(const BSTree* tree, double percent, BstKey* value) {
+    if (bst_is_empty(tree)) {
+        return BST_EMPTY;
+    }
+    if (!(percent >= 0.0 && percent <= 100.0)) {
+        return BST_OUT_OF_RANGE;
     }
 
-    if (data < node->data) {
-        return search_recursive(node->left, data);
+    double position = percent / 100.0 * (double)tree->size;
+    size_t rank = (size_t)position;
+    if ((double)rank < position) {
+        rank++;     // 올림
+    }
+    if (rank == 0) {
+        rank = 1;
     }
-    return search_recursive(node->right, data);
+    return bst_select(tree, rank - 1, value);
 }
 
-/* 노드 검색 (외부 인터페이스)
- * - 매개변수: tree - 대상 트리, data - 검색할 데이터
- * - 반환값: 성공 시 true, 실패 시 false
+/* data 이상인 가장 작은 값 찾기
+ * - 매개변수: tree - 대상 트리, data - 기준 값, value - 결과를 저장할 포인터
+ * - 반환값: 성공 시 BST_OK, 없으면 BST_NOT_FOUND
  */
-bool tree_search(const BSTree* tree, DataType data) {
-    return search_recursive(tree->root, data) != NULL;
+BstResult bst_lower_bound(const BSTree* tree, BstKey data, BstKey* value) {
+    const BstNode* candidate = NULL;
+    const BstNode* current = tree->root;
+    while (current != NULL) {
+        if (current->data >= data) {
+            candidate = current;
+            current = current->left;
+        }
+        else {
+            current = current->right;
+        }
+    }
+    if (candidate == NULL) {
+        return BST_NOT_FOUND;
+    }
+    *value = candidate->data;
+    return BST_OK;
 }
 
-/* 최소값 찾기
- * - 매개변수: tree - 대상 트리, value - 결과를 저장할 포인터
- * - 반환값: 성공 시 TREE_OK, 실패 시 에러 코드
+/* data보다 큰 가장 작은 값 찾기
+ * - 매개변수: tree - 대상 트리, data - 기준 값, value - 결과를 저장할 포인터
+ * - 반환값: 성공 시 BST_OK, 없으면 BST_NOT_FOUND
  */
-TreeResult tree_find_min(const BSTree* tree, DataType* value) {
-    if (tree_is_empty(tree)) {
-        return TREE_EMPTY;
+BstResult bst_upper_bound(const BSTree* tree, BstKey data, BstKey* value) {
+    const BstNode* candidate = NULL;
+    const BstNode* current = tree->root;
+    while (current != NULL) {
+        if (current->data > data) {
+            candidate = current;
+            current = current->left;
+        }
+        else {
+            current = current->right;
+        }
+    }
+    if (candidate == NULL) {
+        return BST_NOT_FOUND;
     }
+    *value = candidate->data;
+    return BST_OK;
+}
 
-    TreeNode* min_node = find_min_node(tree->root);
-    *value = min_node->data;
-    return TREE_OK;
+/* [low, high] 구간에 속한 값의 개수
+ * - (high 이하의 개수) - (low 미만의 개수), 경로 두 개만 내려가므로 O(높이)
+ * - 매개변수: tree - 대상 트리, low/high - 구간 양 끝 (포함)
+ * - 반환값: 구간에 속한 요소 수 (low > high 이면 0)
+ */
+size_t bst_count_range(const BSTree* tree, BstKey low, BstKey high) {
+    if (low > high) {
+        return 0;
+    }
+    return count_less_equal(tree, high) - bst_rank(tree, low);
 }
 
-/* 최대값 찾기 (내부 함수)
- * - 매개변수: node - 시작 노드
- * - 반환값: 최대값을 가진 노드의 포인터
+/* 트리 높이 (노드 수 기준, 빈 트리는 0)
+ * - 명시적 스택으로 깊이 우선 탐색
+ * - 매개변수: tree - 대상 트리
+ * - 반환값: 가장 깊은 경로의 노드 수 (메모리 부족 시 0)
  */
-static TreeNode* find_max_node(TreeNode* node) {
-    TreeNode* current = node;
-    while (current && current->right != NULL) {
-        current = current->right;
+size_t bst_height(const BSTree* tree) {
+    TraversalStack stack = { NULL, 0, 0 };
+    size_t height = 0;
+
+    if (tree->root != NULL && !traversal_push(&stack, tree->root, 1)) {
+        return 0;
+    }
+    while (stack.count > 0) {
+        TraversalItem item = stack.items[--stack.count];
+        if (item.depth > height) {
+            height = item.depth;
+        }
+        if ((item.node->left != NULL && !traversal_push(&stack, item.node->left, item.depth + 1)) ||
+            (item.node->right != NULL && !traversal_push(&stack, item.node->right, item.depth + 1))) {
+            height = 0;
+            break;
+        }
     }
-    return current;
+    free(stack.items);
+    return height;
 }
 
-/* 최대값 찾기 (외부 인터페이스)
- * - 매개변수: tree - 대상 트리, value - 결과를 저장할 포인터
- * - 반환값: 성공 시 TREE_OK, 실패 시 에러 코드
+/* 커서의 스택/큐 끝에 노드 추가 (내부 함수)
+ * - 큐 앞쪽에 빈 칸이 있으면 먼저 당겨서 재사용, 없으면 2배로 늘림
+ * - 반환값: 성공 시 true, 메모리 부족 시 false (status 에 기록)
  */
-TreeResult tree_find_max(const BSTree* tree, DataType* value) {
-    if (tree_is_empty(tree)) {
-        return TREE_EMPTY;
+static bool cursor_push(BstCursor* cursor, const BstNode* node) {
+    if (cursor->count == cursor->capacity) {
+        if (cursor->head > 0) {
+            memmove(cursor->items, cursor->items + cursor->head,
+                (cursor->count - cursor->head) * sizeof(BstNode*));
+            cursor->count -= cursor->head;
+            cursor->head = 0;
+        }
+        else {
+            size_t new_capacity = cursor->capacity ? cursor->capacity * 2 : 32;
+            const BstNode** items = (const BstNode**)realloc((void*)cursor->items, new_capacity * sizeof(BstNode*));
+            if (items == NULL) {
+                cursor->status = BST_MEMORY_ERROR;
+                return false;
+            }
+            cursor->items = items;
+            cursor->capacity = new_capacity;
+        }
     }
+    cursor->items[cursor->count++] = node;
+    return true;
+}
 
-    TreeNode* max_node = find_max_node(tree->root);
-    *value = max_node->data;
-    return TREE_OK;
+/* 순회 커서 초기화
+ * - 메모리를 할당하지 않음 (스택/큐는 처음 필요할 때 할당)
+ * - 매개변수: cursor - 초기화할 커서, tree - 순회할 트리, order - 순회 순서
+ */
+void bst_cursor_init(BstCursor* cursor, const BSTree* tree, TraversalOrder order) {
+    cursor->items = NULL;
+    cursor->count = 0;
+    cursor->head = 0;
+    cursor->capacity = 0;
+    cursor->current = tree->root;
+    cursor->last = NULL;
+    cursor->order = order;
+    cursor->status = BST_OK;
 }
 
-/* 중위 순회 (내부 함수)
- * - 매개변수: node - 현재 노드
+/* 다음 노드
+ * - 전위: 왼쪽으로 내려가면서 오른쪽 자식만 스택에 보관
+ * - 중위: 왼쪽 경로를 스택에 쌓고 하나 꺼낸 뒤 오른쪽 서브트리로 이동
+ * - 후위: 스택 맨 위 노드의 오른쪽 서브트리를 이미 방문했으면(last) 그 노드를 방문
+ * - 레벨 순서: 큐에서 꺼내고 자식을 넣음
+ * - 매개변수: cursor - 대상 커서
+ * - 반환값: 다음 노드 또는 끝(또는 메모리 부족)이면 NULL
  */
-static void inorder_traversal(TreeNode* node) {
-    if (node != NULL) {
-        inorder_traversal(node->left);
-        printf("%d ", node->data);
-        inorder_traversal(node->right);
+const BstNode* bst_cursor_next(BstCursor* cursor) {
+    const BstNode* node;
+
+    if (cursor->status != BST_OK) {
+        return NULL;
+    }
+
+    switch (cursor->order) {
+    case TRAVERSE_PREORDER:
+        node = cursor->current;
+        if (node == NULL) {
+            return NULL;
+        }
+        if (node->left != NULL) {
+            if (node->right != NULL && !cursor_push(cursor, node->right)) {
+                return NULL;
+            }
+            cursor->current = node->left;
+        }
+        else if (node->right != NULL) {
+            cursor->current = node->right;
+        }
+        else {
+            cursor->current = cursor->count > 0 ? cursor->items[--cursor->count] : NULL;
+        }
+        return node;
+
+    case TRAVERSE_INORDER:
+        while (cursor->current != NULL) {
+            if (!cursor_push(cursor, cursor->current)) {
+                return NULL;
+            }
+            cursor->current = cursor->current->left;
+        }
+        if (cursor->count == 0) {
+            return NULL;
+        }
+        node = cursor->items[--cursor->count];
+        cursor->current = node->right;
+        return node;
+
+    case TRAVERSE_POSTORDER:
+        for (;;) {
+            while (cursor->current != NULL) {
+                if (!cursor_push(cursor, cursor->current)) {
+                    return NULL;
+                }
+                cursor->current = cursor->current->left;
+            }
+            if (cursor->count == 0) {
+                return NULL;
+            }
+            node = cursor->items[cursor->count - 1];
+            if (node->right != NULL && cursor->last != node->right) {
+                cursor->current = node->right;
+            }
+            else {
+                cursor->count--;
+                cursor->last = node;
+                return node;
+            }
+        }
+
+    case TRAVERSE_LEVEL_ORDER:
+        if (cursor->current != NULL) {
+            node = cursor->current;     // 루트 (큐를 거치지 않음)
+            cursor->current = NULL;
+        }
+        else if (cursor->head < cursor->count) {
+            node = cursor->items[cursor->head++];
+        }
+        else {
+            return NULL;
+        }
+        if ((node->left != NULL && !cursor_push(cursor, node->left)) ||
+            (node->right != NULL && !cursor_push(cursor, node->right))) {
+            return NULL;
+        }
+        return node;
+
+    default:
+        return NULL;
     }
 }
 
-/* 중위 순회 (외부 인터페이스)
+/* 순회 커서 해제 (순회를 끝까지 하지 않았어도 호출)
+ * - 매개변수: cursor - 해제할 커서
+ */
+void bst_cursor_destroy(BstCursor* cursor) {
+    free((void*)cursor->items);
+    cursor->items = NULL;
+    cursor->count = cursor->head = cursor->capacity = 0;
+    cursor->current = NULL;
+}
+
+/* 정렬된 순서로 출력 (중위 순회 커서)
  * - 매개변수: tree - 순회할 트리
  */
-void tree_print_sorted(const BSTree* tree) {
-    if (tree_is_empty(tree)) {
+void bst_print_sorted(const BSTree* tree) {
+    if (bst_is_empty(tree)) {
         printf("Tree is empty\n");
         return;
     }
+
+    BstCursor cursor;
+    const BstNode* node;
+    bst_cursor_init(&cursor, tree, TRAVERSE_INORDER);
     printf("Sorted elements: ");
-    inorder_traversal(tree->root);
+    while ((node = bst_cursor_next(&cursor)) != NULL) {
+        printf("%d ", node->data);
+    }
     printf("\n");
-}
-
-/* 트리 시각화를 위한 내부 함수
- * - 매개변수: node - 출력할 노드, level - 현재 레벨, prefix - 출력 접두사
- */
-static void print_tree_recursive(const TreeNode* node, int level, char* prefix) {
-    if (node == NULL) {
-        return;
+    if (cursor.status != BST_OK) {
+        printf("Error: Memory allocation failed\n");
     }
-
-    printf("%s", prefix);
-    printf("%s", level ? "├── " : "");
-    printf("%d\n", node->data);
-
-    char new_prefix[256];
-    sprintf(new_prefix, "%s%s", prefix, level ? "│   " : "");
-
-    print_tree_recursive(node->left, 1, new_prefix);
-    print_tree_recursive(node->right, 1, new_prefix);
+    bst_cursor_destroy(&cursor);
 }
 
-/* 트리 시각화 (외부 인터페이스)
+/* 트리 시각화 (전위 순회)
+ * - 깊이만큼 들여쓰기하여 출력, 명시적 스택 사용 (왼쪽 자식을 먼저 출력하도록 오른쪽부터 쌓음)
  * - 매개변수: tree - 출력할 트리
  */
-void tree_print(const BSTree* tree) {
-    if (tree_is_empty(tree)) {
+void bst_print(const BSTree* tree) {
+    if (bst_is_empty(tree)) {
         printf("Tree is empty\n");
         return;
     }
+
+    TraversalStack stack = { NULL, 0, 0 };
     printf("Binary Search Tree Structure:\n");
-    print_tree_recursive(tree->root, 0, "");
+    if (!traversal_push(&stack, tree->root, 0)) {
+        printf("Error: Memory allocation failed\n");
+        return;
+    }
+    while (stack.count > 0) {
+        TraversalItem item = stack.items[--stack.count];
+        for (size_t i = 1; i < item.depth; i++) {
+            printf("│   ");
+        }
+        printf("%s%d (size=%zu)\n", item.depth ? "├── " : "", item.node->data, item.node->size);
+
+        if ((item.node->right != NULL && !traversal_push(&stack, item.node->right, item.depth + 1)) ||
+            (item.node->left != NULL && !traversal_push(&stack, item.node->left, item.depth + 1))) {
+            printf("Error: Memory allocation failed\n");
+            break;
+        }
+    }
+    free(stack.items);
 }
 
-/* 서브트리 삭제 (내부 함수)
- * - 매개변수: node - 삭제할 서브트리의 루트 노드
+/* 트리 초기화
+ * - 풀 모드에서는 노드를 하나씩 반환하지 않고 슬랩을 한꺼번에 해제
+ * - 그 외에는 왼쪽 자식이 있으면 오른쪽 회전으로 펴면서 하나씩 해제 (추가 메모리/재귀 없음)
+ * - 매개변수: tree - 초기화할 트리
  */
-static void delete_subtree(TreeNode* node) {
-    if (node == NULL) {
-        return;
+void bst_clear(BSTree* tree) {
+    if (tree->pool.mode == NODE_ALLOC_POOL) {
+        node_pool_release(&tree->pool);
+    }
+    else {
+        BstNode* current = tree->root;
+        while (current != NULL) {
+            if (current->left != NULL) {
+                BstNode* left = current->left;
+                current->left = left->right;
+                left->right = current;
+                current = left;
+            }
+            else {
+                BstNode* right = current->right;
+                node_pool_free(&tree->pool, current);
+                current = right;
+            }
+        }
     }
-    delete_subtree(node->left);
-    delete_subtree(node->right);
-    free(node);
+    tree->root = NULL;
+    tree->size = 0;
 }
 
 /* 트리 메모리 해제
  * - 매개변수: tree - 해제할 트리
  */
-void tree_destroy(BSTree* tree) {
+void bst_destroy(BSTree* tree) {
     if (tree != NULL) {
-        delete_subtree(tree->root);
+        bst_clear(tree);
         free(tree);
     }
 }
 
-/* 트리의 크기 반환
- * - 매개변수: tree - 대상 트리
- * - 반환값: 트리의 노드 개수
+/* 노드 풀 통계 조회
+ * - 매개변수: tree - 대상 트리, stats - 결과를 저장할 구조체
  */
-size_t tree_size(const BSTree* tree) {
-    return tree->size;
+void bst_pool_stats(const BSTree* tree, NodePoolStats* stats) {
+    node_pool_get_stats(&tree->pool, stats);
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 함수 */
 void print_menu(void) {
     printf("\n=== Binary Search Tree Menu ===\n");
@@ -330,37 +667,53 @@ void print_menu(void) {
     printf("6. Print sorted elements\n");
     printf("7. Print tree structure\n");
     printf("8. Get tree size\n");
+    printf("9. Rank of value\n");
+    printf("10. Select k-th smallest\n");
+    printf("11. Percentile\n");
+    printf("12. Lower/upper bound\n");
+    printf("13. Count values in range\n");
+    printf("14. Insert sorted sequence\n");
+    printf("15. Traverse first k elements\n");
     printf("0. Exit\n");
     printf("Choice: ");
 }
 
 /* 에러 메시지 출력 함수 */
-void print_error(TreeResult result) {
+void print_error(BstResult result) {
     switch (result) {
-    case TREE_MEMORY_ERROR:
+    case BST_MEMORY_ERROR:
         printf("Error: Memory allocation failed\n");
         break;
-    case TREE_EMPTY:
+    case BST_EMPTY:
         printf("Error: Tree is empty\n");
         break;
-    case TREE_NOT_FOUND:
+    case BST_NOT_FOUND:
         printf("Error: Element not found\n");
         break;
+    case BST_DUPLICATE:
+        printf("Error: Element already exists\n");
+        break;
+    case BST_OUT_OF_RANGE:
+        printf("Error: Out of range\n");
+        break;
     default:
         break;
     }
 }
 
 int main(void) {
-    BSTree* tree = tree_create();
+    BSTree* tree = bst_create();
     if (tree == NULL) {
         printf("Failed to create tree\n");
         return 1;
     }
 
     int choice;
-    DataType value;
-    TreeResult result;
+    BstKey value;
+    BstKey high;
+    size_t k;
+    double percent;
+    BstResult result;
 
     do {
         print_menu();
@@ -374,8 +727,8 @@ int main(void) {
         case 1:  // Insert
             printf("Enter value to insert: ");
             scanf("%d", &value);
-            result = tree_insert(tree, value);
-            if (result == TREE_OK) {
+            result = bst_insert(tree, value);
+            if (result == BST_OK) {
                 printf("Successfully inserted %d\n", value);
             }
             else {
@@ -386,8 +739,8 @@ int main(void) {
         case 2:  // Delete
             printf("Enter value to delete: ");
             scanf("%d", &value);
-            result = tree_delete(tree, value);
-            if (result == TREE_OK) {
+            result = bst_delete(tree, value);
+            if (result == BST_OK) {
                 printf("Successfully deleted %d\n", value);
             }
             else {
@@ -398,7 +751,7 @@ int main(void) {
         case 3:  // Search
             printf("Enter value to search: ");
             scanf("%d", &value);
-            if (tree_search(tree, value)) {
+            if (bst_search(tree, value)) {
                 printf("Found %d in the tree\n", value);
             }
             else {
@@ -407,8 +760,8 @@ int main(void) {
             break;
 
         case 4:  // Find minimum
-            result = tree_find_min(tree, &value);
-            if (result == TREE_OK) {
+            result = bst_find_min(tree, &value);
+            if (result == BST_OK) {
                 printf("Minimum value: %d\n", value);
             }
             else {
@@ -417,8 +770,8 @@ int main(void) {
             break;
 
         case 5:  // Find maximum
-            result = tree_find_max(tree, &value);
-            if (result == TREE_OK) {
+            result = bst_find_max(tree, &value);
+            if (result == BST_OK) {
                 printf("Maximum value: %d\n", value);
             }
             else {
@@ -427,17 +780,105 @@ int main(void) {
             break;
 
         case 6:  // Print sorted
-            tree_print_sorted(tree);
+            bst_print_sorted(tree);
             break;
 
         case 7:  // Print structure
-            tree_print(tree);
+            bst_print(tree);
             break;
 
         case 8:  // Get size
-            printf("Tree size: %zu\n", tree_size(tree));
+            printf("Tree size: %zu (height: %zu)\n", bst_size(tree), bst_height(tree));
+            break;
+
+        case 9:  // Rank
+            printf("Enter value: ");
+            scanf("%d", &value);
+            printf("%zu elements are smaller than %d\n", bst_rank(tree, value), value);
+            break;
+
+        case 10:  // Select
+            printf("Enter k (0-based): ");
+            scanf("%zu", &k);
+            result = bst_select(tree, k, &value);
+            if (result == BST_OK) {
+                printf("Element at rank %zu: %d\n", k, value);
+            }
+            else {
+                print_error(result);
+            }
+            break;
+
+        case 11:  // Percentile
+            printf("Enter percentile (0-100): ");
+            scanf("%lf", &percent);
+            result = bst_percentile(tree, percent, &value);
+            if (result == BST_OK) {
+                printf("p%g: %d\n", percent, value);
+            }
+            else {
+                print_error(result);
+            }
+            break;
+
+        case 12:  // Lower/upper bound
+            printf("Enter value: ");
+            scanf("%d", &value);
+            if (bst_lower_bound(tree, value, &high) == BST_OK) {
+                printf("Lower bound (>= %d): %d\n", value, high);
+            }
+            else {
+                printf("No element >= %d\n", value);
+            }
+            if (bst_upper_bound(tree, value, &high) == BST_OK) {
+                printf("Upper bound (> %d): %d\n", value, high);
+            }
+            else {
+                printf("No element > %d\n", value);
+            }
             break;
 
+        case 13:  // Count range
+            printf("Enter low and high: ");
+            scanf("%d %d", &value, &high);
+            printf("%zu elements in [%d, %d]\n", bst_count_range(tree, value, high), value, high);
+            break;
+
+        case 14:  // Insert sorted sequence (편향 트리 만들기)
+            printf("Enter count: ");
+            scanf("%zu", &k);
+            for (size_t i = 0; i < k; i++) {
+                bst_insert(tree, (BstKey)i);
+            }
+            printf("Tree size: %zu (height: %zu)\n", bst_size(tree), bst_height(tree));
+            break;
+
+        case 15:  // Traverse first k elements (커서는 k개만 계산하고 멈춤)
+        {
+            static const char* order_names[] = { "Preorder", "Inorder", "Postorder", "Level-order" };
+            int order;
+            BstCursor cursor;
+            const BstNode* node;
+
+            printf("Order (0: pre, 1: in, 2: post, 3: level) and k: ");
+            scanf("%d %zu", &order, &k);
+            if (order < TRAVERSE_PREORDER || order > TRAVERSE_LEVEL_ORDER) {
+                printf("Invalid order\n");
+                break;
+            }
+            bst_cursor_init(&cursor, tree, (TraversalOrder)order);
+            printf("%s: ", order_names[order]);
+            for (size_t i = 0; i < k && (node = bst_cursor_next(&cursor)) != NULL; i++) {
+                printf("%d ", node->data);
+            }
+            printf("\n");
+            if (cursor.status != BST_OK) {
+                print_error(cursor.status);
+            }
+            bst_cursor_destroy(&cursor);
+            break;
+        }
+
         case 0:  // Exit
             printf("Exiting program\n");
             break;
@@ -447,9 +888,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    tree_destroy(tree);
+    bst_destroy(tree);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -473,6 +915,14 @@ int main(void) {
 - O(h) (h는 트리의 높이)
 - 한쪽 방향으로만 이동
 
+순서 통계 (rank/select/percentile/lower_bound/upper_bound/count_range):
+- O(h), 정렬된 배열로 복사하지 않고 트리에서 바로 계산
+- 각 노드에 서브트리 크기(size)를 저장하는 augmentation 사용
+  * rank: 오른쪽으로 갈 때마다 왼쪽 서브트리 크기 + 1을 더함
+  * select: 왼쪽 서브트리 크기와 k를 비교하여 한 방향으로만 이동
+  * count_range: (high 이하의 수) - (low 미만의 수)
+- 삽입/삭제 시 경로 위의 size만 ±1 하므로 추가 비용은 O(h)
+
 3. 노드 삭제의 세 가지 경우
 ----------------------
 Case 1: 리프 노드
@@ -487,15 +937,24 @@ Case 3: 두 자식
 
 4. 구현 특징
 ----------
-- 재귀적 구현
+- 반복문 기반 구현 (재귀 없음)
+  * 삽입/삭제/검색은 BstNode** 링크를 따라 내려감
+  * 순회/높이/출력은 힙에 잡은 명시적 스택 사용
+  * 순회 커서(BstCursor): 전위/중위/후위/레벨 순서를 한 번에 한 노드씩 (중간에 멈출 수 있음)
+  * 정렬된 입력으로 편향된 트리(높이 = n)에서도 호출 스택 넘침 없음
+- 중복 값은 TREE_DUPLICATE로 거부 (크기 변화 없음)
 - 포인터 기반 구조
 - 동적 메모리 관리
 - 모듈화된 설계
 
 5. 메모리 관리 전략
 ---------------
-- 노드 단위 할당/해제
-- 재귀적 트리 소멸
+- 노드 풀(node_pool.h) 사용
+  * 기본값은 NODE_ALLOC_POOL: 슬랩 단위로 할당, 삭제된 노드는 free list로 재사용
+  * bst_create_ex(NODE_ALLOC_MALLOC, 0)로 노드 단위 malloc/free 선택 가능
+- 트리 소멸
+  * 풀 모드: 노드를 순회하지 않고 슬랩만 해제
+  * malloc 모드: 회전으로 트리를 펴면서 해제 (추가 메모리 없음)
 - 메모리 누수 방지
 - 안전한 포인터 처리
 
@@ -505,6 +964,11 @@ Case 3: 두 자식
   * 정렬된 순서 출력
   * 이진 탐색 트리 검증
 
+- 순회 커서
+  * 추가 메모리: 깊이 우선은 O(높이) 스택, 레벨 순서는 O(최대 너비) 큐
+  * 앞의 k개만 필요하면 k개(와 경로)만 계산 → 전체를 배열로 모을 필요 없음
+  * Morris 순회는 순회 중 포인터를 바꾸므로 const 트리에는 쓰지 않음
+
 - 시각적 출력
   * 트리 구조 표현
   * 디버깅 용이
@@ -528,13 +992,14 @@ Case 3: 두 자식
 --------------
 - 트리 균형 유지
 - 중복 키 처리
-- 재귀 깊이 제한
-- 캐시 효율성
+- 재귀 제거로 깊이 제한 없음
+- 캐시 효율성 (같은 슬랩의 노드가 메모리상 가까이 배치)
 
 10. 교육적 가치
 ------------
-- 재귀 개념 학습
-- 포인터 조작
+- 재귀를 반복문과 명시적 스택으로 바꾸는 방법
+- 포인터 조작 (포인터의 포인터)
+- 서브트리 정보 augmentation
 - 탐색 알고리즘
 - 트리 구조 이해
 
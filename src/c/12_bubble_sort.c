@@ -2,14 +2,13 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <time.h>
-
-typedef int DataType;
+#include "sort.h"
 
 /* 두 원소의 교환
  * - 매개변수: a, b - 교환할 두 원소의 포인터
  */
-void swap(DataType* a, DataType* b) {
-    DataType temp = *a;
+static void swap(SortElement* a, SortElement* b) {
+    SortElement temp = *a;
     *a = *b;
     *b = temp;
 }
@@ -18,7 +17,7 @@ void swap(DataType* a, DataType* b) {
  * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
  * - 설명: 인접한 두 원소를 비교하여 교환
  */
-void bubble_sort_basic(DataType arr[], size_t size) {
+void bubble_sort_basic(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size - 1; i++) {
         for (size_t j = 0; j < size - 1 - i; j++) {
             if (arr[j] > arr[j + 1]) {
@@ -32,7 +31,7 @@ void bubble_sort_basic(DataType arr[], size_t size) {
  * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
  * - 설명: 교환이 일어나지 않으면 조기 종료
  */
-void bubble_sort_optimized(DataType arr[], size_t size) {
+void bubble_sort_optimized(SortElement arr[], size_t size) {
     bool swapped;
     for (size_t i = 0; i < size - 1; i++) {
         swapped = false;
@@ -48,10 +47,11 @@ void bubble_sort_optimized(DataType arr[], size_t size) {
     }
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 배열 출력
  * - 매개변수: arr - 출력할 배열, size - 배열의 크기
  */
-void print_array(const DataType arr[], size_t size) {
+void print_array(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         printf("%d ", arr[i]);
     }
@@ -62,7 +62,7 @@ void print_array(const DataType arr[], size_t size) {
  * - 매개변수: arr - 검증할 배열, size - 배열의 크기
  * - 반환값: 정렬되었으면 true, 아니면 false
  */
-bool is_sorted(const DataType arr[], size_t size) {
+bool is_sorted(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size - 1; i++) {
         if (arr[i] > arr[i + 1]) {
             return false;
@@ -74,7 +74,7 @@ bool is_sorted(const DataType arr[], size_t size) {
 /* 배열을 무작위로 섞기
  * - 매개변수: arr - 섞을 배열, size - 배열의 크기
  */
-void shuffle_array(DataType arr[], size_t size) {
+void shuffle_array(SortElement arr[], size_t size) {
     for (size_t i = size - 1; i > 0; i--) {
         size_t j = rand() % (i + 1);
         swap(&arr[i], &arr[j]);
@@ -84,7 +84,7 @@ void shuffle_array(DataType arr[], size_t size) {
 /* 성능 측정을 위한 배열 복사
  * - 매개변수: dest - 목적지 배열, src - 원본 배열, size - 배열의 크기
  */
-void copy_array(DataType dest[], const DataType src[], size_t size) {
+void copy_array(SortElement dest[], const SortElement src[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         dest[i] = src[i];
     }
@@ -94,8 +94,8 @@ void copy_array(DataType dest[], const DataType src[], size_t size) {
  * - 매개변수: sort_func - 정렬 함수 포인터, arr - 정렬할 배열,
  *            size - 배열의 크기, name - 알고리즘 이름
  */
-void measure_time(void (*sort_func)(DataType[], size_t),
-    DataType arr[], size_t size, const char* name) {
+void measure_time(void (*sort_func)(SortElement[], size_t),
+    SortElement arr[], size_t size, const char* name) {
     clock_t start = clock();
     sort_func(arr, size);
     clock_t end = clock();
@@ -118,7 +118,7 @@ void print_menu(void) {
 /* 새로운 무작위 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_random_array(DataType arr[], size_t size) {
+void generate_random_array(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = rand() % 1000;  // 0-999 범위의 무작위 값
     }
@@ -134,8 +134,8 @@ int main(void) {
         return 1;
     }
 
-    DataType* arr = (DataType*)malloc(size * sizeof(DataType));
-    DataType* temp_arr = (DataType*)malloc(size * sizeof(DataType));
+    SortElement* arr = (SortElement*)malloc(size * sizeof(SortElement));
+    SortElement* temp_arr = (SortElement*)malloc(size * sizeof(SortElement));
     if (arr == NULL || temp_arr == NULL) {
         printf("Memory allocation failed\n");
         free(arr);
@@ -213,6 +213,7 @@ int main(void) {
     free(temp_arr);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -275,7 +276,7 @@ Early Termination:
 
 7. 구현 특징
 ----------
-- 타입 추상화 (DataType)
+- 타입 추상화 (SortElement)
 - 성능 측정 기능
 - 결과 검증 기능
 - 대화형 인터페이스
@@ -2,16 +2,15 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <time.h>
-
-typedef int DataType;
+#include "sort.h"
 
 /* 삽입 정렬
  * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
  * - 설명: 각 원소를 정렬된 부분의 적절한 위치에 삽입
  */
-void insertion_sort(DataType arr[], size_t size) {
+void insertion_sort(SortElement arr[], size_t size) {
     for (size_t i = 1; i < size; i++) {
-        DataType key = arr[i];
+        SortElement key = arr[i];
         int j = i - 1;
 
         // key보다 큰 원소들을 뒤로 이동
@@ -27,9 +26,9 @@ void insertion_sort(DataType arr[], size_t size) {
  * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
  * - 설명: 이진 탐색으로 삽입 위치를 찾아 삽입
  */
-void binary_insertion_sort(DataType arr[], size_t size) {
+void binary_insertion_sort(SortElement arr[], size_t size) {
     for (size_t i = 1; i < size; i++) {
-        DataType key = arr[i];
+        SortElement key = arr[i];
         int left = 0;
         int right = i - 1;
 
@@ -52,10 +51,11 @@ void binary_insertion_sort(DataType arr[], size_t size) {
     }
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 배열 출력
  * - 매개변수: arr - 출력할 배열, size - 배열의 크기
  */
-void print_array(const DataType arr[], size_t size) {
+void print_array(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         printf("%d ", arr[i]);
     }
@@ -66,7 +66,7 @@ void print_array(const DataType arr[], size_t size) {
  * - 매개변수: arr - 검증할 배열, size - 배열의 크기
  * - 반환값: 정렬되었으면 true, 아니면 false
  */
-bool is_sorted(const DataType arr[], size_t size) {
+bool is_sorted(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size - 1; i++) {
         if (arr[i] > arr[i + 1]) {
             return false;
@@ -78,7 +78,7 @@ bool is_sorted(const DataType arr[], size_t size) {
 /* 배열 복사
  * - 매개변수: dest - 목적지 배열, src - 원본 배열, size - 배열의 크기
  */
-void copy_array(DataType dest[], const DataType src[], size_t size) {
+void copy_array(SortElement dest[], const SortElement src[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         dest[i] = src[i];
     }
@@ -88,8 +88,8 @@ void copy_array(DataType dest[], const DataType src[], size_t size) {
  * - 매개변수: sort_func - 정렬 함수 포인터, arr - 정렬할 배열,
  *            size - 배열의 크기, name - 알고리즘 이름
  */
-void measure_time(void (*sort_func)(DataType[], size_t),
-    DataType arr[], size_t size, const char* name) {
+void measure_time(void (*sort_func)(SortElement[], size_t),
+    SortElement arr[], size_t size, const char* name) {
     clock_t start = clock();
     sort_func(arr, size);
     clock_t end = clock();
@@ -101,7 +101,7 @@ void measure_time(void (*sort_func)(DataType[], size_t),
 /* 새로운 무작위 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_random_array(DataType arr[], size_t size) {
+void generate_random_array(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = rand() % 1000;  // 0-999 범위의 무작위 값
     }
@@ -110,7 +110,7 @@ void generate_random_array(DataType arr[], size_t size) {
 /* 거의 정렬된 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_nearly_sorted_array(DataType arr[], size_t size) {
+void generate_nearly_sorted_array(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = i;
     }
@@ -118,7 +118,7 @@ void generate_nearly_sorted_array(DataType arr[], size_t size) {
     for (size_t i = 0; i < size / 20; i++) {
         size_t idx1 = rand() % size;
         size_t idx2 = rand() % size;
-        DataType temp = arr[idx1];
+        SortElement temp = arr[idx1];
         arr[idx1] = arr[idx2];
         arr[idx2] = temp;
     }
@@ -146,8 +146,8 @@ int main(void) {
         return 1;
     }
 
-    DataType* arr = (DataType*)malloc(size * sizeof(DataType));
-    DataType* temp_arr = (DataType*)malloc(size * sizeof(DataType));
+    SortElement* arr = (SortElement*)malloc(size * sizeof(SortElement));
+    SortElement* temp_arr = (SortElement*)malloc(size * sizeof(SortElement));
     if (arr == NULL || temp_arr == NULL) {
         printf("Memory allocation failed\n");
         free(arr);
@@ -234,6 +234,7 @@ int main(void) {
     free(temp_arr);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -2,14 +2,13 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <time.h>
-
-typedef int DataType;
+#include "sort.h"
 
 /* 두 원소의 교환
  * - 매개변수: a, b - 교환할 두 원소의 포인터
  */
-void swap(DataType* a, DataType* b) {
-    DataType temp = *a;
+static void swap(SortElement* a, SortElement* b) {
+    SortElement temp = *a;
     *a = *b;
     *b = temp;
 }
@@ -18,7 +17,7 @@ void swap(DataType* a, DataType* b) {
  * - 매개변수: arr - 배열, left, right - 구간의 시작과 끝
  * - 반환값: 중앙값의 인덱스
  */
-size_t median_of_three(DataType arr[], size_t left, size_t right) {
+size_t median_of_three(SortElement arr[], size_t left, size_t right) {
     size_t mid = (left + right) / 2;
 
     if (arr[left] > arr[mid])
@@ -35,9 +34,9 @@ size_t median_of_three(DataType arr[], size_t left, size_t right) {
  * - 매개변수: arr - 배열, left, right - 분할할 구간
  * - 반환값: 피봇의 최종 위치
  */
-size_t partition_lomuto(DataType arr[], size_t left, size_t right) {
+size_t partition_lomuto(SortElement arr[], size_t left, size_t right) {
     size_t pivot_idx = median_of_three(arr, left, right);
-    DataType pivot = arr[pivot_idx];
+    SortElement pivot = arr[pivot_idx];
     swap(&arr[pivot_idx], &arr[right]);  // 피봇을 끝으로 이동
 
     size_t i = left;  // 작은 원소들의 경계
@@ -57,9 +56,9 @@ size_t partition_lomuto(DataType arr[], size_t left, size_t right) {
  * - 매개변수: arr - 배열, left, right - 분할할 구간
  * - 반환값: 분할 위치
  */
-size_t partition_hoare(DataType arr[], size_t left, size_t right) {
+size_t partition_hoare(SortElement arr[], size_t left, size_t right) {
     size_t pivot_idx = median_of_three(arr, left, right);
-    DataType pivot = arr[pivot_idx];
+    SortElement pivot = arr[pivot_idx];
 
     size_t i = left - 1;
     size_t j = right + 1;
@@ -83,7 +82,7 @@ size_t partition_hoare(DataType arr[], size_t left, size_t right) {
 /* 퀵 정렬 (Lomuto 분할)
  * - 매개변수: arr - 정렬할 배열, left, right - 정렬할 구간
  */
-void quick_sort_lomuto(DataType arr[], size_t left, size_t right) {
+void quick_sort_lomuto(SortElement arr[], size_t left, size_t right) {
     if (left < right) {
         size_t pivot = partition_lomuto(arr, left, right);
         if (pivot > 0)
@@ -95,7 +94,7 @@ void quick_sort_lomuto(DataType arr[], size_t left, size_t right) {
 /* 퀵 정렬 (Hoare 분할)
  * - 매개변수: arr - 정렬할 배열, left, right - 정렬할 구간
  */
-void quick_sort_hoare(DataType arr[], size_t left, size_t right) {
+void quick_sort_hoare(SortElement arr[], size_t left, size_t right) {
     if (left < right) {
         size_t pivot = partition_hoare(arr, left, right);
         quick_sort_hoare(arr, left, pivot);
@@ -103,10 +102,29 @@ void quick_sort_hoare(DataType arr[], size_t left, size_t right) {
     }
 }
 
+/* Wrapper 함수 - Lomuto 퀵 정렬
+ * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
+ */
+void quick_sort_lomuto_wrapper(SortElement arr[], size_t size) {
+    if (size > 0) {
+        quick_sort_lomuto(arr, 0, size - 1);
+    }
+}
+
+/* Wrapper 함수 - Hoare 퀵 정렬
+ * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
+ */
+void quick_sort_hoare_wrapper(SortElement arr[], size_t size) {
+    if (size > 0) {
+        quick_sort_hoare(arr, 0, size - 1);
+    }
+}
+
+#ifndef DS_LIBRARY_BUILD
 /* 배열 출력
  * - 매개변수: arr - 출력할 배열, size - 배열의 크기
  */
-void print_array(const DataType arr[], size_t size) {
+void print_array(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         printf("%d ", arr[i]);
     }
@@ -117,7 +135,7 @@ void print_array(const DataType arr[], size_t size) {
  * - 매개변수: arr - 검증할 배열, size - 배열의 크기
  * - 반환값: 정렬되었으면 true, 아니면 false
  */
-bool is_sorted(const DataType arr[], size_t size) {
+bool is_sorted(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size - 1; i++) {
         if (arr[i] > arr[i + 1]) {
             return false;
@@ -129,36 +147,18 @@ bool is_sorted(const DataType arr[], size_t size) {
 /* 배열 복사
  * - 매개변수: dest - 목적지 배열, src - 원본 배열, size - 배열의 크기
  */
-void copy_array(DataType dest[], const DataType src[], size_t size) {
+void copy_array(SortElement dest[], const SortElement src[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         dest[i] = src[i];
     }
 }
 
-/* Wrapper 함수 - Lomuto 퀵 정렬
- * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
- */
-void quick_sort_lomuto_wrapper(DataType arr[], size_t size) {
-    if (size > 0) {
-        quick_sort_lomuto(arr, 0, size - 1);
-    }
-}
-
-/* Wrapper 함수 - Hoare 퀵 정렬
- * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
- */
-void quick_sort_hoare_wrapper(DataType arr[], size_t size) {
-    if (size > 0) {
-        quick_sort_hoare(arr, 0, size - 1);
-    }
-}
-
 /* 알고리즘 실행 시간 측정
  * - 매개변수: sort_func - 정렬 함수 포인터, arr - 정렬할 배열,
  *            size - 배열의 크기, name - 알고리즘 이름
  */
-void measure_time(void (*sort_func)(DataType[], size_t),
-    DataType arr[], size_t size, const char* name) {
+void measure_time(void (*sort_func)(SortElement[], size_t),
+    SortElement arr[], size_t size, const char* name) {
     clock_t start = clock();
     sort_func(arr, size);
     clock_t end = clock();
@@ -170,7 +170,7 @@ void measure_time(void (*sort_func)(DataType[], size_t),
 /* 새로운 무작위 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_random_array(DataType arr[], size_t size) {
+void generate_random_array(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = rand() % 1000;  // 0-999 범위의 무작위 값
     }
@@ -179,7 +179,7 @@ void generate_random_array(DataType arr[], size_t size) {
 /* 거의 정렬된 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_nearly_sorted_array(DataType arr[], size_t size) {
+void generate_nearly_sorted_array(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = i;
     }
@@ -194,7 +194,7 @@ void generate_nearly_sorted_array(DataType arr[], size_t size) {
 /* 많은 중복값이 있는 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_many_duplicates(DataType arr[], size_t size) {
+void generate_many_duplicates(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = rand() % 10;  // 0-9 범위의 값만 사용
     }
@@ -223,8 +223,8 @@ int main(void) {
         return 1;
     }
 
-    DataType* arr = (DataType*)malloc(size * sizeof(DataType));
-    DataType* temp_arr = (DataType*)malloc(size * sizeof(DataType));
+    SortElement* arr = (SortElement*)malloc(size * sizeof(SortElement));
+    SortElement* temp_arr = (SortElement*)malloc(size * sizeof(SortElement));
     if (arr == NULL || temp_arr == NULL) {
         printf("Memory allocation failed\n");
         free(arr);
@@ -320,6 +320,7 @@ int main(void) {
     free(temp_arr);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
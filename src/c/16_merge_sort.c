@@ -2,14 +2,13 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <time.h>
-
-typedef int DataType;
+#include "sort.h"
 
 /* 병합 함수 (기본 버전)
  * - 매개변수: arr - 원본 배열, left, mid, right - 병합할 구간
  *            temp - 임시 배열
  */
-void merge(DataType arr[], size_t left, size_t mid, size_t right, DataType temp[]) {
+static void merge(SortElement arr[], size_t left, size_t mid, size_t right, SortElement temp[]) {
     size_t i = left;    // 왼쪽 배열 인덱스
     size_t j = mid + 1; // 오른쪽 배열 인덱스
     size_t k = left;    // 임시 배열 인덱스
@@ -44,8 +43,8 @@ void merge(DataType arr[], size_t left, size_t mid, size_t right, DataType temp[
  * - 매개변수: arr - 원본 배열, left, mid, right - 병합할 구간
  *            temp - 임시 배열
  */
-void merge_optimized(DataType arr[], size_t left, size_t mid, size_t right,
-    DataType temp[]) {
+static void merge_optimized(SortElement arr[], size_t left, size_t mid, size_t right,
+    SortElement temp[]) {
     size_t i = left;
     size_t j = mid + 1;
     size_t k = left;
@@ -80,8 +79,8 @@ void merge_optimized(DataType arr[], size_t left, size_t mid, size_t right,
  * - 매개변수: arr - 정렬할 배열, left, right - 정렬할 구간
  *            temp - 임시 배열
  */
-void merge_sort_recursive(DataType arr[], size_t left, size_t right,
-    DataType temp[]) {
+void merge_sort_recursive(SortElement arr[], size_t left, size_t right,
+    SortElement temp[]) {
     if (left < right) {
         size_t mid = (left + right) / 2;
         merge_sort_recursive(arr, left, mid, temp);
@@ -94,19 +93,20 @@ void merge_sort_recursive(DataType arr[], size_t left, size_t right,
  * - 매개변수: arr - 정렬할 배열, left, right - 정렬할 구간
  *            temp - 임시 배열
  */
-void merge_sort_optimized_recursive(DataType arr[], size_t left, size_t right,
-    DataType temp[]) {
+void merge_sort_optimized_recursive(SortElement arr[], size_t left, size_t right,
+    SortElement temp[]) {
     // 작은 배열은 삽입 정렬 사용
     if (right - left <= 10) {
         // 삽입 정렬 구현
         for (size_t i = left + 1; i <= right; i++) {
-            DataType key = arr[i];
-            size_t j = i - 1;
-            while (j >= left && arr[j] > key) {
-                arr[j + 1] = arr[j];
+            SortElement key = arr[i];
+            size_t j = i;
+            // size_t는 음수가 될 수 없으므로 j > left 조건으로 경계를 검사
+            while (j > left && arr[j - 1] > key) {
+                arr[j] = arr[j - 1];
                 j--;
             }
-            arr[j + 1] = key;
+            arr[j] = key;
         }
         return;
     }
@@ -123,7 +123,7 @@ void merge_sort_optimized_recursive(DataType arr[], size_t left, size_t right,
  * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
  *            temp - 임시 배열
  */
-void merge_sort_iterative(DataType arr[], size_t size, DataType temp[]) {
+void merge_sort_iterative(SortElement arr[], size_t size, SortElement temp[]) {
     for (size_t width = 1; width < size; width *= 2) {
         for (size_t left = 0; left < size; left += 2 * width) {
             size_t mid = (left + width < size) ? left + width - 1 : size - 1;
@@ -136,8 +136,8 @@ void merge_sort_iterative(DataType arr[], size_t size, DataType temp[]) {
 /* Wrapper 함수 - 기본 병합 정렬
  * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
  */
-void merge_sort_basic(DataType arr[], size_t size) {
-    DataType* temp = (DataType*)malloc(size * sizeof(DataType));
+void merge_sort_basic(SortElement arr[], size_t size) {
+    SortElement* temp = (SortElement*)malloc(size * sizeof(SortElement));
     if (temp == NULL) {
         printf("Memory allocation failed\n");
         return;
@@ -149,8 +149,8 @@ void merge_sort_basic(DataType arr[], size_t size) {
 /* Wrapper 함수 - 최적화된 병합 정렬
  * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
  */
-void merge_sort_optimized(DataType arr[], size_t size) {
-    DataType* temp = (DataType*)malloc(size * sizeof(DataType));
+void merge_sort_optimized(SortElement arr[], size_t size) {
+    SortElement* temp = (SortElement*)malloc(size * sizeof(SortElement));
     if (temp == NULL) {
         printf("Memory allocation failed\n");
         return;
@@ -162,8 +162,8 @@ void merge_sort_optimized(DataType arr[], size_t size) {
 /* Wrapper 함수 - 반복적 병합 정렬
  * - 매개변수: arr - 정렬할 배열, size - 배열의 크기
  */
-void merge_sort_iterative_wrapper(DataType arr[], size_t size) {
-    DataType* temp = (DataType*)malloc(size * sizeof(DataType));
+void merge_sort_iterative_wrapper(SortElement arr[], size_t size) {
+    SortElement* temp = (SortElement*)malloc(size * sizeof(SortElement));
     if (temp == NULL) {
         printf("Memory allocation failed\n");
         return;
@@ -172,10 +172,11 @@ void merge_sort_iterative_wrapper(DataType arr[], size_t size) {
     free(temp);
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 배열 출력
  * - 매개변수: arr - 출력할 배열, size - 배열의 크기
  */
-void print_array(const DataType arr[], size_t size) {
+void print_array(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         printf("%d ", arr[i]);
     }
@@ -186,7 +187,7 @@ void print_array(const DataType arr[], size_t size) {
  * - 매개변수: arr - 검증할 배열, size - 배열의 크기
  * - 반환값: 정렬되었으면 true, 아니면 false
  */
-bool is_sorted(const DataType arr[], size_t size) {
+bool is_sorted(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size - 1; i++) {
         if (arr[i] > arr[i + 1]) {
             return false;
@@ -198,7 +199,7 @@ bool is_sorted(const DataType arr[], size_t size) {
 /* 배열 복사
  * - 매개변수: dest - 목적지 배열, src - 원본 배열, size - 배열의 크기
  */
-void copy_array(DataType dest[], const DataType src[], size_t size) {
+void copy_array(SortElement dest[], const SortElement src[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         dest[i] = src[i];
     }
@@ -208,8 +209,8 @@ void copy_array(DataType dest[], const DataType src[], size_t size) {
  * - 매개변수: sort_func - 정렬 함수 포인터, arr - 정렬할 배열,
  *            size - 배열의 크기, name - 알고리즘 이름
  */
-void measure_time(void (*sort_func)(DataType[], size_t),
-    DataType arr[], size_t size, const char* name) {
+void measure_time(void (*sort_func)(SortElement[], size_t),
+    SortElement arr[], size_t size, const char* name) {
     clock_t start = clock();
     sort_func(arr, size);
     clock_t end = clock();
@@ -221,7 +222,7 @@ void measure_time(void (*sort_func)(DataType[], size_t),
 /* 새로운 무작위 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_random_array(DataType arr[], size_t size) {
+void generate_random_array(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = rand() % 1000;  // 0-999 범위의 무작위 값
     }
@@ -230,7 +231,7 @@ void generate_random_array(DataType arr[], size_t size) {
 /* 거의 정렬된 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_nearly_sorted_array(DataType arr[], size_t size) {
+void generate_nearly_sorted_array(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = i;
     }
@@ -238,7 +239,7 @@ void generate_nearly_sorted_array(DataType arr[], size_t size) {
     for (size_t i = 0; i < size / 20; i++) {
         size_t idx1 = rand() % size;
         size_t idx2 = rand() % size;
-        DataType temp = arr[idx1];
+        SortElement temp = arr[idx1];
         arr[idx1] = arr[idx2];
         arr[idx2] = temp;
     }
@@ -267,8 +268,8 @@ int main(void) {
         return 1;
     }
 
-    DataType* arr = (DataType*)malloc(size * sizeof(DataType));
-    DataType* temp_arr = (DataType*)malloc(size * sizeof(DataType));
+    SortElement* arr = (SortElement*)malloc(size * sizeof(SortElement));
+    SortElement* temp_arr = (SortElement*)malloc(size * sizeof(SortElement));
     if (arr == NULL || temp_arr == NULL) {
         printf("Memory allocation failed\n");
         free(arr);
@@ -376,6 +377,7 @@ int main(void) {
     free(temp_arr);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
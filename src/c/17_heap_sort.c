@@ -2,14 +2,13 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <time.h>
-
-typedef int DataType;
+#include "sort.h"
 
 /* 두 원소의 교환
  * - 매개변수: a, b - 교환할 두 원소의 포인터
  */
-void swap(DataType* a, DataType* b) {
-    DataType temp = *a;
+static void swap(SortElement* a, SortElement* b) {
+    SortElement temp = *a;
     *a = *b;
     *b = temp;
 }
@@ -17,7 +16,7 @@ void swap(DataType* a, DataType* b) {
 /* 최대 힙 속성 유지 (재귀 버전)
  * - 매개변수: arr - 힙 배열, size - 힙 크기, index - 현재 노드
  */
-void heapify_recursive(DataType arr[], size_t size, size_t index) {
+void heapify_recursive(SortElement arr[], size_t size, size_t index) {
     size_t largest = index;       // 최대값 위치
     size_t left = 2 * index + 1;  // 왼쪽 자식
     size_t right = 2 * index + 2; // 오른쪽 자식
@@ -42,7 +41,7 @@ void heapify_recursive(DataType arr[], size_t size, size_t index) {
 /* 최대 힙 속성 유지 (반복 버전)
  * - 매개변수: arr - 힙 배열, size - 힙 크기, index - 현재 노드
  */
-void heapify_iterative(DataType arr[], size_t size, size_t index) {
+void heapify_iterative(SortElement arr[], size_t size, size_t index) {
     size_t current = index;
 
     while (true) {
@@ -70,8 +69,8 @@ void heapify_iterative(DataType arr[], size_t size, size_t index) {
  * - 매개변수: arr - 배열, size - 배열 크기
  * - 설명: 마지막 비단말 노드부터 역순으로 heapify
  */
-void build_heap_bottom_up(DataType arr[], size_t size,
-    void (*heapify)(DataType[], size_t, size_t)) {
+void build_heap_bottom_up(SortElement arr[], size_t size,
+    void (*heapify)(SortElement[], size_t, size_t)) {
     // 마지막 비단말 노드부터 역순으로 heapify 수행
     for (int i = (size / 2) - 1; i >= 0; i--) {
         heapify(arr, size, i);
@@ -81,7 +80,7 @@ void build_heap_bottom_up(DataType arr[], size_t size,
 /* 기본 힙 정렬
  * - 매개변수: arr - 정렬할 배열, size - 배열 크기
  */
-void heap_sort_basic(DataType arr[], size_t size) {
+void heap_sort_basic(SortElement arr[], size_t size) {
     // 최대 힙 생성
     build_heap_bottom_up(arr, size, heapify_recursive);
 
@@ -95,7 +94,7 @@ void heap_sort_basic(DataType arr[], size_t size) {
 /* 최적화된 힙 정렬 (반복적 heapify 사용)
  * - 매개변수: arr - 정렬할 배열, size - 배열 크기
  */
-void heap_sort_optimized(DataType arr[], size_t size) {
+void heap_sort_optimized(SortElement arr[], size_t size) {
     build_heap_bottom_up(arr, size, heapify_iterative);
 
     for (size_t i = size - 1; i > 0; i--) {
@@ -104,10 +103,11 @@ void heap_sort_optimized(DataType arr[], size_t size) {
     }
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 배열 출력
  * - 매개변수: arr - 출력할 배열, size - 배열의 크기
  */
-void print_array(const DataType arr[], size_t size) {
+void print_array(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         printf("%d ", arr[i]);
     }
@@ -118,7 +118,7 @@ void print_array(const DataType arr[], size_t size) {
  * - 매개변수: arr - 힙 배열, size - 힙 크기, index - 현재 노드
  *            level - 현재 레벨, prefix - 출력 접두사
  */
-void print_heap_recursive(const DataType arr[], size_t size, size_t index,
+void print_heap_recursive(const SortElement arr[], size_t size, size_t index,
     int level, char* prefix) {
     if (index >= size) {
         return;
@@ -138,7 +138,7 @@ void print_heap_recursive(const DataType arr[], size_t size, size_t index,
 /* 힙 구조 출력
  * - 매개변수: arr - 힙 배열, size - 힙 크기
  */
-void print_heap(const DataType arr[], size_t size) {
+void print_heap(const SortElement arr[], size_t size) {
     printf("Heap Structure:\n");
     print_heap_recursive(arr, size, 0, 0, "");
 }
@@ -147,7 +147,7 @@ void print_heap(const DataType arr[], size_t size) {
  * - 매개변수: arr - 검증할 배열, size - 배열의 크기
  * - 반환값: 정렬되었으면 true, 아니면 false
  */
-bool is_sorted(const DataType arr[], size_t size) {
+bool is_sorted(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size - 1; i++) {
         if (arr[i] > arr[i + 1]) {
             return false;
@@ -160,7 +160,7 @@ bool is_sorted(const DataType arr[], size_t size) {
  * - 매개변수: arr - 검증할 배열, size - 배열의 크기
  * - 반환값: 힙 속성을 만족하면 true, 아니면 false
  */
-bool is_heap(const DataType arr[], size_t size) {
+bool is_heap(const SortElement arr[], size_t size) {
     for (size_t i = 0; i < size / 2; i++) {
         size_t left = 2 * i + 1;
         size_t right = 2 * i + 2;
@@ -178,7 +178,7 @@ bool is_heap(const DataType arr[], size_t size) {
 /* 배열 복사
  * - 매개변수: dest - 목적지 배열, src - 원본 배열, size - 배열의 크기
  */
-void copy_array(DataType dest[], const DataType src[], size_t size) {
+void copy_array(SortElement dest[], const SortElement src[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         dest[i] = src[i];
     }
@@ -188,8 +188,8 @@ void copy_array(DataType dest[], const DataType src[], size_t size) {
  * - 매개변수: sort_func - 정렬 함수 포인터, arr - 정렬할 배열,
  *            size - 배열의 크기, name - 알고리즘 이름
  */
-void measure_time(void (*sort_func)(DataType[], size_t),
-    DataType arr[], size_t size, const char* name) {
+void measure_time(void (*sort_func)(SortElement[], size_t),
+    SortElement arr[], size_t size, const char* name) {
     clock_t start = clock();
     sort_func(arr, size);
     clock_t end = clock();
@@ -201,7 +201,7 @@ void measure_time(void (*sort_func)(DataType[], size_t),
 /* 새로운 무작위 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_random_array(DataType arr[], size_t size) {
+void generate_random_array(SortElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = rand() % 1000;  // 0-999 범위의 무작위 값
     }
@@ -230,8 +230,8 @@ int main(void) {
         return 1;
     }
 
-    DataType* arr = (DataType*)malloc(size * sizeof(DataType));
-    DataType* temp_arr = (DataType*)malloc(size * sizeof(DataType));
+    SortElement* arr = (SortElement*)malloc(size * sizeof(SortElement));
+    SortElement* temp_arr = (SortElement*)malloc(size * sizeof(SortElement));
     if (arr == NULL || temp_arr == NULL) {
         printf("Memory allocation failed\n");
         free(arr);
@@ -326,6 +326,7 @@ int main(void) {
     free(temp_arr);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
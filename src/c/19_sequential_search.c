@@ -2,8 +2,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <time.h>
-
-typedef int DataType;
+#include "sequential_search.h"
 
 /*
 전진이동법(Move-to-Front):
@@ -11,12 +10,12 @@ typedef int DataType;
 - 자주 검색되는 요소의 접근 속도를 향상
 - 시간적 지역성(temporal locality) 활용
 */
-int sequential_search_mtf(DataType arr[], size_t size, DataType key) {
+int sequential_search_mtf(SearchElement arr[], size_t size, SearchElement key) {
     for (size_t i = 0; i < size; i++) {
         if (arr[i] == key) {
             // 찾은 요소를 맨 앞으로 이동
             if (i > 0) {
-                DataType temp = arr[i];
+                SearchElement temp = arr[i];
                 for (size_t j = i; j > 0; j--) {
                     arr[j] = arr[j - 1];
                 }
@@ -34,8 +33,8 @@ int sequential_search_mtf(DataType arr[], size_t size, DataType key) {
 - 반복문의 조건 검사 횟수 감소
 - 성능 약간 향상
 */
-int sequential_search_sentinel(DataType arr[], size_t size, DataType key) {
-    DataType last = arr[size - 1];  // 마지막 요소 저장
+int sequential_search_sentinel(SearchElement arr[], size_t size, SearchElement key) {
+    SearchElement last = arr[size - 1];  // 마지막 요소 저장
     arr[size - 1] = key;  // 보초 설정
 
     size_t i = 0;
@@ -53,7 +52,7 @@ int sequential_search_sentinel(DataType arr[], size_t size, DataType key) {
 /* 기본 순차 탐색
  * - 배열의 처음부터 끝까지 순차적으로 검색
  */
-int sequential_search_basic(const DataType arr[], size_t size, DataType key) {
+int sequential_search_basic(const SearchElement arr[], size_t size, SearchElement key) {
     for (size_t i = 0; i < size; i++) {
         if (arr[i] == key) {
             return i;
@@ -62,10 +61,11 @@ int sequential_search_basic(const DataType arr[], size_t size, DataType key) {
     return -1;
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 배열 출력
  * - 매개변수: arr - 출력할 배열, size - 배열의 크기
  */
-void print_array(const DataType arr[], size_t size) {
+void print_array(const SearchElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         printf("%d ", arr[i]);
     }
@@ -75,7 +75,7 @@ void print_array(const DataType arr[], size_t size) {
 /* 배열 복사
  * - 매개변수: dest - 목적지 배열, src - 원본 배열, size - 배열의 크기
  */
-void copy_array(DataType dest[], const DataType src[], size_t size) {
+void copy_array(SearchElement dest[], const SearchElement src[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         dest[i] = src[i];
     }
@@ -85,8 +85,8 @@ void copy_array(DataType dest[], const DataType src[], size_t size) {
  * - 매개변수: search_func - 검색 함수 포인터, arr - 검색할 배열,
  *            size - 배열의 크기, key - 찾을 값, name - 알고리즘 이름
  */
-void measure_time(int (*search_func)(DataType[], size_t, DataType),
-    DataType arr[], size_t size, DataType key,
+void measure_time(int (*search_func)(SearchElement[], size_t, SearchElement),
+    SearchElement arr[], size_t size, SearchElement key,
     const char* name) {
     clock_t start = clock();
     int index = search_func(arr, size, key);
@@ -105,7 +105,7 @@ void measure_time(int (*search_func)(DataType[], size_t, DataType),
 /* 무작위 배열 생성
  * - 매개변수: arr - 생성할 배열, size - 배열의 크기
  */
-void generate_random_array(DataType arr[], size_t size) {
+void generate_random_array(SearchElement arr[], size_t size) {
     for (size_t i = 0; i < size; i++) {
         arr[i] = rand() % 1000;  // 0-999 범위의 무작위 값
     }
@@ -133,8 +133,8 @@ int main(void) {
         return 1;
     }
 
-    DataType* arr = (DataType*)malloc(size * sizeof(DataType));
-    DataType* temp_arr = (DataType*)malloc(size * sizeof(DataType));
+    SearchElement* arr = (SearchElement*)malloc(size * sizeof(SearchElement));
+    SearchElement* temp_arr = (SearchElement*)malloc(size * sizeof(SearchElement));
     if (arr == NULL || temp_arr == NULL) {
         printf("Memory allocation failed\n");
         free(arr);
@@ -230,6 +230,7 @@ int main(void) {
     free(temp_arr);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
-#include <time.h>
+#include "priority_queue.h"
 
 /*
 배열 기반 단순 우선순위 큐:
@@ -11,39 +11,31 @@
 - 구현이 단순하지만 비효율적
 */
 
-typedef int ElementType;
-#define MAX_QUEUE_SIZE 100
-
-typedef struct {
-    ElementType elements[MAX_QUEUE_SIZE];
-    int size;
-} PriorityQueue;
-
 /* 우선순위 큐 초기화 */
-void queue_init(PriorityQueue* queue) {
+void pqueue_init(PriorityQueue* queue) {
     queue->size = 0;
 }
 
 /* 큐가 비어있는지 확인 */
-bool queue_is_empty(const PriorityQueue* queue) {
+bool pqueue_is_empty(const PriorityQueue* queue) {
     return queue->size == 0;
 }
 
 /* 큐가 가득 찼는지 확인 */
-bool queue_is_full(const PriorityQueue* queue) {
+bool pqueue_is_full(const PriorityQueue* queue) {
     return queue->size == MAX_QUEUE_SIZE;
 }
 
 /* 큐의 크기 반환 */
-int queue_size(const PriorityQueue* queue) {
+int pqueue_size(const PriorityQueue* queue) {
     return queue->size;
 }
 
 /* 최대 우선순위 원소 삽입 (큰 값이 높은 우선순위)
  * - 시간복잡도: O(1)
  */
-bool queue_insert_max(PriorityQueue* queue, ElementType value) {
-    if (queue_is_full(queue)) {
+bool pqueue_insert_max(PriorityQueue* queue, PriorityQueueElement value) {
+    if (pqueue_is_full(queue)) {
         return false;
     }
     queue->elements[queue->size++] = value;
@@ -53,8 +45,8 @@ bool queue_insert_max(PriorityQueue* queue, ElementType value) {
 /* 최소 우선순위 원소 삽입 (작은 값이 높은 우선순위)
  * - 시간복잡도: O(1)
  */
-bool queue_insert_min(PriorityQueue* queue, ElementType value) {
-    if (queue_is_full(queue)) {
+bool pqueue_insert_min(PriorityQueue* queue, PriorityQueueElement value) {
+    if (pqueue_is_full(queue)) {
         return false;
     }
     queue->elements[queue->size++] = value;
@@ -64,8 +56,8 @@ bool queue_insert_min(PriorityQueue* queue, ElementType value) {
 /* 최대 우선순위 원소 삭제 (큰 값이 높은 우선순위)
  * - 시간복잡도: O(n)
  */
-bool queue_remove_max(PriorityQueue* queue, ElementType* value) {
-    if (queue_is_empty(queue)) {
+bool pqueue_remove_max(PriorityQueue* queue, PriorityQueueElement* value) {
+    if (pqueue_is_empty(queue)) {
         return false;
     }
 
@@ -90,8 +82,8 @@ bool queue_remove_max(PriorityQueue* queue, ElementType* value) {
 /* 최소 우선순위 원소 삭제 (작은 값이 높은 우선순위)
  * - 시간복잡도: O(n)
  */
-bool queue_remove_min(PriorityQueue* queue, ElementType* value) {
-    if (queue_is_empty(queue)) {
+bool pqueue_remove_min(PriorityQueue* queue, PriorityQueueElement* value) {
+    if (pqueue_is_empty(queue)) {
         return false;
     }
 
@@ -114,7 +106,7 @@ bool queue_remove_min(PriorityQueue* queue, ElementType* value) {
 }
 
 /* 큐의 모든 원소 출력 */
-void queue_print(const PriorityQueue* queue, const char* name) {
+void pqueue_print(const PriorityQueue* queue, const char* name) {
     printf("%s (size=%d): ", name, queue->size);
     for (int i = 0; i < queue->size; i++) {
         printf("%d ", queue->elements[i]);
@@ -122,35 +114,7 @@ void queue_print(const PriorityQueue* queue, const char* name) {
     printf("\n");
 }
 
-/* 성능 측정을 위한 연산 수행 함수 */
-void measure_operations(PriorityQueue* queue, int count) {
-    clock_t start, end;
-    double insert_time, remove_time;
-
-    // 삽입 연산 측정
-    start = clock();
-    for (int i = 0; i < count; i++) {
-        queue_insert_max(queue, rand() % 1000);
-    }
-    end = clock();
-    insert_time = ((double)(end - start)) / CLOCKS_PER_SEC;
-
-    // 삭제 연산 측정
-    ElementType value;
-    start = clock();
-    for (int i = 0; i < count; i++) {
-        queue_remove_max(queue, &value);
-    }
-    end = clock();
-    remove_time = ((double)(end - start)) / CLOCKS_PER_SEC;
-
-    printf("\nPerformance Analysis (%d operations):\n", count);
-    printf("Insert time: %.6f seconds\n", insert_time);
-    printf("Remove time: %.6f seconds\n", remove_time);
-    printf("Average insert time: %.9f seconds\n", insert_time / count);
-    printf("Average remove time: %.9f seconds\n", remove_time / count);
-}
-
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 */
 void print_menu(void) {
     printf("\n=== Priority Queue Menu ===\n");
@@ -159,17 +123,16 @@ void print_menu(void) {
     printf("3. Remove (max priority)\n");
     printf("4. Remove (min priority)\n");
     printf("5. Print queue\n");
-    printf("6. Run performance test\n");
     printf("0. Exit\n");
     printf("Choice: ");
 }
 
 int main(void) {
     PriorityQueue queue;
-    queue_init(&queue);
+    pqueue_init(&queue);
 
     int choice;
-    ElementType value;
+    PriorityQueueElement value;
 
     do {
         print_menu();
@@ -183,61 +146,49 @@ int main(void) {
         case 1:  // Insert (max)
             printf("Enter value to insert: ");
             scanf("%d", &value);
-            if (queue_insert_max(&queue, value)) {
+            if (pqueue_insert_max(&queue, value)) {
                 printf("Inserted %d\n", value);
             }
             else {
                 printf("Queue is full\n");
             }
-            queue_print(&queue, "Queue after insert");
+            pqueue_print(&queue, "Queue after insert");
             break;
 
         case 2:  // Insert (min)
             printf("Enter value to insert: ");
             scanf("%d", &value);
-            if (queue_insert_min(&queue, value)) {
+            if (pqueue_insert_min(&queue, value)) {
                 printf("Inserted %d\n", value);
             }
             else {
                 printf("Queue is full\n");
             }
-            queue_print(&queue, "Queue after insert");
+            pqueue_print(&queue, "Queue after insert");
             break;
 
         case 3:  // Remove (max)
-            if (queue_remove_max(&queue, &value)) {
+            if (pqueue_remove_max(&queue, &value)) {
                 printf("Removed maximum value: %d\n", value);
             }
             else {
                 printf("Queue is empty\n");
             }
-            queue_print(&queue, "Queue after remove");
+            pqueue_print(&queue, "Queue after remove");
             break;
 
         case 4:  // Remove (min)
-            if (queue_remove_min(&queue, &value)) {
+            if (pqueue_remove_min(&queue, &value)) {
                 printf("Removed minimum value: %d\n", value);
             }
             else {
                 printf("Queue is empty\n");
             }
-            queue_print(&queue, "Queue after remove");
+            pqueue_print(&queue, "Queue after remove");
             break;
 
         case 5:  // Print
-            queue_print(&queue, "Current queue");
-            break;
-
-        case 6:  // Performance test
-            printf("Enter number of operations: ");
-            int count;
-            scanf("%d", &count);
-            if (count > MAX_QUEUE_SIZE) {
-                count = MAX_QUEUE_SIZE;
-                printf("Limiting to %d operations\n", count);
-            }
-            queue_init(&queue);  // Reset queue
-            measure_operations(&queue, count);
+            pqueue_print(&queue, "Current queue");
             break;
 
         case 0:  // Exit
@@ -251,6 +202,7 @@ int main(void) {
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -307,7 +259,7 @@ int main(void) {
 6. 구현 특징
 ----------
 - 두 가지 우선순위
-- 성능 측정
+- 성능 측정은 별도 벤치마크로 분리
 - 시각적 출력
 - 에러 처리
 
@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
-#include <time.h>
+#include "priority_queue.h"
 
 /*
 최대 힙:
@@ -11,14 +11,6 @@
 - 효율적인 삽입/삭제 연산
 */
 
-typedef int ElementType;
-#define MAX_HEAP_SIZE 100
-
-typedef struct {
-    ElementType elements[MAX_HEAP_SIZE];
-    int size;  // 힙의 현재 크기
-} MaxHeap;
-
 /* 부모 노드의 인덱스 계산 */
 #define PARENT(i) (((i) - 1) / 2)
 
@@ -29,48 +21,48 @@ typedef struct {
 #define RIGHT_CHILD(i) (2 * (i) + 2)
 
 /* 두 원소의 교환 */
-void swap(ElementType* a, ElementType* b) {
-    ElementType temp = *a;
+static void swap(PriorityQueueElement* a, PriorityQueueElement* b) {
+    PriorityQueueElement temp = *a;
     *a = *b;
     *b = temp;
 }
 
 /* 힙 초기화 */
-void heap_init(MaxHeap* heap) {
+void maxheap_init(MaxHeap* heap) {
     heap->size = 0;
 }
 
 /* 힙이 비어있는지 확인 */
-bool heap_is_empty(const MaxHeap* heap) {
+bool maxheap_is_empty(const MaxHeap* heap) {
     return heap->size == 0;
 }
 
 /* 힙이 가득 찼는지 확인 */
-bool heap_is_full(const MaxHeap* heap) {
+bool maxheap_is_full(const MaxHeap* heap) {
     return heap->size == MAX_HEAP_SIZE;
 }
 
 /* 힙의 크기 반환 */
-int heap_size(const MaxHeap* heap) {
+int maxheap_size(const MaxHeap* heap) {
     return heap->size;
 }
 
-/* 상향 이동 (삽입 시 사용)
+/* 상향 이동 (삽입 시 사용, 내부 함수)
  * - 새로 삽입된 원소를 적절한 위치로 이동
  * - 시간복잡도: O(log n)
  */
-void heapify_up(MaxHeap* heap, int index) {
+static void heapify_up(MaxHeap* heap, int index) {
     while (index > 0 && heap->elements[PARENT(index)] < heap->elements[index]) {
         swap(&heap->elements[PARENT(index)], &heap->elements[index]);
         index = PARENT(index);
     }
 }
 
-/* 하향 이동 (삭제 시 사용)
+/* 하향 이동 (삭제 시 사용, 내부 함수)
  * - 루트 노드부터 시작하여 적절한 위치로 이동
  * - 시간복잡도: O(log n)
  */
-void heapify_down(MaxHeap* heap, int index) {
+static void heapify_down(MaxHeap* heap, int index) {
     int largest = index;
     int left = LEFT_CHILD(index);
     int right = RIGHT_CHILD(index);
@@ -95,8 +87,8 @@ void heapify_down(MaxHeap* heap, int index) {
 /* 원소 삽입
  * - 시간복잡도: O(log n)
  */
-bool heap_insert(MaxHeap* heap, ElementType value) {
-    if (heap_is_full(heap)) {
+bool maxheap_insert(MaxHeap* heap, PriorityQueueElement value) {
+    if (maxheap_is_full(heap)) {
         return false;
     }
 
@@ -113,8 +105,8 @@ bool heap_insert(MaxHeap* heap, ElementType value) {
 /* 최대값 삭제
  * - 시간복잡도: O(log n)
  */
-bool heap_delete_max(MaxHeap* heap, ElementType* value) {
-    if (heap_is_empty(heap)) {
+bool maxheap_delete_max(MaxHeap* heap, PriorityQueueElement* value) {
+    if (maxheap_is_empty(heap)) {
         return false;
     }
 
@@ -126,7 +118,7 @@ bool heap_delete_max(MaxHeap* heap, ElementType* value) {
     heap->size--;
 
     // 루트부터 재정렬
-    if (!heap_is_empty(heap)) {
+    if (!maxheap_is_empty(heap)) {
         heapify_down(heap, 0);
     }
 
@@ -136,8 +128,8 @@ bool heap_delete_max(MaxHeap* heap, ElementType* value) {
 /* 최대값 확인 (삭제하지 않음)
  * - 시간복잡도: O(1)
  */
-bool heap_peek_max(const MaxHeap* heap, ElementType* value) {
-    if (heap_is_empty(heap)) {
+bool maxheap_peek_max(const MaxHeap* heap, PriorityQueueElement* value) {
+    if (maxheap_is_empty(heap)) {
         return false;
     }
     *value = heap->elements[0];
@@ -147,8 +139,8 @@ bool heap_peek_max(const MaxHeap* heap, ElementType* value) {
 /* 힙 시각화 (트리 형태로 출력)
  * - 레벨 순회 방식으로 출력
  */
-void heap_print(const MaxHeap* heap) {
-    if (heap_is_empty(heap)) {
+void maxheap_print(const MaxHeap* heap) {
+    if (maxheap_is_empty(heap)) {
         printf("Heap is empty\n");
         return;
     }
@@ -183,7 +175,7 @@ void heap_print(const MaxHeap* heap) {
 /* 힙 검증
  * - 최대 힙 속성이 유지되는지 확인
  */
-bool heap_verify(const MaxHeap* heap) {
+bool maxheap_verify(const MaxHeap* heap) {
     for (int i = 1; i < heap->size; i++) {
         if (heap->elements[i] > heap->elements[PARENT(i)]) {
             return false;
@@ -192,35 +184,7 @@ bool heap_verify(const MaxHeap* heap) {
     return true;
 }
 
-/* 성능 측정 */
-void measure_operations(MaxHeap* heap, int count) {
-    clock_t start, end;
-    double insert_time, delete_time;
-
-    // 삽입 연산 측정
-    start = clock();
-    for (int i = 0; i < count; i++) {
-        heap_insert(heap, rand() % 1000);
-    }
-    end = clock();
-    insert_time = ((double)(end - start)) / CLOCKS_PER_SEC;
-
-    // 삭제 연산 측정
-    ElementType value;
-    start = clock();
-    for (int i = 0; i < count; i++) {
-        heap_delete_max(heap, &value);
-    }
-    end = clock();
-    delete_time = ((double)(end - start)) / CLOCKS_PER_SEC;
-
-    printf("\nPerformance Analysis (%d operations):\n", count);
-    printf("Insert time: %.6f seconds\n", insert_time);
-    printf("Delete time: %.6f seconds\n", delete_time);
-    printf("Average insert time: %.9f seconds\n", insert_time / count);
-    printf("Average delete time: %.9f seconds\n", delete_time / count);
-}
-
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 */
 void print_menu(void) {
     printf("\n=== Max Heap Menu ===\n");
@@ -229,17 +193,16 @@ void print_menu(void) {
     printf("3. Peek maximum\n");
     printf("4. Print heap\n");
     printf("5. Verify heap\n");
-    printf("6. Run performance test\n");
     printf("0. Exit\n");
     printf("Choice: ");
 }
 
 int main(void) {
     MaxHeap heap;
-    heap_init(&heap);
+    maxheap_init(&heap);
 
     int choice;
-    ElementType value;
+    PriorityQueueElement value;
 
     do {
         print_menu();
@@ -253,9 +216,9 @@ int main(void) {
         case 1:  // Insert
             printf("Enter value to insert: ");
             scanf("%d", &value);
-            if (heap_insert(&heap, value)) {
+            if (maxheap_insert(&heap, value)) {
                 printf("Inserted %d\n", value);
-                heap_print(&heap);
+                maxheap_print(&heap);
             }
             else {
                 printf("Heap is full\n");
@@ -263,9 +226,9 @@ int main(void) {
             break;
 
         case 2:  // Delete maximum
-            if (heap_delete_max(&heap, &value)) {
+            if (maxheap_delete_max(&heap, &value)) {
                 printf("Deleted maximum value: %d\n", value);
-                heap_print(&heap);
+                maxheap_print(&heap);
             }
             else {
                 printf("Heap is empty\n");
@@ -273,7 +236,7 @@ int main(void) {
             break;
 
         case 3:  // Peek maximum
-            if (heap_peek_max(&heap, &value)) {
+            if (maxheap_peek_max(&heap, &value)) {
                 printf("Maximum value: %d\n", value);
             }
             else {
@@ -282,11 +245,11 @@ int main(void) {
             break;
 
         case 4:  // Print
-            heap_print(&heap);
+            maxheap_print(&heap);
             break;
 
         case 5:  // Verify
-            if (heap_verify(&heap)) {
+            if (maxheap_verify(&heap)) {
                 printf("Heap property is satisfied\n");
             }
             else {
@@ -294,18 +257,6 @@ int main(void) {
             }
             break;
 
-        case 6:  // Performance test
-            printf("Enter number of operations: ");
-            int count;
-            scanf("%d", &count);
-            if (count > MAX_HEAP_SIZE) {
-                count = MAX_HEAP_SIZE;
-                printf("Limiting to %d operations\n", count);
-            }
-            heap_init(&heap);  // Reset heap
-            measure_operations(&heap, count);
-            break;
-
         case 0:  // Exit
             printf("Exiting program\n");
             break;
@@ -317,6 +268,7 @@ int main(void) {
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
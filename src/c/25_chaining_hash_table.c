@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "chaining_hash_table.h"
 
 /*
 체이닝 방식 해시 테이블:
@@ -14,26 +15,10 @@
 #define INITIAL_SIZE 7  // 소수를 사용하여 더 좋은 분포
 #define MAX_LOAD_FACTOR 0.75
 
-typedef struct {
-    char* key;
-    int value;
-} KeyValuePair;
-
-typedef struct Node {
-    KeyValuePair data;
-    struct Node* next;
-} Node;
-
-typedef struct {
-    Node** buckets;       // 버킷 배열
-    size_t size;         // 현재 저장된 원소 수
-    size_t capacity;     // 해시 테이블 크기
-} HashTable;
-
 /* 문자열 해시 함수 (djb2)
  * - 실제 프로젝트에서 많이 사용되는 해시 함수
  */
-unsigned long hash_function(const char* str) {
+unsigned long chash_function(const char* str) {
     unsigned long hash = 5381;
     int c;
 
@@ -45,11 +30,11 @@ unsigned long hash_function(const char* str) {
 }
 
 /* 해시 테이블 생성 */
-HashTable* hash_table_create(size_t initial_capacity) {
-    HashTable* table = (HashTable*)malloc(sizeof(HashTable));
+ChainedHashTable* chash_create(size_t initial_capacity) {
+    ChainedHashTable* table = (ChainedHashTable*)malloc(sizeof(ChainedHashTable));
     if (!table) return NULL;
 
-    table->buckets = (Node**)calloc(initial_capacity, sizeof(Node*));
+    table->buckets = (ChainedHashNode**)calloc(initial_capacity, sizeof(ChainedHashNode*));
     if (!table->buckets) {
         free(table);
         return NULL;
@@ -61,8 +46,8 @@ HashTable* hash_table_create(size_t initial_capacity) {
 }
 
 /* 노드 생성 */
-Node* create_node(const char* key, int value) {
-    Node* node = (Node*)malloc(sizeof(Node));
+static ChainedHashNode* create_node(const char* key, int value) {
+    ChainedHashNode* node = (ChainedHashNode*)malloc(sizeof(ChainedHashNode));
     if (!node) return NULL;
 
     node->data.key = strdup(key);
@@ -77,32 +62,32 @@ Node* create_node(const char* key, int value) {
 }
 
 /* 노드 삭제 */
-void free_node(Node* node) {
+static void free_node(ChainedHashNode* node) {
     free(node->data.key);
     free(node);
 }
 
 /* 현재 로드 팩터 계산 */
-double get_load_factor(const HashTable* table) {
+double chash_load_factor(const ChainedHashTable* table) {
     return (double)table->size / table->capacity;
 }
 
 /* 해시 테이블 재해싱
  * - 테이블 크기를 두 배로 늘리고 모든 원소 재삽입
  */
-bool hash_table_resize(HashTable* table) {
+static bool hash_table_resize(ChainedHashTable* table) {
     size_t new_capacity = table->capacity * 2;
-    Node** new_buckets = (Node**)calloc(new_capacity, sizeof(Node*));
+    ChainedHashNode** new_buckets = (ChainedHashNode**)calloc(new_capacity, sizeof(ChainedHashNode*));
     if (!new_buckets) return false;
 
     // 모든 원소를 새 버킷으로 재배치
     for (size_t i = 0; i < table->capacity; i++) {
-        Node* current = table->buckets[i];
+        ChainedHashNode* current = table->buckets[i];
         while (current) {
-            Node* next = current->next;
+            ChainedHashNode* next = current->next;
 
             // 새 위치 계산
-            unsigned long hash = hash_function(current->data.key);
+            unsigned long hash = chash_function(current->data.key);
             size_t new_index = hash % new_capacity;
 
             // 새 버킷의 앞에 삽입
@@ -126,19 +111,19 @@ bool hash_table_resize(HashTable* table) {
 /* 삽입 연산
  * - 시간복잡도: 평균 O(1), 최악 O(n)
  */
-bool hash_table_insert(HashTable* table, const char* key, int value) {
+bool chash_insert(ChainedHashTable* table, const char* key, int value) {
     // 로드 팩터 검사
-    if (get_load_factor(table) >= MAX_LOAD_FACTOR) {
+    if (chash_load_factor(table) >= MAX_LOAD_FACTOR) {
         if (!hash_table_resize(table)) {
             return false;
         }
     }
 
-    unsigned long hash = hash_function(key);
+    unsigned long hash = chash_function(key);
     size_t index = hash % table->capacity;
 
     // 키가 이미 존재하는지 검사
-    Node* current = table->buckets[index];
+    ChainedHashNode* current = table->buckets[index];
     while (current) {
         if (strcmp(current->data.key, key) == 0) {
             current->data.value = value;  // 값 갱신
@@ -148,7 +133,7 @@ bool hash_table_insert(HashTable* table, const char* key, int value) {
     }
 
     // 새 노드 생성
-    Node* new_node = create_node(key, value);
+    ChainedHashNode* new_node = create_node(key, value);
     if (!new_node) return false;
 
     // 버킷의 앞에 삽입
@@ -162,11 +147,11 @@ bool hash_table_insert(HashTable* table, const char* key, int value) {
 /* 검색 연산
  * - 시간복잡도: 평균 O(1), 최악 O(n)
  */
-bool hash_table_get(const HashTable* table, const char* key, int* value) {
-    unsigned long hash = hash_function(key);
+bool chash_get(const ChainedHashTable* table, const char* key, int* value) {
+    unsigned long hash = chash_function(key);
     size_t index = hash % table->capacity;
 
-    Node* current = table->buckets[index];
+    ChainedHashNode* current = table->buckets[index];
     while (current) {
         if (strcmp(current->data.key, key) == 0) {
             *value = current->data.value;
@@ -181,12 +166,12 @@ bool hash_table_get(const HashTable* table, const char* key, int* value) {
 /* 삭제 연산
  * - 시간복잡도: 평균 O(1), 최악 O(n)
  */
-bool hash_table_remove(HashTable* table, const char* key) {
-    unsigned long hash = hash_function(key);
+bool chash_remove(ChainedHashTable* table, const char* key) {
+    unsigned long hash = chash_function(key);
     size_t index = hash % table->capacity;
 
-    Node* current = table->buckets[index];
-    Node* prev = NULL;
+    ChainedHashNode* current = table->buckets[index];
+    ChainedHashNode* prev = NULL;
 
     while (current) {
         if (strcmp(current->data.key, key) == 0) {
@@ -209,13 +194,13 @@ bool hash_table_remove(HashTable* table, const char* key) {
 }
 
 /* 해시 테이블 메모리 해제 */
-void hash_table_destroy(HashTable* table) {
+void chash_destroy(ChainedHashTable* table) {
     if (!table) return;
 
     for (size_t i = 0; i < table->capacity; i++) {
-        Node* current = table->buckets[i];
+        ChainedHashNode* current = table->buckets[i];
         while (current) {
-            Node* next = current->next;
+            ChainedHashNode* next = current->next;
             free_node(current);
             current = next;
         }
@@ -226,15 +211,15 @@ void hash_table_destroy(HashTable* table) {
 }
 
 /* 해시 테이블 상태 출력 */
-void hash_table_print(const HashTable* table) {
+void chash_print(const ChainedHashTable* table) {
     printf("\nHash Table Status:\n");
     printf("Size: %zu\n", table->size);
     printf("Capacity: %zu\n", table->capacity);
-    printf("Load factor: %.2f\n", get_load_factor(table));
+    printf("Load factor: %.2f\n", chash_load_factor(table));
 
     for (size_t i = 0; i < table->capacity; i++) {
         printf("\nBucket %zu: ", i);
-        Node* current = table->buckets[i];
+        ChainedHashNode* current = table->buckets[i];
 
         if (!current) {
             printf("Empty");
@@ -251,7 +236,7 @@ void hash_table_print(const HashTable* table) {
 }
 
 /* 충돌 통계 출력 */
-void print_collision_stats(const HashTable* table) {
+void chash_print_collision_stats(const ChainedHashTable* table) {
     size_t empty_buckets = 0;
     size_t max_chain = 0;
     size_t total_chain = 0;
@@ -259,7 +244,7 @@ void print_collision_stats(const HashTable* table) {
 
     for (size_t i = 0; i < table->capacity; i++) {
         size_t chain_length = 0;
-        Node* current = table->buckets[i];
+        ChainedHashNode* current = table->buckets[i];
 
         if (!current) {
             empty_buckets++;
@@ -284,6 +269,7 @@ void print_collision_stats(const HashTable* table) {
         (float)total_chain / (table->capacity - empty_buckets));
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 */
 void print_menu(void) {
     printf("\n=== Hash Table Menu ===\n");
@@ -297,7 +283,7 @@ void print_menu(void) {
 }
 
 int main(void) {
-    HashTable* table = hash_table_create(INITIAL_SIZE);
+    ChainedHashTable* table = chash_create(INITIAL_SIZE);
     if (!table) {
         printf("Failed to create hash table\n");
         return 1;
@@ -328,7 +314,7 @@ int main(void) {
                 continue;
             }
 
-            if (hash_table_insert(table, key, value)) {
+            if (chash_insert(table, key, value)) {
                 printf("Successfully inserted (%s: %d)\n", key, value);
             }
             else {
@@ -341,7 +327,7 @@ int main(void) {
             if (!fgets(key, sizeof(key), stdin)) continue;
             key[strcspn(key, "\n")] = 0;
 
-            if (hash_table_get(table, key, &value)) {
+            if (chash_get(table, key, &value)) {
                 printf("Value for key '%s': %d\n", key, value);
             }
             else {
@@ -354,7 +340,7 @@ int main(void) {
             if (!fgets(key, sizeof(key), stdin)) continue;
             key[strcspn(key, "\n")] = 0;
 
-            if (hash_table_remove(table, key)) {
+            if (chash_remove(table, key)) {
                 printf("Successfully removed key '%s'\n", key);
             }
             else {
@@ -363,11 +349,11 @@ int main(void) {
             break;
 
         case 4:  // Print
-            hash_table_print(table);
+            chash_print(table);
             break;
 
         case 5:  // Statistics
-            print_collision_stats(table);
+            chash_print_collision_stats(table);
             break;
 
         case 0:  // Exit
@@ -379,9 +365,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    hash_table_destroy(table);
+    chash_destroy(table);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "open_addressing_hash_table.h"
 
 /**
  * 개방 주소법 해시 테이블 구현
@@ -14,45 +15,16 @@
 #define MAX_LOAD_FACTOR 0.75     // 최대 적재율
 #define DELETED_NODE (void*)(~0) // 삭제된 노드 표시값
 
-// 탐사 방식 열거형
-typedef enum {
-    PROBE_LINEAR,      // 선형 조사법: 다음 버킷으로 순차적 이동
-    PROBE_QUADRATIC,   // 이차 조사법: 제곱수만큼 이동
-    PROBE_DOUBLE_HASH  // 이중 해싱: 두 번째 해시 함수 사용
-} ProbeType;
-
-// 키-값 쌍을 저장하는 구조체
-typedef struct {
-    char* key;   // 키 (NULL: 빈 버킷, DELETED_NODE: 삭제된 버킷)
-    int value;   // 값
-} Entry;
-
-// 해시 테이블 구조체
-typedef struct {
-    Entry* entries;    // 엔트리 배열
-    size_t capacity;   // 테이블 크기
-    size_t size;       // 저장된 요소 수
-    size_t tombstones; // 삭제 표시 수
-    ProbeType type;    // 사용 중인 탐사 방식
-} HashTable;
-
-// 함수 선언부
-HashTable* hash_table_create(size_t capacity, ProbeType type);
-bool hash_table_insert(HashTable* table, const char* key, int value);
-bool hash_table_get(const HashTable* table, const char* key, int* value);
-bool hash_table_remove(HashTable* table, const char* key);
-void hash_table_destroy(HashTable* table);
-void hash_table_print(const HashTable* table);
-const char* probe_type_to_string(ProbeType type);
-static double get_load_factor(const HashTable* table);
-static size_t get_probe_position(const HashTable* table, const char* key, size_t i);
-static bool hash_table_resize(HashTable* table);
+// 내부 함수 선언부
+static double get_load_factor(const OpenHashTable* table);
+static size_t get_probe_position(const OpenHashTable* table, const char* key, size_t i);
+static bool hash_table_resize(OpenHashTable* table);
 
 /**
  * 문자열 해시 함수 (djb2 알고리즘)
  * 충돌이 적고 빠른 계산이 가능한 문자열 해시 함수
  */
-unsigned long hash_function(const char* str) {
+unsigned long ohash_function(const char* str) {
     unsigned long hash = 5381;
     int c;
     while ((c = *str++)) {
@@ -65,7 +37,7 @@ unsigned long hash_function(const char* str) {
  * 보조 해시 함수 (이중 해싱에서 사용)
  * 항상 홀수를 반환하여 모든 버킷 방문을 보장
  */
-unsigned long hash_function2(const char* str) {
+unsigned long ohash_function2(const char* str) {
     unsigned long hash = 0;
     int c;
     while ((c = *str++)) {
@@ -78,7 +50,7 @@ unsigned long hash_function2(const char* str) {
  * 현재 해시 테이블의 적재율 계산
  * (실제 저장된 요소 수 + 삭제 표시 수) / 테이블 크기
  */
-static double get_load_factor(const HashTable* table) {
+static double get_load_factor(const OpenHashTable* table) {
     return (double)(table->size + table->tombstones) / table->capacity;
 }
 
@@ -91,8 +63,8 @@ static double get_load_factor(const HashTable* table) {
  * @param i 탐사 단계 (몇 번째 시도인지)
  * @return 다음 탐사할 버킷의 인덱스
  */
-static size_t get_probe_position(const HashTable* table, const char* key, size_t i) {
-    unsigned long hash = hash_function(key);
+static size_t get_probe_position(const OpenHashTable* table, const char* key, size_t i) {
+    unsigned long hash = ohash_function(key);
     unsigned long hash2;
 
     switch (table->type) {
@@ -103,7 +75,7 @@ static size_t get_probe_position(const HashTable* table, const char* key, size_t
             return (hash + i * i) % table->capacity;
 
         case PROBE_DOUBLE_HASH: // 이중 해싱: hash + i * hash2
-            hash2 = hash_function2(key);
+            hash2 = ohash_function2(key);
             return (hash + i * hash2) % table->capacity;
 
         default:
@@ -119,13 +91,13 @@ static size_t get_probe_position(const HashTable* table, const char* key, size_t
  * @param type 사용할 탐사 방식
  * @return 생성된 해시 테이블 포인터, 실패시 NULL
  */
-HashTable* hash_table_create(size_t capacity, ProbeType type) {
+OpenHashTable* ohash_create(size_t capacity, ProbeType type) {
     // 테이블 구조체 할당
-    HashTable* table = (HashTable*)malloc(sizeof(HashTable));
+    OpenHashTable* table = (OpenHashTable*)malloc(sizeof(OpenHashTable));
     if (!table) return NULL;
 
     // 엔트리 배열 할당
-    table->entries = (Entry*)calloc(capacity, sizeof(Entry));
+    table->entries = (OpenHashEntry*)calloc(capacity, sizeof(OpenHashEntry));
     if (!table->entries) {
         free(table);
         return NULL;
@@ -145,13 +117,13 @@ HashTable* hash_table_create(size_t capacity, ProbeType type) {
  * @param table 재해싱할 테이블
  * @return 성공 여부
  */
-static bool hash_table_resize(HashTable* table) {
+static bool hash_table_resize(OpenHashTable* table) {
     size_t old_capacity = table->capacity;
-    Entry* old_entries = table->entries;
+    OpenHashEntry* old_entries = table->entries;
 
     // 새로운 크기의 테이블 생성
     size_t new_capacity = old_capacity * 2;
-    table->entries = (Entry*)calloc(new_capacity, sizeof(Entry));
+    table->entries = (OpenHashEntry*)calloc(new_capacity, sizeof(OpenHashEntry));
     if (!table->entries) {
         table->entries = old_entries;
         return false;
@@ -164,7 +136,7 @@ static bool hash_table_resize(HashTable* table) {
     // 이전 엔트리들을 새 테이블로 복사
     for (size_t i = 0; i < old_capacity; i++) {
         if (old_entries[i].key && old_entries[i].key != DELETED_NODE) {
-            hash_table_insert(table, old_entries[i].key, old_entries[i].value);
+            ohash_insert(table, old_entries[i].key, old_entries[i].value);
             free(old_entries[i].key);
         }
     }
@@ -182,7 +154,7 @@ static bool hash_table_resize(HashTable* table) {
  * @param value 저장할 값
  * @return 성공 여부
  */
-bool hash_table_insert(HashTable* table, const char* key, int value) {
+bool ohash_insert(OpenHashTable* table, const char* key, int value) {
     // 적재율 체크 및 재해싱
     if (get_load_factor(table) >= MAX_LOAD_FACTOR) {
         if (!hash_table_resize(table)) {
@@ -251,7 +223,7 @@ bool hash_table_insert(HashTable* table, const char* key, int value) {
  * @param value 찾은 값을 저장할 포인터
  * @return 검색 성공 여부
  */
-bool hash_table_get(const HashTable* table, const char* key, int* value) {
+bool ohash_get(const OpenHashTable* table, const char* key, int* value) {
     size_t i = 0;
     size_t index;
 
@@ -284,7 +256,7 @@ bool hash_table_get(const HashTable* table, const char* key, int* value) {
  * @param key 삭제할 키
  * @return 삭제 성공 여부
  */
-bool hash_table_remove(HashTable* table, const char* key) {
+bool ohash_remove(OpenHashTable* table, const char* key) {
     size_t i = 0;
     size_t index;
 
@@ -318,7 +290,7 @@ bool hash_table_remove(HashTable* table, const char* key) {
  *
  * @param table 해제할 테이블
  */
-void hash_table_destroy(HashTable* table) {
+void ohash_destroy(OpenHashTable* table) {
     if (!table) return;
 
     // 각 엔트리의 키 문자열 해제
@@ -339,7 +311,7 @@ void hash_table_destroy(HashTable* table) {
  *
  * @param table 출력할 테이블
  */
-void hash_table_print(const HashTable* table) {
+void ohash_print(const OpenHashTable* table) {
     printf("\n=== Hash Table Status ===\n");
     printf("Size: %zu\n", table->size);
     printf("Capacity: %zu\n", table->capacity);
@@ -367,7 +339,7 @@ void hash_table_print(const HashTable* table) {
  * @param type 탐사 방식
  * @return 탐사 방식 설명 문자열
  */
-const char* probe_type_to_string(ProbeType type) {
+const char* ohash_probe_type_to_string(ProbeType type) {
     switch (type) {
         case PROBE_LINEAR:
             return "Linear Probing";
@@ -380,6 +352,7 @@ const char* probe_type_to_string(ProbeType type) {
     }
 }
 
+#ifndef DS_LIBRARY_BUILD
 /**
  * 메뉴 출력
  */
@@ -396,13 +369,13 @@ void print_menu(void) {
 
 int main(void) {
     // 초기 해시 테이블 생성
-    HashTable* table = hash_table_create(INITIAL_SIZE, PROBE_LINEAR);
+    OpenHashTable* table = ohash_create(INITIAL_SIZE, PROBE_LINEAR);
     if (!table) {
         printf("Failed to create hash table\n");
         return 1;
     }
 
-    printf("Initial probe type: %s\n", probe_type_to_string(table->type));
+    printf("Initial probe type: %s\n", ohash_probe_type_to_string(table->type));
 
     int choice;
     char key[256];
@@ -430,7 +403,7 @@ int main(void) {
                     continue;
                 }
 
-                if (hash_table_insert(table, key, value)) {
+                if (ohash_insert(table, key, value)) {
                     printf("Successfully inserted (%s: %d)\n", key, value);
                 }
                 else {
@@ -443,7 +416,7 @@ int main(void) {
                 if (!fgets(key, sizeof(key), stdin)) continue;
                 key[strcspn(key, "\n")] = 0;
 
-                if (hash_table_get(table, key, &value)) {
+                if (ohash_get(table, key, &value)) {
                     printf("Value for key '%s': %d\n", key, value);
                 }
                 else {
@@ -456,7 +429,7 @@ int main(void) {
                 if (!fgets(key, sizeof(key), stdin)) continue;
                 key[strcspn(key, "\n")] = 0;
 
-                if (hash_table_remove(table, key)) {
+                if (ohash_remove(table, key)) {
                     printf("Successfully removed key '%s'\n", key);
                 }
                 else {
@@ -465,7 +438,7 @@ int main(void) {
                 break;
 
             case 4:  // Print
-                hash_table_print(table);
+                ohash_print(table);
                 break;
 
             case 5:  // Change probe type
@@ -480,7 +453,7 @@ int main(void) {
                     probe_choice >= 1 && probe_choice <= 3) {
                     table->type = (ProbeType)(probe_choice - 1);
                     printf("Changed to %s\n",
-                        probe_type_to_string(table->type));
+                        ohash_probe_type_to_string(table->type));
                 }
                 else {
                     printf("Invalid choice\n");
@@ -497,6 +470,7 @@ int main(void) {
     } while (choice != 0);
 
     // 메모리 정리
-    hash_table_destroy(table);
+    ohash_destroy(table);
     return 0;
-}
\ No newline at end of file
+}
+#endif // DS_LIBRARY_BUILD
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "adjacency_matrix.h"
+
 /*
 인접 행렬 기반 그래프:
 - 2차원 배열로 그래프 표현
@@ -10,24 +12,16 @@
 - 간선 확인이 O(1)로 빠름
 */
 
-#define MAX_VERTICES 100
-#define INF 999999  // 무한대 값 (연결되지 않은 간선)
-
-typedef struct {
-    int num_vertices;                         // 정점의 개수
-    int matrix[MAX_VERTICES][MAX_VERTICES];   // 인접 행렬
-} Graph;
-
 /* 그래프 생성
  * - 매개변수: vertices - 정점의 개수
  * - 반환값: 생성된 그래프의 포인터
  */
-Graph* graph_create(int vertices) {
+MatrixGraph* mgraph_create(int vertices) {
     if (vertices > MAX_VERTICES) {
         return NULL;
     }
 
-    Graph* graph = (Graph*)malloc(sizeof(Graph));
+    MatrixGraph* graph = (MatrixGraph*)malloc(sizeof(MatrixGraph));
     if (!graph) {
         return NULL;
     }
@@ -57,7 +51,7 @@ Graph* graph_create(int vertices) {
  *            directed - 방향 그래프 여부
  * - 반환값: 성공 시 true, 실패 시 false
  */
-bool graph_add_edge(Graph* graph, int src, int dest, int weight, bool directed) {
+bool mgraph_add_edge(MatrixGraph* graph, int src, int dest, int weight, bool directed) {
     if (!graph || src < 0 || src >= graph->num_vertices ||
         dest < 0 || dest >= graph->num_vertices) {
         return false;
@@ -79,7 +73,7 @@ bool graph_add_edge(Graph* graph, int src, int dest, int weight, bool directed)
  *            directed - 방향 그래프 여부
  * - 반환값: 성공 시 true, 실패 시 false
  */
-bool graph_remove_edge(Graph* graph, int src, int dest, bool directed) {
+bool mgraph_remove_edge(MatrixGraph* graph, int src, int dest, bool directed) {
     if (!graph || src < 0 || src >= graph->num_vertices ||
         dest < 0 || dest >= graph->num_vertices) {
         return false;
@@ -97,7 +91,7 @@ bool graph_remove_edge(Graph* graph, int src, int dest, bool directed) {
 /* 간선 존재 여부 확인
  * - 시간복잡도: O(1)
  */
-bool graph_has_edge(const Graph* graph, int src, int dest) {
+bool mgraph_has_edge(const MatrixGraph* graph, int src, int dest) {
     if (!graph || src < 0 || src >= graph->num_vertices ||
         dest < 0 || dest >= graph->num_vertices) {
         return false;
@@ -110,7 +104,7 @@ bool graph_has_edge(const Graph* graph, int src, int dest) {
  * - 무방향 그래프의 경우 연결된 모든 간선의 수
  * - 방향 그래프의 경우 진입 차수와 진출 차수의 합
  */
-int graph_degree(const Graph* graph, int vertex) {
+int mgraph_degree(const MatrixGraph* graph, int vertex) {
     if (!graph || vertex < 0 || vertex >= graph->num_vertices) {
         return -1;
     }
@@ -137,7 +131,7 @@ int graph_degree(const Graph* graph, int vertex) {
 /* 그래프 출력
  * - 인접 행렬 형태로 출력
  */
-void graph_print(const Graph* graph) {
+void mgraph_print(const MatrixGraph* graph) {
     if (!graph) return;
 
     printf("\nAdjacency Matrix:\n");
@@ -164,7 +158,7 @@ void graph_print(const Graph* graph) {
 /* 그래프 정보 출력
  * - 각 정점의 연결 상태 출력
  */
-void graph_info(const Graph* graph) {
+void mgraph_info(const MatrixGraph* graph) {
     if (!graph) return;
 
     printf("\nGraph Information:\n");
@@ -186,18 +180,19 @@ void graph_info(const Graph* graph) {
             printf("No connections");
         }
 
-        printf("\n  Degree: %d\n", graph_degree(graph, i));
+        printf("\n  Degree: %d\n", mgraph_degree(graph, i));
     }
 }
 
 /* 그래프 메모리 해제 */
-void graph_destroy(Graph* graph) {
+void mgraph_destroy(MatrixGraph* graph) {
     free(graph);
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 */
 void print_menu(void) {
-    printf("\n=== Graph Menu ===\n");
+    printf("\n=== MatrixGraph Menu ===\n");
     printf("1. Add edge\n");
     printf("2. Remove edge\n");
     printf("3. Check if edge exists\n");
@@ -213,7 +208,7 @@ int main(void) {
     printf("Enter number of vertices: ");
     scanf("%d", &num_vertices);
 
-    Graph* graph = graph_create(num_vertices);
+    MatrixGraph* graph = mgraph_create(num_vertices);
     if (!graph) {
         printf("Failed to create graph\n");
         return 1;
@@ -238,7 +233,7 @@ int main(void) {
             printf("Is it directed? (1/0): ");
             scanf("%d", &directed);
 
-            if (graph_add_edge(graph, src, dest, weight, directed)) {
+            if (mgraph_add_edge(graph, src, dest, weight, directed)) {
                 printf("Edge added successfully\n");
             }
             else {
@@ -258,7 +253,7 @@ int main(void) {
             printf("Is it directed? (1/0): ");
             scanf("%d", &directed);
 
-            if (graph_remove_edge(graph, src, dest, directed)) {
+            if (mgraph_remove_edge(graph, src, dest, directed)) {
                 printf("Edge removed successfully\n");
             }
             else {
@@ -275,7 +270,7 @@ int main(void) {
             printf("Enter destination vertex: ");
             scanf("%d", &dest);
 
-            if (graph_has_edge(graph, src, dest)) {
+            if (mgraph_has_edge(graph, src, dest)) {
                 printf("Edge exists with weight: %d\n",
                     graph->matrix[src][dest]);
             }
@@ -286,11 +281,11 @@ int main(void) {
         }
 
         case 4:  // Print matrix
-            graph_print(graph);
+            mgraph_print(graph);
             break;
 
         case 5:  // Print info
-            graph_info(graph);
+            mgraph_info(graph);
             break;
 
         case 6: {  // Calculate degree
@@ -298,7 +293,7 @@ int main(void) {
             printf("Enter vertex: ");
             scanf("%d", &vertex);
 
-            int degree = graph_degree(graph, vertex);
+            int degree = mgraph_degree(graph, vertex);
             if (degree >= 0) {
                 printf("Degree of vertex %d: %d\n", vertex, degree);
             }
@@ -317,9 +312,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    graph_destroy(graph);
+    mgraph_destroy(graph);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
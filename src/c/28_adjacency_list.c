@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "adjacency_list.h"
+
 /*
 인접 리스트 기반 그래프:
 - 각 정점마다 연결된 정점들의 리스트 유지
@@ -10,20 +12,9 @@
 - 실제 많이 사용되는 방식
 */
 
-typedef struct Node {
-    int vertex;         // 도착 정점
-    int weight;         // 간선의 가중치
-    struct Node* next;  // 다음 간선
-} Node;
-
-typedef struct {
-    int num_vertices;           // 정점의 개수
-    Node** adj_list;           // 인접 리스트 배열
-} Graph;
-
 /* 새로운 노드 생성 */
-Node* create_node(int v, int weight) {
-    Node* new_node = (Node*)malloc(sizeof(Node));
+static ListGraphNode* create_node(int v, int weight) {
+    ListGraphNode* new_node = (ListGraphNode*)malloc(sizeof(ListGraphNode));
     if (new_node) {
         new_node->vertex = v;
         new_node->weight = weight;
@@ -33,11 +24,11 @@ Node* create_node(int v, int weight) {
 }
 
 /* 그래프 생성 */
-Graph* graph_create(int vertices) {
-    Graph* graph = (Graph*)malloc(sizeof(Graph));
+ListGraph* lgraph_create(int vertices) {
+    ListGraph* graph = (ListGraph*)malloc(sizeof(ListGraph));
     if (!graph) return NULL;
 
-    graph->adj_list = (Node**)malloc(vertices * sizeof(Node*));
+    graph->adj_list = (ListGraphNode**)malloc(vertices * sizeof(ListGraphNode*));
     if (!graph->adj_list) {
         free(graph);
         return NULL;
@@ -54,14 +45,14 @@ Graph* graph_create(int vertices) {
 }
 
 /* 간선 추가 */
-bool graph_add_edge(Graph* graph, int src, int dest, int weight, bool directed) {
+bool lgraph_add_edge(ListGraph* graph, int src, int dest, int weight, bool directed) {
     if (!graph || src < 0 || src >= graph->num_vertices ||
         dest < 0 || dest >= graph->num_vertices) {
         return false;
     }
 
     // src에서 dest로의 간선 추가
-    Node* new_node = create_node(dest, weight);
+    ListGraphNode* new_node = create_node(dest, weight);
     if (!new_node) return false;
 
     new_node->next = graph->adj_list[src];
@@ -79,15 +70,15 @@ bool graph_add_edge(Graph* graph, int src, int dest, int weight, bool directed)
 }
 
 /* 간선 제거 */
-bool graph_remove_edge(Graph* graph, int src, int dest, bool directed) {
+bool lgraph_remove_edge(ListGraph* graph, int src, int dest, bool directed) {
     if (!graph || src < 0 || src >= graph->num_vertices ||
         dest < 0 || dest >= graph->num_vertices) {
         return false;
     }
 
     // src에서 dest로의 간선 제거
-    Node* current = graph->adj_list[src];
-    Node* prev = NULL;
+    ListGraphNode* current = graph->adj_list[src];
+    ListGraphNode* prev = NULL;
 
     while (current && current->vertex != dest) {
         prev = current;
@@ -129,13 +120,13 @@ bool graph_remove_edge(Graph* graph, int src, int dest, bool directed) {
 }
 
 /* 간선 존재 여부 확인 */
-bool graph_has_edge(const Graph* graph, int src, int dest) {
+bool lgraph_has_edge(const ListGraph* graph, int src, int dest) {
     if (!graph || src < 0 || src >= graph->num_vertices ||
         dest < 0 || dest >= graph->num_vertices) {
         return false;
     }
 
-    Node* current = graph->adj_list[src];
+    ListGraphNode* current = graph->adj_list[src];
     while (current) {
         if (current->vertex == dest) {
             return true;
@@ -147,13 +138,13 @@ bool graph_has_edge(const Graph* graph, int src, int dest) {
 }
 
 /* 정점의 차수 계산 */
-int graph_degree(const Graph* graph, int vertex) {
+int lgraph_degree(const ListGraph* graph, int vertex) {
     if (!graph || vertex < 0 || vertex >= graph->num_vertices) {
         return -1;
     }
 
     int degree = 0;
-    Node* current = graph->adj_list[vertex];
+    ListGraphNode* current = graph->adj_list[vertex];
 
     while (current) {
         degree++;
@@ -164,13 +155,13 @@ int graph_degree(const Graph* graph, int vertex) {
 }
 
 /* 그래프 출력 */
-void graph_print(const Graph* graph) {
+void lgraph_print(const ListGraph* graph) {
     if (!graph) return;
 
     printf("\nAdjacency List:\n");
     for (int i = 0; i < graph->num_vertices; i++) {
         printf("[%d]", i);
-        Node* current = graph->adj_list[i];
+        ListGraphNode* current = graph->adj_list[i];
 
         while (current) {
             printf(" -> %d(w:%d)", current->vertex, current->weight);
@@ -181,7 +172,7 @@ void graph_print(const Graph* graph) {
 }
 
 /* 정점별 인접 정점 정보 출력 */
-void graph_info(const Graph* graph) {
+void lgraph_info(const ListGraph* graph) {
     if (!graph) return;
 
     printf("\nGraph Information:\n");
@@ -191,7 +182,7 @@ void graph_info(const Graph* graph) {
         printf("\nVertex %d:", i);
         printf("\n  Adjacent vertices: ");
 
-        Node* current = graph->adj_list[i];
+        ListGraphNode* current = graph->adj_list[i];
         if (!current) {
             printf("None");
         }
@@ -201,19 +192,19 @@ void graph_info(const Graph* graph) {
             current = current->next;
         }
 
-        printf("\n  Degree: %d\n", graph_degree(graph, i));
+        printf("\n  Degree: %d\n", lgraph_degree(graph, i));
     }
 }
 
 /* 그래프 메모리 해제 */
-void graph_destroy(Graph* graph) {
+void lgraph_destroy(ListGraph* graph) {
     if (!graph) return;
 
     // 각 정점의 인접 리스트 해제
     for (int i = 0; i < graph->num_vertices; i++) {
-        Node* current = graph->adj_list[i];
+        ListGraphNode* current = graph->adj_list[i];
         while (current) {
-            Node* temp = current;
+            ListGraphNode* temp = current;
             current = current->next;
             free(temp);
         }
@@ -223,9 +214,10 @@ void graph_destroy(Graph* graph) {
     free(graph);
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 메뉴 출력 */
 void print_menu(void) {
-    printf("\n=== Graph Menu ===\n");
+    printf("\n=== ListGraph Menu ===\n");
     printf("1. Add edge\n");
     printf("2. Remove edge\n");
     printf("3. Check if edge exists\n");
@@ -241,7 +233,7 @@ int main(void) {
     printf("Enter number of vertices: ");
     scanf("%d", &num_vertices);
 
-    Graph* graph = graph_create(num_vertices);
+    ListGraph* graph = lgraph_create(num_vertices);
     if (!graph) {
         printf("Failed to create graph\n");
         return 1;
@@ -266,7 +258,7 @@ int main(void) {
             printf("Is it directed? (1/0): ");
             scanf("%d", &directed);
 
-            if (graph_add_edge(graph, src, dest, weight, directed)) {
+            if (lgraph_add_edge(graph, src, dest, weight, directed)) {
                 printf("Edge added successfully\n");
             }
             else {
@@ -286,7 +278,7 @@ int main(void) {
             printf("Is it directed? (1/0): ");
             scanf("%d", &directed);
 
-            if (graph_remove_edge(graph, src, dest, directed)) {
+            if (lgraph_remove_edge(graph, src, dest, directed)) {
                 printf("Edge removed successfully\n");
             }
             else {
@@ -303,7 +295,7 @@ int main(void) {
             printf("Enter destination vertex: ");
             scanf("%d", &dest);
 
-            if (graph_has_edge(graph, src, dest)) {
+            if (lgraph_has_edge(graph, src, dest)) {
                 printf("Edge exists\n");
             }
             else {
@@ -313,11 +305,11 @@ int main(void) {
         }
 
         case 4:  // Print graph
-            graph_print(graph);
+            lgraph_print(graph);
             break;
 
         case 5:  // Print info
-            graph_info(graph);
+            lgraph_info(graph);
             break;
 
         case 6: {  // Calculate degree
@@ -325,7 +317,7 @@ int main(void) {
             printf("Enter vertex: ");
             scanf("%d", &vertex);
 
-            int degree = graph_degree(graph, vertex);
+            int degree = lgraph_degree(graph, vertex);
             if (degree >= 0) {
                 printf("Degree of vertex %d: %d\n", vertex, degree);
             }
@@ -344,9 +336,10 @@ int main(void) {
         }
     } while (choice != 0);
 
-    graph_destroy(graph);
+    lgraph_destroy(graph);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include "string_search.h"
 
 /*
 고지식한 탐색(Brute Force) 알고리즘:
@@ -10,51 +11,6 @@
 - 구현이 단순하고 이해하기 쉬움
 */
 
-/* 문자열 탐색 결과 저장을 위한 구조체 */
-typedef struct {
-    int* positions;    // 발견된 위치들의 배열
-    int count;         // 발견된 총 횟수
-    int capacity;      // positions 배열의 크기
-} SearchResult;
-
-/* 검색 결과 초기화 */
-SearchResult* create_result(int initial_capacity) {
-    SearchResult* result = (SearchResult*)malloc(sizeof(SearchResult));
-    if (!result) return NULL;
-
-    result->positions = (int*)malloc(initial_capacity * sizeof(int));
-    if (!result->positions) {
-        free(result);
-        return NULL;
-    }
-
-    result->count = 0;
-    result->capacity = initial_capacity;
-    return result;
-}
-
-/* 검색 결과에 새로운 위치 추가 */
-void add_position(SearchResult* result, int position) {
-    if (result->count >= result->capacity) {
-        int new_capacity = result->capacity * 2;
-        int* new_positions = (int*)realloc(result->positions, new_capacity * sizeof(int));
-        if (!new_positions) return;
-
-        result->positions = new_positions;
-        result->capacity = new_capacity;
-    }
-
-    result->positions[result->count++] = position;
-}
-
-/* 검색 결과 메모리 해제 */
-void destroy_result(SearchResult* result) {
-    if (result) {
-        free(result->positions);
-        free(result);
-    }
-}
-
 /* 기본 브루트 포스 문자열 검색
  * - 시간복잡도: O(mn), m: 패턴길이, n: 텍스트길이
  * - 공간복잡도: O(1)
@@ -106,6 +62,7 @@ SearchResult* brute_force_search(const char* text, const char* pattern, bool pri
     return result;
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 검색 결과 출력 */
 void print_search_result(const SearchResult* result, const char* text, const char* pattern) {
     if (result->count == 0) {
@@ -213,6 +170,7 @@ int main(void) {
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "string_search.h"
 
 /*
 KMP(Knuth-Morris-Pratt) 알고리즘:
@@ -16,50 +17,6 @@ KMP(Knuth-Morris-Pratt) 알고리즘:
 - 예: "ABCDABD"의 테이블: [0,0,0,0,1,2,0]
 */
 
-typedef struct {
-    int* positions;    // 발견된 위치들의 배열
-    int count;         // 발견된 총 횟수
-    int capacity;      // positions 배열의 크기
-} SearchResult;
-
-/* 검색 결과 초기화 */
-SearchResult* create_result(int initial_capacity) {
-    SearchResult* result = (SearchResult*)malloc(sizeof(SearchResult));
-    if (!result) return NULL;
-
-    result->positions = (int*)malloc(initial_capacity * sizeof(int));
-    if (!result->positions) {
-        free(result);
-        return NULL;
-    }
-
-    result->count = 0;
-    result->capacity = initial_capacity;
-    return result;
-}
-
-/* 검색 결과에 새로운 위치 추가 */
-void add_position(SearchResult* result, int position) {
-    if (result->count >= result->capacity) {
-        int new_capacity = result->capacity * 2;
-        int* new_positions = (int*)realloc(result->positions, new_capacity * sizeof(int));
-        if (!new_positions) return;
-
-        result->positions = new_positions;
-        result->capacity = new_capacity;
-    }
-
-    result->positions[result->count++] = position;
-}
-
-/* 검색 결과 메모리 해제 */
-void destroy_result(SearchResult* result) {
-    if (result) {
-        free(result->positions);
-        free(result);
-    }
-}
-
 /* 부분일치 테이블 계산
  * - 시간복잡도: O(m), m: 패턴의 길이
  */
@@ -202,6 +159,7 @@ SearchResult* kmp_search(const char* text, const char* pattern, bool print_steps
     return result;
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 검색 결과 출력 */
 void print_search_result(const SearchResult* result, const char* text, const char* pattern) {
     if (result->count == 0) {
@@ -310,6 +268,7 @@ int main(void) {
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
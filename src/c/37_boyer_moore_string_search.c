@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "string_search.h"
 
 /*
 Boyer-Moore 알고리즘:
@@ -19,55 +20,10 @@ Boyer-Moore 알고리즘:
 #define NO_OF_CHARS 256
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 
-typedef struct {
-    int* positions;
-    int count;
-    int capacity;
-} SearchResult;
-
-/* 검색 결과 초기화 */
-SearchResult* create_result(int initial_capacity) {
-    SearchResult* result = (SearchResult*)malloc(sizeof(SearchResult));
-    if (!result) return NULL;
-
-    result->positions = (int*)malloc(initial_capacity * sizeof(int));
-    if (!result->positions) {
-        free(result);
-        return NULL;
-    }
-
-    result->count = 0;
-    result->capacity = initial_capacity;
-    return result;
-}
-
-/* 검색 결과에 새로운 위치 추가 */
-void add_position(SearchResult* result, int position) {
-    if (result->count >= result->capacity) {
-        int new_capacity = result->capacity * 2;
-        int* new_positions = (int*)realloc(result->positions,
-            new_capacity * sizeof(int));
-        if (!new_positions) return;
-
-        result->positions = new_positions;
-        result->capacity = new_capacity;
-    }
-
-    result->positions[result->count++] = position;
-}
-
-/* 검색 결과 메모리 해제 */
-void destroy_result(SearchResult* result) {
-    if (result) {
-        free(result->positions);
-        free(result);
-    }
-}
-
 /* Bad Character 규칙 테이블 생성
  * - 각 문자의 패턴 내 마지막 위치 저장
  */
-void compute_bad_char(const char* pattern, int m, int bad_char[NO_OF_CHARS]) {
+static void compute_bad_char(const char* pattern, int m, int bad_char[NO_OF_CHARS]) {
     // 모든 문자를 -1로 초기화
     for (int i = 0; i < NO_OF_CHARS; i++)
         bad_char[i] = -1;
@@ -80,7 +36,7 @@ void compute_bad_char(const char* pattern, int m, int bad_char[NO_OF_CHARS]) {
 /* 접미부 테이블 생성
  * - 패턴의 접미부와 일치하는 다른 부분을 찾음
  */
-void compute_good_suffix(const char* pattern, int m, int suffix[], bool prefix[]) {
+static void compute_good_suffix(const char* pattern, int m, int suffix[], bool prefix[]) {
     // 초기화
     for (int i = 0; i < m; i++) {
         suffix[i] = -1;
@@ -105,9 +61,13 @@ void compute_good_suffix(const char* pattern, int m, int suffix[], bool prefix[]
 }
 
 /* Good Suffix 규칙에 따른 이동 거리 계산 */
-int get_good_suffix_shift(int pos, int m, const int suffix[], const bool prefix[]) {
+static int get_good_suffix_shift(int pos, int m, const int suffix[], const bool prefix[]) {
     int len = m - 1 - pos;  // 일치하는 접미부 길이
 
+    // 일치한 접미부가 없으면 Bad Character 규칙만 적용
+    if (len == 0)
+        return 0;
+
     // Case 1: 접미부가 다시 나타나는 경우
     if (suffix[len] != -1)
         return pos - suffix[len] + 1;
@@ -182,7 +142,7 @@ SearchResult* boyer_moore_search(const char* text, const char* pattern, bool pri
             if (print_steps) {
                 printf("Pattern found at position %d\n", s);
             }
-            s += (s + m < n) ? m - bad_char[text[s + m]] : 1;
+            s += (s + m < n) ? m - bad_char[(unsigned char)text[s + m]] : 1;
         }
         else {
             comparisons++;
@@ -191,9 +151,9 @@ SearchResult* boyer_moore_search(const char* text, const char* pattern, bool pri
             }
 
             // Bad Character와 Good Suffix 규칙 중 더 큰 이동 거리 선택
-            int bc_shift = j - bad_char[text[s + j]];
+            int bc_shift = j - bad_char[(unsigned char)text[s + j]];
             int gs_shift = get_good_suffix_shift(j, m, suffix, prefix);
-            int shift = MAX(bc_shift, gs_shift);
+            int shift = MAX(MAX(bc_shift, gs_shift), 1);
 
             if (print_steps) {
                 printf("Bad Character shift: %d\n", bc_shift);
@@ -214,6 +174,7 @@ SearchResult* boyer_moore_search(const char* text, const char* pattern, bool pri
     return result;
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 검색 결과 출력 */
 void print_search_result(const SearchResult* result, const char* text, const char* pattern) {
     if (result->count == 0) {
@@ -321,6 +282,7 @@ int main(void) {
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
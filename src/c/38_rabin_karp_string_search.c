@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "string_search.h"
 
 /*
 Rabin-Karp 알고리즘:
@@ -19,55 +20,10 @@ Rabin-Karp 알고리즘:
 #define PRIME 101  // 해시 계산을 위한 소수
 #define D 256     // 문자셋 크기 (ASCII)
 
-typedef struct {
-    int* positions;
-    int count;
-    int capacity;
-} SearchResult;
-
-/* 검색 결과 초기화 */
-SearchResult* create_result(int initial_capacity) {
-    SearchResult* result = (SearchResult*)malloc(sizeof(SearchResult));
-    if (!result) return NULL;
-
-    result->positions = (int*)malloc(initial_capacity * sizeof(int));
-    if (!result->positions) {
-        free(result);
-        return NULL;
-    }
-
-    result->count = 0;
-    result->capacity = initial_capacity;
-    return result;
-}
-
-/* 검색 결과에 새로운 위치 추가 */
-void add_position(SearchResult* result, int position) {
-    if (result->count >= result->capacity) {
-        int new_capacity = result->capacity * 2;
-        int* new_positions = (int*)realloc(result->positions,
-            new_capacity * sizeof(int));
-        if (!new_positions) return;
-
-        result->positions = new_positions;
-        result->capacity = new_capacity;
-    }
-
-    result->positions[result->count++] = position;
-}
-
-/* 검색 결과 메모리 해제 */
-void destroy_result(SearchResult* result) {
-    if (result) {
-        free(result->positions);
-        free(result);
-    }
-}
-
 /* 거듭제곱 계산 (모듈러 연산 포함)
  * - (a^b) % mod 를 효율적으로 계산
  */
-unsigned long long mod_pow(int base, int exp, int mod) {
+static unsigned long long mod_pow(int base, int exp, int mod) {
     unsigned long long result = 1;
     base %= mod;
 
@@ -159,6 +115,7 @@ SearchResult* rabin_karp_search(const char* text, const char* pattern, bool prin
     return result;
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 검색 결과 출력 */
 void print_search_result(const SearchResult* result, const char* text, const char* pattern) {
     if (result->count == 0) {
@@ -266,6 +223,7 @@ int main(void) {
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
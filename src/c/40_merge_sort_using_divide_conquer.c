@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include "sort.h"
 
 /*
 병합 정렬(Merge Sort):
@@ -20,7 +21,7 @@
  * - mid+1 ~ right: 두 번째 부분 배열
  * - 시간복잡도: O(n), 공간복잡도: O(n)
  */
-void merge(int arr[], int left, int mid, int right, bool print_steps) {
+static void merge(int arr[], int left, int mid, int right, bool print_steps) {
     int i, j, k;
     int n1 = mid - left + 1;  // 왼쪽 부분 배열의 크기
     int n2 = right - mid;     // 오른쪽 부분 배열의 크기
@@ -117,6 +118,7 @@ void merge_sort(int arr[], int left, int right, bool print_steps) {
     }
 }
 
+#ifndef DS_LIBRARY_BUILD
 /* 배열이 정렬되었는지 검증 */
 bool is_sorted(const int arr[], int size) {
     for (int i = 0; i < size - 1; i++) {
@@ -137,42 +139,12 @@ void print_array(const int arr[], int size) {
     printf("]\n");
 }
 
-/* 성능 분석을 위한 함수 */
-void analyze_performance(void) {
-    printf("\nPerformance Analysis:\n");
-    printf("-------------------\n");
-
-    int sizes[] = { 100, 1000, 10000, 100000 };
-    int num_sizes = sizeof(sizes) / sizeof(sizes[0]);
-
-    for (int i = 0; i < num_sizes; i++) {
-        int size = sizes[i];
-        int* arr = (int*)malloc(size * sizeof(int));
-
-        // 랜덤 배열 생성
-        for (int j = 0; j < size; j++) {
-            arr[j] = rand() % 1000;
-        }
-
-        // 시간 측정
-        clock_t start = clock();
-        merge_sort(arr, 0, size - 1, false);
-        clock_t end = clock();
-
-        double time = ((double)(end - start)) / CLOCKS_PER_SEC;
-        printf("Size: %d, Time: %f seconds\n", size, time);
-
-        free(arr);
-    }
-}
-
 /* 메뉴 출력 */
 void print_menu(void) {
     printf("\n=== Merge Sort Menu ===\n");
     printf("1. Sort new array\n");
     printf("2. Sort with steps\n");
-    printf("3. Analyze performance\n");
-    printf("4. Sort custom array\n");
+    printf("3. Sort custom array\n");
     printf("0. Exit\n");
     printf("Choice: ");
 }
@@ -216,11 +188,7 @@ int main(void) {
             break;
         }
 
-        case 3:  // Analyze performance
-            analyze_performance();
-            break;
-
-        case 4: {  // Sort custom array
+        case 3: {  // Sort custom array
             printf("Enter array size: ");
             scanf("%d", &size);
 
@@ -257,6 +225,7 @@ int main(void) {
     free(arr);
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 ==========================================
@@ -328,7 +297,7 @@ O(n)
 - 병렬 정렬
 
 이 구현은 병합 정렬의 모든 단계를
-명확히 보여주며, 실제 성능 분석도
-포함하고 있습니다. 다음 단계인
+명확히 보여주며, 성능 측정은
+benchmarks/c/bench_sort.c에서 수행합니다. 다음 단계인
 거듭제곱 계산의 기초가 됩니다.
 */
\ No newline at end of file
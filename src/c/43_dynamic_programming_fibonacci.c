@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <time.h>
 #include <stdbool.h>
+#include "dynamic_programming.h"
 
 /*
 동적 계획법 (Dynamic Programming)
@@ -65,8 +66,8 @@ long long fib_recursive(int n, bool print_steps) {
 }
 
 // === 2. 메모이제이션 (Top-down) ===
-long long* memo;
-int* calculation_count;  // 각 n에 대한 계산 횟수 추적
+static long long* memo;
+static int* calculation_count;  // 각 n에 대한 계산 횟수 추적
 
 void init_memoization(int size) {
     memo = (long long*)malloc(size * sizeof(long long));
@@ -134,11 +135,6 @@ long long fib_memoization(int n, bool print_steps) {
 }
 
 // === 3. 타뷸레이션 (Bottom-up) ===
-typedef struct {
-    long long* table;
-    int size;
-} FibTable;
-
 FibTable create_fib_table(int size) {
     FibTable table;
     table.table = (long long*)malloc(size * sizeof(long long));
@@ -206,6 +202,7 @@ long long fib_optimized(int n, bool print_steps) {
     return curr;
 }
 
+#ifndef DS_LIBRARY_BUILD
 // === 성능 분석 및 비교 ===
 void analyze_performance(int n) {
     clock_t start, end;
@@ -339,6 +336,7 @@ int main(void) {
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 구현 분석 및 교훈
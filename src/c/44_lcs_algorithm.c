@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "dynamic_programming.h"
 
 /*
 최장 공통 부분수열 (LCS: Longest Common Subsequence)
@@ -18,20 +19,6 @@
 - LCS: "ACE" (길이 3)
 */
 
-// === LCS 계산 결과를 저장하는 구조체 ===
-typedef struct {
-    int** length;    // LCS 길이 테이블
-    char** path;     // 경로 추적용 방향 테이블
-    int rows;        // 행 수 (첫 번째 문자열 길이 + 1)
-    int cols;        // 열 수 (두 번째 문자열 길이 + 1)
-} LCSTable;
-
-// === LCS 결과를 저장하는 구조체 ===
-typedef struct {
-    char* sequence;  // 실제 LCS 문자열
-    int length;      // LCS 길이
-} LCSResult;
-
 // === LCS 테이블 생성 ===
 LCSTable* create_lcs_table(int rows, int cols) {
     LCSTable* table = (LCSTable*)malloc(sizeof(LCSTable));
@@ -135,7 +122,7 @@ LCSTable* compute_lcs(const char* str1, const char* str2, bool print_steps) {
 }
 
 // === LCS 추출 (재귀적 방법) ===
-void extract_lcs(LCSTable* table, const char* str1,
+static void extract_lcs(LCSTable* table, const char* str1,
     int i, int j, char* result, int* pos) {
     if (i == 0 || j == 0) return;
 
@@ -209,6 +196,7 @@ void visualize_lcs(const char* str1, const char* str2, LCSResult* result) {
     printf("\n");
 }
 
+#ifndef DS_LIBRARY_BUILD
 int main(void) {
     printf("=== 최장 공통 부분수열(LCS) 계산 프로그램 ===\n");
 
@@ -253,6 +241,7 @@ int main(void) {
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 LCS 알고리즘 분석
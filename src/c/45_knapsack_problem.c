@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include "dynamic_programming.h"
 
 /*
 배낭 문제 (0/1 Knapsack Problem)
@@ -18,28 +19,6 @@
 - 최적해: dp[i][w]
 */
 
-// === 물건 구조체 ===
-typedef struct {
-    int weight;     // 무게
-    int value;      // 가치
-    char* name;     // 물건 이름
-} Item;
-
-// === 배낭 테이블 구조체 ===
-typedef struct {
-    int** table;    // DP 테이블
-    bool** selected; // 선택된 물건 추적
-    int rows;       // 물건 수 + 1
-    int cols;       // 배낭 용량 + 1
-} KnapsackTable;
-
-// === 배낭 결과 구조체 ===
-typedef struct {
-    int maxValue;           // 최대 가치
-    bool* selectedItems;    // 선택된 물건들
-    int numSelected;        // 선택된 물건 수
-} KnapsackResult;
-
 // === 배낭 테이블 생성 ===
 KnapsackTable* create_knapsack_table(int numItems, int capacity) {
     KnapsackTable* table = (KnapsackTable*)malloc(sizeof(KnapsackTable));
@@ -151,6 +130,12 @@ KnapsackResult* solve_knapsack(Item* items, int numItems, int capacity, bool pri
     return result;
 }
 
+// === 배낭 결과 메모리 해제 ===
+void destroy_knapsack_result(KnapsackResult* result) {
+    free(result->selectedItems);
+    free(result);
+}
+
 // === 결과 출력 ===
 void print_knapsack_result(KnapsackResult* result, Item* items, int numItems) {
     printf("\n=== 배낭 문제 해결 결과 ===\n");
@@ -168,6 +153,7 @@ void print_knapsack_result(KnapsackResult* result, Item* items, int numItems) {
     printf("\n총 무게: %d\n", totalWeight);
 }
 
+#ifndef DS_LIBRARY_BUILD
 // === 메인 함수 ===
 int main(void) {
     printf("=== 배낭 문제 해결 프로그램 ===\n");
@@ -204,11 +190,11 @@ int main(void) {
         free(items[i].name);
     }
     free(items);
-    free(result->selectedItems);
-    free(result);
+    destroy_knapsack_result(result);
 
     return 0;
 }
+#endif // DS_LIBRARY_BUILD
 
 /*
 배낭 문제 분석
@@ -0,0 +1,786 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "splay_tree.h"
+
+/* 순회용 명시적 스택 항목 */
+typedef struct {
+    const SplayNode* node;
+    size_t depth;
+} TraversalItem;
+
+/* 필요할 때 2배씩 늘어나는 순회용 스택 */
+typedef struct {
+    TraversalItem* items;
+    size_t count;
+    size_t capacity;
+} TraversalStack;
+
+/* 스택에 항목 추가
+ * - 반환값: 성공 시 true, 메모리 부족 시 false
+ */
+static bool traversal_push(TraversalStack* stack, const SplayNode* node, size_t depth) {
+    if (stack->count == stack->capacity) {
+        size_t new_capacity = stack->capacity ? stack->capacity * 2 : 32;
+        TraversalItem* items = (TraversalItem*)realloc(stack->items, new_capacity * sizeof(TraversalItem));
+        if (items == NULL) {
+            return false;
+        }
+        stack->items = items;
+        stack->capacity = new_capacity;
+    }
+    stack->items[stack->count].node = node;
+    stack->items[stack->count].depth = depth;
+    stack->count++;
+    return true;
+}
+
+/* 서브트리 크기 (빈 서브트리는 0) */
+static size_t node_size(const SplayNode* node) {
+    return node ? node->size : 0;
+}
+
+/* 하향식(top-down) 스플레이
+ * - 루트에서 key를 찾아 한 번만 내려가면서 경로를 왼쪽 트리(key보다 작은 쪽)와
+ *   오른쪽 트리(key보다 큰 쪽)로 떼어 붙이고, 마지막 노드를 새 루트로 조립
+ * - 같은 방향으로 두 번 내려가면(zig-zig) 먼저 회전하여 경로 길이를 절반으로 줄임
+ * - 재귀도 부모 포인터도 없음, 서브트리 크기는 조립 후 왼쪽/오른쪽 트리의 가장자리만 다시 계산
+ * - key가 없으면 탐색 경로의 마지막 노드(key의 이전 또는 다음 값)가 루트가 됨
+ * - 매개변수: t - 서브트리의 루트, key - 찾을 값
+ * - 반환값: 새 루트
+ */
+static SplayNode* splay(SplayNode* t, BstKey key) {
+    SplayNode header;       // header.right: 왼쪽 트리, header.left: 오른쪽 트리
+    SplayNode* l;           // 왼쪽 트리의 가장 오른쪽 노드
+    SplayNode* r;           // 오른쪽 트리의 가장 왼쪽 노드
+    SplayNode* y;
+    size_t l_size = 0;
+    size_t r_size = 0;
+
+    if (t == NULL) {
+        return NULL;
+    }
+    header.left = header.right = NULL;
+    l = r = &header;
+
+    for (;;) {
+        if (key < t->data) {
+            if (t->left == NULL) {
+                break;
+            }
+            if (key < t->left->data) {
+                // zig-zig: 오른쪽 회전
+                y = t->left;
+                t->left = y->right;
+                y->right = t;
+                t->size = node_size(t->left) + node_size(t->right) + 1;
+                t = y;
+                if (t->left == NULL) {
+                    break;
+                }
+            }
+            // t를 오른쪽 트리의 가장 왼쪽에 연결
+            r->left = t;
+            r = t;
+            t = t->left;
+            r_size += node_size(r->right) + 1;
+        }
+        else if (key > t->data) {
+            if (t->right == NULL) {
+                break;
+            }
+            if (key > t->right->data) {
+                // zig-zig: 왼쪽 회전
+                y = t->right;
+                t->right = y->left;
+                y->left = t;
+                t->size = node_size(t->left) + node_size(t->right) + 1;
+                t = y;
+                if (t->right == NULL) {
+                    break;
+                }
+            }
+            // t를 왼쪽 트리의 가장 오른쪽에 연결
+            l->right = t;
+            l = t;
+            t = t->right;
+            l_size += node_size(l->left) + 1;
+        }
+        else {
+            break;
+        }
+    }
+
+    // 새 루트의 양쪽 서브트리가 왼쪽/오른쪽 트리의 끝에 붙으므로 크기에 포함
+    l_size += node_size(t->left);
+    r_size += node_size(t->right);
+    t->size = l_size + r_size + 1;
+
+    // 왼쪽 트리의 오른쪽 가장자리, 오른쪽 트리의 왼쪽 가장자리 노드들의 크기 갱신
+    l->right = r->left = NULL;
+    for (y = header.right; y != NULL; y = y->right) {
+        y->size = l_size;
+        l_size -= node_size(y->left) + 1;
+    }
+    for (y = header.left; y != NULL; y = y->left) {
+        y->size = r_size;
+        r_size -= node_size(y->right) + 1;
+    }
+
+    // 조립
+    l->right = t->left;
+    r->left = t->right;
+    t->left = header.right;
+    t->right = header.left;
+    return t;
+}
+
+/* 새로운 노드 생성
+ * - 매개변수: tree - 대상 트리, data - 저장할 데이터
+ * - 반환값: 생성된 노드의 포인터 또는 실패 시 NULL
+ */
+static SplayNode* node_create(SplayTree* tree, BstKey data) {
+    SplayNode* new_node = (SplayNode*)node_pool_alloc(&tree->pool->nodes);
+    if (new_node == NULL) {
+        return NULL;
+    }
+    new_node->data = data;
+    new_node->size = 1;
+    new_node->left = NULL;
+    new_node->right = NULL;
+    return new_node;
+}
+
+/* 트리 생성
+ * - 노드 풀(NODE_ALLOC_POOL)을 사용하는 빈 스플레이 트리 생성
+ * - 반환값: 생성된 트리의 포인터 또는 실패 시 NULL
+ */
+SplayTree* splay_create(void) {
+    return splay_create_ex(NODE_ALLOC_POOL, 0);
+}
+
+/* 노드 할당 방식을 지정하여 트리 생성
+ * - 매개변수: mode - 노드 할당 방식, nodes_per_slab - 슬랩당 노드 수 (0이면 기본값)
+ * - 반환값: 생성된 트리의 포인터 또는 실패 시 NULL
+ */
+SplayTree* splay_create_ex(NodeAllocMode mode, size_t nodes_per_slab) {
+    SplayTree* tree = (SplayTree*)malloc(sizeof(SplayTree));
+    if (tree == NULL) {
+        return NULL;
+    }
+    tree->pool = (SplayPool*)malloc(sizeof(SplayPool));
+    if (tree->pool == NULL) {
+        free(tree);
+        return NULL;
+    }
+    tree->root = NULL;
+    node_pool_init(&tree->pool->nodes, mode, sizeof(SplayNode), nodes_per_slab);
+    tree->pool->owners = 1;
+    return tree;
+}
+
+/* 트리가 비어있는지 확인
+ * - 매개변수: tree - 검사할 트리
+ * - 반환값: 비어있으면 true, 아니면 false
+ */
+bool splay_is_empty(const SplayTree* tree) {
+    return (tree->root == NULL);
+}
+
+/* 트리의 크기 반환 (루트의 서브트리 크기)
+ * - 매개변수: tree - 대상 트리
+ * - 반환값: 트리의 노드 개수
+ */
+size_t splay_size(const SplayTree* tree) {
+    return node_size(tree->root);
+}
+
+/* 노드 삽입
+ * - data로 스플레이하면 루트가 data의 이전 또는 다음 값이 되므로,
+ *   새 노드를 루트로 만들고 기존 루트를 한쪽 자식으로 내림
+ * - 매개변수: tree - 대상 트리, data - 삽입할 데이터
+ * - 반환값: 성공 시 BST_OK, 이미 있으면 BST_DUPLICATE, 실패 시 BST_MEMORY_ERROR
+ */
+BstResult splay_insert(SplayTree* tree, BstKey data) {
+    SplayNode* root = splay(tree->root, data);
+    tree->root = root;
+    if (root != NULL && root->data == data) {
+        return BST_DUPLICATE;
+    }
+
+    SplayNode* new_node = node_create(tree, data);
+    if (new_node == NULL) {
+        return BST_MEMORY_ERROR;
+    }
+
+    if (root != NULL) {
+        if (data < root->data) {
+            new_node->left = root->left;
+            new_node->right = root;
+            root->left = NULL;
+            root->size = node_size(root->right) + 1;
+        }
+        else {
+            new_node->right = root->right;
+            new_node->left = root;
+            root->right = NULL;
+            root->size = node_size(root->left) + 1;
+        }
+        new_node->size = node_size(new_node->left) + node_size(new_node->right) + 1;
+    }
+    tree->root = new_node;
+    return BST_OK;
+}
+
+/* 노드 삭제
+ * - data를 루트로 끌어올린 뒤 제거하고, 왼쪽 서브트리의 최대값을 스플레이하여
+ *   (오른쪽 자식이 없는 루트가 됨) 오른쪽 서브트리를 붙임
+ * - 매개변수: tree - 대상 트리, data - 삭제할 데이터
+ * - 반환값: 성공 시 BST_OK, 실패 시 에러 코드
+ */
+BstResult splay_delete(SplayTree* tree, BstKey data) {
+    if (splay_is_empty(tree)) {
+        return BST_EMPTY;
+    }
+
+    SplayNode* target = splay(tree->root, data);
+    tree->root = target;
+    if (target->data != data) {
+        return BST_NOT_FOUND;
+    }
+
+    if (target->left == NULL) {
+        tree->root = target->right;
+    }
+    else {
+        SplayNode* root = splay(target->left, data);
+        root->right = target->right;
+        root->size += node_size(target->right);
+        tree->root = root;
+    }
+    node_pool_free(&tree->pool->nodes, target);
+    return BST_OK;
+}
+
+/* 노드 검색
+ * - 찾은 노드(없으면 마지막으로 방문한 노드)를 루트로 끌어올림
+ *   자주 찾는 값일수록 루트 근처에 머물러 다음 검색이 빨라짐
+ * - 매개변수: tree - 대상 트리, data - 검색할 데이터
+ * - 반환값: 성공 시 true, 실패 시 false
+ */
+bool splay_search(SplayTree* tree, BstKey data) {
+    tree->root = splay(tree->root, data);
+    return tree->root != NULL && tree->root->data == data;
+}
+
+/* 최소값 찾기 (최소값 노드를 루트로 끌어올림)
+ * - 매개변수: tree - 대상 트리, value - 결과를 저장할 포인터
+ * - 반환값: 성공 시 BST_OK, 실패 시 에러 코드
+ */
+BstResult splay_find_min(SplayTree* tree, BstKey* value) {
+    if (splay_is_empty(tree)) {
+        return BST_EMPTY;
+    }
+
+    const SplayNode* current = tree->root;
+    while (current->left != NULL) {
+        current = current->left;
+    }
+    tree->root = splay(tree->root, current->data);
+    *value = tree->root->data;
+    return BST_OK;
+}
+
+/* 최대값 찾기 (최대값 노드를 루트로 끌어올림)
+ * - 매개변수: tree - 대상 트리, value - 결과를 저장할 포인터
+ * - 반환값: 성공 시 BST_OK, 실패 시 에러 코드
+ */
+BstResult splay_find_max(SplayTree* tree, BstKey* value) {
+    if (splay_is_empty(tree)) {
+        return BST_EMPTY;
+    }
+
+    const SplayNode* current = tree->root;
+    while (current->right != NULL) {
+        current = current->right;
+    }
+    tree->root = splay(tree->root, current->data);
+    *value = tree->root->data;
+    return BST_OK;
+}
+
+/* 분할
+ * - key로 스플레이한 뒤 루트의 한쪽 서브트리를 떼어냄 (O(log n) 분할 상환)
+ * - tree에는 key 이하의 값이 남고, key보다 큰 값은 새 트리로 이동
+ * - 풀 모드에서는 새 트리가 tree의 노드 풀을 공유함 (참조 횟수 증가, 해제 순서는 자유)
+ * - 매개변수: tree - 분할할 트리, key - 기준 값
+ * - 반환값: key보다 큰 값을 가진 새 트리 또는 실패 시 NULL
+ */
+SplayTree* splay_split(SplayTree* tree, BstKey key) {
+    SplayTree* greater = splay_create_ex(tree->pool->nodes.mode, tree->pool->nodes.nodes_per_slab);
+    if (greater == NULL) {
+        return NULL;
+    }
+    if (tree->pool->nodes.mode == NODE_ALLOC_POOL) {
+        // 노드는 tree의 슬랩에 그대로 있으므로 새로 만든 빈 풀 대신 tree의 풀을 공유
+        free(greater->pool);
+        greater->pool = tree->pool;
+        greater->pool->owners++;
+    }
+    if (splay_is_empty(tree)) {
+        return greater;
+    }
+
+    SplayNode* root = splay(tree->root, key);
+    if (root->data <= key) {
+        greater->root = root->right;
+        root->right = NULL;
+        root->size -= node_size(greater->root);
+        tree->root = root;
+    }
+    else {
+        tree->root = root->left;
+        root->left = NULL;
+        root->size -= node_size(tree->root);
+        greater->root = root;
+    }
+
+    // malloc 모드는 풀이 서로 다르므로 사용 중인 노드 수를 옮김
+    if (greater->pool != tree->pool) {
+        tree->pool->nodes.nodes_in_use -= splay_size(greater);
+        greater->pool->nodes.nodes_in_use += splay_size(greater);
+    }
+    return greater;
+}
+
+/* 병합
+ * - left의 모든 값이 right의 모든 값보다 작아야 함
+ * - left를 right의 최소값으로 스플레이하면 left의 최대값이 오른쪽 자식 없는 루트가 되므로
+ *   그 오른쪽에 right를 통째로 붙임 (O(log n) 분할 상환)
+ * - 성공하면 right는 비게 되고, 해제는 호출자가 함
+ * - 매개변수: left - 결과를 담을 트리, right - 붙일 트리
+ * - 반환값: 성공 시 BST_OK, 순서가 맞지 않거나 노드 풀이 다르면 BST_INVALID_ARGUMENT
+ */
+BstResult splay_join(SplayTree* left, SplayTree* right) {
+    bool same_pool = left->pool == right->pool;
+    if (!same_pool && (left->pool->nodes.mode != NODE_ALLOC_MALLOC || right->pool->nodes.mode != NODE_ALLOC_MALLOC)) {
+        return BST_INVALID_ARGUMENT;   // 서로 다른 풀의 슬랩에 있는 노드는 섞을 수 없음
+    }
+    if (splay_is_empty(right)) {
+        return BST_OK;
+    }
+
+    size_t moved = splay_size(right);
+    if (splay_is_empty(left)) {
+        left->root = right->root;
+    }
+    else {
+        const SplayNode* right_min = right->root;
+        while (right_min->left != NULL) {
+            right_min = right_min->left;
+        }
+        SplayNode* root = splay(left->root, right_min->data);
+        left->root = root;
+        // 루트가 right의 최소값 이상이거나, 루트 오른쪽에 더 큰 값이 남아있으면 순서가 맞지 않음
+        if (root->data >= right_min->data || root->right != NULL) {
+            return BST_INVALID_ARGUMENT;
+        }
+        root->right = right->root;
+        root->size += moved;
+    }
+    right->root = NULL;
+
+    if (!same_pool) {
+        right->pool->nodes.nodes_in_use -= moved;
+        left->pool->nodes.nodes_in_use += moved;
+    }
+    return BST_OK;
+}
+
+/* 트리 높이 (노드 수 기준, 빈 트리는 0)
+ * - 명시적 스택으로 깊이 우선 탐색
+ * - 매개변수: tree - 대상 트리
+ * - 반환값: 가장 깊은 경로의 노드 수 (메모리 부족 시 0)
+ */
+size_t splay_height(const SplayTree* tree) {
+    TraversalStack stack = { NULL, 0, 0 };
+    size_t height = 0;
+
+    if (tree->root != NULL && !traversal_push(&stack, tree->root, 1)) {
+        return 0;
+    }
+    while (stack.count > 0) {
+        TraversalItem item = stack.items[--stack.count];
+        if (item.depth > height) {
+            height = item.depth;
+        }
+        if ((item.node->left != NULL && !traversal_push(&stack, item.node->left, item.depth + 1)) ||
+            (item.node->right != NULL && !traversal_push(&stack, item.node->right, item.depth + 1))) {
+            height = 0;
+            break;
+        }
+    }
+    free(stack.items);
+    return height;
+}
+
+/* 정렬된 순서로 출력 (중위 순회, 트리 모양은 바꾸지 않음)
+ * - 매개변수: tree - 순회할 트리
+ */
+void splay_print_sorted(const SplayTree* tree) {
+    if (splay_is_empty(tree)) {
+        printf("Tree is empty\n");
+        return;
+    }
+
+    TraversalStack stack = { NULL, 0, 0 };
+    const SplayNode* current = tree->root;
+    printf("Sorted elements: ");
+    while (current != NULL || stack.count > 0) {
+        while (current != NULL) {
+            if (!traversal_push(&stack, current, 0)) {
+                printf("\nError: Memory allocation failed\n");
+                free(stack.items);
+                return;
+            }
+            current = current->left;
+        }
+        current = stack.items[--stack.count].node;
+        printf("%d ", current->data);
+        current = current->right;
+    }
+    printf("\n");
+    free(stack.items);
+}
+
+/* 트리 시각화 (전위 순회)
+ * - 매개변수: tree - 출력할 트리
+ */
+void splay_print(const SplayTree* tree) {
+    if (splay_is_empty(tree)) {
+        printf("Tree is empty\n");
+        return;
+    }
+
+    TraversalStack stack = { NULL, 0, 0 };
+    printf("Splay Tree Structure:\n");
+    if (!traversal_push(&stack, tree->root, 0)) {
+        printf("Error: Memory allocation failed\n");
+        return;
+    }
+    while (stack.count > 0) {
+        TraversalItem item = stack.items[--stack.count];
+        for (size_t i = 1; i < item.depth; i++) {
+            printf("│   ");
+        }
+        printf("%s%d (size=%zu)\n", item.depth ? "├── " : "", item.node->data, item.node->size);
+
+        if ((item.node->right != NULL && !traversal_push(&stack, item.node->right, item.depth + 1)) ||
+            (item.node->left != NULL && !traversal_push(&stack, item.node->left, item.depth + 1))) {
+            printf("Error: Memory allocation failed\n");
+            break;
+        }
+    }
+    free(stack.items);
+}
+
+/* 트리 초기화
+ * - 풀을 다른 트리와 공유하지 않으면 슬랩을 한꺼번에 해제
+ * - 그 외에는 오른쪽 회전으로 펴면서 노드를 하나씩 풀에 반환
+ * - 매개변수: tree - 초기화할 트리
+ */
+void splay_clear(SplayTree* tree) {
+    if (tree->pool->owners == 1 && tree->pool->nodes.mode == NODE_ALLOC_POOL) {
+        node_pool_release(&tree->pool->nodes);
+    }
+    else {
+        SplayNode* current = tree->root;
+        while (current != NULL) {
+            if (current->left != NULL) {
+                SplayNode* left = current->left;
+                current->left = left->right;
+                left->right = current;
+                current = left;
+            }
+            else {
+                SplayNode* right = current->right;
+                node_pool_free(&tree->pool->nodes, current);
+                current = right;
+            }
+        }
+    }
+    tree->root = NULL;
+}
+
+/* 트리 메모리 해제
+ * - 노드를 풀에 돌려준 뒤 풀의 참조 횟수를 줄이고, 마지막 트리이면 풀도 해제
+ * - 매개변수: tree - 해제할 트리
+ */
+void splay_destroy(SplayTree* tree) {
+    if (tree != NULL) {
+        splay_clear(tree);
+        if (--tree->pool->owners == 0) {
+            node_pool_release(&tree->pool->nodes);
+            free(tree->pool);
+        }
+        free(tree);
+    }
+}
+
+/* 노드 풀 통계 조회
+ * - 매개변수: tree - 대상 트리, stats - 결과를 저장할 구조체
+ */
+void splay_pool_stats(const SplayTree* tree, NodePoolStats* stats) {
+    node_pool_get_stats(&tree->pool->nodes, stats);
+}
+
+#ifndef DS_LIBRARY_BUILD
+/* 메뉴 출력 함수 */
+void print_menu(void) {
+    printf("\n=== Splay Tree Menu ===\n");
+    printf("1. Insert element\n");
+    printf("2. Delete element\n");
+    printf("3. Search element\n");
+    printf("4. Find minimum\n");
+    printf("5. Find maximum\n");
+    printf("6. Print sorted elements\n");
+    printf("7. Print tree structure\n");
+    printf("8. Get tree size\n");
+    printf("9. Split at key and join back\n");
+    printf("10. Insert sorted sequence\n");
+    printf("0. Exit\n");
+    printf("Choice: ");
+}
+
+/* 에러 메시지 출력 함수 */
+void print_error(BstResult result) {
+    switch (result) {
+    case BST_MEMORY_ERROR:
+        printf("Error: Memory allocation failed\n");
+        break;
+    case BST_EMPTY:
+        printf("Error: Tree is empty\n");
+        break;
+    case BST_NOT_FOUND:
+        printf("Error: Element not found\n");
+        break;
+    case BST_DUPLICATE:
+        printf("Error: Element already exists\n");
+        break;
+    case BST_INVALID_ARGUMENT:
+        printf("Error: Trees cannot be joined\n");
+        break;
+    default:
+        break;
+    }
+}
+
+int main(void) {
+    SplayTree* tree = splay_create();
+    if (tree == NULL) {
+        printf("Failed to create tree\n");
+        return 1;
+    }
+
+    int choice;
+    BstKey value;
+    size_t count;
+    BstResult result;
+    SplayTree* greater;
+
+    do {
+        print_menu();
+        if (scanf("%d", &choice) != 1) {
+            printf("Invalid input\n");
+            while (getchar() != '\n');  // 입력 버퍼 비우기
+            continue;
+        }
+
+        switch (choice) {
+        case 1:  // Insert
+            printf("Enter value to insert: ");
+            scanf("%d", &value);
+            result = splay_insert(tree, value);
+            if (result == BST_OK) {
+                printf("Successfully inserted %d\n", value);
+            }
+            else {
+                print_error(result);
+            }
+            break;
+
+        case 2:  // Delete
+            printf("Enter value to delete: ");
+            scanf("%d", &value);
+            result = splay_delete(tree, value);
+            if (result == BST_OK) {
+                printf("Successfully deleted %d\n", value);
+            }
+            else {
+                print_error(result);
+            }
+            break;
+
+        case 3:  // Search
+            printf("Enter value to search: ");
+            scanf("%d", &value);
+            if (splay_search(tree, value)) {
+                printf("Found %d in the tree (now at root)\n", value);
+            }
+            else {
+                printf("Did not find %d in the tree\n", value);
+            }
+            break;
+
+        case 4:  // Find minimum
+            result = splay_find_min(tree, &value);
+            if (result == BST_OK) {
+                printf("Minimum value: %d\n", value);
+            }
+            else {
+                print_error(result);
+            }
+            break;
+
+        case 5:  // Find maximum
+            result = splay_find_max(tree, &value);
+            if (result == BST_OK) {
+                printf("Maximum value: %d\n", value);
+            }
+            else {
+                print_error(result);
+            }
+            break;
+
+        case 6:  // Print sorted
+            splay_print_sorted(tree);
+            break;
+
+        case 7:  // Print structure
+            splay_print(tree);
+            break;
+
+        case 8:  // Get size
+            printf("Tree size: %zu (height: %zu)\n", splay_size(tree), splay_height(tree));
+            break;
+
+        case 9:  // Split and join
+            printf("Enter split key: ");
+            scanf("%d", &value);
+            greater = splay_split(tree, value);
+            if (greater == NULL) {
+                print_error(BST_MEMORY_ERROR);
+                break;
+            }
+            printf("<= %d: ", value);
+            splay_print_sorted(tree);
+            printf(" > %d: ", value);
+            splay_print_sorted(greater);
+            result = splay_join(tree, greater);
+            if (result == BST_OK) {
+                printf("Joined back, size: %zu\n", splay_size(tree));
+            }
+            else {
+                print_error(result);
+            }
+            splay_destroy(greater);
+            break;
+
+        case 10:  // Insert sorted sequence
+            printf("Enter count: ");
+            scanf("%zu", &count);
+            for (size_t i = 0; i < count; i++) {
+                splay_insert(tree, (BstKey)i);
+            }
+            printf("Tree size: %zu (height: %zu)\n", splay_size(tree), splay_height(tree));
+            break;
+
+        case 0:  // Exit
+            printf("Exiting program\n");
+            break;
+
+        default:
+            printf("Invalid choice\n");
+        }
+    } while (choice != 0);
+
+    splay_destroy(tree);
+    return 0;
+}
+#endif // DS_LIBRARY_BUILD
+
+/*
+==========================================
+상세 설명 및 주요 개념
+==========================================
+
+1. 스플레이 트리의 기본 개념
+----------------------
+- 자가 조정(self-adjusting) 이진 탐색 트리
+- 접근한 노드를 회전으로 루트까지 끌어올림 (스플레이)
+- 균형 정보(높이, 색)를 저장하지 않음
+- 자주 접근하는 값이 루트 근처에 모임
+
+2. 주요 연산과 시간 복잡도
+---------------------
+검색/삽입/삭제/분할/병합:
+- 분할 상환(amortized) O(log n)
+- 한 번의 연산은 최악 O(n) (정렬된 삽입 직후 최소값 검색 등)
+- 접근 빈도가 치우치면 엔트로피 한계에 가까운 비용 (정적 최적성)
+  * 상위 몇 개 키가 대부분인 요청에서는 평균 깊이가 log n 보다 훨씬 작음
+
+3. 하향식(top-down) 스플레이
+-----------------------
+- 상향식: 먼저 내려가서 찾은 뒤 부모를 따라 올라오며 회전 (부모 포인터 또는 스택 필요)
+- 하향식: 내려가면서 경로를 왼쪽 트리(L)와 오른쪽 트리(R)로 떼어 붙임
+  * zig: 현재 노드를 R의 가장 왼쪽(또는 L의 가장 오른쪽)에 연결
+  * zig-zig: 한 번 회전한 뒤 연결
+  * zig-zag: 연결만 두 번 (zig 두 번과 같음)
+- 끝나면 L, 찾은 노드, R을 조립
+- 반복문 한 번, 재귀/스택/부모 포인터 없음
+
+4. 서브트리 크기 유지
+-----------------
+- 분할 후 두 트리의 크기를 O(1)에 알기 위해 노드마다 size 저장
+- 하향식 스플레이 중에는 L/R에 붙인 노드들의 크기가 틀어지므로,
+  조립 직전 L의 오른쪽 가장자리와 R의 왼쪽 가장자리만 다시 계산
+  (내려간 경로 길이에 비례, 스플레이 비용과 같은 차수)
+
+5. 분할과 병합
+-----------
+- split(key): key로 스플레이 → 루트의 오른쪽(또는 루트와 오른쪽) 서브트리를 떼어냄
+- join(L, R): L을 R의 최소값으로 스플레이 → L의 최대값이 오른쪽 자식 없는 루트
+  → 그 오른쪽에 R을 붙임
+- 구간 삭제, 구간 이동 등을 분할/병합 조합으로 구현 가능
+
+6. 메모리 관리 전략
+---------------
+- 노드 풀(node_pool.h), 기본값은 NODE_ALLOC_POOL
+- 풀 모드 분할: 떼어낸 트리가 원래 트리와 풀을 공유함 (SplayPool)
+  * 노드가 다른 풀의 슬랩으로 옮겨갈 수 없기 때문
+  * 풀에 참조 횟수(owners)를 두어 마지막 트리가 해제될 때 슬랩을 반환
+  * 두 트리를 어떤 순서로 해제해도 됨
+  * 풀을 공유하는 동안에는 clear/destroy 가 노드를 하나씩 free list 로 돌려보냄
+- malloc 모드: 서로 독립적인 트리, 사용 중인 노드 수만 옮김
+- 서로 다른 풀 모드 트리끼리의 병합은 BST_INVALID_ARGUMENT
+
+7. 이진 탐색 트리(09) 및 전진이동법(19)과 비교
+-------------------------------------
+- 09 이진 탐색 트리: 검색이 트리를 바꾸지 않음, 삽입 순서에 따라 높이 결정
+- 19 전진이동법: 찾은 값을 배열 맨 앞으로 옮김, 이동 비용 O(위치), 검색 O(n)
+- 스플레이 트리: 찾은 값을 루트로 옮김, 비용 O(깊이), 인기 키가 얕은 곳에 모임
+- 단점: 검색도 쓰기 연산 (여러 스레드가 동시에 읽기만 할 수 없음)
+
+8. 응용 분야
+----------
+- 캐시, 최근 사용 목록
+- 접근이 치우친 심볼 테이블
+- 로프(rope) 등 분할/병합이 잦은 시퀀스
+- 네트워크 라우팅 테이블
+
+9. 교육적 가치
+-----------
+- 분할 상환 분석 (포텐셜 함수)
+- 재귀 없는 트리 재구성
+- 자가 조정 자료구조의 개념
+*/
@@ -0,0 +1,213 @@
+#ifndef HAZARD_POINTER_HPP
+#define HAZARD_POINTER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief 해저드 포인터 기반 안전한 메모리 회수 (Michael, 2004)
+ * lock-free 자료구조에서 다른 스레드가 아직 읽고 있을 수 있는 노드를 바로 해제하지 않고
+ * "회수 대기(retire)" 목록에 넣어 두었다가, 어떤 스레드의 해저드 포인터도 가리키지 않을 때 해제
+ * - 스레드마다 해저드 레코드(보호 슬롯 Slots개)를 하나씩 점유하며, 스레드 종료 시 반납
+ * - 보호 중인 노드는 해제/재사용되지 않으므로 CAS의 ABA 문제도 함께 방지
+ * - 회수 대기 노드가 임계값을 넘으면 전체 해저드 포인터를 모아 한 번에 검사 (상각 O(1))
+ * - 종료하는 스레드의 남은 회수 대기 노드는 도메인이 넘겨받아 다른 스레드가 회수
+ */
+class HazardPointerDomain {
+public:
+    static constexpr size_t Slots = 2;  // 스레드당 동시에 보호할 수 있는 포인터 수
+
+private:
+    // 스레드 하나가 점유하는 해저드 레코드 (한 번 만든 레코드는 도메인 소멸 시까지 재사용)
+    struct alignas(64) Record {
+        std::atomic<const void*> hazards[Slots];
+        std::atomic<bool> active;
+        Record* next;
+
+        Record() : active(true), next(nullptr) {
+            for (auto& hazard : hazards) {
+                hazard.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // 회수 대기 중인 노드와 해제 함수
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+    };
+
+    // 스레드별 상태 (스레드 종료 시 레코드 반납, 남은 노드는 도메인으로 넘김)
+    struct ThreadState {
+        HazardPointerDomain* domain = nullptr;
+        Record* record = nullptr;
+        std::vector<Retired> retired;
+
+        ~ThreadState() {
+            if (domain) {
+                domain->scan(*this);
+                domain->orphan(*this);
+                for (auto& hazard : record->hazards) {
+                    hazard.store(nullptr, std::memory_order_relaxed);
+                }
+                record->active.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    std::atomic<Record*> records_{nullptr};     // 모든 해저드 레코드 목록
+    std::atomic<size_t> record_count_{0};       // 레코드 수 (회수 임계값 계산용)
+    std::mutex orphan_mutex_;                   // 종료된 스레드가 남긴 노드 보호
+    std::vector<Retired> orphans_;
+    std::atomic<bool> has_orphans_{false};
+
+    // 비활성 레코드를 재사용하거나 새 레코드를 만들어 점유
+    Record* acquire_record() {
+        for (Record* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+            bool expected = false;
+            if (!record->active.load(std::memory_order_relaxed) &&
+                record->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return record;
+            }
+        }
+
+        Record* record = new Record();
+        Record* head = records_.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!records_.compare_exchange_weak(head, record,
+                                                 std::memory_order_release, std::memory_order_relaxed));
+        record_count_.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    ThreadState& state() {
+        thread_local ThreadState state;
+        if (!state.domain) {
+            state.record = acquire_record();
+            state.domain = this;
+        }
+        return state;
+    }
+
+    // 회수 대기 노드 중 어떤 해저드 포인터도 가리키지 않는 노드를 해제
+    void scan(ThreadState& state) {
+        if (has_orphans_.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(orphan_mutex_);
+            state.retired.insert(state.retired.end(), orphans_.begin(), orphans_.end());
+            orphans_.clear();
+            has_orphans_.store(false, std::memory_order_relaxed);
+        }
+
+        // 노드를 retire 목록에 넣은 뒤의 해저드 포인터를 읽도록 보장
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::vector<const void*> protected_pointers;
+        for (Record* record = records_.load(std::memory_order_acquire); record; record = record->next) {
+            for (auto& hazard : record->hazards) {
+                const void* pointer = hazard.load(std::memory_order_acquire);
+                if (pointer) {
+                    protected_pointers.push_back(pointer);
+                }
+            }
+        }
+        std::sort(protected_pointers.begin(), protected_pointers.end());
+
+        size_t kept = 0;
+        for (Retired& node : state.retired) {
+            if (std::binary_search(protected_pointers.begin(), protected_pointers.end(),
+                                   static_cast<const void*>(node.pointer))) {
+                state.retired[kept++] = node;
+            } else {
+                node.deleter(node.pointer);
+            }
+        }
+        state.retired.resize(kept);
+    }
+
+    // 종료하는 스레드가 아직 해제하지 못한 노드를 도메인에 맡김
+    void orphan(ThreadState& state) {
+        if (state.retired.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(orphan_mutex_);
+        orphans_.insert(orphans_.end(), state.retired.begin(), state.retired.end());
+        state.retired.clear();
+        has_orphans_.store(true, std::memory_order_relaxed);
+    }
+
+    // 스레드별 상태가 도메인 하나에 묶이므로 전역 도메인(global())만 생성 가능
+    HazardPointerDomain() = default;
+
+public:
+    HazardPointerDomain(const HazardPointerDomain&) = delete;
+    HazardPointerDomain& operator=(const HazardPointerDomain&) = delete;
+
+    // 프로그램 종료 시 (모든 스레드 종료 후) 남은 노드와 레코드 해제
+    ~HazardPointerDomain() {
+        for (Retired& node : orphans_) {
+            node.deleter(node.pointer);
+        }
+        Record* record = records_.load(std::memory_order_relaxed);
+        while (record) {
+            Record* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    // 모든 lock-free 컨테이너가 공유하는 전역 도메인
+    static HazardPointerDomain& global() {
+        static HazardPointerDomain domain;
+        return domain;
+    }
+
+    /**
+     * @brief source가 가리키는 노드를 slot에 보호한 뒤 반환
+     * 보호를 게시한 후에도 source가 같은 값이면, 그 노드는 clear() 전까지 해제되지 않음
+     */
+    template<typename Node>
+    Node* protect(const std::atomic<Node*>& source, size_t slot = 0) {
+        auto& hazard = state().record->hazards[slot];
+        Node* pointer = source.load(std::memory_order_relaxed);
+        for (;;) {
+            hazard.store(pointer, std::memory_order_seq_cst);
+            Node* current = source.load(std::memory_order_acquire);
+            if (current == pointer) {
+                return pointer;
+            }
+            pointer = current;
+        }
+    }
+
+    // 이미 소유한(아직 공개하지 않은) 노드를 slot에 보호
+    // 노드를 다른 스레드에 넘긴 뒤에도 clear() 전까지 해제/재사용되지 않게 할 때 사용
+    void publish(const void* pointer, size_t slot = 0) {
+        state().record->hazards[slot].store(pointer, std::memory_order_seq_cst);
+    }
+
+    // slot의 보호 해제
+    void clear(size_t slot = 0) {
+        state().record->hazards[slot].store(nullptr, std::memory_order_release);
+    }
+
+    /**
+     * @brief 더 이상 자료구조에서 도달할 수 없는 노드를 회수 대기 목록에 추가
+     * 아무도 보호하지 않게 되면 deleter로 해제 (호출 스레드의 다음 scan 시점)
+     */
+    template<typename Node>
+    void retire(Node* node) {
+        ThreadState& current = state();
+        current.retired.push_back({ node, [](void* pointer) { delete static_cast<Node*>(pointer); } });
+
+        size_t threshold = 2 * Slots * record_count_.load(std::memory_order_relaxed) + 64;
+        if (current.retired.size() >= threshold) {
+            scan(current);
+        }
+    }
+};
+
+#endif // HAZARD_POINTER_HPP
@@ -0,0 +1,220 @@
+#ifndef SLAB_ALLOCATOR_HPP
+#define SLAB_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 고정 크기 블록 슬랩 풀
+ * 연속된 청크(chunk)를 미리 할당해 두고 같은 크기의 블록을 잘라서 나누어 줌
+ * - 블록 크기는 첫 단일 객체 할당 요청 시 결정
+ * - 반환된 블록은 자유 리스트(free list)로 재사용
+ * - release()는 개별 블록을 순회하지 않고 청크 단위로 반환 (O(청크 수))
+ */
+class SlabPool {
+private:
+    // 반환된 블록을 연결하는 자유 리스트 노드 (블록 내부에 겹쳐서 저장)
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // 각 청크의 앞부분에 위치하는 헤더 (청크 간 연결)
+    struct ChunkHeader {
+        ChunkHeader* next;
+    };
+
+    static constexpr size_t HEADER_SIZE =
+        (sizeof(ChunkHeader) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    size_t blocks_per_chunk_;   // 청크 하나에 들어가는 블록 수
+    size_t block_size_;         // 블록 크기 (0이면 아직 결정되지 않음)
+    size_t block_align_;        // 블록 정렬
+    ChunkHeader* chunks_;       // 할당된 청크 목록
+    FreeBlock* free_list_;      // 재사용 가능한 블록 목록
+    char* bump_;                // 현재 청크에서 다음에 나누어 줄 위치
+    char* bump_end_;            // 현재 청크의 끝
+    size_t chunk_count_;        // 할당된 청크 수
+    size_t in_use_;             // 사용 중인 블록 수
+
+    // 새 청크를 할당하여 bump 영역으로 설정
+    void add_chunk() {
+        const size_t bytes = HEADER_SIZE + block_size_ * blocks_per_chunk_;
+        auto* chunk = static_cast<ChunkHeader*>(::operator new(bytes));
+        chunk->next = chunks_;
+        chunks_ = chunk;
+        bump_ = reinterpret_cast<char*>(chunk) + HEADER_SIZE;
+        bump_end_ = reinterpret_cast<char*>(chunk) + bytes;
+        ++chunk_count_;
+    }
+
+public:
+    explicit SlabPool(size_t blocks_per_chunk)
+        : blocks_per_chunk_(blocks_per_chunk > 0 ? blocks_per_chunk : 1),
+          block_size_(0), block_align_(0), chunks_(nullptr), free_list_(nullptr),
+          bump_(nullptr), bump_end_(nullptr), chunk_count_(0), in_use_(0) {}
+
+    ~SlabPool() {
+        release();
+    }
+
+    // 복사 생성자와 대입 연산자 삭제
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    /**
+     * @brief 요청 크기를 이 풀에서 처리할 수 있는지 확인
+     * 블록 크기가 아직 정해지지 않았으면 이 요청의 크기로 고정
+     * 기본 new 정렬보다 큰 정렬이 필요한 타입은 처리하지 않음
+     */
+    bool matches(size_t size, size_t align) {
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return false;
+        }
+        if (block_size_ == 0) {
+            size_t block = size < sizeof(FreeBlock) ? sizeof(FreeBlock) : size;
+            size_t block_align = align < alignof(FreeBlock) ? alignof(FreeBlock) : align;
+            block_size_ = (block + block_align - 1) / block_align * block_align;
+            block_align_ = block_align;
+            return true;
+        }
+        return size <= block_size_ && align <= block_align_;
+    }
+
+    // 블록 하나 할당 (자유 리스트 → 현재 청크 → 새 청크 순서)
+    void* allocate() {
+        void* block;
+        if (free_list_) {
+            block = free_list_;
+            free_list_ = free_list_->next;
+        } else {
+            if (bump_ == bump_end_) {
+                add_chunk();
+            }
+            block = bump_;
+            bump_ += block_size_;
+        }
+        ++in_use_;
+        return block;
+    }
+
+    // 블록 하나 반환 (자유 리스트에 추가)
+    void deallocate(void* block) noexcept {
+        auto* free_block = static_cast<FreeBlock*>(block);
+        free_block->next = free_list_;
+        free_list_ = free_block;
+        --in_use_;
+    }
+
+    // 모든 청크를 한꺼번에 반환 (블록에 남아 있는 객체의 소멸자는 호출되지 않음)
+    void release() noexcept {
+        while (chunks_) {
+            ChunkHeader* next = chunks_->next;
+            ::operator delete(chunks_);
+            chunks_ = next;
+        }
+        free_list_ = nullptr;
+        bump_ = bump_end_ = nullptr;
+        chunk_count_ = 0;
+        in_use_ = 0;
+    }
+
+    [[nodiscard]] size_t chunk_count() const { return chunk_count_; }
+    [[nodiscard]] size_t blocks_in_use() const { return in_use_; }
+    [[nodiscard]] size_t block_size() const { return block_size_; }
+    [[nodiscard]] size_t blocks_per_chunk() const { return blocks_per_chunk_; }
+};
+
+/**
+ * @brief SlabPool 기반 표준 할당자
+ * 연결 리스트처럼 노드를 하나씩 할당하는 컨테이너용
+ * - 단일 객체 할당은 슬랩 풀에서, 배열 할당은 기본 operator new 로 처리
+ * - rebind 된 복사본은 같은 풀을 공유
+ * - 복사 생성되는 컨테이너에는 새 풀을 만들어 줌
+ */
+template<typename T, size_t BlocksPerChunk = 256>
+class SlabAllocator {
+private:
+    template<typename, size_t> friend class SlabAllocator;
+
+    std::shared_ptr<SlabPool> pool_;
+
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template<typename U>
+    struct rebind {
+        using other = SlabAllocator<U, BlocksPerChunk>;
+    };
+
+    SlabAllocator() : pool_(std::make_shared<SlabPool>(BlocksPerChunk)) {}
+
+    // 이동도 복사로 처리하여 이동된 쪽 컨테이너가 계속 같은 풀을 사용할 수 있게 함
+    SlabAllocator(const SlabAllocator&) noexcept = default;
+    SlabAllocator& operator=(const SlabAllocator&) noexcept = default;
+
+    template<typename U>
+    SlabAllocator(const SlabAllocator<U, BlocksPerChunk>& other) noexcept : pool_(other.pool_) {}
+
+    T* allocate(size_t n) {
+        if (n == 1 && pool_->matches(sizeof(T), alignof(T))) {
+            return static_cast<T*>(pool_->allocate());
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (n == 1 && pool_->matches(sizeof(T), alignof(T))) {
+            pool_->deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    SlabAllocator select_on_container_copy_construction() const {
+        return SlabAllocator();
+    }
+
+    /**
+     * @brief 풀을 이 할당자만 사용하고 있을 때 모든 청크를 한꺼번에 반환
+     * 다른 컨테이너나 할당자 복사본과 풀을 공유 중이면 아무것도 하지 않음
+     * @return 반환했으면 true
+     */
+    bool try_release() noexcept {
+        if (pool_.use_count() != 1) {
+            return false;
+        }
+        pool_->release();
+        return true;
+    }
+
+    [[nodiscard]] const SlabPool& pool() const { return *pool_; }
+
+    template<typename U>
+    bool operator==(const SlabAllocator<U, BlocksPerChunk>& other) const noexcept {
+        return pool_ == other.pool_;
+    }
+
+    template<typename U>
+    bool operator!=(const SlabAllocator<U, BlocksPerChunk>& other) const noexcept {
+        return pool_ != other.pool_;
+    }
+};
+
+/**
+ * @brief 할당자가 일괄 반환(try_release)을 지원하는지 검사하는 트레이트
+ * 지원하고 노드가 자명하게 소멸 가능하면 컨테이너는 노드 순회 없이 메모리를 반환할 수 있음
+ */
+template<typename Alloc, typename = void>
+struct supports_bulk_release : std::false_type {};
+
+template<typename Alloc>
+struct supports_bulk_release<Alloc, std::void_t<decltype(std::declval<Alloc&>().try_release())>>
+    : std::true_type {};
+
+#endif // SLAB_ALLOCATOR_HPP
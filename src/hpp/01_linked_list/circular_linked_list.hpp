@@ -2,46 +2,246 @@
 #define CIRCULAR_LINKED_LIST_HPP
 
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include "i_linked_list.hpp"
+#include "slab_allocator.hpp"
 
 /**
  * @brief 원형 연결 리스트 구현 클래스
  * 마지막 노드가 첫 번째 노드를 가리키는 순환 구조의 연결 리스트
+ * @tparam Alloc 노드 할당에 사용할 할당자 (std::allocator, std::pmr::polymorphic_allocator, SlabAllocator 등)
  */
-template<typename T>
-class CircularLinkedList : public ILinkedList<T> {
+template<typename T, typename Alloc = std::allocator<T>>
+class CircularLinkedList final : public ILinkedList<T> {
 private:
     // 원형 연결 리스트의 노드 구조체
     struct Node {
-        T data;                      // 노드에 저장될 데이터
-        std::unique_ptr<Node> next;  // 다음 노드를 가리키는 포인터
-        Node* prev;                  // 이전 노드를 가리키는 포인터
-        
-        // 새로운 노드 생성 시 데이터 초기화
-        explicit Node(const T& value) 
-            : data(value), next(nullptr), prev(nullptr) {}
+        T data;      // 노드에 저장될 데이터
+        Node* next;  // 다음 노드를 가리키는 포인터
+        Node* prev;  // 이전 노드를 가리키는 포인터
+
+        // 새로운 노드 생성 시 인자로 데이터를 제자리 생성
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    NodeAllocator alloc_;  // 노드 할당자
+    Node* head_;           // 리스트의 첫 번째 노드
+    Node* tail_;           // 리스트의 마지막 노드 (tail_->next == head_)
+    size_t size_;          // 리스트의 크기
+
+    // 할당자를 통해 노드 생성
+    template<typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* node = NodeTraits::allocate(alloc_, 1);
+        try {
+            NodeTraits::construct(alloc_, node, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    // 할당자를 통해 노드 해제
+    void destroy_node(Node* node) noexcept {
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+
+    // 모든 노드 해제
+    // 슬랩 풀을 단독으로 사용하고 소멸자 호출이 필요 없으면 청크 단위로 한꺼번에 반환
+    void destroy_all() noexcept {
+        if constexpr (supports_bulk_release<NodeAllocator>::value &&
+                      std::is_trivially_destructible_v<Node>) {
+            if (alloc_.try_release()) {
+                head_ = tail_ = nullptr;
+                size_ = 0;
+                return;
+            }
+        }
+
+        if (tail_) {
+            tail_->next = nullptr;  // 순환을 끊고 앞에서부터 해제
+        }
+        while (head_) {
+            Node* next = head_->next;
+            destroy_node(head_);
+            head_ = next;
+        }
+        tail_ = nullptr;
+        size_ = 0;
+    }
+
+    // 다른 리스트의 노드를 그대로 넘겨받음
+    void steal(CircularLinkedList& other) noexcept {
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    // prev와 next 사이에 새 노드 연결 (비어 있지 않은 리스트 전용)
+    void link_between(Node* new_node, Node* prev, Node* next) noexcept {
+        new_node->prev = prev;
+        new_node->next = next;
+        prev->next = new_node;
+        next->prev = new_node;
+    }
+
+    // 노드를 원형 연결에서 분리 (노드는 해제하지 않음)
+    void unlink(Node* node) noexcept {
+        if (size_ == 1) {
+            head_ = tail_ = nullptr;
+            return;
+        }
+        if (node == head_) {
+            head_ = node->next;
+        }
+        if (node == tail_) {
+            tail_ = node->prev;
+        }
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    // 지정된 위치의 노드 탐색 (index < size_)
+    Node* node_at(size_t index) const {
+        Node* current = head_;
+        for (size_t i = 0; i < index; ++i) {
+            current = current->next;
+        }
+        return current;
+    }
+
+    /**
+     * @brief 양방향 반복자
+     * 원형 구조를 한 바퀴만 순회하도록 tail 다음을 end()(nullptr)로 취급
+     * @tparam IsConst true면 const_iterator
+     */
+    template<bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : node_(nullptr), list_(nullptr) {}
+
+        // iterator → const_iterator 변환
+        template<bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : node_(other.node_), list_(other.list_) {}
+
+        reference operator*() const { return node_->data; }
+        pointer operator->() const { return &node_->data; }
+
+        Iterator& operator++() {
+            node_ = (node_ == list_->tail_) ? nullptr : node_->next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        Iterator& operator--() {
+            node_ = node_ ? node_->prev : list_->tail_;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.node_ == b.node_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.node_ != b.node_; }
+
+    private:
+        friend class CircularLinkedList;
+        template<bool> friend class Iterator;
+
+        Iterator(Node* node, const CircularLinkedList* list) : node_(node), list_(list) {}
+
+        Node* node_;                      // 현재 노드 (end()면 nullptr)
+        const CircularLinkedList* list_;  // 한 바퀴의 끝(tail) 판별용 소속 리스트
     };
-    
-    std::unique_ptr<Node> head_;  // 리스트의 첫 번째 노드
-    Node* tail_;                  // 리스트의 마지막 노드
-    size_t size_;                // 리스트의 크기
 
 public:
+    using allocator_type = Alloc;
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
     // 빈 리스트 생성
-    CircularLinkedList() : head_(nullptr), tail_(nullptr), size_(0) {}
+    CircularLinkedList() : CircularLinkedList(Alloc()) {}
+
+    // 지정한 할당자를 사용하는 빈 리스트 생성
+    explicit CircularLinkedList(const Alloc& alloc)
+        : alloc_(alloc), head_(nullptr), tail_(nullptr), size_(0) {}
 
     // 가상 소멸자
-    ~CircularLinkedList() override = default;
+    ~CircularLinkedList() override {
+        destroy_all();
+    }
 
     // 복사 생성자와 대입 연산자 삭제
     CircularLinkedList(const CircularLinkedList&) = delete;
     CircularLinkedList& operator=(const CircularLinkedList&) = delete;
 
-    // 이동 생성자와 이동 대입 연산자 기본 구현 사용
-    CircularLinkedList(CircularLinkedList&&) = default;
-    CircularLinkedList& operator=(CircularLinkedList&&) = default;
+    // 이동 생성자 (할당자와 노드를 함께 이동)
+    CircularLinkedList(CircularLinkedList&& other) noexcept
+        : alloc_(std::move(other.alloc_)), head_(nullptr), tail_(nullptr), size_(0) {
+        steal(other);
+    }
+
+    // 이동 대입 연산자
+    // 할당자가 전파되지 않고 서로 다르면 (pmr 등) 원소 단위로 옮김
+    CircularLinkedList& operator=(CircularLinkedList&& other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        destroy_all();
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+            steal(other);
+        } else if (alloc_ == other.alloc_) {
+            steal(other);
+        } else {
+            Node* current = other.head_;
+            for (size_t i = 0; i < other.size_; ++i) {
+                push_back(std::move(current->data));
+                current = current->next;
+            }
+            other.destroy_all();
+        }
+        return *this;
+    }
+
+    // 노드 할당에 사용하는 할당자 반환
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator_type(alloc_);
+    }
 
     // 리스트가 비어있는지 확인
     [[nodiscard]] bool empty() const override {
@@ -53,43 +253,50 @@ public:
         return size_;
     }
 
-    // 리스트의 맨 앞에 노드 추가
-    void push_front(const T& value) override {
-        auto new_node = std::make_unique<Node>(value);
-        Node* new_node_ptr = new_node.get();
-        
+    // 리스트의 맨 앞에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        emplace_back(std::forward<Args>(args)...);
+        // 원형 구조이므로 맨 뒤에 추가한 뒤 head를 한 칸 뒤로 돌리면 맨 앞 삽입
+        head_ = tail_;
+        tail_ = tail_->prev;
+        return head_->data;
+    }
+
+    // 리스트의 맨 뒤에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node* new_node = create_node(std::forward<Args>(args)...);
+
         if (empty()) {
-            new_node->prev = new_node_ptr;
-            tail_ = new_node_ptr;
+            new_node->next = new_node;
+            new_node->prev = new_node;
+            head_ = new_node;
         } else {
-            new_node->next = std::move(head_);
-            new_node->prev = tail_;
-            new_node->next->prev = new_node_ptr;
-            tail_->next = std::move(new_node);
+            link_between(new_node, tail_, head_);
         }
-        
-        head_ = std::move(new_node);
+
+        tail_ = new_node;
         ++size_;
+        return new_node->data;
+    }
+
+    // 리스트의 맨 앞에 노드 추가
+    void push_front(const T& value) override {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) override {
+        emplace_front(std::move(value));
     }
 
     // 리스트의 맨 뒤에 노드 추가
     void push_back(const T& value) override {
-        auto new_node = std::make_unique<Node>(value);
-        Node* new_node_ptr = new_node.get();
-        
-        if (empty()) {
-            new_node->prev = new_node_ptr;
-            head_ = std::move(new_node);
-            tail_ = head_.get();
-        } else {
-            new_node->prev = tail_;
-            new_node->next = std::move(head_);
-            head_->prev = new_node_ptr;
-            tail_->next = std::move(new_node);
-            tail_ = new_node_ptr;
-        }
-        
-        ++size_;
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) override {
+        emplace_back(std::move(value));
     }
 
     // 지정된 위치 다음에 노드 삽입
@@ -97,26 +304,29 @@ public:
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
-        
-        if (index == size_ - 1) {
-            push_back(value);
-            return;
+        insert_after(const_iterator(node_at(index), this), value);
+    }
+
+    void insert_after(size_t index, T&& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        insert_after(const_iterator(node_at(index), this), std::move(value));
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void append_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace_back(value);
+            } else {
+                emplace_back(std::move(value));
+            }
         }
-        
-        Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
-        }
-        
-        auto new_node = std::make_unique<Node>(value);
-        Node* new_node_ptr = new_node.get();
-        
-        new_node->prev = current;
-        new_node->next = std::move(current->next);
-        new_node->next->prev = new_node_ptr;
-        current->next = std::move(new_node);
-        
-        ++size_;
     }
 
     // 리스트의 맨 앞 노드 제거
@@ -124,46 +334,35 @@ public:
         if (empty()) {
             throw std::runtime_error("List is empty");
         }
-        
-        if (size_ == 1) {
-            head_ = nullptr;
-            tail_ = nullptr;
-        } else {
-            head_ = std::move(head_->next);
-            head_->prev = tail_;
-            tail_->next = std::move(head_);
-        }
-        
+
+        Node* old_head = head_;
+        unlink(old_head);
+        destroy_node(old_head);
         --size_;
     }
 
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_front_value() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T value = std::move(head_->data);
+        pop_front();
+        return value;
+    }
+
     // 지정된 위치의 노드 제거
     void remove_at(size_t index) override {
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
-        
+
         if (index == 0) {
             pop_front();
             return;
         }
-        
-        Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
-        }
-        
-        if (current == tail_) {
-            tail_ = current->prev;
-            tail_->next = std::move(head_);
-            head_->prev = tail_;
-        } else {
-            Node* prev_node = current->prev;
-            prev_node->next = std::move(current->next);
-            prev_node->next->prev = prev_node;
-        }
-        
-        --size_;
+
+        erase(const_iterator(node_at(index), this));
     }
 
     // 지정된 위치의 노드 데이터 반환
@@ -171,12 +370,8 @@ public:
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
-        
-        Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
-        }
-        return current->data;
+
+        return node_at(index)->data;
     }
 
     // 지정된 위치의 노드 데이터 반환 (상수 버전)
@@ -184,12 +379,178 @@ public:
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
-        
-        const Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
+
+        return node_at(index)->data;
+    }
+
+    // 전체 순회 (head부터 한 바퀴)
+    void for_each(const std::function<void(T&)>& visit) override {
+        Node* current = head_;
+        for (size_t i = 0; i < size_; ++i, current = current->next) {
+            visit(current->data);
+        }
+    }
+
+    void for_each(const std::function<void(const T&)>& visit) const override {
+        const Node* current = head_;
+        for (size_t i = 0; i < size_; ++i, current = current->next) {
+            visit(current->data);
+        }
+    }
+
+    // 모든 요소 제거 (슬랩 풀 단독 사용 시 O(1) 일괄 반환, 그 외에는 반복문으로 해제)
+    void clear() noexcept {
+        destroy_all();
+    }
+
+    // 반복자 (head부터 tail까지 한 바퀴)
+    iterator begin() noexcept { return iterator(head_, this); }
+    iterator end() noexcept { return iterator(nullptr, this); }
+    const_iterator begin() const noexcept { return const_iterator(head_, this); }
+    const_iterator end() const noexcept { return const_iterator(nullptr, this); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // 역방향 반복자
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 맨 앞/맨 뒤 요소 접근 (O(1))
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_->data;
+    }
+
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_->data;
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
         }
-        return current->data;
+        return tail_->data;
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->data;
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 다음에 삽입 (O(1))
+     * @return 새로 삽입된 요소를 가리키는 반복자
+     */
+    iterator insert_after(const_iterator pos, const T& value) {
+        if (!pos.node_) {
+            throw std::out_of_range("Cannot insert after end()");
+        }
+        return emplace(std::next(pos), value);
+    }
+
+    iterator insert_after(const_iterator pos, T&& value) {
+        if (!pos.node_) {
+            throw std::out_of_range("Cannot insert after end()");
+        }
+        return emplace(std::next(pos), std::move(value));
+    }
+
+    // 반복자가 가리키는 노드 앞에 삽입 (O(1), end()면 맨 뒤에 추가)
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 앞에 요소를 제자리 생성 (O(1), end()면 맨 뒤에 추가)
+     * @return 새로 삽입된 요소를 가리키는 반복자
+     */
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if (!pos.node_) {
+            emplace_back(std::forward<Args>(args)...);
+            return iterator(tail_, this);
+        }
+        if (pos.node_ == head_) {
+            emplace_front(std::forward<Args>(args)...);
+            return iterator(head_, this);
+        }
+
+        Node* new_node = create_node(std::forward<Args>(args)...);
+        link_between(new_node, pos.node_->prev, pos.node_);
+        ++size_;
+        return iterator(new_node, this);
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 제거 (O(1))
+     * @return 제거된 요소 다음 위치의 반복자 (tail을 제거했으면 end())
+     */
+    iterator erase(const_iterator pos) {
+        if (!pos.node_) {
+            throw std::out_of_range("Cannot erase end()");
+        }
+
+        Node* target = pos.node_;
+        Node* next = (target == tail_) ? nullptr : target->next;
+        unlink(target);
+        destroy_node(target);
+        --size_;
+        return iterator(next, this);
+    }
+
+    /**
+     * @brief 다른 리스트의 모든 노드를 pos 앞으로 옮김 (end()면 맨 뒤에 연결)
+     * 할당자가 같으면 두 고리를 잘라 이어 붙이므로 O(1), 다르면 요소 단위로 이동
+     */
+    void splice(const_iterator pos, CircularLinkedList& other) {
+        if (this == &other || other.empty()) {
+            return;
+        }
+
+        if (!(alloc_ == other.alloc_)) {
+            Node* current = other.head_;
+            for (size_t i = 0; i < other.size_; ++i, current = current->next) {
+                emplace(pos, std::move(current->data));
+            }
+            other.destroy_all();
+            return;
+        }
+
+        if (empty()) {
+            steal(other);
+            return;
+        }
+
+        // pos 앞 (end()면 tail 다음)에 other의 head..tail 구간을 끼워 넣음
+        Node* next = pos.node_ ? pos.node_ : head_;
+        Node* prev = next->prev;
+        prev->next = other.head_;
+        other.head_->prev = prev;
+        other.tail_->next = next;
+        next->prev = other.tail_;
+
+        if (!pos.node_) {
+            tail_ = other.tail_;
+        } else if (pos.node_ == head_) {
+            head_ = other.head_;
+        }
+
+        size_ += other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
     }
 
     // 리스트의 모든 요소 출력
@@ -198,15 +559,21 @@ public:
             std::cout << "List is empty" << std::endl;
             return;
         }
-        
-        const Node* current = head_.get();
+
+        const Node* current = head_;
         std::cout << "List contents: ";
         do {
             std::cout << current->data << " ";
-            current = current->next.get();
-        } while (current != head_.get());
+            current = current->next;
+        } while (current != head_);
         std::cout << std::endl;
     }
 };
 
-#endif // CIRCULAR_LINKED_LIST_HPP
\ No newline at end of file
+namespace pmr {
+    // std::pmr 메모리 리소스를 사용하는 원형 연결 리스트
+    template<typename T>
+    using CircularLinkedList = ::CircularLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+#endif // CIRCULAR_LINKED_LIST_HPP
@@ -2,46 +2,217 @@
 #define DOUBLE_LINKED_LIST_HPP
 
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include "i_linked_list.hpp"
+#include "slab_allocator.hpp"
 
 /**
  * @brief 이중 연결 리스트 구현 클래스
  * 각 노드가 이전 노드와 다음 노드를 모두 가리키는 양방향 연결 리스트
+ * @tparam Alloc 노드 할당에 사용할 할당자 (std::allocator, std::pmr::polymorphic_allocator, SlabAllocator 등)
  */
-template<typename T>
-class DoubleLinkedList : public ILinkedList<T> {
+template<typename T, typename Alloc = std::allocator<T>>
+class DoubleLinkedList final : public ILinkedList<T> {
 private:
     // 이중 연결 리스트의 노드 구조체
     struct Node {
-        T data;                      // 노드에 저장될 데이터
-        std::unique_ptr<Node> next;  // 다음 노드를 가리키는 포인터
-        Node* prev;                  // 이전 노드를 가리키는 포인터
-
-        // 새로운 노드 생성 시 데이터 초기화
-        explicit Node(const T& value)
-            : data(value), next(nullptr), prev(nullptr) {}
+        T data;      // 노드에 저장될 데이터
+        Node* next;  // 다음 노드를 가리키는 포인터
+        Node* prev;  // 이전 노드를 가리키는 포인터
+
+        // 새로운 노드 생성 시 인자로 데이터를 제자리 생성
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr) {}
     };
 
-    std::unique_ptr<Node> head_;  // 리스트의 첫 번째 노드
-    Node* tail_;                  // 리스트의 마지막 노드
-    size_t size_;                // 리스트의 크기
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    NodeAllocator alloc_;  // 노드 할당자
+    Node* head_;           // 리스트의 첫 번째 노드
+    Node* tail_;           // 리스트의 마지막 노드
+    size_t size_;          // 리스트의 크기
+
+    // 할당자를 통해 노드 생성
+    template<typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* node = NodeTraits::allocate(alloc_, 1);
+        try {
+            NodeTraits::construct(alloc_, node, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    // 할당자를 통해 노드 해제
+    void destroy_node(Node* node) noexcept {
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+
+    // 모든 노드 해제
+    // 슬랩 풀을 단독으로 사용하고 소멸자 호출이 필요 없으면 청크 단위로 한꺼번에 반환
+    void destroy_all() noexcept {
+        if constexpr (supports_bulk_release<NodeAllocator>::value &&
+                      std::is_trivially_destructible_v<Node>) {
+            if (alloc_.try_release()) {
+                head_ = tail_ = nullptr;
+                size_ = 0;
+                return;
+            }
+        }
+
+        while (head_) {
+            Node* next = head_->next;
+            destroy_node(head_);
+            head_ = next;
+        }
+        tail_ = nullptr;
+        size_ = 0;
+    }
+
+    // 다른 리스트의 노드를 그대로 넘겨받음
+    void steal(DoubleLinkedList& other) noexcept {
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    // 지정된 위치의 노드 탐색 (index < size_)
+    Node* node_at(size_t index) const {
+        Node* current = head_;
+        for (size_t i = 0; i < index; ++i) {
+            current = current->next;
+        }
+        return current;
+    }
+
+    /**
+     * @brief 양방향 반복자
+     * end()는 nullptr로 표현하며, --end()가 마지막 노드가 되도록 리스트 포인터를 함께 보관
+     * @tparam IsConst true면 const_iterator
+     */
+    template<bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : node_(nullptr), list_(nullptr) {}
+
+        // iterator → const_iterator 변환
+        template<bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : node_(other.node_), list_(other.list_) {}
+
+        reference operator*() const { return node_->data; }
+        pointer operator->() const { return &node_->data; }
+
+        Iterator& operator++() {
+            node_ = node_->next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            node_ = node_->next;
+            return previous;
+        }
+
+        Iterator& operator--() {
+            node_ = node_ ? node_->prev : list_->tail_;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.node_ == b.node_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.node_ != b.node_; }
+
+    private:
+        friend class DoubleLinkedList;
+        template<bool> friend class Iterator;
+
+        Iterator(Node* node, const DoubleLinkedList* list) : node_(node), list_(list) {}
+
+        Node* node_;                    // 현재 노드 (end()면 nullptr)
+        const DoubleLinkedList* list_;  // --end() 처리를 위한 소속 리스트
+    };
 
 public:
+    using allocator_type = Alloc;
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
     // 빈 리스트 생성
-    DoubleLinkedList() : head_(nullptr), tail_(nullptr), size_(0) {}
+    DoubleLinkedList() : DoubleLinkedList(Alloc()) {}
+
+    // 지정한 할당자를 사용하는 빈 리스트 생성
+    explicit DoubleLinkedList(const Alloc& alloc)
+        : alloc_(alloc), head_(nullptr), tail_(nullptr), size_(0) {}
 
     // 가상 소멸자
-    ~DoubleLinkedList() override = default;
+    ~DoubleLinkedList() override {
+        destroy_all();
+    }
 
     // 복사 생성자와 대입 연산자 삭제
     DoubleLinkedList(const DoubleLinkedList&) = delete;
     DoubleLinkedList& operator=(const DoubleLinkedList&) = delete;
 
-    // 이동 생성자와 이동 대입 연산자 기본 구현 사용
-    DoubleLinkedList(DoubleLinkedList&&) = default;
-    DoubleLinkedList& operator=(DoubleLinkedList&&) = default;
+    // 이동 생성자 (할당자와 노드를 함께 이동)
+    DoubleLinkedList(DoubleLinkedList&& other) noexcept
+        : alloc_(std::move(other.alloc_)), head_(nullptr), tail_(nullptr), size_(0) {
+        steal(other);
+    }
+
+    // 이동 대입 연산자
+    // 할당자가 전파되지 않고 서로 다르면 (pmr 등) 원소 단위로 옮김
+    DoubleLinkedList& operator=(DoubleLinkedList&& other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        destroy_all();
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+            steal(other);
+        } else if (alloc_ == other.alloc_) {
+            steal(other);
+        } else {
+            for (Node* current = other.head_; current; current = current->next) {
+                push_back(std::move(current->data));
+            }
+            other.destroy_all();
+        }
+        return *this;
+    }
+
+    // 노드 할당에 사용하는 할당자 반환
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator_type(alloc_);
+    }
 
     // 리스트가 비어있는지 확인
     [[nodiscard]] bool empty() const override {
@@ -53,37 +224,56 @@ public:
         return size_;
     }
 
-    // 리스트의 맨 앞에 노드 추가
-    void push_front(const T& value) override {
-        auto new_node = std::make_unique<Node>(value);
-        Node* new_node_ptr = new_node.get();
+    // 리스트의 맨 앞에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        Node* new_node = create_node(std::forward<Args>(args)...);
 
         if (empty()) {
-            tail_ = new_node_ptr;
+            tail_ = new_node;
         } else {
-            new_node->next = std::move(head_);
-            new_node->next->prev = new_node_ptr;
+            new_node->next = head_;
+            head_->prev = new_node;
         }
 
-        head_ = std::move(new_node);
+        head_ = new_node;
         ++size_;
+        return new_node->data;
     }
 
-    // 리스트의 맨 뒤에 노드 추가
-    void push_back(const T& value) override {
-        auto new_node = std::make_unique<Node>(value);
-        Node* new_node_ptr = new_node.get();
+    // 리스트의 맨 뒤에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node* new_node = create_node(std::forward<Args>(args)...);
 
         if (empty()) {
-            head_ = std::move(new_node);
-            tail_ = head_.get();
+            head_ = new_node;
         } else {
             new_node->prev = tail_;
-            tail_->next = std::move(new_node);
-            tail_ = new_node_ptr;
+            tail_->next = new_node;
         }
 
+        tail_ = new_node;
         ++size_;
+        return new_node->data;
+    }
+
+    // 리스트의 맨 앞에 노드 추가
+    void push_front(const T& value) override {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) override {
+        emplace_front(std::move(value));
+    }
+
+    // 리스트의 맨 뒤에 노드 추가
+    void push_back(const T& value) override {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) override {
+        emplace_back(std::move(value));
     }
 
     // 지정된 위치 다음에 노드 삽입
@@ -91,24 +281,29 @@ public:
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
+        emplace(const_iterator(node_at(index)->next, this), value);
+    }
 
-        if (index == size_ - 1) {
-            push_back(value);
-            return;
+    void insert_after(size_t index, T&& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
         }
+        emplace(const_iterator(node_at(index)->next, this), std::move(value));
+    }
 
-        Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
+    /**
+     * @brief 범위의 모든 요소를 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void append_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace_back(value);
+            } else {
+                emplace_back(std::move(value));
+            }
         }
-
-        auto new_node = std::make_unique<Node>(value);
-        new_node->prev = current;
-        new_node->next = std::move(current->next);
-        new_node->next->prev = new_node.get();
-        current->next = std::move(new_node);
-
-        ++size_;
     }
 
     // 리스트의 맨 앞 노드 제거
@@ -117,16 +312,28 @@ public:
             throw std::runtime_error("List is empty");
         }
 
-        head_ = std::move(head_->next);
+        Node* old_head = head_;
+        head_ = head_->next;
         if (head_) {
             head_->prev = nullptr;
         } else {
             tail_ = nullptr;
         }
 
+        destroy_node(old_head);
         --size_;
     }
 
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_front_value() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T value = std::move(head_->data);
+        pop_front();
+        return value;
+    }
+
     // 지정된 위치의 노드 제거
     void remove_at(size_t index) override {
         if (index >= size_) {
@@ -138,20 +345,7 @@ public:
             return;
         }
 
-        Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
-        }
-
-        if (current == tail_) {
-            tail_ = current->prev;
-            tail_->next = nullptr;
-        } else {
-            current->next->prev = current->prev;
-            current->prev->next = std::move(current->next);
-        }
-
-        --size_;
+        erase(const_iterator(node_at(index), this));
     }
 
     // 지정된 위치의 노드 데이터 반환
@@ -160,11 +354,7 @@ public:
             throw std::out_of_range("Index out of range");
         }
 
-        Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
-        }
-        return current->data;
+        return node_at(index)->data;
     }
 
     // 지정된 위치의 노드 데이터 반환 (상수 버전)
@@ -173,23 +363,206 @@ public:
             throw std::out_of_range("Index out of range");
         }
 
-        const Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
+        return node_at(index)->data;
+    }
+
+    // 전체 순회
+    void for_each(const std::function<void(T&)>& visit) override {
+        for (Node* current = head_; current; current = current->next) {
+            visit(current->data);
+        }
+    }
+
+    void for_each(const std::function<void(const T&)>& visit) const override {
+        for (const Node* current = head_; current; current = current->next) {
+            visit(current->data);
+        }
+    }
+
+    // 모든 요소 제거 (슬랩 풀 단독 사용 시 O(1) 일괄 반환, 그 외에는 반복문으로 해제)
+    void clear() noexcept {
+        destroy_all();
+    }
+
+    // 반복자
+    iterator begin() noexcept { return iterator(head_, this); }
+    iterator end() noexcept { return iterator(nullptr, this); }
+    const_iterator begin() const noexcept { return const_iterator(head_, this); }
+    const_iterator end() const noexcept { return const_iterator(nullptr, this); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // 역방향 반복자
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 맨 앞/맨 뒤 요소 접근 (O(1))
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_->data;
+    }
+
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_->data;
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->data;
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->data;
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 다음에 삽입 (O(1))
+     * @return 새로 삽입된 요소를 가리키는 반복자
+     */
+    iterator insert_after(const_iterator pos, const T& value) {
+        if (!pos.node_) {
+            throw std::out_of_range("Cannot insert after end()");
+        }
+        return emplace(std::next(pos), value);
+    }
+
+    iterator insert_after(const_iterator pos, T&& value) {
+        if (!pos.node_) {
+            throw std::out_of_range("Cannot insert after end()");
         }
-        return current->data;
+        return emplace(std::next(pos), std::move(value));
+    }
+
+    // 반복자가 가리키는 노드 앞에 삽입 (O(1), end()면 맨 뒤에 추가)
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 앞에 요소를 제자리 생성 (O(1), end()면 맨 뒤에 추가)
+     * @return 새로 삽입된 요소를 가리키는 반복자
+     */
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if (!pos.node_) {
+            emplace_back(std::forward<Args>(args)...);
+            return iterator(tail_, this);
+        }
+        if (pos.node_ == head_) {
+            emplace_front(std::forward<Args>(args)...);
+            return iterator(head_, this);
+        }
+
+        Node* next = pos.node_;
+        Node* new_node = create_node(std::forward<Args>(args)...);
+        new_node->prev = next->prev;
+        new_node->next = next;
+        next->prev->next = new_node;
+        next->prev = new_node;
+        ++size_;
+        return iterator(new_node, this);
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 제거 (O(1))
+     * @return 제거된 요소 다음 위치의 반복자
+     */
+    iterator erase(const_iterator pos) {
+        if (!pos.node_) {
+            throw std::out_of_range("Cannot erase end()");
+        }
+
+        Node* target = pos.node_;
+        Node* next = target->next;
+
+        if (target->prev) {
+            target->prev->next = next;
+        } else {
+            head_ = next;
+        }
+
+        if (next) {
+            next->prev = target->prev;
+        } else {
+            tail_ = target->prev;
+        }
+
+        destroy_node(target);
+        --size_;
+        return iterator(next, this);
+    }
+
+    /**
+     * @brief 다른 리스트의 모든 노드를 pos 앞으로 옮김 (end()면 맨 뒤에 연결)
+     * 할당자가 같으면 노드를 다시 연결만 하므로 O(1), 다르면 요소 단위로 이동
+     */
+    void splice(const_iterator pos, DoubleLinkedList& other) {
+        if (this == &other || other.empty()) {
+            return;
+        }
+
+        if (!(alloc_ == other.alloc_)) {
+            for (Node* current = other.head_; current; current = current->next) {
+                emplace(pos, std::move(current->data));
+            }
+            other.destroy_all();
+            return;
+        }
+
+        Node* next = pos.node_;
+        Node* prev = next ? next->prev : tail_;
+
+        other.head_->prev = prev;
+        if (prev) {
+            prev->next = other.head_;
+        } else {
+            head_ = other.head_;
+        }
+
+        other.tail_->next = next;
+        if (next) {
+            next->prev = other.tail_;
+        } else {
+            tail_ = other.tail_;
+        }
+
+        size_ += other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
     }
 
     // 리스트의 모든 요소 출력
     void print() const override {
-        const Node* current = head_.get();
+        const Node* current = head_;
         std::cout << "List contents: ";
         while (current) {
             std::cout << current->data << " ";
-            current = current->next.get();
+            current = current->next;
         }
         std::cout << std::endl;
     }
 };
 
-#endif // DOUBLE_LINKED_LIST_HPP
\ No newline at end of file
+namespace pmr {
+    // std::pmr 메모리 리소스를 사용하는 이중 연결 리스트
+    template<typename T>
+    using DoubleLinkedList = ::DoubleLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+#endif // DOUBLE_LINKED_LIST_HPP
@@ -2,43 +2,202 @@
 #define SINGLE_LINKED_LIST_HPP
 
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include "i_linked_list.hpp"
+#include "slab_allocator.hpp"
 
 /**
  * @brief 단일 연결 리스트 구현 클래스
  * 각 노드가 다음 노드만을 가리키는 단방향 연결 리스트
+ * @tparam Alloc 노드 할당에 사용할 할당자 (std::allocator, std::pmr::polymorphic_allocator, SlabAllocator 등)
  */
-template<typename T>
-class SingleLinkedList : public ILinkedList<T> {
+template<typename T, typename Alloc = std::allocator<T>>
+class SingleLinkedList final : public ILinkedList<T> {
 private:
     // 단일 연결 리스트의 노드 구조체
     struct Node {
-        T data;                      // 노드에 저장될 데이터
-        std::unique_ptr<Node> next;  // 다음 노드를 가리키는 포인터
+        T data;      // 노드에 저장될 데이터
+        Node* next;  // 다음 노드를 가리키는 포인터
 
-        // 새로운 노드 생성 시 데이터 초기화
-        explicit Node(const T& value) : data(value), next(nullptr) {}
+        // 새로운 노드 생성 시 인자로 데이터를 제자리 생성
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : data(std::forward<Args>(args)...), next(nullptr) {}
     };
 
-    std::unique_ptr<Node> head_;  // 리스트의 첫 번째 노드
-    size_t size_;                 // 리스트의 크기
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    NodeAllocator alloc_;  // 노드 할당자
+    Node* head_;           // 리스트의 첫 번째 노드
+    Node* tail_;           // 리스트의 마지막 노드 (push_back을 O(1)로 유지)
+    size_t size_;          // 리스트의 크기
+
+    // 할당자를 통해 노드 생성
+    template<typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* node = NodeTraits::allocate(alloc_, 1);
+        try {
+            NodeTraits::construct(alloc_, node, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    // 할당자를 통해 노드 해제
+    void destroy_node(Node* node) noexcept {
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+
+    // 모든 노드 해제
+    // 슬랩 풀을 단독으로 사용하고 소멸자 호출이 필요 없으면 청크 단위로 한꺼번에 반환
+    void destroy_all() noexcept {
+        if constexpr (supports_bulk_release<NodeAllocator>::value &&
+                      std::is_trivially_destructible_v<Node>) {
+            if (alloc_.try_release()) {
+                head_ = tail_ = nullptr;
+                size_ = 0;
+                return;
+            }
+        }
+
+        while (head_) {
+            Node* next = head_->next;
+            destroy_node(head_);
+            head_ = next;
+        }
+        tail_ = nullptr;
+        size_ = 0;
+    }
+
+    // 다른 리스트의 노드를 그대로 넘겨받음
+    void steal(SingleLinkedList& other) noexcept {
+        head_ = other.head_;
+        tail_ = other.tail_;
+        size_ = other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    // 지정된 위치의 노드 탐색 (index < size_)
+    Node* node_at(size_t index) const {
+        Node* current = head_;
+        for (size_t i = 0; i < index; ++i) {
+            current = current->next;
+        }
+        return current;
+    }
+
+    /**
+     * @brief 단방향 반복자
+     * 노드 포인터 하나만 가지며, end()는 nullptr로 표현
+     * @tparam IsConst true면 const_iterator
+     */
+    template<bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : node_(nullptr) {}
+
+        // iterator → const_iterator 변환
+        template<bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : node_(other.node_) {}
+
+        reference operator*() const { return node_->data; }
+        pointer operator->() const { return &node_->data; }
+
+        Iterator& operator++() {
+            node_ = node_->next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            node_ = node_->next;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.node_ == b.node_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.node_ != b.node_; }
+
+    private:
+        friend class SingleLinkedList;
+        template<bool> friend class Iterator;
+
+        explicit Iterator(Node* node) : node_(node) {}
+
+        Node* node_;  // 현재 노드 (end()면 nullptr)
+    };
 
 public:
+    using allocator_type = Alloc;
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
     // 빈 리스트 생성
-    SingleLinkedList() : head_(nullptr), size_(0) {}
+    SingleLinkedList() : SingleLinkedList(Alloc()) {}
+
+    // 지정한 할당자를 사용하는 빈 리스트 생성
+    explicit SingleLinkedList(const Alloc& alloc)
+        : alloc_(alloc), head_(nullptr), tail_(nullptr), size_(0) {}
 
     // 가상 소멸자
-    ~SingleLinkedList() override = default;
+    ~SingleLinkedList() override {
+        destroy_all();
+    }
 
     // 복사 생성자와 대입 연산자 삭제
     SingleLinkedList(const SingleLinkedList&) = delete;
     SingleLinkedList& operator=(const SingleLinkedList&) = delete;
 
-    // 이동 생성자와 이동 대입 연산자 기본 구현 사용
-    SingleLinkedList(SingleLinkedList&&) = default;
-    SingleLinkedList& operator=(SingleLinkedList&&) = default;
+    // 이동 생성자 (할당자와 노드를 함께 이동)
+    SingleLinkedList(SingleLinkedList&& other) noexcept
+        : alloc_(std::move(other.alloc_)), head_(nullptr), tail_(nullptr), size_(0) {
+        steal(other);
+    }
+
+    // 이동 대입 연산자
+    // 할당자가 전파되지 않고 서로 다르면 (pmr 등) 원소 단위로 옮김
+    SingleLinkedList& operator=(SingleLinkedList&& other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        destroy_all();
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+            steal(other);
+        } else if (alloc_ == other.alloc_) {
+            steal(other);
+        } else {
+            for (Node* current = other.head_; current; current = current->next) {
+                push_back(std::move(current->data));
+            }
+            other.destroy_all();
+        }
+        return *this;
+    }
+
+    // 노드 할당에 사용하는 할당자 반환
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator_type(alloc_);
+    }
 
     // 리스트가 비어있는지 확인
     [[nodiscard]] bool empty() const override {
@@ -50,28 +209,50 @@ public:
         return size_;
     }
 
-    // 리스트의 맨 앞에 노드 추가
-    void push_front(const T& value) override {
-        auto new_node = std::make_unique<Node>(value);
-        new_node->next = std::move(head_);
-        head_ = std::move(new_node);
+    // 리스트의 맨 앞에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        Node* new_node = create_node(std::forward<Args>(args)...);
+        new_node->next = head_;
+        head_ = new_node;
+        if (!tail_) {
+            tail_ = new_node;
+        }
         ++size_;
+        return new_node->data;
     }
 
-    // 리스트의 맨 뒤에 노드 추가
-    void push_back(const T& value) override {
-        auto new_node = std::make_unique<Node>(value);
+    // 리스트의 맨 뒤에 요소를 제자리 생성 (tail 포인터로 O(1))
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node* new_node = create_node(std::forward<Args>(args)...);
 
         if (!head_) {
-            head_ = std::move(new_node);
+            head_ = new_node;
         } else {
-            Node* current = head_.get();
-            while (current->next) {
-                current = current->next.get();
-            }
-            current->next = std::move(new_node);
+            tail_->next = new_node;
         }
+        tail_ = new_node;
         ++size_;
+        return new_node->data;
+    }
+
+    // 리스트의 맨 앞에 노드 추가
+    void push_front(const T& value) override {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) override {
+        emplace_front(std::move(value));
+    }
+
+    // 리스트의 맨 뒤에 노드 추가
+    void push_back(const T& value) override {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) override {
+        emplace_back(std::move(value));
     }
 
     // 지정된 위치 다음에 노드 삽입
@@ -79,16 +260,29 @@ public:
         if (index >= size_) {
             throw std::out_of_range("Index out of range");
         }
+        emplace_after(const_iterator(node_at(index)), value);
+    }
 
-        Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
+    void insert_after(size_t index, T&& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
         }
+        emplace_after(const_iterator(node_at(index)), std::move(value));
+    }
 
-        auto new_node = std::make_unique<Node>(value);
-        new_node->next = std::move(current->next);
-        current->next = std::move(new_node);
-        ++size_;
+    /**
+     * @brief 범위의 모든 요소를 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void append_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace_back(value);
+            } else {
+                emplace_back(std::move(value));
+            }
+        }
     }
 
     // 리스트의 맨 앞 노드 제거
@@ -96,10 +290,25 @@ public:
         if (empty()) {
             throw std::runtime_error("List is empty");
         }
-        head_ = std::move(head_->next);
+        Node* old_head = head_;
+        head_ = head_->next;
+        if (!head_) {
+            tail_ = nullptr;
+        }
+        destroy_node(old_head);
         --size_;
     }
 
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_front_value() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T value = std::move(head_->data);
+        pop_front();
+        return value;
+    }
+
     // 지정된 위치의 노드 제거
     void remove_at(size_t index) override {
         if (index >= size_) {
@@ -107,15 +316,11 @@ public:
         }
 
         if (index == 0) {
-            head_ = std::move(head_->next);
-        } else {
-            Node* current = head_.get();
-            for (size_t i = 0; i < index - 1; ++i) {
-                current = current->next.get();
-            }
-            current->next = std::move(current->next->next);
+            pop_front();
+            return;
         }
-        --size_;
+
+        erase_after(const_iterator(node_at(index - 1)));
     }
 
     // 지정된 위치의 노드 데이터 반환
@@ -124,11 +329,7 @@ public:
             throw std::out_of_range("Index out of range");
         }
 
-        Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
-        }
-        return current->data;
+        return node_at(index)->data;
     }
 
     // 지정된 위치의 노드 데이터 반환 (const(상수) 버전)
@@ -137,23 +338,166 @@ public:
             throw std::out_of_range("Index out of range");
         }
 
-        const Node* current = head_.get();
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next.get();
+        return node_at(index)->data;
+    }
+
+    // 전체 순회
+    void for_each(const std::function<void(T&)>& visit) override {
+        for (Node* current = head_; current; current = current->next) {
+            visit(current->data);
         }
-        return current->data;
+    }
+
+    void for_each(const std::function<void(const T&)>& visit) const override {
+        for (const Node* current = head_; current; current = current->next) {
+            visit(current->data);
+        }
+    }
+
+    // 모든 요소 제거 (슬랩 풀 단독 사용 시 O(1) 일괄 반환, 그 외에는 반복문으로 해제)
+    void clear() noexcept {
+        destroy_all();
+    }
+
+    // 반복자
+    iterator begin() noexcept { return iterator(head_); }
+    iterator end() noexcept { return iterator(nullptr); }
+    const_iterator begin() const noexcept { return const_iterator(head_); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // 맨 앞/맨 뒤 요소 접근 (O(1))
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_->data;
+    }
+
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_->data;
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->data;
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->data;
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 다음에 요소를 제자리 생성 (O(1))
+     * @return 새로 삽입된 요소를 가리키는 반복자
+     */
+    template<typename... Args>
+    iterator emplace_after(const_iterator pos, Args&&... args) {
+        if (!pos.node_) {
+            throw std::out_of_range("Cannot insert after end()");
+        }
+
+        Node* new_node = create_node(std::forward<Args>(args)...);
+        new_node->next = pos.node_->next;
+        pos.node_->next = new_node;
+        if (pos.node_ == tail_) {
+            tail_ = new_node;
+        }
+        ++size_;
+        return iterator(new_node);
+    }
+
+    // 반복자가 가리키는 노드 다음에 삽입 (O(1))
+    iterator insert_after(const_iterator pos, const T& value) {
+        return emplace_after(pos, value);
+    }
+
+    iterator insert_after(const_iterator pos, T&& value) {
+        return emplace_after(pos, std::move(value));
+    }
+
+    /**
+     * @brief 다른 리스트의 모든 노드를 pos 다음으로 옮김 (end()면 맨 뒤에 연결)
+     * 할당자가 같으면 노드를 다시 연결만 하므로 O(1), 다르면 요소 단위로 이동
+     */
+    void splice_after(const_iterator pos, SingleLinkedList& other) {
+        if (this == &other || other.empty()) {
+            return;
+        }
+
+        if (!(alloc_ == other.alloc_)) {
+            for (Node* current = other.head_; current; current = current->next) {
+                if (pos.node_) {
+                    pos = emplace_after(pos, std::move(current->data));
+                } else {
+                    emplace_back(std::move(current->data));
+                }
+            }
+            other.destroy_all();
+            return;
+        }
+
+        Node* after = pos.node_ ? pos.node_ : tail_;
+        if (!after) {
+            head_ = other.head_;
+            tail_ = other.tail_;
+        } else {
+            other.tail_->next = after->next;
+            after->next = other.head_;
+            if (after == tail_) {
+                tail_ = other.tail_;
+            }
+        }
+        size_ += other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드의 다음 노드를 제거 (O(1))
+     * 단방향 리스트는 이전 노드를 알 수 없으므로 erase 대신 erase_after를 제공
+     * @return 제거된 요소 다음 위치의 반복자
+     */
+    iterator erase_after(const_iterator pos) {
+        if (!pos.node_ || !pos.node_->next) {
+            throw std::out_of_range("No element after position");
+        }
+
+        Node* target = pos.node_->next;
+        pos.node_->next = target->next;
+        if (target == tail_) {
+            tail_ = pos.node_;
+        }
+        destroy_node(target);
+        --size_;
+        return iterator(pos.node_->next);
     }
 
     // 리스트의 모든 요소 출력
     void print() const override {
-        const Node* current = head_.get();
+        const Node* current = head_;
         std::cout << "List contents: ";
         while (current) {
             std::cout << current->data << " ";
-            current = current->next.get();
+            current = current->next;
         }
         std::cout << std::endl;
     }
 };
 
-#endif // SINGLE_LINKED_LIST_HPP
\ No newline at end of file
+namespace pmr {
+    // std::pmr 메모리 리소스를 사용하는 단일 연결 리스트
+    template<typename T>
+    using SingleLinkedList = ::SingleLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+#endif // SINGLE_LINKED_LIST_HPP
@@ -0,0 +1,530 @@
+#ifndef SKIP_LIST_HPP
+#define SKIP_LIST_HPP
+
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "i_linked_list.hpp"
+
+/**
+ * @brief 인덱스 접근이 가능한 스킵 리스트 구현 클래스
+ * 각 노드가 여러 층의 전방 링크를 가지며, 링크마다 건너뛰는 요소 수(span)를 기록
+ * - at / insert_after / remove_at: span을 누적하며 위층부터 내려가므로 평균 O(log n)
+ * - 요소를 Compare 순서로 유지하면 find / lower_bound / insert_sorted로 값 탐색 가능
+ * @tparam Compare 정렬 모드에서 사용할 비교 함수 객체
+ */
+template<typename T, typename Compare = std::less<T>>
+class SkipList final : public ILinkedList<T> {
+public:
+    // find 실패 시 반환하는 위치
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+private:
+    static constexpr int MAX_LEVEL = 32;  // 최대 층 수 (2^64개 요소까지 충분)
+
+    struct Node;
+
+    // 한 층의 전방 링크
+    struct Link {
+        Node* next;   // 이 층의 다음 노드
+        size_t span;  // 다음 노드까지의 위치 차이 (다음 노드가 없으면 끝까지의 거리)
+    };
+
+    // 노드 뒤에 층 수만큼의 Link 배열을 이어서 할당
+    struct alignas(Link) Node {
+        T data;     // 노드에 저장될 데이터
+        int level;  // 링크 층 수
+
+        template<typename... Args>
+        explicit Node(int node_level, std::in_place_t, Args&&... args)
+            : data(std::forward<Args>(args)...), level(node_level) {}
+
+        Link* links() noexcept { return reinterpret_cast<Link*>(this + 1); }
+        const Link* links() const noexcept { return reinterpret_cast<const Link*>(this + 1); }
+    };
+
+    Link head_[MAX_LEVEL];  // 머리 링크 (위치 0)
+    Node* tail_;            // 마지막 노드
+    int level_;             // 현재 사용 중인 최고 층 수
+    size_t size_;           // 리스트의 크기
+    uint64_t rng_;          // 층 결정용 난수 상태 (xorshift64)
+    Compare comp_;          // 정렬 모드 비교 함수
+
+    // 노드의 링크 배열 (nullptr이면 머리)
+    Link* links(Node* node) noexcept { return node ? node->links() : head_; }
+    const Link* links(const Node* node) const noexcept { return node ? node->links() : head_; }
+
+    // 새 노드의 층 수 결정 (한 층 올라갈 확률 1/4)
+    int random_level() noexcept {
+        int level = 1;
+        while (level < MAX_LEVEL) {
+            rng_ ^= rng_ << 13;
+            rng_ ^= rng_ >> 7;
+            rng_ ^= rng_ << 17;
+            if ((rng_ & 3) != 0) {
+                break;
+            }
+            ++level;
+        }
+        return level;
+    }
+
+    // 노드와 링크 배열을 한 번에 할당하여 생성
+    template<typename... Args>
+    Node* create_node(int level, Args&&... args) {
+        size_t bytes = sizeof(Node) + sizeof(Link) * static_cast<size_t>(level);
+        void* memory = ::operator new(bytes, std::align_val_t(alignof(Node)));
+        try {
+            return new (memory) Node(level, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            ::operator delete(memory, std::align_val_t(alignof(Node)));
+            throw;
+        }
+    }
+
+    void destroy_node(Node* node) noexcept {
+        node->~Node();
+        ::operator delete(node, std::align_val_t(alignof(Node)));
+    }
+
+    // 모든 노드 해제 (최하층을 따라 반복문으로 해제)
+    void destroy_all() noexcept {
+        Node* current = head_[0].next;
+        while (current) {
+            Node* next = current->links()[0].next;
+            destroy_node(current);
+            current = next;
+        }
+        for (int i = 0; i < MAX_LEVEL; ++i) {
+            head_[i] = { nullptr, 0 };
+        }
+        tail_ = nullptr;
+        level_ = 1;
+        size_ = 0;
+    }
+
+    // 다른 리스트의 노드를 그대로 넘겨받음
+    void steal(SkipList& other) noexcept {
+        for (int i = 0; i < MAX_LEVEL; ++i) {
+            head_[i] = other.head_[i];
+            other.head_[i] = { nullptr, 0 };
+        }
+        tail_ = other.tail_;
+        level_ = other.level_;
+        size_ = other.size_;
+        other.tail_ = nullptr;
+        other.level_ = 1;
+        other.size_ = 0;
+    }
+
+    // 위치 rank(1부터 시작)의 노드 탐색: O(log n)
+    Node* node_at_rank(size_t rank) const {
+        const Node* current = nullptr;
+        size_t traversed = 0;
+        for (int i = level_ - 1; i >= 0; --i) {
+            while (links(current)[i].next && traversed + links(current)[i].span <= rank) {
+                traversed += links(current)[i].span;
+                current = links(current)[i].next;
+            }
+            if (traversed == rank) {
+                break;
+            }
+        }
+        return const_cast<Node*>(current);
+    }
+
+    // position개의 요소 뒤(0이면 맨 앞)에 요소 생성: O(log n)
+    template<typename... Args>
+    Node* insert_at(size_t position, Args&&... args) {
+        Node* update[MAX_LEVEL] = {};
+        size_t rank[MAX_LEVEL];
+
+        // 각 층에서 삽입 위치 직전 노드와 그 위치를 기록
+        Node* current = nullptr;
+        for (int i = level_ - 1; i >= 0; --i) {
+            rank[i] = (i == level_ - 1) ? 0 : rank[i + 1];
+            while (links(current)[i].next && rank[i] + links(current)[i].span <= position) {
+                rank[i] += links(current)[i].span;
+                current = links(current)[i].next;
+            }
+            update[i] = current;
+        }
+
+        int level = random_level();
+        Node* new_node = create_node(level, std::forward<Args>(args)...);
+
+        if (level > level_) {
+            for (int i = level_; i < level; ++i) {
+                rank[i] = 0;
+                update[i] = nullptr;
+                head_[i].span = size_;
+            }
+            level_ = level;
+        }
+
+        // 새 노드가 올라간 층: 링크를 끼워 넣고 span을 둘로 나눔
+        for (int i = 0; i < level; ++i) {
+            Link& prev = links(update[i])[i];
+            size_t distance = position - rank[i];
+            new_node->links()[i] = { prev.next, prev.span - distance };
+            prev.next = new_node;
+            prev.span = distance + 1;
+        }
+
+        // 새 노드보다 높은 층: 건너뛰는 요소가 하나 늘어남
+        for (int i = level; i < level_; ++i) {
+            ++links(update[i])[i].span;
+        }
+
+        if (!new_node->links()[0].next) {
+            tail_ = new_node;
+        }
+        ++size_;
+        return new_node;
+    }
+
+    // index 위치의 노드 제거: O(log n)
+    void erase_at(size_t index) {
+        Node* update[MAX_LEVEL] = {};
+        size_t traversed = 0;
+
+        Node* current = nullptr;
+        for (int i = level_ - 1; i >= 0; --i) {
+            while (links(current)[i].next && traversed + links(current)[i].span <= index) {
+                traversed += links(current)[i].span;
+                current = links(current)[i].next;
+            }
+            update[i] = current;
+        }
+
+        Node* target = links(update[0])[0].next;
+        for (int i = 0; i < level_; ++i) {
+            Link& prev = links(update[i])[i];
+            if (prev.next == target) {
+                prev.span += target->links()[i].span - 1;
+                prev.next = target->links()[i].next;
+            } else {
+                --prev.span;
+            }
+        }
+
+        if (target == tail_) {
+            tail_ = update[0];
+        }
+        while (level_ > 1 && !head_[level_ - 1].next) {
+            --level_;
+        }
+        destroy_node(target);
+        --size_;
+    }
+
+    // value 이상인 첫 노드와 그 앞의 요소 수 (정렬 모드 전용)
+    std::pair<Node*, size_t> lower_bound_node(const T& value) const {
+        const Node* current = nullptr;
+        size_t traversed = 0;
+        for (int i = level_ - 1; i >= 0; --i) {
+            while (links(current)[i].next && comp_(links(current)[i].next->data, value)) {
+                traversed += links(current)[i].span;
+                current = links(current)[i].next;
+            }
+        }
+        return { links(current)[0].next, traversed };
+    }
+
+    /**
+     * @brief 전방 반복자 (최하층 링크를 따라 이동)
+     * end()는 nullptr로 표현
+     * @tparam IsConst true면 const_iterator
+     */
+    template<bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : node_(nullptr) {}
+
+        // iterator → const_iterator 변환
+        template<bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : node_(other.node_) {}
+
+        reference operator*() const { return node_->data; }
+        pointer operator->() const { return &node_->data; }
+
+        Iterator& operator++() {
+            node_ = node_->links()[0].next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.node_ == b.node_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.node_ != b.node_; }
+
+    private:
+        friend class SkipList;
+        template<bool> friend class Iterator;
+
+        explicit Iterator(Node* node) : node_(node) {}
+
+        Node* node_;  // 현재 노드 (end()면 nullptr)
+    };
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    // 빈 리스트 생성
+    explicit SkipList(const Compare& comp = Compare())
+        : head_{}, tail_(nullptr), level_(1), size_(0), rng_(0x2545F4914F6CDD1DULL), comp_(comp) {}
+
+    // 가상 소멸자
+    ~SkipList() override {
+        destroy_all();
+    }
+
+    // 복사 생성자와 대입 연산자 삭제
+    SkipList(const SkipList&) = delete;
+    SkipList& operator=(const SkipList&) = delete;
+
+    // 이동 생성자
+    SkipList(SkipList&& other) noexcept
+        : head_{}, tail_(nullptr), level_(1), size_(0), rng_(other.rng_), comp_(std::move(other.comp_)) {
+        steal(other);
+    }
+
+    // 이동 대입 연산자
+    SkipList& operator=(SkipList&& other) noexcept {
+        if (this != &other) {
+            destroy_all();
+            comp_ = std::move(other.comp_);
+            steal(other);
+        }
+        return *this;
+    }
+
+    // 리스트가 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return size_ == 0;
+    }
+
+    // 리스트의 크기 반환
+    [[nodiscard]] size_t size() const override {
+        return size_;
+    }
+
+    // 리스트의 맨 앞에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        return insert_at(0, std::forward<Args>(args)...)->data;
+    }
+
+    // 리스트의 맨 뒤에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        return insert_at(size_, std::forward<Args>(args)...)->data;
+    }
+
+    // 리스트의 맨 앞에 요소 추가
+    void push_front(const T& value) override {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) override {
+        emplace_front(std::move(value));
+    }
+
+    // 리스트의 맨 뒤에 요소 추가
+    void push_back(const T& value) override {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) override {
+        emplace_back(std::move(value));
+    }
+
+    // 지정된 위치 다음에 요소 삽입 (O(log n))
+    void insert_after(size_t index, const T& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        insert_at(index + 1, value);
+    }
+
+    void insert_after(size_t index, T&& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        insert_at(index + 1, std::move(value));
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void append_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace_back(value);
+            } else {
+                emplace_back(std::move(value));
+            }
+        }
+    }
+
+    // 리스트의 맨 앞 요소 제거
+    void pop_front() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        erase_at(0);
+    }
+
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_front_value() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T value = std::move(head_[0].next->data);
+        erase_at(0);
+        return value;
+    }
+
+    // 지정된 위치의 요소 제거 (O(log n))
+    void remove_at(size_t index) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        erase_at(index);
+    }
+
+    // 지정된 위치의 요소 반환 (O(log n))
+    T& at(size_t index) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return node_at_rank(index + 1)->data;
+    }
+
+    // 지정된 위치의 요소 반환 (상수 버전)
+    const T& at(size_t index) const override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return node_at_rank(index + 1)->data;
+    }
+
+    /**
+     * @brief 정렬 모드: value 이상인 첫 요소의 위치 (O(log n))
+     * 요소가 Compare 순서로 정렬되어 있어야 함 (insert_sorted로만 삽입하면 항상 유지됨)
+     * @return 해당 요소의 인덱스 (없으면 size())
+     */
+    [[nodiscard]] size_t lower_bound(const T& value) const {
+        return lower_bound_node(value).second;
+    }
+
+    /**
+     * @brief 정렬 모드: value와 같은 첫 요소의 위치 (O(log n))
+     * @return 해당 요소의 인덱스 (없으면 npos)
+     */
+    [[nodiscard]] size_t find(const T& value) const {
+        auto [node, index] = lower_bound_node(value);
+        if (node && !comp_(value, node->data)) {
+            return index;
+        }
+        return npos;
+    }
+
+    /**
+     * @brief 정렬 모드: 순서를 유지하는 위치에 삽입 (O(log n))
+     * 같은 값이 있으면 그 앞에 삽입
+     * @return 삽입된 요소의 인덱스
+     */
+    size_t insert_sorted(const T& value) {
+        size_t index = lower_bound(value);
+        insert_at(index, value);
+        return index;
+    }
+
+    // 전체 순회
+    void for_each(const std::function<void(T&)>& visit) override {
+        for (Node* current = head_[0].next; current; current = current->links()[0].next) {
+            visit(current->data);
+        }
+    }
+
+    void for_each(const std::function<void(const T&)>& visit) const override {
+        for (const Node* current = head_[0].next; current; current = current->links()[0].next) {
+            visit(current->data);
+        }
+    }
+
+    // 모든 요소 제거
+    void clear() noexcept {
+        destroy_all();
+    }
+
+    // 반복자
+    iterator begin() noexcept { return iterator(head_[0].next); }
+    iterator end() noexcept { return iterator(nullptr); }
+    const_iterator begin() const noexcept { return const_iterator(head_[0].next); }
+    const_iterator end() const noexcept { return const_iterator(nullptr); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // 맨 앞/맨 뒤 요소 접근 (O(1))
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_[0].next->data;
+    }
+
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_[0].next->data;
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->data;
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->data;
+    }
+
+    // 리스트의 모든 요소 출력
+    void print() const override {
+        std::cout << "List contents: ";
+        for (const Node* current = head_[0].next; current; current = current->links()[0].next) {
+            std::cout << current->data << " ";
+        }
+        std::cout << std::endl;
+    }
+};
+
+#endif // SKIP_LIST_HPP
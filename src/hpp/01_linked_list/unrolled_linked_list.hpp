@@ -0,0 +1,574 @@
+#ifndef UNROLLED_LINKED_LIST_HPP
+#define UNROLLED_LINKED_LIST_HPP
+
+#include <new>
+#include <stdexcept>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "i_linked_list.hpp"
+
+/**
+ * @brief 블록 하나에 담을 기본 요소 수
+ * 요소 배열이 캐시 라인(64바이트) 하나를 채우도록 설정 (최소 4개)
+ */
+template<typename T>
+constexpr size_t unrolled_block_capacity() {
+    return 64 / sizeof(T) >= 4 ? 64 / sizeof(T) : 4;
+}
+
+/**
+ * @brief 언롤드(청크) 연결 리스트 구현 클래스
+ * 노드 하나에 최대 N개의 요소를 연속 배열로 저장하는 이중 연결 리스트
+ * - 순회/인덱스 접근 시 방문하는 노드 수가 약 N분의 1로 줄어듦
+ * - 가득 찬 블록 중간에 삽입하면 블록을 반으로 분할
+ * - 삭제 후 블록이 절반 미만이 되면 다음 블록과 병합하거나 요소를 빌려옴
+ * @tparam N 블록당 최대 요소 수
+ */
+template<typename T, size_t N = unrolled_block_capacity<T>()>
+class UnrolledLinkedList final : public ILinkedList<T> {
+    static_assert(N >= 2, "UnrolledLinkedList block capacity must be at least 2");
+
+private:
+    // 요소 블록 노드
+    struct Node {
+        Node* next;    // 다음 블록
+        Node* prev;    // 이전 블록
+        size_t count;  // 블록에 저장된 요소 수
+        alignas(T) unsigned char storage[sizeof(T) * N];  // 요소 저장 공간 (필요할 때 생성)
+
+        Node() : next(nullptr), prev(nullptr), count(0) {}
+
+        T* elements() { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* elements() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+    static constexpr size_t MIN_FILL = N / 2;  // 블록 병합 기준
+
+    Node* head_;   // 첫 번째 블록
+    Node* tail_;   // 마지막 블록
+    size_t size_;  // 전체 요소 수
+    size_t blocks_;  // 블록 수
+
+    // 블록 생성 및 해제
+    Node* create_node() {
+        ++blocks_;
+        return new Node();
+    }
+
+    void destroy_node(Node* node) noexcept {
+        T* e = node->elements();
+        for (size_t i = 0; i < node->count; ++i) {
+            e[i].~T();
+        }
+        delete node;
+        --blocks_;
+    }
+
+    // pos 다음에 블록 연결 (pos가 nullptr이면 맨 앞)
+    void link_after(Node* pos, Node* node) noexcept {
+        node->prev = pos;
+        node->next = pos ? pos->next : head_;
+        if (node->next) {
+            node->next->prev = node;
+        } else {
+            tail_ = node;
+        }
+        if (pos) {
+            pos->next = node;
+        } else {
+            head_ = node;
+        }
+    }
+
+    // 블록을 리스트에서 분리
+    void unlink(Node* node) noexcept {
+        if (node->prev) {
+            node->prev->next = node->next;
+        } else {
+            head_ = node->next;
+        }
+        if (node->next) {
+            node->next->prev = node->prev;
+        } else {
+            tail_ = node->prev;
+        }
+    }
+
+    // from 블록의 [first, from->count) 요소를 to 블록 끝으로 이동
+    static void move_tail(Node* from, size_t first, Node* to) {
+        T* src = from->elements();
+        T* dst = to->elements();
+        for (size_t i = first; i < from->count; ++i) {
+            new (&dst[to->count++]) T(std::move(src[i]));
+            src[i].~T();
+        }
+        from->count = first;
+    }
+
+    // from 블록 앞쪽 k개 요소를 to 블록 끝으로 이동하고 from을 앞으로 당김
+    static void move_front(Node* from, size_t k, Node* to) {
+        T* src = from->elements();
+        T* dst = to->elements();
+        for (size_t i = 0; i < k; ++i) {
+            new (&dst[to->count++]) T(std::move(src[i]));
+            src[i].~T();
+        }
+        for (size_t i = k; i < from->count; ++i) {
+            new (&src[i - k]) T(std::move(src[i]));
+            src[i].~T();
+        }
+        from->count -= k;
+    }
+
+    // 전역 인덱스의 요소가 있는 블록과 블록 내 위치 탐색 (index < size_)
+    std::pair<Node*, size_t> locate(size_t index) const {
+        Node* current = head_;
+        while (index >= current->count) {
+            index -= current->count;
+            current = current->next;
+        }
+        return { current, index };
+    }
+
+    // 삽입 위치 탐색 (index <= size_)
+    // 블록 경계에서는 다음 블록 앞보다 이전 블록 끝을 선택하여 분할을 줄임
+    std::pair<Node*, size_t> locate_for_insert(size_t index) const {
+        Node* current = head_;
+        while (current && index > current->count) {
+            index -= current->count;
+            current = current->next;
+        }
+        return { current, index };
+    }
+
+    // node의 offset 위치에 요소 생성 (node가 nullptr이면 빈 리스트)
+    template<typename... Args>
+    Node* insert_at(Node* node, size_t offset, Args&&... args) {
+        // 블록 끝에 빈 칸이 있으면 요소 이동 없이 제자리 생성
+        if (node && offset == node->count && node->count < N) {
+            new (&node->elements()[offset]) T(std::forward<Args>(args)...);
+            ++node->count;
+            ++size_;
+            return node;
+        }
+
+        // 요소를 옮기기 전에 값을 먼저 생성 (인자가 리스트 안의 요소를 참조해도 안전)
+        T value(std::forward<Args>(args)...);
+
+        if (!node) {
+            node = create_node();
+            link_after(nullptr, node);
+        } else if (node->count == N) {
+            if (offset == N) {
+                // 블록 끝에 추가: 분할 없이 다음 새 블록에 저장
+                Node* new_node = create_node();
+                link_after(node, new_node);
+                node = new_node;
+                offset = 0;
+            } else if (offset == 0 && node == head_) {
+                // 리스트 맨 앞에 추가: 분할 없이 앞쪽 새 블록에 저장
+                Node* new_node = create_node();
+                link_after(nullptr, new_node);
+                node = new_node;
+            } else {
+                // 블록 중간에 삽입: 뒤쪽 절반을 새 블록으로 분할
+                Node* new_node = create_node();
+                link_after(node, new_node);
+                move_tail(node, N / 2, new_node);
+                if (offset > N / 2) {
+                    node = new_node;
+                    offset -= N / 2;
+                }
+            }
+        }
+
+        // offset 이후 요소를 한 칸씩 뒤로 이동
+        T* e = node->elements();
+        for (size_t i = node->count; i > offset; --i) {
+            new (&e[i]) T(std::move(e[i - 1]));
+            e[i - 1].~T();
+        }
+        try {
+            new (&e[offset]) T(std::move(value));
+        } catch (...) {
+            // 생성 실패 시 이동한 요소를 되돌림
+            for (size_t i = offset; i < node->count; ++i) {
+                new (&e[i]) T(std::move(e[i + 1]));
+                e[i + 1].~T();
+            }
+            throw;
+        }
+        ++node->count;
+        ++size_;
+        return node;
+    }
+
+    // node의 offset 위치 요소 제거 후 필요하면 병합
+    void erase_at(Node* node, size_t offset) {
+        T* e = node->elements();
+        e[offset].~T();
+        for (size_t i = offset + 1; i < node->count; ++i) {
+            new (&e[i - 1]) T(std::move(e[i]));
+            e[i].~T();
+        }
+        --node->count;
+        --size_;
+
+        if (node->count == 0) {
+            unlink(node);
+            destroy_node(node);
+            return;
+        }
+
+        // 절반 미만이면 다음 블록과 병합하거나 요소를 빌려와 밀도 유지
+        Node* next = node->next;
+        if (node->count < MIN_FILL && next) {
+            if (node->count + next->count <= N) {
+                move_tail(next, 0, node);
+                unlink(next);
+                destroy_node(next);
+            } else {
+                move_front(next, MIN_FILL - node->count, node);
+            }
+        }
+    }
+
+    /**
+     * @brief 양방향 반복자
+     * (블록, 블록 내 위치) 쌍으로 요소를 가리키며 end()는 블록이 nullptr
+     * @tparam IsConst true면 const_iterator
+     */
+    template<bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : node_(nullptr), offset_(0), list_(nullptr) {}
+
+        // iterator → const_iterator 변환
+        template<bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other)
+            : node_(other.node_), offset_(other.offset_), list_(other.list_) {}
+
+        reference operator*() const { return node_->elements()[offset_]; }
+        pointer operator->() const { return &node_->elements()[offset_]; }
+
+        Iterator& operator++() {
+            if (++offset_ == node_->count) {
+                node_ = node_->next;
+                offset_ = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        Iterator& operator--() {
+            if (!node_) {
+                node_ = list_->tail_;
+                offset_ = node_->count - 1;
+            } else if (offset_ == 0) {
+                node_ = node_->prev;
+                offset_ = node_->count - 1;
+            } else {
+                --offset_;
+            }
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node_ == b.node_ && a.offset_ == b.offset_;
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return !(a == b); }
+
+    private:
+        friend class UnrolledLinkedList;
+        template<bool> friend class Iterator;
+
+        Iterator(Node* node, size_t offset, const UnrolledLinkedList* list)
+            : node_(node), offset_(offset), list_(list) {}
+
+        Node* node_;                      // 현재 블록 (end()면 nullptr)
+        size_t offset_;                   // 블록 내 위치
+        const UnrolledLinkedList* list_;  // --end() 처리를 위한 소속 리스트
+    };
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // 블록당 최대 요소 수
+    static constexpr size_t block_capacity = N;
+
+    // 빈 리스트 생성
+    UnrolledLinkedList() : head_(nullptr), tail_(nullptr), size_(0), blocks_(0) {}
+
+    // 가상 소멸자
+    ~UnrolledLinkedList() override {
+        clear();
+    }
+
+    // 복사 생성자와 대입 연산자 삭제
+    UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+    UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+
+    // 이동 생성자
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+        : head_(other.head_), tail_(other.tail_), size_(other.size_), blocks_(other.blocks_) {
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = other.blocks_ = 0;
+    }
+
+    // 이동 대입 연산자
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head_ = other.head_;
+            tail_ = other.tail_;
+            size_ = other.size_;
+            blocks_ = other.blocks_;
+            other.head_ = other.tail_ = nullptr;
+            other.size_ = other.blocks_ = 0;
+        }
+        return *this;
+    }
+
+    // 리스트가 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return size_ == 0;
+    }
+
+    // 리스트의 크기 반환
+    [[nodiscard]] size_t size() const override {
+        return size_;
+    }
+
+    // 현재 블록 수 반환
+    [[nodiscard]] size_t block_count() const {
+        return blocks_;
+    }
+
+    // 리스트의 맨 앞에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        return insert_at(head_, 0, std::forward<Args>(args)...)->elements()[0];
+    }
+
+    // 리스트의 맨 뒤에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        Node* node = insert_at(tail_, tail_ ? tail_->count : 0, std::forward<Args>(args)...);
+        return node->elements()[node->count - 1];
+    }
+
+    // 리스트의 맨 앞에 요소 추가
+    void push_front(const T& value) override {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) override {
+        emplace_front(std::move(value));
+    }
+
+    // 리스트의 맨 뒤에 요소 추가
+    void push_back(const T& value) override {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) override {
+        emplace_back(std::move(value));
+    }
+
+    // 지정된 위치 다음에 요소 삽입
+    void insert_after(size_t index, const T& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        auto [node, offset] = locate_for_insert(index + 1);
+        insert_at(node, offset, value);
+    }
+
+    void insert_after(size_t index, T&& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        auto [node, offset] = locate_for_insert(index + 1);
+        insert_at(node, offset, std::move(value));
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void append_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace_back(value);
+            } else {
+                emplace_back(std::move(value));
+            }
+        }
+    }
+
+    // 리스트의 맨 앞 요소 제거
+    void pop_front() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        erase_at(head_, 0);
+    }
+
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_front_value() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T value = std::move(head_->elements()[0]);
+        erase_at(head_, 0);
+        return value;
+    }
+
+    // 지정된 위치의 요소 제거
+    void remove_at(size_t index) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        auto [node, offset] = locate(index);
+        erase_at(node, offset);
+    }
+
+    // 지정된 위치의 요소 반환 (블록 단위로 건너뛰므로 약 index / N 번 이동)
+    T& at(size_t index) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        auto [node, offset] = locate(index);
+        return node->elements()[offset];
+    }
+
+    // 지정된 위치의 요소 반환 (상수 버전)
+    const T& at(size_t index) const override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        auto [node, offset] = locate(index);
+        return node->elements()[offset];
+    }
+
+    // 전체 순회 (블록 내부는 연속 배열 순회)
+    void for_each(const std::function<void(T&)>& visit) override {
+        for (Node* node = head_; node; node = node->next) {
+            T* e = node->elements();
+            for (size_t i = 0; i < node->count; ++i) {
+                visit(e[i]);
+            }
+        }
+    }
+
+    void for_each(const std::function<void(const T&)>& visit) const override {
+        for (const Node* node = head_; node; node = node->next) {
+            const T* e = node->elements();
+            for (size_t i = 0; i < node->count; ++i) {
+                visit(e[i]);
+            }
+        }
+    }
+
+    // 모든 요소 제거
+    void clear() noexcept {
+        while (head_) {
+            Node* next = head_->next;
+            destroy_node(head_);
+            head_ = next;
+        }
+        tail_ = nullptr;
+        size_ = 0;
+    }
+
+    // 반복자
+    iterator begin() noexcept { return iterator(head_, 0, this); }
+    iterator end() noexcept { return iterator(nullptr, 0, this); }
+    const_iterator begin() const noexcept { return const_iterator(head_, 0, this); }
+    const_iterator end() const noexcept { return const_iterator(nullptr, 0, this); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // 역방향 반복자
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 맨 앞/맨 뒤 요소 접근 (O(1))
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_->elements()[0];
+    }
+
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return head_->elements()[0];
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->elements()[tail_->count - 1];
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return tail_->elements()[tail_->count - 1];
+    }
+
+    // 리스트의 모든 요소 출력 (블록 경계는 | 로 표시)
+    void print() const override {
+        std::cout << "List contents: ";
+        for (const Node* node = head_; node; node = node->next) {
+            const T* e = node->elements();
+            for (size_t i = 0; i < node->count; ++i) {
+                std::cout << e[i] << " ";
+            }
+            if (node->next) {
+                std::cout << "| ";
+            }
+        }
+        std::cout << std::endl;
+    }
+};
+
+#endif // UNROLLED_LINKED_LIST_HPP
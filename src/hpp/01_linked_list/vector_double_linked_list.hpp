@@ -0,0 +1,601 @@
+#ifndef VECTOR_DOUBLE_LINKED_LIST_HPP
+#define VECTOR_DOUBLE_LINKED_LIST_HPP
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "i_linked_list.hpp"
+
+/**
+ * @brief 인덱스 기반 이중 연결 리스트 구현 클래스
+ * 노드를 연속 배열(슬롯)에 두고 포인터 대신 32비트 prev/next 인덱스로 연결
+ * - 링크 배열과 값 배열을 분리한 구조 (struct-of-arrays)
+ * - 노드당 링크 비용이 포인터 두 개(16바이트)에서 인덱스 두 개(8바이트)로 감소
+ * - 삭제된 슬롯은 next 인덱스를 재사용한 내부 free list로 재활용
+ * - 링크가 주소가 아닌 인덱스라 배열째 복사/직렬화해도 연결 구조가 유지됨
+ * @tparam Alloc 슬롯 배열 할당에 사용할 할당자
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class VectorDoubleLinkedList final : public ILinkedList<T> {
+public:
+    using index_type = std::uint32_t;
+
+    // 연결 없음을 나타내는 인덱스 (nullptr 역할)
+    static constexpr index_type npos = static_cast<index_type>(-1);
+
+private:
+    // 노드 연결 정보
+    struct Link {
+        index_type prev;  // 이전 노드 인덱스
+        index_type next;  // 다음 노드 인덱스 (빈 슬롯이면 다음 빈 슬롯)
+    };
+
+    // 값 저장 공간 (사용 중인 슬롯에만 객체가 생성됨)
+    struct Slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    using LinkAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Link>;
+    using SlotAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+
+    std::vector<Link, LinkAllocator> links_;   // 슬롯별 연결 정보
+    std::vector<Slot, SlotAllocator> values_;  // 슬롯별 값 (links_와 같은 크기)
+    index_type head_;       // 첫 번째 노드 인덱스
+    index_type tail_;       // 마지막 노드 인덱스
+    index_type free_head_;  // 첫 번째 빈 슬롯 인덱스
+    index_type used_;       // 한 번이라도 사용된 슬롯 수
+    size_t size_;           // 리스트의 크기
+
+    T& value(index_type index) noexcept {
+        return *std::launder(reinterpret_cast<T*>(values_[index].bytes));
+    }
+
+    const T& value(index_type index) const noexcept {
+        return *std::launder(reinterpret_cast<const T*>(values_[index].bytes));
+    }
+
+    // 슬롯 배열 확장
+    // 값 배열은 바이트 복사로 옮길 수 없으므로 사용 중인 노드만 새 배열로 이동
+    void grow(size_t new_capacity) {
+        if (new_capacity > npos) {
+            throw std::length_error("List capacity exceeded");
+        }
+
+        // 할당이 실패할 수 있는 작업은 기존 값을 건드리기 전에 모두 끝냄
+        // (링크 배열도 미리 예약해 두어 아래 resize 는 재할당 없이 예외를 던지지 않음)
+        links_.reserve(new_capacity);
+        std::vector<Slot, SlotAllocator> fresh(new_capacity, values_.get_allocator());
+        index_type moved = head_;
+        try {
+            for (; moved != npos; moved = links_[moved].next) {
+                new (fresh[moved].bytes) T(std::move_if_noexcept(value(moved)));
+            }
+        } catch (...) {
+            for (index_type i = head_; i != moved; i = links_[i].next) {
+                std::launder(reinterpret_cast<T*>(fresh[i].bytes))->~T();
+            }
+            throw;
+        }
+
+        for (index_type i = head_; i != npos; i = links_[i].next) {
+            value(i).~T();
+        }
+        values_.swap(fresh);
+        links_.resize(new_capacity);
+    }
+
+    // 빈 슬롯을 꺼내 값 생성 (free list 우선, 없으면 새 슬롯)
+    template<typename... Args>
+    index_type create_node(Args&&... args) {
+        index_type index;
+        if (free_head_ != npos) {
+            index = free_head_;
+            new (values_[index].bytes) T(std::forward<Args>(args)...);
+            free_head_ = links_[index].next;
+        } else if (used_ < values_.size()) {
+            index = used_;
+            new (values_[index].bytes) T(std::forward<Args>(args)...);
+            ++used_;
+        } else {
+            // 확장 전에 값을 먼저 생성 (인자가 기존 요소를 참조해도 안전)
+            T value(std::forward<Args>(args)...);
+            grow(values_.empty() ? 8 : values_.size() * 2);
+            index = used_;
+            new (values_[index].bytes) T(std::move(value));
+            ++used_;
+        }
+        return index;
+    }
+
+    // 값 소멸 후 슬롯을 free list에 반환
+    void destroy_node(index_type index) noexcept {
+        value(index).~T();
+        links_[index].next = free_head_;
+        free_head_ = index;
+    }
+
+    // 모든 노드 해제 (슬롯 배열은 유지)
+    void destroy_all() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (index_type i = head_; i != npos; i = links_[i].next) {
+                value(i).~T();
+            }
+        }
+        head_ = tail_ = free_head_ = npos;
+        used_ = 0;
+        size_ = 0;
+    }
+
+    // 다른 리스트의 슬롯 배열을 그대로 넘겨받음 (할당자가 같거나 전파될 때만 호출)
+    void steal(VectorDoubleLinkedList& other) noexcept {
+        links_ = std::move(other.links_);
+        values_ = std::move(other.values_);
+        other.links_.clear();
+        other.values_.clear();
+        head_ = other.head_;
+        tail_ = other.tail_;
+        free_head_ = other.free_head_;
+        used_ = other.used_;
+        size_ = other.size_;
+        other.head_ = other.tail_ = other.free_head_ = npos;
+        other.used_ = 0;
+        other.size_ = 0;
+    }
+
+    // index 위치의 노드 인덱스 탐색 (가까운 쪽 끝에서 시작)
+    index_type node_at(size_t index) const {
+        index_type current;
+        if (index < size_ / 2) {
+            current = head_;
+            for (size_t i = 0; i < index; ++i) {
+                current = links_[current].next;
+            }
+        } else {
+            current = tail_;
+            for (size_t i = size_ - 1; i > index; --i) {
+                current = links_[current].prev;
+            }
+        }
+        return current;
+    }
+
+    /**
+     * @brief 양방향 반복자
+     * 슬롯 인덱스로 위치를 표현하므로 슬롯 배열이 재할당되어도 무효화되지 않음
+     * end()는 npos로 표현
+     * @tparam IsConst true면 const_iterator
+     */
+    template<bool IsConst>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() : index_(npos), list_(nullptr) {}
+
+        // iterator → const_iterator 변환
+        template<bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+        Iterator(const Iterator<WasConst>& other) : index_(other.index_), list_(other.list_) {}
+
+        reference operator*() const { return list_->value(index_); }
+        pointer operator->() const { return &list_->value(index_); }
+
+        Iterator& operator++() {
+            index_ = list_->links_[index_].next;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        Iterator& operator--() {
+            index_ = index_ != npos ? list_->links_[index_].prev : list_->tail_;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator previous = *this;
+            --*this;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.index_ == b.index_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.index_ != b.index_; }
+
+    private:
+        using ListPointer = std::conditional_t<IsConst, const VectorDoubleLinkedList*, VectorDoubleLinkedList*>;
+
+        friend class VectorDoubleLinkedList;
+        template<bool> friend class Iterator;
+
+        Iterator(index_type index, ListPointer list) : index_(index), list_(list) {}
+
+        index_type index_;  // 현재 노드 인덱스 (end()면 npos)
+        ListPointer list_;  // 소속 리스트
+    };
+
+public:
+    using allocator_type = Alloc;
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // 빈 리스트 생성
+    VectorDoubleLinkedList() : VectorDoubleLinkedList(Alloc()) {}
+
+    // 지정한 할당자를 사용하는 빈 리스트 생성
+    explicit VectorDoubleLinkedList(const Alloc& alloc)
+        : links_(LinkAllocator(alloc)), values_(SlotAllocator(alloc)),
+          head_(npos), tail_(npos), free_head_(npos), used_(0), size_(0) {}
+
+    // 가상 소멸자
+    ~VectorDoubleLinkedList() override {
+        destroy_all();
+    }
+
+    // 복사 생성자와 대입 연산자 삭제
+    VectorDoubleLinkedList(const VectorDoubleLinkedList&) = delete;
+    VectorDoubleLinkedList& operator=(const VectorDoubleLinkedList&) = delete;
+
+    // 이동 생성자 (할당자와 슬롯 배열을 함께 이동)
+    VectorDoubleLinkedList(VectorDoubleLinkedList&& other) noexcept
+        : links_(LinkAllocator(other.links_.get_allocator())),
+          values_(SlotAllocator(other.values_.get_allocator())),
+          head_(npos), tail_(npos), free_head_(npos), used_(0), size_(0) {
+        steal(other);
+    }
+
+    // 이동 대입 연산자
+    // 할당자가 전파되지 않고 서로 다르면 (pmr 등) 원소 단위로 옮김
+    VectorDoubleLinkedList& operator=(VectorDoubleLinkedList&& other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        destroy_all();
+        using SlotTraits = std::allocator_traits<SlotAllocator>;
+        if constexpr (SlotTraits::propagate_on_container_move_assignment::value) {
+            steal(other);
+        } else if (values_.get_allocator() == other.values_.get_allocator()) {
+            steal(other);
+        } else {
+            for (index_type i = other.head_; i != npos; i = other.links_[i].next) {
+                push_back(std::move(other.value(i)));
+            }
+            other.destroy_all();
+        }
+        return *this;
+    }
+
+    // 슬롯 배열 할당에 사용하는 할당자 반환
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator_type(values_.get_allocator());
+    }
+
+    // 리스트가 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return size_ == 0;
+    }
+
+    // 리스트의 크기 반환
+    [[nodiscard]] size_t size() const override {
+        return size_;
+    }
+
+    // 재할당 없이 저장할 수 있는 노드 수
+    [[nodiscard]] size_t capacity() const noexcept {
+        return values_.size();
+    }
+
+    // 최소 capacity개의 슬롯을 미리 확보
+    void reserve(size_t capacity) {
+        if (capacity > values_.size()) {
+            grow(capacity);
+        }
+    }
+
+    // 리스트의 맨 앞에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        index_type new_node = create_node(std::forward<Args>(args)...);
+        links_[new_node] = { npos, head_ };
+
+        if (head_ != npos) {
+            links_[head_].prev = new_node;
+        } else {
+            tail_ = new_node;
+        }
+        head_ = new_node;
+        ++size_;
+        return value(new_node);
+    }
+
+    // 리스트의 맨 뒤에 요소를 제자리 생성
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        index_type new_node = create_node(std::forward<Args>(args)...);
+        links_[new_node] = { tail_, npos };
+
+        if (tail_ != npos) {
+            links_[tail_].next = new_node;
+        } else {
+            head_ = new_node;
+        }
+        tail_ = new_node;
+        ++size_;
+        return value(new_node);
+    }
+
+    // 리스트의 맨 앞에 노드 추가
+    void push_front(const T& value) override {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) override {
+        emplace_front(std::move(value));
+    }
+
+    // 리스트의 맨 뒤에 노드 추가
+    void push_back(const T& value) override {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) override {
+        emplace_back(std::move(value));
+    }
+
+    // 지정된 위치 다음에 노드 삽입
+    void insert_after(size_t index, const T& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        insert_after(const_iterator(node_at(index), this), value);
+    }
+
+    void insert_after(size_t index, T&& value) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        insert_after(const_iterator(node_at(index), this), std::move(value));
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void append_range(Range&& range) {
+        for (auto&& element : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace_back(element);
+            } else {
+                emplace_back(std::move(element));
+            }
+        }
+    }
+
+    // 리스트의 맨 앞 노드 제거
+    void pop_front() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+
+        erase(cbegin());
+    }
+
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_front_value() override {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        T result = std::move(value(head_));
+        erase(cbegin());
+        return result;
+    }
+
+    // 지정된 위치의 노드 제거
+    void remove_at(size_t index) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        erase(const_iterator(node_at(index), this));
+    }
+
+    // 지정된 위치의 노드 데이터 반환
+    T& at(size_t index) override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        return value(node_at(index));
+    }
+
+    // 지정된 위치의 노드 데이터 반환 (상수 버전)
+    const T& at(size_t index) const override {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        return value(node_at(index));
+    }
+
+    // 전체 순회
+    void for_each(const std::function<void(T&)>& visit) override {
+        for (index_type i = head_; i != npos; i = links_[i].next) {
+            visit(value(i));
+        }
+    }
+
+    void for_each(const std::function<void(const T&)>& visit) const override {
+        for (index_type i = head_; i != npos; i = links_[i].next) {
+            visit(value(i));
+        }
+    }
+
+    // 모든 요소 제거 (확보한 슬롯 배열은 유지)
+    void clear() noexcept {
+        destroy_all();
+    }
+
+    // 반복자
+    iterator begin() noexcept { return iterator(head_, this); }
+    iterator end() noexcept { return iterator(npos, this); }
+    const_iterator begin() const noexcept { return const_iterator(head_, this); }
+    const_iterator end() const noexcept { return const_iterator(npos, this); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // 역방향 반복자
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 맨 앞/맨 뒤 요소 접근 (O(1))
+    T& front() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return value(head_);
+    }
+
+    const T& front() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return value(head_);
+    }
+
+    T& back() {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return value(tail_);
+    }
+
+    const T& back() const {
+        if (empty()) {
+            throw std::runtime_error("List is empty");
+        }
+        return value(tail_);
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 다음에 삽입 (O(1))
+     * @return 새로 삽입된 요소를 가리키는 반복자
+     */
+    iterator insert_after(const_iterator pos, const T& value) {
+        if (pos.index_ == npos) {
+            throw std::out_of_range("Cannot insert after end()");
+        }
+        return emplace(std::next(pos), value);
+    }
+
+    iterator insert_after(const_iterator pos, T&& value) {
+        if (pos.index_ == npos) {
+            throw std::out_of_range("Cannot insert after end()");
+        }
+        return emplace(std::next(pos), std::move(value));
+    }
+
+    // 반복자가 가리키는 노드 앞에 삽입 (O(1), end()면 맨 뒤에 추가)
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 앞에 요소를 제자리 생성 (O(1), end()면 맨 뒤에 추가)
+     * @return 새로 삽입된 요소를 가리키는 반복자
+     */
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        if (pos.index_ == npos) {
+            emplace_back(std::forward<Args>(args)...);
+            return iterator(tail_, this);
+        }
+        if (pos.index_ == head_) {
+            emplace_front(std::forward<Args>(args)...);
+            return iterator(head_, this);
+        }
+
+        index_type next = pos.index_;
+        index_type new_node = create_node(std::forward<Args>(args)...);
+        index_type prev = links_[next].prev;
+        links_[new_node] = { prev, next };
+        links_[prev].next = new_node;
+        links_[next].prev = new_node;
+        ++size_;
+        return iterator(new_node, this);
+    }
+
+    /**
+     * @brief 반복자가 가리키는 노드 제거 (O(1))
+     * @return 제거된 요소 다음 위치의 반복자
+     */
+    iterator erase(const_iterator pos) {
+        if (pos.index_ == npos) {
+            throw std::out_of_range("Cannot erase end()");
+        }
+
+        index_type target = pos.index_;
+        index_type prev = links_[target].prev;
+        index_type next = links_[target].next;
+
+        if (prev != npos) {
+            links_[prev].next = next;
+        } else {
+            head_ = next;
+        }
+
+        if (next != npos) {
+            links_[next].prev = prev;
+        } else {
+            tail_ = prev;
+        }
+
+        destroy_node(target);
+        --size_;
+        return iterator(next, this);
+    }
+
+    // 리스트의 모든 요소 출력
+    void print() const override {
+        std::cout << "List contents: ";
+        for (index_type i = head_; i != npos; i = links_[i].next) {
+            std::cout << value(i) << " ";
+        }
+        std::cout << std::endl;
+    }
+};
+
+namespace pmr {
+    // std::pmr 메모리 리소스를 사용하는 인덱스 기반 이중 연결 리스트
+    template<typename T>
+    using VectorDoubleLinkedList = ::VectorDoubleLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+#endif // VECTOR_DOUBLE_LINKED_LIST_HPP
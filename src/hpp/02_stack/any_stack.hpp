@@ -0,0 +1,133 @@
+#ifndef ANY_STACK_HPP
+#define ANY_STACK_HPP
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "container_traits.hpp"
+
+/**
+ * @brief 타입 소거(type-erased) 스택
+ * 스택 연산을 제공하는 아무 타입(is_stack_v)이나 소유하고, 실행 중에 구현을 바꿔 끼울 수 있게 함
+ * - 감싸는 타입이 IStack을 상속할 필요 없음
+ * - 연산마다 가상 호출이 한 번 일어나므로 메뉴처럼 구현을 실행 중에 고르는 곳에서만 사용
+ *   (성능이 중요한 루프는 구체 타입을 템플릿 인자로 받아 정적으로 호출)
+ * - 이동만 가능 (이동된 객체는 대입 또는 소멸만 가능)
+ */
+template<typename T>
+class AnyStack final {
+private:
+    // 감싼 스택에 대한 연산 목록
+    struct Concept {
+        virtual ~Concept() = default;
+        virtual bool empty() const = 0;
+        virtual size_t size() const = 0;
+        virtual size_t capacity() const = 0;
+        virtual void push(const T& value) = 0;
+        virtual void push(T&& value) = 0;
+        virtual void pop() = 0;
+        virtual T pop_value() = 0;
+        virtual const T& peek() const = 0;
+        virtual T& peek() = 0;
+        virtual void clear() = 0;
+        virtual void print() const = 0;
+    };
+
+    // 구체 스택을 값으로 보관하고 연산을 그대로 전달 (Stack이 final이면 내부 호출은 정적)
+    template<typename Stack>
+    struct Model final : Concept {
+        Stack stack;
+
+        template<typename... Args>
+        explicit Model(Args&&... args) : stack(std::forward<Args>(args)...) {}
+
+        bool empty() const override { return stack.empty(); }
+        size_t size() const override { return stack.size(); }
+        size_t capacity() const override { return stack.capacity(); }
+        void push(const T& value) override { stack.push(value); }
+        void push(T&& value) override { stack.push(std::move(value)); }
+        void pop() override { stack.pop(); }
+        T pop_value() override { return stack.pop_value(); }
+        const T& peek() const override { return stack.peek(); }
+        T& peek() override { return stack.peek(); }
+        void clear() override { stack.clear(); }
+        void print() const override { stack.print(); }
+    };
+
+    std::unique_ptr<Concept> impl_;
+
+public:
+    // Stack을 인자로 제자리 생성 (복사/이동이 금지된 스택도 가능)
+    template<typename Stack, typename... Args>
+    explicit AnyStack(std::in_place_type_t<Stack>, Args&&... args)
+        : impl_(std::make_unique<Model<Stack>>(std::forward<Args>(args)...)) {
+        static_assert(is_stack_v<Stack>, "Stack must provide the IStack operations");
+        static_assert(std::is_same_v<stack_value_t<Stack>, T>, "Stack element type must be T");
+    }
+
+    // 이미 만든 스택을 이동해 보관
+    template<typename Stack,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<Stack>, AnyStack> &&
+                                         !std::is_lvalue_reference_v<Stack>>>
+    AnyStack(Stack&& stack)
+        : AnyStack(std::in_place_type<std::decay_t<Stack>>, std::move(stack)) {}
+
+    AnyStack(AnyStack&&) noexcept = default;
+    AnyStack& operator=(AnyStack&&) noexcept = default;
+
+    // 스택이 비어있는지 확인
+    [[nodiscard]] bool empty() const {
+        return impl_->empty();
+    }
+
+    // 현재 스택 크기 반환
+    [[nodiscard]] size_t size() const {
+        return impl_->size();
+    }
+
+    // 현재 스택 용량 반환
+    [[nodiscard]] size_t capacity() const {
+        return impl_->capacity();
+    }
+
+    // 스택에 요소 추가
+    void push(const T& value) {
+        impl_->push(value);
+    }
+
+    void push(T&& value) {
+        impl_->push(std::move(value));
+    }
+
+    // 스택에서 요소 제거
+    void pop() {
+        impl_->pop();
+    }
+
+    // 최상단 요소를 이동으로 꺼내며 제거
+    T pop_value() {
+        return impl_->pop_value();
+    }
+
+    // 최상단 요소 확인 (const 버전)
+    const T& peek() const {
+        return impl_->peek();
+    }
+
+    // 최상단 요소 확인
+    T& peek() {
+        return impl_->peek();
+    }
+
+    // 스택 초기화
+    void clear() {
+        impl_->clear();
+    }
+
+    // 스택 내용 출력
+    void print() const {
+        impl_->print();
+    }
+};
+
+#endif // ANY_STACK_HPP
@@ -4,18 +4,34 @@
 #include <memory>
 #include <stdexcept>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include "i_stack.hpp"
-
-template<typename T>
-class ArrayStack : public IStack<T> {
+#include "growth_policy.hpp"
+
+// std::size()로 요소 수를 미리 알 수 있는 범위인지 판별
+template<typename Range, typename = void>
+struct is_sized_range : std::false_type {};
+
+template<typename Range>
+struct is_sized_range<Range, std::void_t<decltype(std::size(std::declval<Range&>()))>>
+    : std::true_type {};
+
+/**
+ * @brief 배열 기반 스택
+ * @tparam GrowthPolicy 가득 찼을 때의 확장 정책 (GeometricGrowth, HalfGrowth)
+ * @tparam ShrinkPolicy pop/clear 시의 축소 정책 (QuarterShrink, NeverShrink, HysteresisShrink)
+ */
+template<typename T, typename GrowthPolicy = GeometricGrowth, typename ShrinkPolicy = QuarterShrink>
+class ArrayStack final : public IStack<T> {
 private:
     static const size_t INITIAL_CAPACITY = 8;     // 초기 스택 크기
-    static const size_t GROWTH_FACTOR = 2;        // 확장 비율
-    static constexpr float SHRINK_THRESHOLD = 0.25f;  // 축소 임계값
 
     std::unique_ptr<T[]> elements_;         // 요소를 저장할 동적 배열
     size_t size_;                          // 현재 저장된 요소의 수
     size_t capacity_;                      // 현재 할당된 배열의 크기
+    ResizeStats stats_;                    // 재할당 통계
 
     // 스택 크기 조정
     void resize(size_t new_capacity) {
@@ -24,6 +40,12 @@ private:
             new_elements[i] = std::move(elements_[i]);
         }
         elements_ = std::move(new_elements);
+        if (new_capacity > capacity_) {
+            ++stats_.grow_count;
+        } else {
+            ++stats_.shrink_count;
+        }
+        stats_.elements_moved += size_;
         capacity_ = new_capacity;
     }
 
@@ -59,14 +81,82 @@ public:
         return capacity_;
     }
 
+    // 최소 new_capacity개를 담을 수 있도록 미리 확보
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            resize(new_capacity);
+        }
+    }
+
+    // 용량을 현재 크기에 맞춤
+    void shrink_to_fit() {
+        if (size_ < capacity_) {
+            resize(size_);
+        }
+    }
+
+    // 재할당 통계 조회/초기화
+    [[nodiscard]] const ResizeStats& resize_stats() const noexcept {
+        return stats_;
+    }
+
+    void reset_resize_stats() noexcept {
+        stats_ = ResizeStats{};
+    }
+
     // 스택에 요소 추가
     void push(const T& value) override {
         if (size_ == capacity_) {
-            resize(capacity_ * GROWTH_FACTOR);
+            emplace(value);
+            return;
         }
         elements_[size_++] = value;
     }
 
+    void push(T&& value) override {
+        if (size_ == capacity_) {
+            emplace(std::move(value));
+            return;
+        }
+        elements_[size_++] = std::move(value);
+    }
+
+    // 인자로 요소를 생성하여 추가
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        if (size_ == capacity_) {
+            // 확장 전에 값을 먼저 생성 (인자가 스택 안의 요소를 참조해도 안전)
+            T value(std::forward<Args>(args)...);
+            resize(GrowthPolicy::grow(capacity_, size_ + 1));
+            elements_[size_] = std::move(value);
+        } else {
+            elements_[size_] = T(std::forward<Args>(args)...);
+        }
+        return elements_[size_++];
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 순서대로 추가 (마지막 요소가 최상단)
+     * 크기를 알 수 있는 범위는 한 번만 확장하고, rvalue 범위는 요소를 이동
+     */
+    template<typename Range>
+    void push_range(Range&& range) {
+        if constexpr (is_sized_range<Range>::value) {
+            size_t required = size_ + static_cast<size_t>(std::size(range));
+            if (required > capacity_) {
+                resize(GrowthPolicy::grow(capacity_, required));
+            }
+        }
+
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                push(value);
+            } else {
+                push(std::move(value));
+            }
+        }
+    }
+
     // 스택에서 요소 제거
     void pop() override {
         if (empty()) {
@@ -75,16 +165,23 @@ public:
 
         --size_;
 
-        // 스택 크기가 충분히 작아지면 배열 크기 축소
-        if (size_ < capacity_ * SHRINK_THRESHOLD && capacity_ > INITIAL_CAPACITY) {
-            size_t new_capacity = capacity_ / GROWTH_FACTOR;
-            if (new_capacity < INITIAL_CAPACITY) {
-                new_capacity = INITIAL_CAPACITY;
-            }
+        // 스택 크기가 충분히 작아지면 축소 정책에 따라 배열 크기 축소
+        size_t new_capacity = ShrinkPolicy::shrink(size_, capacity_, INITIAL_CAPACITY);
+        if (new_capacity != capacity_) {
             resize(new_capacity);
         }
     }
 
+    // 최상단 요소를 이동으로 꺼내며 제거
+    T pop_value() override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        T value = std::move(elements_[size_ - 1]);
+        pop();
+        return value;
+    }
+
     // 최상단 요소 확인 (const 버전)
     const T& peek() const override {
         if (empty()) {
@@ -101,10 +198,10 @@ public:
         return elements_[size_ - 1];
     }
 
-    // 스택 초기화
+    // 스택 초기화 (축소 정책이 허용하면 초기 용량으로 복귀)
     void clear() override {
         size_ = 0;
-        if (capacity_ > INITIAL_CAPACITY) {
+        if (ShrinkPolicy::release_on_clear && capacity_ > INITIAL_CAPACITY) {
             resize(INITIAL_CAPACITY);
         }
     }
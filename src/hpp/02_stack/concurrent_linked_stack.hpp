@@ -0,0 +1,205 @@
+#ifndef CONCURRENT_LINKED_STACK_HPP
+#define CONCURRENT_LINKED_STACK_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "i_stack.hpp"
+#include "hazard_pointer.hpp"
+
+/**
+ * @brief lock-free 연결 리스트 기반 스택 (Treiber stack)
+ * 최상단 포인터 하나를 CAS로 갱신하므로 여러 스레드가 잠금 없이 동시에 push/pop 가능
+ * - pop은 최상단 노드를 해저드 포인터로 보호한 뒤 CAS하므로, 노드가 해제되거나
+ *   같은 주소로 재사용되는 일이 없어 ABA 문제가 생기지 않음
+ * - 꺼낸 노드는 바로 해제하지 않고 HazardPointerDomain에 retire하여 안전하게 회수
+ * - size()는 동시 수정 중에는 근사값
+ * - peek()/print()는 참조를 반환하거나 전체를 순회하므로 다른 스레드가 pop하지 않을 때만 사용
+ *   (동시 사용 시에는 try_pop 사용)
+ */
+template<typename T>
+class ConcurrentLinkedStack final : public IStack<T> {
+private:
+    // 노드 구조체 정의
+    struct Node {
+        T data;
+        Node* next;
+
+        // 새로운 노드 생성시 인자로 데이터를 제자리 생성
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : data(std::forward<Args>(args)...), next(nullptr) {}
+    };
+
+    alignas(64) std::atomic<Node*> top_;    // 스택의 최상위 노드
+    alignas(64) std::atomic<size_t> size_;  // 현재 스택에 저장된 요소의 수 (근사값)
+
+    // 노드를 최상단에 연결 (CAS 재시도)
+    // 크기는 연결 전에 늘려, 다른 스레드가 곧바로 pop해도 0 아래로 내려가지 않게 함
+    void push_node(Node* node) noexcept {
+        size_.fetch_add(1, std::memory_order_relaxed);
+        node->next = top_.load(std::memory_order_relaxed);
+        while (!top_.compare_exchange_weak(node->next, node,
+                                           std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    // 최상단 노드를 떼어냄 (비어있으면 nullptr)
+    // 반환된 노드는 다른 스레드가 아직 읽고 있을 수 있으므로 직접 해제하지 않고 retire
+    Node* pop_node() noexcept {
+        HazardPointerDomain& domain = HazardPointerDomain::global();
+        Node* old_top;
+        for (;;) {
+            old_top = domain.protect(top_);
+            if (old_top == nullptr) {
+                break;
+            }
+            // 보호 중이므로 old_top->next를 읽어도 안전 (해제/재사용되지 않음)
+            if (top_.compare_exchange_weak(old_top, old_top->next,
+                                           std::memory_order_acquire, std::memory_order_relaxed)) {
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+        domain.clear();
+        return old_top;
+    }
+
+    // 노드 목록 전체 해제 (다른 스레드가 접근하지 않을 때만 사용)
+    static void delete_chain(Node* node) noexcept {
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+public:
+    // 생성자
+    ConcurrentLinkedStack() : top_(nullptr), size_(0) {}
+
+    // 복사/이동 금지 (다른 스레드가 참조하는 공유 객체)
+    ConcurrentLinkedStack(const ConcurrentLinkedStack&) = delete;
+    ConcurrentLinkedStack& operator=(const ConcurrentLinkedStack&) = delete;
+
+    // 소멸자 (모든 스레드의 사용이 끝난 뒤 호출되어야 함)
+    ~ConcurrentLinkedStack() override {
+        delete_chain(top_.load(std::memory_order_acquire));
+    }
+
+    // 스택이 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return top_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    // 현재 스택 크기 반환 (동시 수정 중에는 근사값)
+    [[nodiscard]] size_t size() const override {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    // 현재 스택 용량 반환 (연결 리스트는 이론적으로 무제한)
+    [[nodiscard]] size_t capacity() const override {
+        return size_t(-1);  // 최대값 반환
+    }
+
+    // 스택에 요소 추가
+    void push(const T& value) override {
+        emplace(value);
+    }
+
+    void push(T&& value) override {
+        emplace(std::move(value));
+    }
+
+    // 인자로 요소를 생성하여 추가 (노드는 CAS 전에 생성하므로 예외 발생 시 스택은 그대로)
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        push_node(new Node(std::in_place, std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief 최상단 요소를 꺼내 value에 이동
+     * @return 꺼냈으면 true, 비어있었으면 false (동시 사용 시 권장)
+     */
+    bool try_pop(T& value) {
+        Node* node = pop_node();
+        if (node == nullptr) {
+            return false;
+        }
+        // 노드를 떼어낸 스레드만 data에 접근하므로 이동해도 안전
+        value = std::move(node->data);
+        HazardPointerDomain::global().retire(node);
+        return true;
+    }
+
+    // 스택에서 요소 제거
+    void pop() override {
+        Node* node = pop_node();
+        if (node == nullptr) {
+            throw std::runtime_error("Stack is empty");
+        }
+        HazardPointerDomain::global().retire(node);
+    }
+
+    // 최상단 요소를 이동으로 꺼내며 제거
+    T pop_value() override {
+        Node* node = pop_node();
+        if (node == nullptr) {
+            throw std::runtime_error("Stack is empty");
+        }
+        T value = std::move(node->data);
+        HazardPointerDomain::global().retire(node);
+        return value;
+    }
+
+    // 최상단 요소 확인 (const 버전, 다른 스레드가 pop하지 않을 때만 안전)
+    const T& peek() const override {
+        Node* node = top_.load(std::memory_order_acquire);
+        if (node == nullptr) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return node->data;
+    }
+
+    // 최상단 요소 확인 (다른 스레드가 pop하지 않을 때만 안전)
+    T& peek() override {
+        Node* node = top_.load(std::memory_order_acquire);
+        if (node == nullptr) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return node->data;
+    }
+
+    // 스택 초기화
+    // 노드 목록 전체를 한 번에 떼어낸 뒤 retire (동시에 pop 중인 스레드가 있어도 안전)
+    void clear() override {
+        Node* node = top_.exchange(nullptr, std::memory_order_acquire);
+        HazardPointerDomain& domain = HazardPointerDomain::global();
+        while (node) {
+            Node* next = node->next;
+            domain.retire(node);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            node = next;
+        }
+    }
+
+    // 스택 내용 출력 (다른 스레드가 pop하지 않을 때만 안전)
+    void print() const override {
+        const Node* current = top_.load(std::memory_order_acquire);
+        if (current == nullptr) {
+            std::cout << "Stack is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Stack (size=" << size() << "): TOP [ ";
+        while (current != nullptr) {
+            std::cout << current->data << " ";
+            current = current->next;
+        }
+        std::cout << "] BOTTOM" << std::endl;
+    }
+};
+
+#endif // CONCURRENT_LINKED_STACK_HPP
@@ -0,0 +1,313 @@
+#ifndef ELIMINATION_BACKOFF_STACK_HPP
+#define ELIMINATION_BACKOFF_STACK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "i_stack.hpp"
+#include "hazard_pointer.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief 소거 백오프(elimination-backoff) lock-free 스택 (Hendler, Shavit, Yerushalmi, 2004)
+ * Treiber 스택의 최상단 CAS가 경합으로 실패하면, 최상단 대신 소거 배열의 임의 슬롯에서
+ * 반대 연산(push ↔ pop)을 기다렸다가 만나면 값을 직접 주고받고 둘 다 완료
+ * - 만난 push/pop 쌍은 최상단 포인터를 건드리지 않으므로 경합이 심할수록 처리량이 유지됨
+ * - push는 노드를 슬롯에 올려두고 잠시 기다리며, pop은 슬롯의 노드를 CAS로 가져감
+ * - 슬롯에 올린 노드는 push 스레드가 해저드 포인터로 보호하므로, 가져간 쪽이 해제한 주소가
+ *   같은 슬롯에 다시 올라와 혼동되는 ABA가 생기지 않음
+ * - 최상단 pop은 ConcurrentLinkedStack과 같이 해저드 포인터로 보호한 뒤 CAS
+ * @tparam Slots 소거 배열 크기 (경합하는 스레드 수 정도가 적당)
+ */
+template<typename T, size_t Slots = 8>
+class EliminationBackoffStack final : public IStack<T> {
+    static_assert(Slots > 0, "elimination array requires at least one slot");
+
+private:
+    static constexpr int SPINS = 64;        // 소거 슬롯에서 상대를 기다리는 횟수
+    static constexpr size_t OFFER_HAZARD = 1;  // push 대기 중 자기 노드를 보호하는 해저드 슬롯
+
+    // 노드 구조체 정의
+    struct Node {
+        T data;
+        Node* next;
+
+        // 새로운 노드 생성시 인자로 데이터를 제자리 생성
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : data(std::forward<Args>(args)...), next(nullptr) {}
+    };
+
+    // 소거 슬롯 (거짓 공유를 막기 위해 캐시 라인 단위로 분리)
+    struct alignas(64) Exchanger {
+        std::atomic<Node*> offer{nullptr};   // push가 올려둔 노드 (비어있으면 nullptr)
+    };
+
+    alignas(64) std::atomic<Node*> top_;    // 스택의 최상위 노드
+    alignas(64) std::atomic<size_t> size_;  // 현재 스택에 저장된 요소의 수 (근사값)
+    Exchanger exchangers_[Slots];           // 소거 배열
+    std::atomic<uint64_t> eliminations_;    // 소거로 완료된 push/pop 쌍 수
+
+    static void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#endif
+    }
+
+    // 스레드별 xorshift 난수로 소거 슬롯 선택
+    static size_t random_slot() noexcept {
+        thread_local uint32_t state = 0;
+        if (state == 0) {
+            state = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&state)) | 1u;
+        }
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state % Slots;
+    }
+
+    // 최상단에 한 번 연결 시도
+    bool try_push_top(Node* node) noexcept {
+        Node* old_top = top_.load(std::memory_order_relaxed);
+        node->next = old_top;
+        return top_.compare_exchange_strong(old_top, node,
+                                            std::memory_order_release, std::memory_order_relaxed);
+    }
+
+    // 소거 슬롯에 노드를 올려두고 pop을 기다림
+    // 반환값: pop이 가져갔으면 true, 아무도 오지 않아 회수했으면 false
+    bool try_eliminate_push(Node* node) noexcept {
+        Exchanger& exchanger = exchangers_[random_slot()];
+        Node* expected = nullptr;
+        if (!exchanger.offer.compare_exchange_strong(expected, node, std::memory_order_release,
+                                                     std::memory_order_relaxed)) {
+            return false;   // 다른 push가 사용 중
+        }
+
+        for (int spin = 0; spin < SPINS; ++spin) {
+            if (exchanger.offer.load(std::memory_order_acquire) != node) {
+                return true;
+            }
+            cpu_relax();
+        }
+
+        // 기다려도 오지 않으면 회수 (실패했다면 그 사이에 pop이 가져간 것)
+        expected = node;
+        return !exchanger.offer.compare_exchange_strong(expected, nullptr, std::memory_order_acquire,
+                                                        std::memory_order_relaxed);
+    }
+
+    // 최상단에서 한 번 떼어내기 시도
+    // 반환값: 성공 시 true (node에 떼어낸 노드, 비어있으면 nullptr), CAS 경합으로 실패 시 false
+    bool try_pop_top(Node*& node) noexcept {
+        HazardPointerDomain& domain = HazardPointerDomain::global();
+        Node* old_top = domain.protect(top_);
+        if (old_top == nullptr) {
+            domain.clear();
+            node = nullptr;
+            return true;
+        }
+        // 보호 중이므로 old_top->next를 읽어도 안전 (해제/재사용되지 않음)
+        bool popped = top_.compare_exchange_strong(old_top, old_top->next,
+                                                   std::memory_order_acquire, std::memory_order_relaxed);
+        domain.clear();
+        node = old_top;
+        return popped;
+    }
+
+    // 소거 슬롯에서 push가 올려둔 노드를 가져옴 (없으면 nullptr)
+    Node* try_eliminate_pop() noexcept {
+        Exchanger& exchanger = exchangers_[random_slot()];
+        for (int spin = 0; spin < SPINS; ++spin) {
+            Node* offered = exchanger.offer.load(std::memory_order_acquire);
+            // 가져오기 전에는 노드를 역참조하지 않음 (포인터 비교만)
+            if (offered != nullptr &&
+                exchanger.offer.compare_exchange_strong(offered, nullptr, std::memory_order_acquire,
+                                                        std::memory_order_relaxed)) {
+                eliminations_.fetch_add(1, std::memory_order_relaxed);
+                return offered;
+            }
+            cpu_relax();
+        }
+        return nullptr;
+    }
+
+    // 노드를 스택에 넣음 (최상단 CAS 실패 시 소거 시도 후 재시도)
+    void push_node(Node* node) noexcept {
+        size_.fetch_add(1, std::memory_order_relaxed);
+        if (try_push_top(node)) {
+            return;
+        }
+
+        HazardPointerDomain& domain = HazardPointerDomain::global();
+        domain.publish(node, OFFER_HAZARD);
+        for (;;) {
+            if (try_eliminate_push(node) || try_push_top(node)) {
+                break;
+            }
+        }
+        domain.clear(OFFER_HAZARD);
+    }
+
+    // 노드를 꺼냄 (비어있으면 nullptr, 꺼낸 노드는 호출자가 retire)
+    Node* pop_node() noexcept {
+        for (;;) {
+            Node* node;
+            if (try_pop_top(node)) {
+                if (node != nullptr) {
+                    size_.fetch_sub(1, std::memory_order_relaxed);
+                }
+                return node;
+            }
+            if ((node = try_eliminate_pop()) != nullptr) {
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                return node;
+            }
+        }
+    }
+
+    // 꺼낸 노드의 값을 옮기고 회수 대기 목록에 추가
+    static T take(Node* node) {
+        T value = std::move(node->data);
+        HazardPointerDomain::global().retire(node);
+        return value;
+    }
+
+public:
+    // 생성자
+    EliminationBackoffStack() : top_(nullptr), size_(0), eliminations_(0) {}
+
+    // 복사/이동 금지 (다른 스레드가 참조하는 공유 객체)
+    EliminationBackoffStack(const EliminationBackoffStack&) = delete;
+    EliminationBackoffStack& operator=(const EliminationBackoffStack&) = delete;
+
+    // 소멸자 (모든 스레드의 사용이 끝난 뒤 호출되어야 함)
+    ~EliminationBackoffStack() override {
+        Node* node = top_.load(std::memory_order_acquire);
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    // 스택이 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return top_.load(std::memory_order_acquire) == nullptr;
+    }
+
+    // 현재 스택 크기 반환 (동시 수정 중에는 근사값)
+    [[nodiscard]] size_t size() const override {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    // 현재 스택 용량 반환 (연결 리스트는 이론적으로 무제한)
+    [[nodiscard]] size_t capacity() const override {
+        return size_t(-1);  // 최대값 반환
+    }
+
+    // 소거 배열에서 만나 완료된 push/pop 쌍 수
+    [[nodiscard]] uint64_t eliminations() const noexcept {
+        return eliminations_.load(std::memory_order_relaxed);
+    }
+
+    // 스택에 요소 추가
+    void push(const T& value) override {
+        emplace(value);
+    }
+
+    void push(T&& value) override {
+        emplace(std::move(value));
+    }
+
+    // 인자로 요소를 생성하여 추가
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        push_node(new Node(std::in_place, std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief 최상단 요소를 꺼내 value에 이동
+     * @return 꺼냈으면 true, 비어있었으면 false (동시 사용 시 권장)
+     */
+    bool try_pop(T& value) {
+        Node* node = pop_node();
+        if (node == nullptr) {
+            return false;
+        }
+        value = take(node);
+        return true;
+    }
+
+    // 스택에서 요소 제거
+    void pop() override {
+        Node* node = pop_node();
+        if (node == nullptr) {
+            throw std::runtime_error("Stack is empty");
+        }
+        HazardPointerDomain::global().retire(node);
+    }
+
+    // 최상단 요소를 이동으로 꺼내며 제거
+    T pop_value() override {
+        Node* node = pop_node();
+        if (node == nullptr) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return take(node);
+    }
+
+    // 최상단 요소 확인 (const 버전, 다른 스레드가 pop하지 않을 때만 안전)
+    const T& peek() const override {
+        Node* node = top_.load(std::memory_order_acquire);
+        if (node == nullptr) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return node->data;
+    }
+
+    // 최상단 요소 확인 (다른 스레드가 pop하지 않을 때만 안전)
+    T& peek() override {
+        Node* node = top_.load(std::memory_order_acquire);
+        if (node == nullptr) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return node->data;
+    }
+
+    // 스택 초기화 (노드 목록 전체를 한 번에 떼어낸 뒤 retire)
+    void clear() override {
+        Node* node = top_.exchange(nullptr, std::memory_order_acquire);
+        HazardPointerDomain& domain = HazardPointerDomain::global();
+        while (node) {
+            Node* next = node->next;
+            domain.retire(node);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            node = next;
+        }
+    }
+
+    // 스택 내용 출력 (다른 스레드가 pop하지 않을 때만 안전)
+    void print() const override {
+        const Node* current = top_.load(std::memory_order_acquire);
+        if (current == nullptr) {
+            std::cout << "Stack is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Stack (size=" << size() << "): TOP [ ";
+        while (current != nullptr) {
+            std::cout << current->data << " ";
+            current = current->next;
+        }
+        std::cout << "] BOTTOM" << std::endl;
+    }
+};
+
+#endif // ELIMINATION_BACKOFF_STACK_HPP
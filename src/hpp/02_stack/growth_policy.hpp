@@ -0,0 +1,85 @@
+#ifndef GROWTH_POLICY_HPP
+#define GROWTH_POLICY_HPP
+
+#include <cstddef>
+
+/**
+ * 배열 기반 컨테이너의 확장/축소 정책
+ *
+ * 확장 정책: static size_t grow(size_t capacity, size_t required)
+ * - 가득 찼을 때 호출되며 required 이상의 새 용량을 반환
+ *
+ * 축소 정책: static size_t shrink(size_t size, size_t capacity, size_t min_capacity)
+ * - pop 이후 호출되며 새 용량을 반환 (capacity 그대로 반환하면 축소하지 않음)
+ * - release_on_clear: clear() 시 최소 용량으로 되돌릴지 여부
+ */
+
+// 2배 확장 (재할당 횟수 최소, 상각 O(1))
+struct GeometricGrowth {
+    static size_t grow(size_t capacity, size_t required) {
+        size_t new_capacity = capacity > 0 ? capacity : 1;
+        while (new_capacity < required) {
+            new_capacity *= 2;
+        }
+        return new_capacity;
+    }
+};
+
+// 1.5배 확장 (재할당은 늘지만 여유 메모리가 적고, 해제된 블록을 재사용하기 쉬움)
+struct HalfGrowth {
+    static size_t grow(size_t capacity, size_t required) {
+        size_t new_capacity = capacity;
+        while (new_capacity < required) {
+            new_capacity += new_capacity / 2 + 1;  // 작은 용량에서도 늘어나도록 +1
+        }
+        return new_capacity;
+    }
+};
+
+// 사용량이 25% 미만이면 절반으로 축소 (기존 ArrayStack 동작)
+struct QuarterShrink {
+    static constexpr bool release_on_clear = true;
+
+    static size_t shrink(size_t size, size_t capacity, size_t min_capacity) {
+        if (capacity > min_capacity && size < capacity / 4) {
+            size_t new_capacity = capacity / 2;
+            return new_capacity < min_capacity ? min_capacity : new_capacity;
+        }
+        return capacity;
+    }
+};
+
+// 축소하지 않음 (shrink_to_fit 호출 시에만 반환)
+struct NeverShrink {
+    static constexpr bool release_on_clear = false;
+
+    static size_t shrink(size_t, size_t capacity, size_t) {
+        return capacity;
+    }
+};
+
+// 사용량이 1/Divisor 미만일 때만 절반으로 축소
+// 축소 직후 사용량이 2/Divisor 이하이므로 확장/축소 경계 사이에 넓은 간격(히스테리시스)이 생겨
+// 경계 부근에서 push/pop이 반복되어도 재할당이 연달아 일어나지 않음
+template<size_t Divisor = 8>
+struct HysteresisShrink {
+    static_assert(Divisor >= 4, "shrink threshold must leave room below half capacity");
+    static constexpr bool release_on_clear = true;
+
+    static size_t shrink(size_t size, size_t capacity, size_t min_capacity) {
+        if (capacity > min_capacity && size < capacity / Divisor) {
+            size_t new_capacity = capacity / 2;
+            return new_capacity < min_capacity ? min_capacity : new_capacity;
+        }
+        return capacity;
+    }
+};
+
+// 재할당 통계 (워크로드별 정책 튜닝용)
+struct ResizeStats {
+    size_t grow_count = 0;      // 확장 재할당 횟수
+    size_t shrink_count = 0;    // 축소 재할당 횟수
+    size_t elements_moved = 0;  // 재할당 시 옮긴 요소 수 (누적)
+};
+
+#endif // GROWTH_POLICY_HPP
@@ -2,39 +2,140 @@
 #define LINKED_STACK_HPP
 
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 #include "i_stack.hpp"
-
-template<typename T>
-class LinkedStack : public IStack<T> {
+#include "slab_allocator.hpp"
+
+/**
+ * @brief 연결 리스트 기반 스택
+ * 노드를 할당자로 직접 관리하므로 소멸/초기화가 재귀 없이 반복문으로 진행됨
+ * @tparam Alloc 노드 할당에 사용할 할당자 (std::allocator, std::pmr::polymorphic_allocator, SlabAllocator 등)
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class LinkedStack final : public IStack<T> {
 private:
     // 노드 구조체 정의
     struct Node {
         T data;
-        std::unique_ptr<Node> next;
+        Node* next;
 
-        // 새로운 노드 생성시 데이터 초기화
-        explicit Node(const T& value) : data(value), next(nullptr) {}
+        // 새로운 노드 생성시 인자로 데이터를 제자리 생성
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : data(std::forward<Args>(args)...), next(nullptr) {}
     };
 
-    std::unique_ptr<Node> top_;   // 스택의 최상위 노드
-    size_t size_;                // 현재 스택에 저장된 요소의 수
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    NodeAllocator alloc_;   // 노드 할당자
+    Node* top_;             // 스택의 최상위 노드
+    size_t size_;           // 현재 스택에 저장된 요소의 수
+
+    // 할당자를 통해 노드 생성
+    template<typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* node = NodeTraits::allocate(alloc_, 1);
+        try {
+            NodeTraits::construct(alloc_, node, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    // 할당자를 통해 노드 해제
+    void destroy_node(Node* node) noexcept {
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+
+    // 모든 노드 해제
+    // 슬랩 풀을 단독으로 사용하고 소멸자 호출이 필요 없으면 청크 단위로 한꺼번에 반환
+    void destroy_all() noexcept {
+        if constexpr (supports_bulk_release<NodeAllocator>::value &&
+                      std::is_trivially_destructible_v<Node>) {
+            if (alloc_.try_release()) {
+                top_ = nullptr;
+                size_ = 0;
+                return;
+            }
+        }
+
+        while (top_) {
+            Node* next = top_->next;
+            destroy_node(top_);
+            top_ = next;
+        }
+        size_ = 0;
+    }
+
+    // 다른 스택의 노드를 그대로 넘겨받음
+    void steal(LinkedStack& other) noexcept {
+        top_ = other.top_;
+        size_ = other.size_;
+        other.top_ = nullptr;
+        other.size_ = 0;
+    }
 
 public:
+    using allocator_type = Alloc;
+
     // 생성자
-    LinkedStack() : top_(nullptr), size_(0) {}
+    LinkedStack() : LinkedStack(Alloc()) {}
+
+    // 지정한 할당자를 사용하는 빈 스택 생성
+    explicit LinkedStack(const Alloc& alloc) : alloc_(alloc), top_(nullptr), size_(0) {}
 
     // 복사 금지
     LinkedStack(const LinkedStack&) = delete;
     LinkedStack& operator=(const LinkedStack&) = delete;
 
-    // 이동 생성/대입 허용
-    LinkedStack(LinkedStack&&) = default;
-    LinkedStack& operator=(LinkedStack&&) = default;
+    // 이동 생성자 (할당자와 노드를 함께 이동)
+    LinkedStack(LinkedStack&& other) noexcept
+        : alloc_(std::move(other.alloc_)), top_(nullptr), size_(0) {
+        steal(other);
+    }
+
+    // 이동 대입 연산자
+    // 할당자가 전파되지 않고 서로 다르면 (pmr 등) 원소 단위로 옮김 (순서 유지)
+    LinkedStack& operator=(LinkedStack&& other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        destroy_all();
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+            steal(other);
+        } else if (alloc_ == other.alloc_) {
+            steal(other);
+        } else {
+            Node** link = &top_;
+            for (Node* current = other.top_; current; current = current->next) {
+                *link = create_node(std::move(current->data));
+                link = &(*link)->next;
+                ++size_;
+            }
+            other.destroy_all();
+        }
+        return *this;
+    }
+
+    // 소멸자 (노드 수와 무관하게 재귀 없이 해제)
+    ~LinkedStack() override {
+        destroy_all();
+    }
 
-    // 소멸자
-    ~LinkedStack() override = default;
+    // 노드 할당에 사용하는 할당자 반환
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator_type(alloc_);
+    }
 
     // 스택이 비어있는지 확인
     [[nodiscard]] bool empty() const override {
@@ -53,10 +154,36 @@ public:
 
     // 스택에 요소 추가
     void push(const T& value) override {
-        auto new_node = std::make_unique<Node>(value);
-        new_node->next = std::move(top_);
-        top_ = std::move(new_node);
+        emplace(value);
+    }
+
+    void push(T&& value) override {
+        emplace(std::move(value));
+    }
+
+    // 인자로 요소를 생성하여 추가
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        Node* new_node = create_node(std::forward<Args>(args)...);
+        new_node->next = top_;
+        top_ = new_node;
         ++size_;
+        return top_->data;
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 순서대로 추가 (마지막 요소가 최상단)
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void push_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace(value);
+            } else {
+                emplace(std::move(value));
+            }
+        }
     }
 
     // 스택에서 요소 제거
@@ -64,10 +191,22 @@ public:
         if (empty()) {
             throw std::runtime_error("Stack is empty");
         }
-        top_ = std::move(top_->next);
+        Node* old_top = top_;
+        top_ = top_->next;
+        destroy_node(old_top);
         --size_;
     }
 
+    // 최상단 요소를 이동으로 꺼내며 제거
+    T pop_value() override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        T value = std::move(top_->data);
+        pop();
+        return value;
+    }
+
     // 최상단 요소 확인 (const 버전)
     const T& peek() const override {
         if (empty()) {
@@ -84,11 +223,9 @@ public:
         return top_->data;
     }
 
-    // 스택 초기화
+    // 스택 초기화 (슬랩 풀 단독 사용 시 O(1) 일괄 반환)
     void clear() override {
-        while (!empty()) {
-            pop();
-        }
+        destroy_all();
     }
 
     // 스택 내용 출력
@@ -99,13 +236,19 @@ public:
         }
 
         std::cout << "Stack (size=" << size_ << "): TOP [ ";
-        Node* current = top_.get();
+        const Node* current = top_;
         while (current != nullptr) {
             std::cout << current->data << " ";
-            current = current->next.get();
+            current = current->next;
         }
         std::cout << "] BOTTOM" << std::endl;
     }
 };
 
-#endif // LINKED_STACK_HPP
\ No newline at end of file
+namespace pmr {
+    // std::pmr 메모리 리소스를 사용하는 연결 리스트 기반 스택
+    template<typename T>
+    using LinkedStack = ::LinkedStack<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+#endif // LINKED_STACK_HPP
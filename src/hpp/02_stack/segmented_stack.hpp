@@ -0,0 +1,291 @@
+#ifndef SEGMENTED_STACK_HPP
+#define SEGMENTED_STACK_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "i_stack.hpp"
+
+/**
+ * @brief 세그먼트 스택
+ * 크기가 2배씩 커지는 블록(세그먼트)을 연결해 쌓으므로 요소를 한 번도 옮기지 않음
+ * - push/pop 모두 최악의 경우에도 O(1) (배열 전체 복사로 인한 지연 없음)
+ * - peek()가 반환한 참조는 해당 요소가 pop되기 전까지 유효 (포인터 안정성)
+ * - 비워진 세그먼트 하나를 캐시해 두므로 블록 경계에서 push/pop이 반복되어도 할당/해제가 없음
+ * - 저장소는 초기화되지 않은 원시 메모리이며 요소는 placement new로 생성/소멸
+ */
+template<typename T>
+class SegmentedStack final : public IStack<T> {
+private:
+    static const size_t INITIAL_CAPACITY = 8;   // 첫 세그먼트 크기
+    static const size_t GROWTH_FACTOR = 2;      // 다음 세그먼트 크기 비율
+
+    // 세그먼트 헤더 (바로 뒤에 요소 배열이 이어짐)
+    struct Segment {
+        Segment* prev;      // 아래쪽(먼저 만든) 세그먼트
+        size_t capacity;    // 이 세그먼트의 요소 수
+    };
+
+    static constexpr size_t ALIGNMENT = std::max(alignof(Segment), alignof(T));
+    static constexpr size_t HEADER_SIZE = (sizeof(Segment) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    Segment* top_segment_;  // 현재 push/pop 하는 세그먼트
+    Segment* spare_;        // 가장 최근에 비워진 세그먼트 (다음 확장 시 재사용)
+    size_t used_;           // 현재 세그먼트에 들어있는 요소 수
+    size_t size_;           // 전체 요소 수
+    size_t capacity_;       // 연결된 세그먼트 용량의 합 (spare 제외)
+    size_t segment_count_;  // 연결된 세그먼트 수
+
+    static T* data(Segment* segment) noexcept {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(segment) + HEADER_SIZE);
+    }
+
+    static const T* data(const Segment* segment) noexcept {
+        return reinterpret_cast<const T*>(reinterpret_cast<const char*>(segment) + HEADER_SIZE);
+    }
+
+    static Segment* allocate_segment(size_t capacity) {
+        void* memory = ::operator new(HEADER_SIZE + capacity * sizeof(T), std::align_val_t(ALIGNMENT));
+        Segment* segment = static_cast<Segment*>(memory);
+        segment->prev = nullptr;
+        segment->capacity = capacity;
+        return segment;
+    }
+
+    static void free_segment(Segment* segment) noexcept {
+        ::operator delete(segment, std::align_val_t(ALIGNMENT));
+    }
+
+    static void destroy_range(T* first, size_t count) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < count; ++i) {
+                first[i].~T();
+            }
+        }
+    }
+
+    // 현재 세그먼트가 가득 찼을 때 다음 세그먼트를 연결 (캐시된 세그먼트 우선)
+    void push_segment() {
+        Segment* segment = spare_;
+        if (segment != nullptr) {
+            spare_ = nullptr;
+        } else {
+            size_t capacity = top_segment_ ? top_segment_->capacity * GROWTH_FACTOR : INITIAL_CAPACITY;
+            segment = allocate_segment(capacity);
+        }
+        segment->prev = top_segment_;
+        top_segment_ = segment;
+        used_ = 0;
+        capacity_ += segment->capacity;
+        ++segment_count_;
+    }
+
+    // 비워진 현재 세그먼트를 떼어내 캐시하고 아래 세그먼트로 이동
+    // 캐시는 하나만 유지 (기존 캐시는 더 큰 세그먼트이므로 해제)
+    void pop_segment() noexcept {
+        Segment* segment = top_segment_;
+        top_segment_ = segment->prev;
+        used_ = top_segment_->capacity;
+        capacity_ -= segment->capacity;
+        --segment_count_;
+        if (spare_ != nullptr) {
+            free_segment(spare_);
+        }
+        spare_ = segment;
+    }
+
+    // 모든 요소를 소멸시키고 세그먼트를 해제
+    void destroy_all() noexcept {
+        Segment* segment = top_segment_;
+        size_t count = used_;
+        while (segment != nullptr) {
+            Segment* prev = segment->prev;
+            destroy_range(data(segment), count);
+            free_segment(segment);
+            segment = prev;
+            count = segment ? segment->capacity : 0;
+        }
+        if (spare_ != nullptr) {
+            free_segment(spare_);
+        }
+        top_segment_ = nullptr;
+        spare_ = nullptr;
+        used_ = 0;
+        size_ = 0;
+        capacity_ = 0;
+        segment_count_ = 0;
+    }
+
+    // 다른 스택의 세그먼트를 그대로 넘겨받음
+    void steal(SegmentedStack& other) noexcept {
+        top_segment_ = std::exchange(other.top_segment_, nullptr);
+        spare_ = std::exchange(other.spare_, nullptr);
+        used_ = std::exchange(other.used_, 0);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+        segment_count_ = std::exchange(other.segment_count_, 0);
+    }
+
+public:
+    // 생성자 (첫 push 때 세그먼트 할당)
+    SegmentedStack() noexcept
+        : top_segment_(nullptr), spare_(nullptr), used_(0), size_(0), capacity_(0), segment_count_(0) {}
+
+    // 복사 금지
+    SegmentedStack(const SegmentedStack&) = delete;
+    SegmentedStack& operator=(const SegmentedStack&) = delete;
+
+    // 이동 생성/대입 (세그먼트 포인터만 이동하므로 요소의 주소도 그대로 유지)
+    SegmentedStack(SegmentedStack&& other) noexcept : SegmentedStack() {
+        steal(other);
+    }
+
+    SegmentedStack& operator=(SegmentedStack&& other) noexcept {
+        if (this != &other) {
+            destroy_all();
+            steal(other);
+        }
+        return *this;
+    }
+
+    // 소멸자
+    ~SegmentedStack() override {
+        destroy_all();
+    }
+
+    // 스택이 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return size_ == 0;
+    }
+
+    // 현재 스택 크기 반환
+    [[nodiscard]] size_t size() const override {
+        return size_;
+    }
+
+    // 현재 스택 용량 반환 (연결된 세그먼트 용량의 합)
+    [[nodiscard]] size_t capacity() const override {
+        return capacity_;
+    }
+
+    // 연결된 세그먼트 수
+    [[nodiscard]] size_t segment_count() const noexcept {
+        return segment_count_;
+    }
+
+    // 스택에 요소 추가
+    void push(const T& value) override {
+        emplace(value);
+    }
+
+    void push(T&& value) override {
+        emplace(std::move(value));
+    }
+
+    // 인자로 요소를 생성하여 추가 (기존 요소는 옮겨지지 않으므로 인자가 스택 안을 참조해도 안전)
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        if (top_segment_ == nullptr || used_ == top_segment_->capacity) {
+            push_segment();
+            try {
+                ::new (static_cast<void*>(data(top_segment_))) T(std::forward<Args>(args)...);
+            } catch (...) {
+                if (top_segment_->prev != nullptr) {
+                    pop_segment();
+                }
+                throw;
+            }
+        } else {
+            ::new (static_cast<void*>(data(top_segment_) + used_)) T(std::forward<Args>(args)...);
+        }
+        ++used_;
+        ++size_;
+        return data(top_segment_)[used_ - 1];
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 순서대로 추가 (마지막 요소가 최상단)
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void push_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace(value);
+            } else {
+                emplace(std::move(value));
+            }
+        }
+    }
+
+    // 스택에서 요소 제거
+    void pop() override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        --used_;
+        --size_;
+        data(top_segment_)[used_].~T();
+        if (used_ == 0 && top_segment_->prev != nullptr) {
+            pop_segment();
+        }
+    }
+
+    // 최상단 요소를 이동으로 꺼내며 제거
+    T pop_value() override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        T value = std::move(data(top_segment_)[used_ - 1]);
+        pop();
+        return value;
+    }
+
+    // 최상단 요소 확인 (const 버전)
+    const T& peek() const override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return data(top_segment_)[used_ - 1];
+    }
+
+    // 최상단 요소 확인
+    T& peek() override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return data(top_segment_)[used_ - 1];
+    }
+
+    // 스택 초기화 (모든 세그먼트 해제)
+    void clear() override {
+        destroy_all();
+    }
+
+    // 스택 내용 출력
+    void print() const override {
+        if (empty()) {
+            std::cout << "Stack is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Stack (size=" << size_ << ", capacity=" << capacity_
+                  << ", segments=" << segment_count_ << "): TOP [ ";
+        const Segment* segment = top_segment_;
+        size_t count = used_;
+        while (segment != nullptr) {
+            for (size_t i = count; i > 0; --i) {
+                std::cout << data(segment)[i - 1] << " ";
+            }
+            segment = segment->prev;
+            count = segment ? segment->capacity : 0;
+        }
+        std::cout << "] BOTTOM" << std::endl;
+    }
+};
+
+#endif // SEGMENTED_STACK_HPP
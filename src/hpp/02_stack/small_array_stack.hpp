@@ -0,0 +1,314 @@
+#ifndef SMALL_ARRAY_STACK_HPP
+#define SMALL_ARRAY_STACK_HPP
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "i_stack.hpp"
+#include "array_stack.hpp"
+
+/**
+ * @brief 작은 버퍼 최적화(SBO) 배열 기반 스택
+ * N개까지는 객체 안의 인라인 저장소를 사용하므로 힙 할당이 전혀 없고,
+ * 넘치면 힙 버퍼로 옮겨 기하급수적으로 확장
+ * - 저장소는 초기화되지 않은 원시 메모리이며 요소는 placement new로 생성/소멸
+ * - trivially copyable 타입은 재배치 시 memcpy 한 번으로 옮김
+ * @tparam N 인라인 슬롯 수 (파서/DFS 스택처럼 대부분 64개 이하로 머무는 용도 기준)
+ */
+template<typename T, size_t N = 64>
+class SmallArrayStack final : public IStack<T> {
+    static_assert(N > 0, "SmallArrayStack requires at least one inline slot");
+
+private:
+    static const size_t GROWTH_FACTOR = 2;  // 확장 비율
+
+    alignas(T) unsigned char inline_storage_[N * sizeof(T)];  // 인라인 저장소 (미초기화)
+    T* data_;           // 현재 저장소 (인라인 또는 힙)
+    size_t size_;       // 현재 저장된 요소의 수
+    size_t capacity_;   // 현재 저장소의 슬롯 수
+
+    T* inline_data() noexcept {
+        return reinterpret_cast<T*>(inline_storage_);
+    }
+
+    const T* inline_data() const noexcept {
+        return reinterpret_cast<const T*>(inline_storage_);
+    }
+
+    static T* allocate(size_t n) {
+        return std::allocator<T>().allocate(n);
+    }
+
+    static void deallocate(T* p, size_t n) noexcept {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    // 요소 n개를 src에서 미초기화 메모리 dst로 재배치 (src의 요소는 소멸)
+    // 이동 생성이 예외를 던질 수 있으면 복사하여 원본을 보존 (강한 예외 보장)
+    static void relocate(T* dst, T* src, size_t n) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (n > 0) {
+                std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+            }
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < n; ++i) {
+                    ::new (static_cast<void*>(dst + i)) T(std::move_if_noexcept(src[i]));
+                }
+            } catch (...) {
+                destroy_range(dst, i);
+                throw;
+            }
+            destroy_range(src, n);
+        }
+    }
+
+    static void destroy_range(T* p, size_t n) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < n; ++i) {
+                p[i].~T();
+            }
+        }
+    }
+
+    // 힙 버퍼 해제 후 인라인 저장소로 복귀 (요소는 이미 소멸/이동된 상태)
+    void release_heap() noexcept {
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+        }
+        data_ = inline_data();
+        capacity_ = N;
+    }
+
+    // new_capacity 크기의 저장소로 모든 요소를 옮김
+    void reallocate(size_t new_capacity) {
+        T* new_data = new_capacity <= N ? inline_data() : allocate(new_capacity);
+        if (new_data == data_) {
+            return;
+        }
+        try {
+            relocate(new_data, data_, size_);
+        } catch (...) {
+            if (new_data != inline_data()) {
+                deallocate(new_data, new_capacity);
+            }
+            throw;
+        }
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+        }
+        data_ = new_data;
+        capacity_ = new_data == inline_data() ? N : new_capacity;
+    }
+
+    // 다른 스택의 요소를 넘겨받음 (이 스택은 비어있는 인라인 상태여야 함)
+    void steal(SmallArrayStack& other) {
+        if (other.is_inline()) {
+            relocate(inline_data(), other.data_, other.size_);
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+public:
+    // 인라인 슬롯 수
+    static constexpr size_t inline_capacity = N;
+
+    // 생성자 (힙 할당 없음)
+    SmallArrayStack() noexcept : data_(inline_data()), size_(0), capacity_(N) {}
+
+    // 복사 금지
+    SmallArrayStack(const SmallArrayStack&) = delete;
+    SmallArrayStack& operator=(const SmallArrayStack&) = delete;
+
+    // 이동 생성자 (힙 버퍼는 포인터만 넘기고, 인라인 요소는 재배치)
+    SmallArrayStack(SmallArrayStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : data_(inline_data()), size_(0), capacity_(N) {
+        steal(other);
+    }
+
+    // 이동 대입 연산자
+    SmallArrayStack& operator=(SmallArrayStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            steal(other);
+        }
+        return *this;
+    }
+
+    // 소멸자
+    ~SmallArrayStack() override {
+        destroy_range(data_, size_);
+        release_heap();
+    }
+
+    // 스택이 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return size_ == 0;
+    }
+
+    // 현재 스택 크기 반환
+    [[nodiscard]] size_t size() const override {
+        return size_;
+    }
+
+    // 현재 스택 용량 반환
+    [[nodiscard]] size_t capacity() const override {
+        return capacity_;
+    }
+
+    // 요소가 인라인 저장소에 있는지 (힙을 사용하지 않는 상태인지) 확인
+    [[nodiscard]] bool is_inline() const noexcept {
+        return data_ == inline_data();
+    }
+
+    // 최소 new_capacity개를 담을 수 있도록 저장소 확보
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+
+    // 용량을 현재 크기에 맞춤 (N개 이하면 인라인 저장소로 복귀)
+    void shrink_to_fit() {
+        if (!is_inline() && size_ < capacity_) {
+            reallocate(size_);
+        }
+    }
+
+    // 스택에 요소 추가
+    void push(const T& value) override {
+        emplace(value);
+    }
+
+    void push(T&& value) override {
+        emplace(std::move(value));
+    }
+
+    // 인자로 요소를 생성하여 추가
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        if (size_ < capacity_) {
+            ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+            return data_[size_++];
+        }
+
+        // 새 버퍼에 값을 먼저 생성한 뒤 기존 요소를 재배치 (인자가 스택 안의 요소를 참조해도 안전)
+        size_t new_capacity = capacity_ * GROWTH_FACTOR;
+        T* new_data = allocate(new_capacity);
+        try {
+            ::new (static_cast<void*>(new_data + size_)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        try {
+            relocate(new_data, data_, size_);
+        } catch (...) {
+            new_data[size_].~T();
+            deallocate(new_data, new_capacity);
+            throw;
+        }
+        if (!is_inline()) {
+            deallocate(data_, capacity_);
+        }
+        data_ = new_data;
+        capacity_ = new_capacity;
+        return data_[size_++];
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 순서대로 추가 (마지막 요소가 최상단)
+     * 크기를 알 수 있는 범위는 한 번만 확장하고, rvalue 범위는 요소를 이동
+     */
+    template<typename Range>
+    void push_range(Range&& range) {
+        if constexpr (is_sized_range<Range>::value) {
+            size_t required = size_ + static_cast<size_t>(std::size(range));
+            if (required > capacity_) {
+                size_t new_capacity = capacity_;
+                while (new_capacity < required) {
+                    new_capacity *= GROWTH_FACTOR;
+                }
+                reallocate(new_capacity);
+            }
+        }
+
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace(value);
+            } else {
+                emplace(std::move(value));
+            }
+        }
+    }
+
+    // 스택에서 요소 제거 (버퍼는 축소하지 않음)
+    void pop() override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        --size_;
+        data_[size_].~T();
+    }
+
+    // 최상단 요소를 이동으로 꺼내며 제거
+    T pop_value() override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        T value = std::move(data_[size_ - 1]);
+        pop();
+        return value;
+    }
+
+    // 최상단 요소 확인 (const 버전)
+    const T& peek() const override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return data_[size_ - 1];
+    }
+
+    // 최상단 요소 확인
+    T& peek() override {
+        if (empty()) {
+            throw std::runtime_error("Stack is empty");
+        }
+        return data_[size_ - 1];
+    }
+
+    // 스택 초기화 (힙 버퍼를 반환하고 인라인 저장소로 복귀)
+    void clear() override {
+        destroy_range(data_, size_);
+        size_ = 0;
+        release_heap();
+    }
+
+    // 스택 내용 출력
+    void print() const override {
+        if (empty()) {
+            std::cout << "Stack is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Stack (size=" << size_ << ", capacity=" << capacity_
+                  << (is_inline() ? ", inline" : ", heap") << "): TOP [ ";
+        for (size_t i = size_; i > 0; --i) {
+            std::cout << data_[i - 1] << " ";
+        }
+        std::cout << "] BOTTOM" << std::endl;
+    }
+};
+
+#endif // SMALL_ARRAY_STACK_HPP
@@ -0,0 +1,314 @@
+#ifndef ARRAY_QUEUE_HPP
+#define ARRAY_QUEUE_HPP
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "i_queue.hpp"
+
+/**
+ * @brief 배열 기반 원형 큐 (링 버퍼)
+ * 원형 큐(06_circular_queue.c)의 템플릿 버전
+ * - 용량은 항상 2의 거듭제곱이므로 나머지 연산 대신 마스크(& mask)로 위치 계산
+ * - 저장소는 초기화되지 않은 원시 메모리이며 요소는 placement new로 생성/소멸
+ * - 확장 시 감긴 두 구간을 새 배열 앞쪽으로 순서대로 재배치
+ *   (trivially copyable 타입은 memcpy, 그 외에는 이동 생성이 예외를 던지지 않을 때만 이동)
+ */
+template<typename T>
+class ArrayQueue final : public IQueue<T> {
+private:
+    static const size_t INITIAL_CAPACITY = 8;   // 초기 큐 크기 (2의 거듭제곱)
+    static const size_t GROWTH_FACTOR = 2;      // 확장 비율
+
+    T* elements_;       // 요소를 저장할 원시 배열
+    size_t capacity_;   // 현재 할당된 배열의 크기 (2의 거듭제곱)
+    size_t mask_;       // capacity_ - 1
+    size_t head_;       // 첫 번째 요소의 위치
+    size_t size_;       // 현재 저장된 요소의 수
+
+    static T* allocate(size_t n) {
+        return std::allocator<T>().allocate(n);
+    }
+
+    static void deallocate(T* p, size_t n) noexcept {
+        if (p != nullptr) {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    // 앞에서 i번째 요소의 위치
+    size_t position(size_t i) const noexcept {
+        return (head_ + i) & mask_;
+    }
+
+    static void destroy_range(T* p, size_t n) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < n; ++i) {
+                p[i].~T();
+            }
+        }
+    }
+
+    // 저장된 요소를 모두 소멸 (위치 정보는 호출자가 정리)
+    void destroy_stored() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < size_; ++i) {
+                elements_[position(i)].~T();
+            }
+        }
+    }
+
+    // 모든 요소 소멸 (저장소는 유지)
+    void destroy_elements() noexcept {
+        destroy_stored();
+        head_ = 0;
+        size_ = 0;
+    }
+
+    /**
+     * @brief 모든 요소를 앞에서부터 순서대로 미초기화 메모리 dst로 재배치
+     * trivially copyable 타입은 감긴 두 구간([head_, capacity_), [0, tail))을 memcpy 두 번으로 복사,
+     * 그 외에는 이동 생성이 예외를 던질 수 있으면 복사하고 모두 성공한 뒤에만 원본을 소멸 (강한 예외 보장)
+     */
+    void relocate_to(T* dst) {
+        if (size_ == 0) {
+            return;
+        }
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            size_t first = capacity_ - head_;
+            if (first > size_) {
+                first = size_;
+            }
+            std::memcpy(static_cast<void*>(dst), static_cast<const void*>(elements_ + head_), first * sizeof(T));
+            std::memcpy(static_cast<void*>(dst + first), static_cast<const void*>(elements_), (size_ - first) * sizeof(T));
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < size_; ++i) {
+                    ::new (static_cast<void*>(dst + i)) T(std::move_if_noexcept(elements_[position(i)]));
+                }
+            } catch (...) {
+                destroy_range(dst, i);
+                throw;
+            }
+            destroy_stored();
+        }
+    }
+
+    // 재배치가 끝난 새 배열을 저장소로 채택
+    void adopt(T* new_elements, size_t new_capacity) noexcept {
+        deallocate(elements_, capacity_);
+        elements_ = new_elements;
+        capacity_ = new_capacity;
+        mask_ = new_capacity - 1;
+        head_ = 0;
+    }
+
+    // 큐 크기 조정 (new_capacity는 2의 거듭제곱이며 size_ 이상)
+    void resize(size_t new_capacity) {
+        T* new_elements = allocate(new_capacity);
+        try {
+            relocate_to(new_elements);
+        } catch (...) {
+            deallocate(new_elements, new_capacity);
+            throw;
+        }
+        adopt(new_elements, new_capacity);
+    }
+
+public:
+    // 생성자
+    ArrayQueue() : elements_(allocate(INITIAL_CAPACITY)),
+                   capacity_(INITIAL_CAPACITY),
+                   mask_(INITIAL_CAPACITY - 1),
+                   head_(0),
+                   size_(0) {}
+
+    // 복사 금지
+    ArrayQueue(const ArrayQueue&) = delete;
+    ArrayQueue& operator=(const ArrayQueue&) = delete;
+
+    // 이동 생성자 (저장소 포인터만 이동, 이동된 큐는 용량 0의 빈 큐)
+    ArrayQueue(ArrayQueue&& other) noexcept
+        : elements_(std::exchange(other.elements_, nullptr)),
+          capacity_(std::exchange(other.capacity_, 0)),
+          mask_(std::exchange(other.mask_, 0)),
+          head_(std::exchange(other.head_, 0)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    // 이동 대입 연산자
+    ArrayQueue& operator=(ArrayQueue&& other) noexcept {
+        if (this != &other) {
+            destroy_elements();
+            deallocate(elements_, capacity_);
+            elements_ = std::exchange(other.elements_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            mask_ = std::exchange(other.mask_, 0);
+            head_ = std::exchange(other.head_, 0);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    // 소멸자
+    ~ArrayQueue() override {
+        destroy_elements();
+        deallocate(elements_, capacity_);
+    }
+
+    // 큐가 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return size_ == 0;
+    }
+
+    // 현재 큐 크기 반환
+    [[nodiscard]] size_t size() const override {
+        return size_;
+    }
+
+    // 현재 큐 용량 반환
+    [[nodiscard]] size_t capacity() const override {
+        return capacity_;
+    }
+
+    // 최소 new_capacity개를 재할당 없이 담을 수 있도록 확장 (2의 거듭제곱으로 올림)
+    void reserve(size_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        size_t capacity = capacity_ ? capacity_ : INITIAL_CAPACITY;
+        while (capacity < new_capacity) {
+            capacity *= GROWTH_FACTOR;
+        }
+        resize(capacity);
+    }
+
+    // 큐에 요소 추가
+    void push(const T& value) override {
+        emplace(value);
+    }
+
+    void push(T&& value) override {
+        emplace(std::move(value));
+    }
+
+    // 인자로 요소를 생성하여 맨 뒤에 추가
+    // 가득 찼으면 먼저 새 요소를 새 배열에 만든 뒤 기존 요소를 옮기므로, 인자가 큐 안을 참조해도 안전
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        if (size_ == capacity_) {
+            size_t new_capacity = capacity_ ? capacity_ * GROWTH_FACTOR : INITIAL_CAPACITY;
+            T* new_elements = allocate(new_capacity);
+            try {
+                ::new (static_cast<void*>(new_elements + size_)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_elements, new_capacity);
+                throw;
+            }
+            try {
+                relocate_to(new_elements);
+            } catch (...) {
+                new_elements[size_].~T();
+                deallocate(new_elements, new_capacity);
+                throw;
+            }
+            adopt(new_elements, new_capacity);
+        } else {
+            ::new (static_cast<void*>(elements_ + position(size_))) T(std::forward<Args>(args)...);
+        }
+        ++size_;
+        return back();
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 순서대로 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void push_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace(value);
+            } else {
+                emplace(std::move(value));
+            }
+        }
+    }
+
+    // 맨 앞 요소 제거
+    void pop() override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        elements_[head_].~T();
+        head_ = (head_ + 1) & mask_;
+        --size_;
+    }
+
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_value() override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        T value = std::move(elements_[head_]);
+        pop();
+        return value;
+    }
+
+    // 맨 앞 요소 확인 (const 버전)
+    const T& front() const override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return elements_[head_];
+    }
+
+    // 맨 앞 요소 확인
+    T& front() override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return elements_[head_];
+    }
+
+    // 맨 뒤 요소 확인 (const 버전)
+    const T& back() const override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return elements_[position(size_ - 1)];
+    }
+
+    // 맨 뒤 요소 확인
+    T& back() override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return elements_[position(size_ - 1)];
+    }
+
+    // 큐 초기화 (용량은 유지)
+    void clear() override {
+        destroy_elements();
+    }
+
+    // 큐 내용 출력
+    void print() const override {
+        if (empty()) {
+            std::cout << "Queue is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Queue (size=" << size_ << ", capacity=" << capacity_ << "): FRONT [ ";
+        for (size_t i = 0; i < size_; ++i) {
+            std::cout << elements_[position(i)] << " ";
+        }
+        std::cout << "] REAR" << std::endl;
+    }
+};
+
+#endif // ARRAY_QUEUE_HPP
@@ -0,0 +1,327 @@
+#ifndef CHANNEL_HPP
+#define CHANNEL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include "array_queue.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief 블로킹 생산자/소비자 채널 (고정 용량)
+ * 배열 기반 원형 큐(ArrayQueue)를 뮤텍스 하나로 보호하고 조건 변수로 대기
+ * - 가득 차면 생산자가 기다림 (back-pressure), 비어있으면 소비자가 기다림
+ * - 요소를 꺼낼 때 잠든 생산자가 있으면 적어도 하나는 항상 깨움 (가득 찬 동안에만 대기),
+ *   모두 깨우는 것은 용량의 1/4 이상이 비었을 때만 (한 칸 빌 때마다 모두 깨우면
+ *   생산자들이 한 칸을 두고 다투다 다시 잠드는 문맥 교환이 반복됨)
+ * - 경합이 없으면 시스템 호출 없음: std::mutex는 경합 시에만 futex로 잠들고,
+ *   알림은 잠든 스레드가 있을 때만 보냄 (대기자 수는 잠금 안에서 관리)
+ * - 잠들기 전에 요소 수(원자 변수)를 잠금 없이 잠시 확인하며 스핀하여 깨어나는 지연을 줄임
+ * - dequeue_batch는 잠금 한 번으로 여러 요소를 꺼내므로 요소당 동기화 비용이 작음
+ * - close() 이후 enqueue는 실패하고, dequeue는 남은 요소를 모두 꺼낸 뒤 실패
+ *   (기다리던 스레드는 모두 깨어남)
+ */
+template<typename T>
+class Channel {
+private:
+    static constexpr int SPINS = 64;    // 잠들기 전에 상태를 다시 확인하는 횟수
+
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    ArrayQueue<T> queue_;                   // 요소 저장소 (capacity_ 이상으로 늘어나지 않음)
+    size_t capacity_;                       // 최대 요소 수
+    size_t resume_free_;                    // 잠든 생산자를 모두 깨우는 빈 칸 수 (용량의 1/4, 최소 1)
+    std::atomic<size_t> count_;             // queue_.size()의 사본 (잠금 없는 스핀 확인용)
+    std::atomic<bool> closed_;
+    int consumers_waiting_;                 // not_empty_에서 잠든 소비자 수 (잠금 안에서만 접근)
+    int producers_waiting_;                 // not_full_에서 잠든 생산자 수
+
+    static void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#endif
+    }
+
+    // 조건이 참이 되거나 닫힐 때까지 잠금 없이 잠시 스핀
+    template<typename Predicate>
+    void spin_until(Predicate ready) const noexcept {
+        for (int spin = 0; spin < SPINS; ++spin) {
+            if (ready() || closed_.load(std::memory_order_relaxed)) {
+                return;
+            }
+            cpu_relax();
+        }
+    }
+
+    bool full() const noexcept {
+        return queue_.size() >= capacity_;
+    }
+
+    // 잠금을 놓은 뒤 대기 중인 상대에게 알림 (잠든 스레드가 없으면 생략)
+    static void wake(std::condition_variable& cv, int waiting, size_t count) {
+        if (waiting == 0) {
+            return;
+        }
+        if (count > 1 && waiting > 1) {
+            cv.notify_all();
+        } else {
+            cv.notify_one();
+        }
+    }
+
+    // 요소를 넣을 자리가 생길 때까지 대기 (잠금을 잡은 상태로 호출, 닫혔으면 false)
+    bool wait_not_full(std::unique_lock<std::mutex>& lock) {
+        while (full() && !closed_.load(std::memory_order_relaxed)) {
+            ++producers_waiting_;
+            not_full_.wait(lock);
+            --producers_waiting_;
+        }
+        return !closed_.load(std::memory_order_relaxed);
+    }
+
+    // 요소가 들어올 때까지 최대 deadline까지 대기 (요소가 있으면 true)
+    template<typename Clock, typename Duration>
+    bool wait_not_empty_until(std::unique_lock<std::mutex>& lock,
+                              const std::chrono::time_point<Clock, Duration>& deadline) {
+        while (queue_.empty() && !closed_.load(std::memory_order_relaxed)) {
+            ++consumers_waiting_;
+            std::cv_status status = not_empty_.wait_until(lock, deadline);
+            --consumers_waiting_;
+            if (status == std::cv_status::timeout) {
+                break;
+            }
+        }
+        return !queue_.empty();
+    }
+
+    // 요소가 들어오거나 닫힐 때까지 대기 (요소가 있으면 true)
+    bool wait_not_empty(std::unique_lock<std::mutex>& lock) {
+        while (queue_.empty() && !closed_.load(std::memory_order_relaxed)) {
+            ++consumers_waiting_;
+            not_empty_.wait(lock);
+            --consumers_waiting_;
+        }
+        return !queue_.empty();
+    }
+
+    // 요소 하나를 넣고 소비자를 깨움 (잠금을 잡은 상태로 호출, 반환 시 잠금 해제)
+    template<typename U>
+    void push_locked(std::unique_lock<std::mutex>& lock, U&& value) {
+        queue_.push(std::forward<U>(value));
+        count_.store(queue_.size(), std::memory_order_release);
+        int waiting = consumers_waiting_;
+        lock.unlock();
+        wake(not_empty_, waiting, 1);
+    }
+
+    // 최대 max_count개를 out에 꺼내고 생산자를 깨움 (잠금을 잡은 상태로 호출, 반환 시 잠금 해제)
+    // - 잠든 생산자가 있으면 하나는 항상 깨움: 이미 깨운(잠금을 기다리는) 스레드는 다시 선택되지
+    //   않으므로, 꺼낼 때마다 잠든 생산자가 하나씩 깨어나 빈 칸이 있는데 계속 잠들어 있는 일이 없음
+    // - 여유가 resume_free_ 이상이면 모두 깨움
+    template<typename OutputIt>
+    size_t pop_locked(std::unique_lock<std::mutex>& lock, OutputIt& out, size_t max_count) {
+        size_t n = 0;
+        while (n < max_count && !queue_.empty()) {
+            *out = queue_.pop_value();
+            ++out;
+            ++n;
+        }
+        size_t free = capacity_ - queue_.size();
+        count_.store(queue_.size(), std::memory_order_release);
+        int waiting = n > 0 ? producers_waiting_ : 0;
+        lock.unlock();
+        wake(not_full_, waiting, free >= resume_free_ ? free : 1);
+        return n;
+    }
+
+public:
+    /**
+     * @brief 생성자
+     * @param capacity 최대 요소 수 (가득 차면 enqueue가 대기)
+     */
+    explicit Channel(size_t capacity = 1024)
+        : capacity_(capacity), resume_free_(capacity / 4 ? capacity / 4 : 1),
+          count_(0), closed_(false), consumers_waiting_(0), producers_waiting_(0) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Channel capacity must be positive");
+        }
+        queue_.reserve(capacity);
+    }
+
+    // 복사/이동 금지 (여러 스레드가 참조하는 공유 객체)
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    // 최대 요소 수
+    [[nodiscard]] size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    // 현재 요소 수 (동시 수정 중에는 근사값)
+    [[nodiscard]] size_t size() const noexcept {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    [[nodiscard]] bool is_closed() const noexcept {
+        return closed_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief 채널 닫기
+     * 이후 enqueue는 모두 실패하고, 기다리던 생산자/소비자는 모두 깨어남
+     * 남아있는 요소는 계속 꺼낼 수 있음
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_.store(true, std::memory_order_release);
+        }
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+    /**
+     * @brief 자리가 생길 때까지 기다렸다가 추가 (back-pressure)
+     * @return 추가했으면 true, 채널이 닫혔으면 false
+     */
+    bool enqueue(const T& value) {
+        return enqueue_impl(value);
+    }
+
+    bool enqueue(T&& value) {
+        return enqueue_impl(std::move(value));
+    }
+
+    // 기다리지 않고 추가 (가득 찼거나 닫혔으면 false)
+    bool try_enqueue(const T& value) {
+        return try_enqueue_impl(value);
+    }
+
+    bool try_enqueue(T&& value) {
+        return try_enqueue_impl(std::move(value));
+    }
+
+    /**
+     * @brief count개를 순서대로 추가 (자리가 날 때마다 잠금 한 번에 가능한 만큼 넣음)
+     * @return 추가한 수 (채널이 닫히면 count보다 작을 수 있음)
+     */
+    template<typename InputIt>
+    size_t enqueue_batch(InputIt first, size_t count) {
+        size_t sent = 0;
+        while (sent < count) {
+            spin_until([this] { return count_.load(std::memory_order_acquire) < capacity_; });
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!wait_not_full(lock)) {
+                break;
+            }
+            size_t n = 0;
+            while (sent < count && !full()) {
+                queue_.push(*first);
+                ++first;
+                ++sent;
+                ++n;
+            }
+            count_.store(queue_.size(), std::memory_order_release);
+            int waiting = consumers_waiting_;
+            lock.unlock();
+            wake(not_empty_, waiting, n);
+        }
+        return sent;
+    }
+
+    /**
+     * @brief 요소가 들어올 때까지 기다렸다가 꺼냄
+     * @return 꺼냈으면 true, 채널이 닫혔고 비어있으면 false
+     */
+    bool dequeue(T& value) {
+        spin_until([this] { return count_.load(std::memory_order_acquire) > 0; });
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!wait_not_empty(lock)) {
+            return false;
+        }
+        T* out = &value;
+        return pop_locked(lock, out, 1) == 1;
+    }
+
+    // 기다리지 않고 꺼냄 (비어있으면 false)
+    bool try_dequeue(T& value) {
+        if (count_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+            return false;
+        }
+        T* out = &value;
+        return pop_locked(lock, out, 1) == 1;
+    }
+
+    /**
+     * @brief 최대 timeout 동안 요소를 기다린 뒤, 있는 만큼 최대 max_count개를 한 번에 꺼냄
+     * @param out 꺼낸 요소를 기록할 출력 반복자
+     * @return 꺼낸 수 (시간 초과 또는 닫히고 비어있으면 0, 닫힘 여부는 is_closed()로 구분)
+     */
+    template<typename OutputIt, typename Rep, typename Period>
+    size_t dequeue_batch(OutputIt out, size_t max_count, const std::chrono::duration<Rep, Period>& timeout) {
+        if (max_count == 0) {
+            return 0;
+        }
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        spin_until([this] { return count_.load(std::memory_order_acquire) > 0; });
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!wait_not_empty_until(lock, deadline)) {
+            return 0;
+        }
+        return pop_locked(lock, out, max_count);
+    }
+
+    // 요소가 들어오거나 닫힐 때까지 기다린 뒤, 있는 만큼 최대 max_count개를 꺼냄
+    template<typename OutputIt>
+    size_t dequeue_batch(OutputIt out, size_t max_count) {
+        if (max_count == 0) {
+            return 0;
+        }
+        spin_until([this] { return count_.load(std::memory_order_acquire) > 0; });
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!wait_not_empty(lock)) {
+            return 0;
+        }
+        return pop_locked(lock, out, max_count);
+    }
+
+private:
+    template<typename U>
+    bool enqueue_impl(U&& value) {
+        spin_until([this] { return count_.load(std::memory_order_acquire) < capacity_; });
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!wait_not_full(lock)) {
+            return false;
+        }
+        push_locked(lock, std::forward<U>(value));
+        return true;
+    }
+
+    template<typename U>
+    bool try_enqueue_impl(U&& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closed_.load(std::memory_order_relaxed) || full()) {
+            return false;
+        }
+        push_locked(lock, std::forward<U>(value));
+        return true;
+    }
+};
+
+#endif // CHANNEL_HPP
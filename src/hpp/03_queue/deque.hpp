@@ -0,0 +1,421 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "i_queue.hpp"
+
+/**
+ * @brief 고정 크기 블록으로 구성된 양방향 큐 (덱)
+ * 블록 포인터를 담은 맵(map) + 크기가 같은 요소 블록들
+ * - 양쪽 끝 삽입/삭제 모두 O(1), 임의 접근 operator[]도 O(1) (블록 번호와 블록 내 위치 계산)
+ * - 맵이 부족하면 블록 포인터만 가운데로 다시 배치하거나 2배로 키우고 요소는 옮기지 않음
+ *   → 삽입/삭제 후에도 남아있는 요소의 참조는 계속 유효 (참조 안정성)
+ * - 블록은 필요할 때 할당하고 비워지면 반환, 비워진 블록 하나는 캐시하여
+ *   블록 경계에서 push/pop이 반복되어도 할당/해제가 없음
+ * - IQueue의 push/pop은 각각 push_back/pop_front에 해당
+ * @tparam BlockSize 블록 하나에 담는 요소 수 (기본: 약 4KB)
+ */
+template<typename T, size_t BlockSize = (sizeof(T) < 256 ? 4096 / sizeof(T) : 16)>
+class Deque final : public IQueue<T> {
+    static_assert(BlockSize > 0, "BlockSize must be positive");
+
+private:
+    static const size_t INITIAL_MAP_SIZE = 8;   // 초기 맵 크기 (블록 포인터 수)
+
+    std::unique_ptr<T*[]> map_;     // 블록 포인터 배열 (사용하지 않는 칸은 nullptr)
+    size_t map_size_;               // 맵의 칸 수
+    size_t start_;                  // 첫 요소의 전역 위치 (블록 = start_ / BlockSize)
+    size_t size_;                   // 현재 저장된 요소의 수
+    size_t block_count_;            // 맵에 연결된 블록 수 (spare 제외)
+    T* spare_;                      // 가장 최근에 비워진 블록 (다음 할당 시 재사용)
+
+    static T* allocate_block() {
+        return std::allocator<T>().allocate(BlockSize);
+    }
+
+    static void free_block(T* block) noexcept {
+        std::allocator<T>().deallocate(block, BlockSize);
+    }
+
+    // 전역 위치의 요소 주소
+    T* slot(size_t index) const noexcept {
+        return map_[index / BlockSize] + index % BlockSize;
+    }
+
+    // 맵의 칸에 블록이 없으면 연결 (캐시된 블록 우선)
+    // @return 새로 연결했으면 true (요소 생성 실패 시 되돌리기 위해)
+    bool attach_block(size_t block) {
+        if (map_[block] != nullptr) {
+            return false;
+        }
+        if (spare_ != nullptr) {
+            map_[block] = std::exchange(spare_, nullptr);
+        } else {
+            map_[block] = allocate_block();
+        }
+        ++block_count_;
+        return true;
+    }
+
+    // 비워진 블록을 맵에서 떼어 캐시 (캐시는 하나만 유지)
+    void detach_block(size_t block) noexcept {
+        T* memory = std::exchange(map_[block], nullptr);
+        --block_count_;
+        if (spare_ == nullptr) {
+            spare_ = memory;
+        } else {
+            free_block(memory);
+        }
+    }
+
+    // 비워진 덱의 시작 위치를 맵 가운데로 되돌림 (양쪽 모두 여유가 생김)
+    void recenter_if_empty() noexcept {
+        if (size_ == 0) {
+            start_ = map_size_ / 2 * BlockSize;
+        }
+    }
+
+    /**
+     * @brief 양쪽 끝에 블록 하나 이상의 여유가 있도록 맵을 재구성
+     * 사용 중인 블록이 맵의 절반 이하이면 같은 크기로 가운데 재배치, 아니면 2배로 확장
+     * 블록 포인터만 복사하므로 요소의 주소는 변하지 않음
+     */
+    void reallocate_map() {
+        size_t first_block = start_ / BlockSize;
+        size_t used = size_ ? (start_ + size_ - 1) / BlockSize - first_block + 1 : 0;
+
+        size_t new_map_size = map_size_ ? map_size_ : INITIAL_MAP_SIZE;
+        while (new_map_size < 2 * (used + 1)) {
+            new_map_size *= 2;
+        }
+
+        std::unique_ptr<T*[]> new_map(new T*[new_map_size]());
+        size_t new_first = (new_map_size - used) / 2;
+        for (size_t i = 0; i < used; ++i) {
+            new_map[new_first + i] = map_[first_block + i];
+        }
+
+        map_ = std::move(new_map);
+        map_size_ = new_map_size;
+        start_ = new_first * BlockSize + start_ % BlockSize;
+    }
+
+    // 모든 요소를 소멸시키고 블록을 반환 (맵과 캐시 블록은 유지)
+    void destroy_elements() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < size_; ++i) {
+                slot(start_ + i)->~T();
+            }
+        }
+        for (size_t block = 0; block < map_size_; ++block) {
+            if (map_[block] != nullptr) {
+                detach_block(block);
+            }
+        }
+        size_ = 0;
+        recenter_if_empty();
+    }
+
+    // 다른 덱의 맵과 블록을 그대로 넘겨받음
+    void steal(Deque& other) noexcept {
+        map_ = std::move(other.map_);
+        map_size_ = std::exchange(other.map_size_, 0);
+        start_ = std::exchange(other.start_, 0);
+        size_ = std::exchange(other.size_, 0);
+        block_count_ = std::exchange(other.block_count_, 0);
+        spare_ = std::exchange(other.spare_, nullptr);
+    }
+
+public:
+    // 생성자 (첫 push 때 블록 할당)
+    Deque() : map_(new T*[INITIAL_MAP_SIZE]()),
+              map_size_(INITIAL_MAP_SIZE),
+              start_(INITIAL_MAP_SIZE / 2 * BlockSize),
+              size_(0),
+              block_count_(0),
+              spare_(nullptr) {}
+
+    // 복사 금지
+    Deque(const Deque&) = delete;
+    Deque& operator=(const Deque&) = delete;
+
+    // 이동 생성/대입 (맵만 이동하므로 요소의 주소도 그대로 유지)
+    Deque(Deque&& other) noexcept
+        : map_size_(0), start_(0), size_(0), block_count_(0), spare_(nullptr) {
+        steal(other);
+    }
+
+    Deque& operator=(Deque&& other) noexcept {
+        if (this != &other) {
+            if (map_) {
+                destroy_elements();
+            }
+            if (spare_ != nullptr) {
+                free_block(spare_);
+            }
+            steal(other);
+        }
+        return *this;
+    }
+
+    // 소멸자
+    ~Deque() override {
+        if (map_) {
+            destroy_elements();
+        }
+        if (spare_ != nullptr) {
+            free_block(spare_);
+        }
+    }
+
+    // 덱이 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return size_ == 0;
+    }
+
+    // 현재 덱 크기 반환
+    [[nodiscard]] size_t size() const override {
+        return size_;
+    }
+
+    // 현재 덱 용량 반환 (연결된 블록 용량의 합)
+    [[nodiscard]] size_t capacity() const override {
+        return block_count_ * BlockSize;
+    }
+
+    // 블록 하나에 담기는 요소 수
+    [[nodiscard]] static constexpr size_t block_size() noexcept {
+        return BlockSize;
+    }
+
+    // 인자로 요소를 생성하여 맨 뒤에 추가
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if ((start_ + size_) / BlockSize >= map_size_) {
+            reallocate_map();
+        }
+        size_t index = start_ + size_;
+        size_t block = index / BlockSize;
+        bool attached = attach_block(block);
+        try {
+            ::new (static_cast<void*>(slot(index))) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (attached) {
+                detach_block(block);
+            }
+            throw;
+        }
+        ++size_;
+        return *slot(index);
+    }
+
+    // 인자로 요소를 생성하여 맨 앞에 추가
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (start_ == 0) {
+            reallocate_map();
+        }
+        size_t index = start_ - 1;
+        size_t block = index / BlockSize;
+        bool attached = attach_block(block);
+        try {
+            ::new (static_cast<void*>(slot(index))) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (attached) {
+                detach_block(block);
+            }
+            throw;
+        }
+        start_ = index;
+        ++size_;
+        return *slot(index);
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void push_front(const T& value) {
+        emplace_front(value);
+    }
+
+    void push_front(T&& value) {
+        emplace_front(std::move(value));
+    }
+
+    // 큐 인터페이스: 맨 뒤에 추가
+    void push(const T& value) override {
+        emplace_back(value);
+    }
+
+    void push(T&& value) override {
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        return emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 순서대로 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void push_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace_back(value);
+            } else {
+                emplace_back(std::move(value));
+            }
+        }
+    }
+
+    // 맨 앞 요소 제거 (블록이 비면 반환)
+    void pop_front() {
+        if (empty()) {
+            throw std::runtime_error("Deque is empty");
+        }
+        size_t block = start_ / BlockSize;
+        slot(start_)->~T();
+        ++start_;
+        --size_;
+        if (start_ % BlockSize == 0 || size_ == 0) {
+            detach_block(block);
+        }
+        recenter_if_empty();
+    }
+
+    // 맨 뒤 요소 제거 (블록이 비면 반환)
+    void pop_back() {
+        if (empty()) {
+            throw std::runtime_error("Deque is empty");
+        }
+        size_t index = start_ + size_ - 1;
+        slot(index)->~T();
+        --size_;
+        if (index % BlockSize == 0 || size_ == 0) {
+            detach_block(index / BlockSize);
+        }
+        recenter_if_empty();
+    }
+
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_front_value() {
+        if (empty()) {
+            throw std::runtime_error("Deque is empty");
+        }
+        T value = std::move(*slot(start_));
+        pop_front();
+        return value;
+    }
+
+    // 맨 뒤 요소를 이동으로 꺼내며 제거
+    T pop_back_value() {
+        if (empty()) {
+            throw std::runtime_error("Deque is empty");
+        }
+        T value = std::move(*slot(start_ + size_ - 1));
+        pop_back();
+        return value;
+    }
+
+    // 큐 인터페이스: 맨 앞 요소 제거
+    void pop() override {
+        pop_front();
+    }
+
+    T pop_value() override {
+        return pop_front_value();
+    }
+
+    // 맨 앞 요소 확인 (const 버전)
+    const T& front() const override {
+        if (empty()) {
+            throw std::runtime_error("Deque is empty");
+        }
+        return *slot(start_);
+    }
+
+    // 맨 앞 요소 확인
+    T& front() override {
+        if (empty()) {
+            throw std::runtime_error("Deque is empty");
+        }
+        return *slot(start_);
+    }
+
+    // 맨 뒤 요소 확인 (const 버전)
+    const T& back() const override {
+        if (empty()) {
+            throw std::runtime_error("Deque is empty");
+        }
+        return *slot(start_ + size_ - 1);
+    }
+
+    // 맨 뒤 요소 확인
+    T& back() override {
+        if (empty()) {
+            throw std::runtime_error("Deque is empty");
+        }
+        return *slot(start_ + size_ - 1);
+    }
+
+    // 인덱스로 접근 (범위 검사 없음)
+    const T& operator[](size_t index) const noexcept {
+        return *slot(start_ + index);
+    }
+
+    T& operator[](size_t index) noexcept {
+        return *slot(start_ + index);
+    }
+
+    // 인덱스로 접근 (범위 검사)
+    const T& at(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return *slot(start_ + index);
+    }
+
+    T& at(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        return *slot(start_ + index);
+    }
+
+    // 덱 초기화 (맵과 캐시 블록 하나는 유지)
+    void clear() override {
+        if (map_) {
+            destroy_elements();
+        }
+    }
+
+    // 덱 내용 출력
+    void print() const override {
+        if (empty()) {
+            std::cout << "Deque is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Deque (size=" << size_ << ", blocks=" << block_count_ << "): FRONT [ ";
+        for (size_t i = 0; i < size_; ++i) {
+            std::cout << *slot(start_ + i) << " ";
+        }
+        std::cout << "] BACK" << std::endl;
+    }
+};
+
+#endif // DEQUE_HPP
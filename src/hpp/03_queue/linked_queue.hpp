@@ -0,0 +1,279 @@
+#ifndef LINKED_QUEUE_HPP
+#define LINKED_QUEUE_HPP
+
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include "i_queue.hpp"
+#include "slab_allocator.hpp"
+
+/**
+ * @brief 연결 리스트 기반 큐
+ * 연결 리스트 큐(07_linked_queue.c)의 템플릿 버전
+ * - 앞(head)에서 꺼내고 뒤(tail)에 붙이므로 양쪽 모두 O(1)
+ * - 노드를 하나씩 할당/해제하므로 기본 할당자는 슬랩 풀 (노드 재사용, clear()는 청크 단위 일괄 반환)
+ * - 요소의 주소는 꺼낼 때까지 변하지 않음
+ * @tparam Alloc 노드 할당에 사용할 할당자 (SlabAllocator, std::allocator, std::pmr::polymorphic_allocator 등)
+ */
+template<typename T, typename Alloc = SlabAllocator<T>>
+class LinkedQueue final : public IQueue<T> {
+private:
+    // 노드 구조체 정의
+    struct Node {
+        T data;
+        Node* next;
+
+        // 새로운 노드 생성시 인자로 데이터를 제자리 생성
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args)
+            : data(std::forward<Args>(args)...), next(nullptr) {}
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    NodeAllocator alloc_;   // 노드 할당자
+    Node* head_;            // 맨 앞 노드 (꺼낼 위치)
+    Node* tail_;            // 맨 뒤 노드 (붙일 위치)
+    size_t size_;           // 현재 큐에 저장된 요소의 수
+
+    // 할당자를 통해 노드 생성
+    template<typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* node = NodeTraits::allocate(alloc_, 1);
+        try {
+            NodeTraits::construct(alloc_, node, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            NodeTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    // 할당자를 통해 노드 해제
+    void destroy_node(Node* node) noexcept {
+        NodeTraits::destroy(alloc_, node);
+        NodeTraits::deallocate(alloc_, node, 1);
+    }
+
+    // 모든 노드 해제
+    // 슬랩 풀을 단독으로 사용하고 소멸자 호출이 필요 없으면 청크 단위로 한꺼번에 반환
+    void destroy_all() noexcept {
+        if constexpr (supports_bulk_release<NodeAllocator>::value &&
+                      std::is_trivially_destructible_v<Node>) {
+            if (alloc_.try_release()) {
+                head_ = nullptr;
+                tail_ = nullptr;
+                size_ = 0;
+                return;
+            }
+        }
+
+        while (head_) {
+            Node* next = head_->next;
+            destroy_node(head_);
+            head_ = next;
+        }
+        tail_ = nullptr;
+        size_ = 0;
+    }
+
+    // 다른 큐의 노드를 그대로 넘겨받음
+    void steal(LinkedQueue& other) noexcept {
+        head_ = std::exchange(other.head_, nullptr);
+        tail_ = std::exchange(other.tail_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+public:
+    using allocator_type = Alloc;
+
+    // 생성자
+    LinkedQueue() : LinkedQueue(Alloc()) {}
+
+    // 지정한 할당자를 사용하는 빈 큐 생성
+    explicit LinkedQueue(const Alloc& alloc) : alloc_(alloc), head_(nullptr), tail_(nullptr), size_(0) {}
+
+    // 복사 금지
+    LinkedQueue(const LinkedQueue&) = delete;
+    LinkedQueue& operator=(const LinkedQueue&) = delete;
+
+    // 이동 생성자 (할당자와 노드를 함께 이동)
+    LinkedQueue(LinkedQueue&& other) noexcept
+        : alloc_(std::move(other.alloc_)), head_(nullptr), tail_(nullptr), size_(0) {
+        steal(other);
+    }
+
+    // 이동 대입 연산자
+    // 할당자가 전파되지 않고 서로 다르면 (pmr 등) 원소 단위로 옮김 (순서 유지)
+    LinkedQueue& operator=(LinkedQueue&& other) {
+        if (this == &other) {
+            return *this;
+        }
+
+        destroy_all();
+        if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+            steal(other);
+        } else if (alloc_ == other.alloc_) {
+            steal(other);
+        } else {
+            for (Node* current = other.head_; current; current = current->next) {
+                emplace(std::move(current->data));
+            }
+            other.destroy_all();
+        }
+        return *this;
+    }
+
+    // 소멸자 (노드 수와 무관하게 재귀 없이 해제)
+    ~LinkedQueue() override {
+        destroy_all();
+    }
+
+    // 노드 할당에 사용하는 할당자 반환
+    [[nodiscard]] allocator_type get_allocator() const {
+        return allocator_type(alloc_);
+    }
+
+    // 큐가 비어있는지 확인
+    [[nodiscard]] bool empty() const override {
+        return size_ == 0;
+    }
+
+    // 현재 큐 크기 반환
+    [[nodiscard]] size_t size() const override {
+        return size_;
+    }
+
+    // 현재 큐 용량 반환 (연결 리스트는 이론적으로 무제한)
+    [[nodiscard]] size_t capacity() const override {
+        return size_t(-1);  // 최대값 반환
+    }
+
+    // 큐에 요소 추가
+    void push(const T& value) override {
+        emplace(value);
+    }
+
+    void push(T&& value) override {
+        emplace(std::move(value));
+    }
+
+    // 인자로 요소를 생성하여 맨 뒤에 추가
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        Node* new_node = create_node(std::forward<Args>(args)...);
+        if (tail_) {
+            tail_->next = new_node;
+        } else {
+            head_ = new_node;
+        }
+        tail_ = new_node;
+        ++size_;
+        return new_node->data;
+    }
+
+    /**
+     * @brief 범위의 모든 요소를 순서대로 맨 뒤에 추가
+     * rvalue 범위(임시 컨테이너 등)가 전달되면 요소를 이동
+     */
+    template<typename Range>
+    void push_range(Range&& range) {
+        for (auto&& value : range) {
+            if constexpr (std::is_lvalue_reference_v<Range>) {
+                emplace(value);
+            } else {
+                emplace(std::move(value));
+            }
+        }
+    }
+
+    // 맨 앞 요소 제거
+    void pop() override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        Node* old_head = head_;
+        head_ = head_->next;
+        if (head_ == nullptr) {
+            tail_ = nullptr;
+        }
+        destroy_node(old_head);
+        --size_;
+    }
+
+    // 맨 앞 요소를 이동으로 꺼내며 제거
+    T pop_value() override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        T value = std::move(head_->data);
+        pop();
+        return value;
+    }
+
+    // 맨 앞 요소 확인 (const 버전)
+    const T& front() const override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return head_->data;
+    }
+
+    // 맨 앞 요소 확인
+    T& front() override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return head_->data;
+    }
+
+    // 맨 뒤 요소 확인 (const 버전)
+    const T& back() const override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return tail_->data;
+    }
+
+    // 맨 뒤 요소 확인
+    T& back() override {
+        if (empty()) {
+            throw std::runtime_error("Queue is empty");
+        }
+        return tail_->data;
+    }
+
+    // 큐 초기화 (슬랩 풀 단독 사용 시 O(1) 일괄 반환)
+    void clear() override {
+        destroy_all();
+    }
+
+    // 큐 내용 출력
+    void print() const override {
+        if (empty()) {
+            std::cout << "Queue is empty" << std::endl;
+            return;
+        }
+
+        std::cout << "Queue (size=" << size_ << "): FRONT [ ";
+        const Node* current = head_;
+        while (current != nullptr) {
+            std::cout << current->data << " ";
+            current = current->next;
+        }
+        std::cout << "] REAR" << std::endl;
+    }
+};
+
+namespace pmr {
+    // std::pmr 메모리 리소스를 사용하는 연결 리스트 기반 큐
+    template<typename T>
+    using LinkedQueue = ::LinkedQueue<T, std::pmr::polymorphic_allocator<T>>;
+}
+
+#endif // LINKED_QUEUE_HPP
@@ -0,0 +1,283 @@
+#ifndef MPMC_BOUNDED_QUEUE_HPP
+#define MPMC_BOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief 다중 생산자/다중 소비자(MPMC) 고정 용량 큐 (Vyukov bounded MPMC queue)
+ * 칸(cell)마다 순번(sequence)을 두어, 생산자/소비자가 위치 카운터 하나만 CAS로 차지하면
+ * 나머지는 해당 칸의 순번으로 동기화
+ * - 순번 == 위치: 비어있어 생산자가 쓸 수 있음 / 순번 == 위치 + 1: 소비자가 읽을 수 있음
+ * - 읽은 뒤 순번을 위치 + 용량으로 올려 다음 바퀴의 생산자에게 넘김
+ * - 전역 잠금이나 (head, tail) 쌍에 대한 CAS가 없고, 생산자끼리/소비자끼리만 경합
+ * - 용량은 2의 거듭제곱으로 올림하여 마스크로 칸 위치 계산
+ * - try_push/try_pop은 잠금 없이 즉시 반환, push/pop은 잠시 스핀한 뒤 조건 변수에서 대기
+ *   (대기하는 스레드가 없으면 try_* 경로에서 잠금/시스템 호출 없음)
+ * @tparam T 이동 생성이 예외를 던지지 않는 타입 (칸을 차지한 뒤 실패하면 큐가 멈추므로)
+ */
+template<typename T>
+class MpmcBoundedQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "MpmcBoundedQueue requires a nothrow move constructible element type");
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t MIN_CAPACITY = 2;
+    static constexpr int SPINS = 64;    // 대기 전에 다시 시도하는 횟수
+
+    // 칸 (순번 + 초기화되지 않은 요소 저장소)
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* element() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    alignas(CACHE_LINE) std::atomic<size_t> enqueue_pos_;   // 다음에 쓸 위치
+    alignas(CACHE_LINE) std::atomic<size_t> dequeue_pos_;   // 다음에 읽을 위치
+
+    alignas(CACHE_LINE) std::unique_ptr<Cell[]> cells_;
+    size_t capacity_;
+    size_t mask_;
+
+    // 블로킹 대기용 (대기 중인 스레드 수가 0이면 알림을 생략)
+    alignas(CACHE_LINE) std::atomic<int> pop_waiters_;
+    std::atomic<int> push_waiters_;
+    std::mutex not_empty_mutex_;
+    std::condition_variable not_empty_;
+    std::mutex not_full_mutex_;
+    std::condition_variable not_full_;
+
+    static size_t round_up_pow2(size_t n) {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity < n) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    static void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#endif
+    }
+
+    // 대기 중인 스레드가 있으면 하나를 깨움
+    // 순번 공개와 대기자 수 확인 사이의 순서를 fence로 보장
+    // (잠금을 잡았다 놓으므로 대기 측이 조건 확인과 wait 사이에 있을 때 알림이 사라지지 않음)
+    static void notify(std::atomic<int>& waiters, std::mutex& mutex, std::condition_variable& cv) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters.load(std::memory_order_relaxed) > 0) {
+            { std::lock_guard<std::mutex> lock(mutex); }
+            cv.notify_one();
+        }
+    }
+
+    // 다음 생산자 칸이 비어있는지 (차지하지 않고 확인만, 위치가 바뀌었으면 다시 시도하도록 true)
+    bool has_free_slot() const noexcept {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        size_t sequence = cells_[pos & mask_].sequence.load(std::memory_order_acquire);
+        return static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos) >= 0;
+    }
+
+    // 다음 소비자 칸에 요소가 있는지
+    bool has_ready_slot() const noexcept {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        size_t sequence = cells_[pos & mask_].sequence.load(std::memory_order_acquire);
+        return static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) >= 0;
+    }
+
+    // 생산자 칸 차지 (가득 찼으면 nullptr)
+    Cell* claim_enqueue(size_t& pos) noexcept {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;     // 소비자가 아직 이전 바퀴의 요소를 읽지 않음
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 소비자 칸 차지 (비어있으면 nullptr)
+    Cell* claim_dequeue(size_t& pos) noexcept {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &cell;
+                }
+            } else if (diff < 0) {
+                return nullptr;     // 생산자가 아직 쓰지 않음
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief 생성자
+     * @param min_capacity 최소 용량 (2의 거듭제곱으로 올림)
+     */
+    explicit MpmcBoundedQueue(size_t min_capacity = 1024)
+        : enqueue_pos_(0), dequeue_pos_(0),
+          capacity_(round_up_pow2(min_capacity)), mask_(capacity_ - 1),
+          pop_waiters_(0), push_waiters_(0) {
+        cells_ = std::make_unique<Cell[]>(capacity_);
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // 복사/이동 금지 (다른 스레드가 참조하는 공유 객체)
+    MpmcBoundedQueue(const MpmcBoundedQueue&) = delete;
+    MpmcBoundedQueue& operator=(const MpmcBoundedQueue&) = delete;
+
+    // 소멸자 (모든 스레드의 사용이 끝난 뒤 호출되어야 함)
+    ~MpmcBoundedQueue() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            size_t end = enqueue_pos_.load(std::memory_order_relaxed);
+            for (size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != end; ++pos) {
+                cells_[pos & mask_].element()->~T();
+            }
+        }
+    }
+
+    // 최대 저장 가능한 요소 수
+    [[nodiscard]] size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    // 현재 요소 수 (동시 수정 중에는 근사값)
+    [[nodiscard]] size_t size() const noexcept {
+        size_t dequeue = dequeue_pos_.load(std::memory_order_acquire);
+        size_t enqueue = enqueue_pos_.load(std::memory_order_acquire);
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+    }
+
+    // 비어있는지 확인 (동시 수정 중에는 근사값)
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 인자로 요소를 생성하여 추가 (잠금 없이 즉시 반환)
+     * 생성이 예외를 던질 수 있으면 칸을 차지하기 전에 임시 객체로 만든 뒤 이동
+     * @return 추가했으면 true, 가득 찼으면 false
+     */
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+            size_t pos;
+            Cell* cell = claim_enqueue(pos);
+            if (cell == nullptr) {
+                return false;
+            }
+            ::new (static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            notify(pop_waiters_, not_empty_mutex_, not_empty_);
+            return true;
+        } else {
+            T value(std::forward<Args>(args)...);
+            return try_emplace(std::move(value));
+        }
+    }
+
+    bool try_push(const T& value) {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value) {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * @brief 맨 앞 요소를 꺼내 value에 이동 (잠금 없이 즉시 반환)
+     * @return 꺼냈으면 true, 비어있었으면 false
+     */
+    bool try_pop(T& value) {
+        size_t pos;
+        Cell* cell = claim_dequeue(pos);
+        if (cell == nullptr) {
+            return false;
+        }
+        T* element = cell->element();
+        T taken(std::move(*element));
+        element->~T();
+        cell->sequence.store(pos + capacity_, std::memory_order_release);
+        notify(push_waiters_, not_full_mutex_, not_full_);
+        value = std::move(taken);
+        return true;
+    }
+
+    // 빈 칸이 생길 때까지 기다렸다가 추가
+    void push(const T& value) {
+        T copy(value);
+        push(std::move(copy));
+    }
+
+    void push(T&& value) {
+        for (int spin = 0; spin < SPINS; ++spin) {
+            if (try_push(std::move(value))) {
+                return;
+            }
+            cpu_relax();
+        }
+
+        // 대기자 수를 늘린 뒤 다시 시도하므로, 그 사이에 비워진 칸의 알림을 놓치지 않음
+        // notify()의 fence와 짝을 이루는 fence: 대기자 수 증가가 칸 순번 재확인보다 먼저 보이도록 보장
+        // (없으면 재확인이 오래된 순번을 읽고, 알리는 쪽도 대기자 0을 읽어 둘 다 놓칠 수 있음)
+        push_waiters_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!try_push(std::move(value))) {
+            std::unique_lock<std::mutex> lock(not_full_mutex_);
+            not_full_.wait(lock, [this] { return has_free_slot(); });
+        }
+        push_waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // 요소가 들어올 때까지 기다렸다가 꺼냄
+    void pop(T& value) {
+        for (int spin = 0; spin < SPINS; ++spin) {
+            if (try_pop(value)) {
+                return;
+            }
+            cpu_relax();
+        }
+
+        pop_waiters_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!try_pop(value)) {
+            std::unique_lock<std::mutex> lock(not_empty_mutex_);
+            not_empty_.wait(lock, [this] { return has_ready_slot(); });
+        }
+        pop_waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+};
+
+#endif // MPMC_BOUNDED_QUEUE_HPP
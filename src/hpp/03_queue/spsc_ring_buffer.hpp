@@ -0,0 +1,226 @@
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief 단일 생산자/단일 소비자(SPSC) lock-free 링 버퍼
+ * 원형 큐(06_circular_queue.c)와 같은 front/rear 순환 배열이지만, 생산자 스레드 하나와
+ * 소비자 스레드 하나가 잠금 없이 동시에 사용할 수 있도록 만든 고정 용량 버전
+ * - 용량은 2의 거듭제곱으로 올림하여 나머지 연산 대신 마스크(& mask)로 위치 계산
+ * - head(소비자가 갱신)/tail(생산자가 갱신)은 계속 증가하는 값이며 서로 다른 캐시 라인에 배치
+ * - 상대 인덱스는 마지막으로 읽은 값을 캐시해 두고, 그 값으로 공간/요소가 부족할 때만
+ *   다시 읽으므로 코어 사이의 캐시 라인 이동이 줄어듦
+ * - 요소 기록 후 tail을 release로 공개하고 소비자는 acquire로 읽음 (head도 같은 방식)
+ * - 배치 연산(try_push_n/try_pop_n)은 인덱스를 한 번만 공개하므로 요소당 동기화 비용이 작음
+ * - try_push 계열은 생산자 스레드에서만, try_pop/front 계열은 소비자 스레드에서만 호출
+ */
+template<typename T>
+class SpscRingBuffer {
+private:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t MIN_CAPACITY = 2;
+
+    // 생산자 쪽 (tail_과 캐시한 head를 같은 캐시 라인에)
+    alignas(CACHE_LINE) std::atomic<size_t> tail_;  // 다음에 기록할 위치 (생산자만 갱신)
+    size_t cached_head_;                            // 생산자가 마지막으로 읽은 head_
+
+    // 소비자 쪽
+    alignas(CACHE_LINE) std::atomic<size_t> head_;  // 다음에 읽을 위치 (소비자만 갱신)
+    size_t cached_tail_;                            // 소비자가 마지막으로 읽은 tail_
+
+    // 두 스레드가 읽기만 하는 값
+    alignas(CACHE_LINE) T* elements_;   // 초기화되지 않은 원시 저장소
+    size_t capacity_;                   // 2의 거듭제곱
+    size_t mask_;                       // capacity_ - 1
+
+    // 2의 거듭제곱으로 올림 (용량 * sizeof(T) 가 size_t 를 넘으면 std::length_error)
+    static size_t round_up_pow2(size_t n) {
+        const size_t limit = std::numeric_limits<size_t>::max() / sizeof(T);
+        size_t capacity = MIN_CAPACITY;
+        while (capacity < n) {
+            if (capacity > limit / 2) {
+                throw std::length_error("SpscRingBuffer capacity exceeded");
+            }
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    // 빈 공간 수 (부족하면 head_를 다시 읽음, 생산자 전용)
+    size_t free_slots(size_t tail, size_t wanted) noexcept {
+        size_t free = capacity_ - (tail - cached_head_);
+        if (free < wanted) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = capacity_ - (tail - cached_head_);
+        }
+        return free;
+    }
+
+    // 읽을 수 있는 요소 수 (부족하면 tail_을 다시 읽음, 소비자 전용)
+    size_t ready_slots(size_t head, size_t wanted) noexcept {
+        size_t ready = cached_tail_ - head;
+        if (ready < wanted) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            ready = cached_tail_ - head;
+        }
+        return ready;
+    }
+
+public:
+    /**
+     * @brief 생성자
+     * @param min_capacity 최소 용량 (2의 거듭제곱으로 올림)
+     * @throws std::length_error 올림한 용량의 저장소 크기가 size_t 범위를 넘을 때
+     */
+    explicit SpscRingBuffer(size_t min_capacity = 1024)
+        : tail_(0), cached_head_(0), head_(0), cached_tail_(0),
+          elements_(nullptr), capacity_(round_up_pow2(min_capacity)), mask_(capacity_ - 1) {
+        elements_ = static_cast<T*>(::operator new(capacity_ * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    // 복사/이동 금지 (두 스레드가 참조하는 공유 객체)
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    // 소멸자 (두 스레드의 사용이 끝난 뒤 호출되어야 함)
+    ~SpscRingBuffer() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            for (size_t i = head_.load(std::memory_order_relaxed); i != tail; ++i) {
+                elements_[i & mask_].~T();
+            }
+        }
+        ::operator delete(elements_, std::align_val_t(alignof(T)));
+    }
+
+    // 최대 저장 가능한 요소 수
+    [[nodiscard]] size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    // 현재 요소 수 (동시 수정 중에는 근사값)
+    [[nodiscard]] size_t size() const noexcept {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    // 비어있는지 확인 (동시 수정 중에는 근사값)
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 인자로 요소를 제자리 생성하여 추가 (생산자 전용)
+     * @return 추가했으면 true, 가득 찼으면 false
+     */
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (free_slots(tail, 1) == 0) {
+            return false;
+        }
+        ::new (static_cast<void*>(&elements_[tail & mask_])) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value) {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value) {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * @brief first부터 최대 count개를 한 번에 추가 (생산자 전용)
+     * @return 실제로 추가한 요소 수 (빈 공간만큼만 추가)
+     */
+    template<typename InputIt>
+    size_t try_push_n(InputIt first, size_t count) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t n = free_slots(tail, count);
+        if (n > count) {
+            n = count;
+        }
+        size_t i = 0;
+        try {
+            for (; i < n; ++i, ++first) {
+                ::new (static_cast<void*>(&elements_[(tail + i) & mask_])) T(*first);
+            }
+        } catch (...) {
+            // 이미 생성한 요소까지만 공개
+            tail_.store(tail + i, std::memory_order_release);
+            throw;
+        }
+        if (n > 0) {
+            tail_.store(tail + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /**
+     * @brief 맨 앞 요소를 꺼내 value에 이동 (소비자 전용)
+     * @return 꺼냈으면 true, 비어있었으면 false
+     */
+    bool try_pop(T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (ready_slots(head, 1) == 0) {
+            return false;
+        }
+        T& slot = elements_[head & mask_];
+        value = std::move(slot);
+        slot.~T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 최대 max_count개를 꺼내 out에 차례로 이동 (소비자 전용)
+     * 이동 중 예외가 나면 그 앞까지 꺼낸 것으로 처리하고 다시 던짐
+     * @return 실제로 꺼낸 요소 수
+     */
+    template<typename OutputIt>
+    size_t try_pop_n(OutputIt out, size_t max_count) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        size_t n = ready_slots(head, max_count);
+        if (n > max_count) {
+            n = max_count;
+        }
+        size_t i = 0;
+        try {
+            for (; i < n; ++i, ++out) {
+                T& slot = elements_[(head + i) & mask_];
+                *out = std::move(slot);
+                slot.~T();
+            }
+        } catch (...) {
+            // 이미 꺼내고 소멸시킨 요소까지만 반환 (예외가 난 요소는 그대로 남음)
+            head_.store(head + i, std::memory_order_release);
+            throw;
+        }
+        if (n > 0) {
+            head_.store(head + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // 맨 앞 요소의 포인터 (비어있으면 nullptr, 소비자 전용이며 다음 pop 전까지 유효)
+    T* front() noexcept {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (ready_slots(head, 1) == 0) {
+            return nullptr;
+        }
+        return &elements_[head & mask_];
+    }
+};
+
+#endif // SPSC_RING_BUFFER_HPP
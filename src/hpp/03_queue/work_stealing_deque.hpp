@@ -0,0 +1,205 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Chase-Lev 작업 훔치기(work-stealing) 덱
+ * 작업 스레드(owner) 하나가 아래쪽(bottom)에서 push/pop 하고,
+ * 다른 스레드(thief)들은 위쪽(top)에서 훔쳐가는 병렬 작업 분배용 덱
+ * - owner의 push/pop은 일반적으로 원자적 읽기/쓰기와 fence만 사용 (CAS 없음)
+ *   마지막 요소 하나를 두고 thief와 경쟁할 때만 top에 CAS
+ * - thief끼리는 top에 대한 CAS로 경쟁하며, 진 쪽은 실패를 반환하고 다른 덱을 찾아감
+ * - 순환 배열이 가득 차면 owner가 2배 크기의 배열로 복사한 뒤 교체
+ *   (thief가 아직 이전 배열을 읽고 있을 수 있으므로 이전 배열은 소멸 시까지 보관,
+ *    크기가 2배씩 커지므로 보관 메모리는 현재 배열 크기를 넘지 않음)
+ * - 메모리 순서는 Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models"
+ *   (PPoPP 2013)의 C11 버전을 따름
+ * - 재귀 분할 알고리즘(병합 정렬, 퀵 정렬 등)을 병렬화할 때 작업 스레드마다 하나씩 두고,
+ *   분할한 하위 작업을 push 하고 자기 덱이 비면 다른 스레드의 덱에서 훔침
+ * @tparam T 작업 항목 (thief가 owner의 기록과 동시에 읽을 수 있으므로 std::atomic으로 담을 수 있는
+ *           trivially copyable 타입만 허용, 보통 작업 포인터나 작은 구조체)
+ */
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque requires a trivially copyable element type (e.g. a task pointer)");
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t MIN_CAPACITY = 2;
+
+    // 순환 배열 (칸은 원자 변수이므로 thief의 읽기와 owner의 쓰기가 겹쳐도 데이터 경쟁이 아님)
+    struct Array {
+        int64_t capacity;   // 2의 거듭제곱
+        int64_t mask;       // capacity - 1
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Array(int64_t capacity)
+            : capacity(capacity), mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+        T get(int64_t index) const noexcept {
+            return slots[index & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t index, T value) noexcept {
+            slots[index & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(CACHE_LINE) std::atomic<int64_t> top_;      // 다음에 훔칠 위치 (thief가 CAS로 증가)
+    alignas(CACHE_LINE) std::atomic<int64_t> bottom_;   // 다음에 push할 위치 (owner만 갱신)
+    std::atomic<Array*> array_;                         // 현재 순환 배열
+
+    // owner만 접근 (교체된 이전 배열 포함, 소멸 시 해제)
+    std::vector<std::unique_ptr<Array>> arrays_;
+
+    static int64_t round_up_pow2(size_t n) {
+        int64_t capacity = MIN_CAPACITY;
+        while (capacity < static_cast<int64_t>(n)) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    // 2배 크기의 배열로 [top, bottom) 구간을 복사한 뒤 교체 (owner 전용)
+    Array* grow(Array* old_array, int64_t top, int64_t bottom) {
+        arrays_.push_back(std::make_unique<Array>(old_array->capacity * 2));
+        Array* new_array = arrays_.back().get();
+        for (int64_t i = top; i < bottom; ++i) {
+            new_array->put(i, old_array->get(i));
+        }
+        array_.store(new_array, std::memory_order_release);
+        return new_array;
+    }
+
+public:
+    /**
+     * @brief 생성자
+     * @param min_capacity 초기 용량 (2의 거듭제곱으로 올림, 가득 차면 2배씩 확장)
+     */
+    explicit WorkStealingDeque(size_t min_capacity = 1024) : top_(0), bottom_(0), array_(nullptr) {
+        arrays_.push_back(std::make_unique<Array>(round_up_pow2(min_capacity)));
+        array_.store(arrays_.back().get(), std::memory_order_relaxed);
+    }
+
+    // 복사/이동 금지 (여러 스레드가 참조하는 공유 객체)
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // 소멸자 (모든 스레드의 사용이 끝난 뒤 호출되어야 함)
+    ~WorkStealingDeque() = default;
+
+    // 현재 배열 용량
+    [[nodiscard]] size_t capacity() const noexcept {
+        return static_cast<size_t>(array_.load(std::memory_order_relaxed)->capacity);
+    }
+
+    // 현재 요소 수 (동시 수정 중에는 근사값)
+    [[nodiscard]] size_t size() const noexcept {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    // 비어있는지 확인 (동시 수정 중에는 근사값)
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief 아래쪽에 작업 추가 (owner 전용)
+     * 가득 찼으면 배열을 2배로 확장
+     */
+    void push(T value) {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_acquire);
+        Array* array = array_.load(std::memory_order_relaxed);
+        if (bottom - top > array->capacity - 1) {
+            array = grow(array, top, bottom);
+        }
+        array->put(bottom, value);
+        // 요소 기록이 bottom 증가보다 먼저 보이도록
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 아래쪽에서 가장 최근 작업을 꺼냄 (owner 전용, LIFO)
+     * @return 꺼냈으면 true, 비어있었거나 마지막 요소를 thief에게 빼앗겼으면 false
+     */
+    bool try_pop(T& value) {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Array* array = array_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        // bottom 감소를 thief에게 먼저 보인 뒤 top을 읽음 (thief의 top/bottom 읽기와 전순서)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // 비어있음
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        value = array->get(bottom);
+        if (top == bottom) {
+            // 마지막 요소: thief와 top을 두고 경쟁
+            bool won = top_.compare_exchange_strong(top, top + 1,
+                                                    std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 위쪽에서 가장 오래된 작업을 훔침 (임의의 스레드, FIFO)
+     * @return 훔쳤으면 true, 비어있었거나 다른 스레드와의 경쟁에서 졌으면 false
+     */
+    bool try_steal(T& value) {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return false;
+        }
+
+        // 배열 교체와 요소 기록은 release로 공개되므로 acquire로 읽음
+        Array* array = array_.load(std::memory_order_acquire);
+        T stolen = array->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1,
+                                          std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        value = stolen;
+        return true;
+    }
+
+    // 덱 내용 출력 (다른 스레드가 사용하지 않을 때만 호출)
+    void print() const {
+        int64_t top = top_.load(std::memory_order_relaxed);
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        if (top >= bottom) {
+            std::cout << "Deque is empty" << std::endl;
+            return;
+        }
+
+        const Array* array = array_.load(std::memory_order_relaxed);
+        std::cout << "WorkStealingDeque (size=" << (bottom - top)
+                  << ", capacity=" << array->capacity << "): TOP [ ";
+        for (int64_t i = top; i < bottom; ++i) {
+            std::cout << array->get(i) << " ";
+        }
+        std::cout << "] BOTTOM" << std::endl;
+    }
+};
+
+#endif // WORK_STEALING_DEQUE_HPP
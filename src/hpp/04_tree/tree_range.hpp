@@ -0,0 +1,493 @@
+#ifndef TREE_RANGE_HPP
+#define TREE_RANGE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// C 트리 헤더(binary_tree.h 또는 binary_search_tree.h)의 순회 커서를 감싸므로 먼저 포함해야 함
+#if !defined(BINARY_TREE_H) && !defined(BINARY_SEARCH_TREE_H)
+#error "tree_range.hpp requires binary_tree.h or binary_search_tree.h to be included first"
+#endif
+
+/**
+ * @brief 트리 타입별 커서 타입과 함수 (포함된 C 트리 헤더마다 특수화)
+ * 두 헤더를 함께 포함하면 BinaryTree와 BSTree 모두 순회할 수 있음
+ */
+template<typename Tree>
+struct TreeCursorTraits;
+
+#ifdef BINARY_TREE_H
+template<>
+struct TreeCursorTraits<BinaryTree> {
+    using Node = BTreeNode;
+    using Cursor = BTreeCursor;
+
+    static void init(Cursor* cursor, const BinaryTree* tree, TraversalOrder order) {
+        btree_cursor_init(cursor, tree, order);
+    }
+    static const Node* next(Cursor* cursor) { return btree_cursor_next(cursor); }
+    static void destroy(Cursor* cursor) { btree_cursor_destroy(cursor); }
+    static bool failed(const Cursor& cursor) { return cursor.status == BTREE_MEMORY_ERROR; }
+};
+#endif
+
+#ifdef BINARY_SEARCH_TREE_H
+template<>
+struct TreeCursorTraits<BSTree> {
+    using Node = BstNode;
+    using Cursor = BstCursor;
+
+    static void init(Cursor* cursor, const BSTree* tree, TraversalOrder order) {
+        bst_cursor_init(cursor, tree, order);
+    }
+    static const Node* next(Cursor* cursor) { return bst_cursor_next(cursor); }
+    static void destroy(Cursor* cursor) { bst_cursor_destroy(cursor); }
+    static bool failed(const Cursor& cursor) { return cursor.status == BST_MEMORY_ERROR; }
+};
+#endif
+
+/**
+ * @brief C 트리 순회 커서를 범위 기반 for와 지연 파이프라인에 쓰는 입력 범위
+ * - 반복자를 한 칸 진행할 때마다 커서의 next를 한 번 호출 (노드를 배열에 모으지 않음)
+ * - 도중에 break 하면 남은 노드는 계산하지 않음
+ * - begin()을 다시 부르면 처음부터 다시 순회 (이전 반복자는 무효)
+ * - 순회 도중 트리를 수정하면 안 됨
+ * - 커서의 스택/큐 할당이 실패하면 std::bad_alloc
+ * @tparam Tree C 트리 타입 (BinaryTree 또는 BSTree)
+ */
+template<typename Tree>
+class TreeRange {
+private:
+    using Traits = TreeCursorTraits<Tree>;
+    using Node = typename Traits::Node;
+    using Cursor = typename Traits::Cursor;
+
+    const Tree* tree_;
+    TraversalOrder order_;
+    Cursor cursor_;
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Node;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Node*;
+        using reference = const Node&;
+
+        // 끝 반복자
+        Iterator() : cursor_(nullptr), node_(nullptr) {}
+
+        reference operator*() const { return *node_; }
+        pointer operator->() const { return node_; }
+
+        Iterator& operator++() {
+            advance();
+            return *this;
+        }
+
+        // 입력 반복자이므로 후위 증가는 진행만 하고 이전 위치를 돌려주지 않음
+        void operator++(int) { advance(); }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.node_ == b.node_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.node_ != b.node_; }
+
+    private:
+        friend class TreeRange;
+
+        Cursor* cursor_;
+        const Node* node_;
+
+        explicit Iterator(Cursor* cursor) : cursor_(cursor), node_(nullptr) {
+            advance();
+        }
+
+        void advance() {
+            node_ = Traits::next(cursor_);
+            if (node_ == nullptr && Traits::failed(*cursor_)) {
+                throw std::bad_alloc();
+            }
+        }
+    };
+
+    using iterator = Iterator;
+
+    TreeRange(const Tree* tree, TraversalOrder order) : tree_(tree), order_(order) {
+        Traits::init(&cursor_, tree_, order_);
+    }
+
+    // 커서의 스택/큐를 소유하므로 복사 금지, 이동만 허용
+    TreeRange(const TreeRange&) = delete;
+    TreeRange& operator=(const TreeRange&) = delete;
+
+    TreeRange(TreeRange&& other) noexcept : tree_(other.tree_), order_(other.order_), cursor_(other.cursor_) {
+        Traits::init(&other.cursor_, other.tree_, other.order_);
+    }
+
+    TreeRange& operator=(TreeRange&& other) noexcept {
+        if (this != &other) {
+            Traits::destroy(&cursor_);
+            tree_ = other.tree_;
+            order_ = other.order_;
+            cursor_ = other.cursor_;
+            Traits::init(&other.cursor_, other.tree_, other.order_);
+        }
+        return *this;
+    }
+
+    ~TreeRange() {
+        Traits::destroy(&cursor_);
+    }
+
+    // 처음부터 다시 순회 (스택/큐 메모리는 재사용)
+    Iterator begin() {
+        Cursor fresh;
+        Traits::init(&fresh, tree_, order_);
+        fresh.items = cursor_.items;
+        fresh.capacity = cursor_.capacity;
+        cursor_ = fresh;
+        return Iterator(&cursor_);
+    }
+
+    Iterator end() { return Iterator(); }
+};
+
+/**
+ * @brief 트리 순회 범위 생성
+ * @param tree 순회할 트리 (범위보다 오래 살아있어야 함)
+ * @param order 순회 순서
+ */
+template<typename Tree>
+TreeRange<Tree> traverse(const Tree* tree, TraversalOrder order) {
+    return TreeRange<Tree>(tree, order);
+}
+
+/**
+ * @brief 입력 범위 위의 지연 어댑터 (filter / transform / take / take_while)
+ * range | tree_views::filter(f) | tree_views::take(3) 처럼 이어 쓰며,
+ * 반복자를 진행할 때만 안쪽 범위를 한 칸씩 당겨옴
+ * - 왼쪽 범위가 lvalue면 참조로, rvalue면 이동해서 보관
+ * - begin()/end()는 같은 반복자 타입이므로 표준 알고리즘에도 넘길 수 있음
+ */
+namespace tree_views {
+
+namespace detail {
+
+template<typename Range>
+using InnerIterator = decltype(std::declval<Range&>().begin());
+
+}  // namespace detail
+
+// 조건을 만족하는 요소만 통과
+template<typename Range, typename Predicate>
+class FilterView {
+private:
+    Range range_;
+    Predicate predicate_;
+
+    using Inner = detail::InnerIterator<Range>;
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename std::iterator_traits<Inner>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<Inner>::pointer;
+        using reference = typename std::iterator_traits<Inner>::reference;
+
+        Iterator() : predicate_(nullptr) {}
+
+        reference operator*() const { return *it_; }
+
+        Iterator& operator++() {
+            ++it_;
+            skip();
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.it_ == b.it_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.it_ != b.it_; }
+
+    private:
+        friend class FilterView;
+
+        Inner it_;
+        Inner end_;
+        Predicate* predicate_;
+
+        Iterator(Inner it, Inner end, Predicate* predicate) : it_(it), end_(end), predicate_(predicate) {
+            skip();
+        }
+
+        void skip() {
+            while (it_ != end_ && !(*predicate_)(*it_)) {
+                ++it_;
+            }
+        }
+    };
+
+    FilterView(Range&& range, Predicate predicate)
+        : range_(std::forward<Range>(range)), predicate_(std::move(predicate)) {}
+
+    Iterator begin() {
+        Inner first = range_.begin();
+        return Iterator(first, range_.end(), &predicate_);
+    }
+
+    Iterator end() {
+        Inner last = range_.end();
+        return Iterator(last, last, &predicate_);
+    }
+};
+
+// 각 요소에 함수를 적용한 값을 돌려줌 (역참조할 때마다 호출)
+template<typename Range, typename Function>
+class TransformView {
+private:
+    Range range_;
+    Function function_;
+
+    using Inner = detail::InnerIterator<Range>;
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using reference = std::invoke_result_t<Function&, typename std::iterator_traits<Inner>::reference>;
+        using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+
+        Iterator() : function_(nullptr) {}
+
+        reference operator*() const { return (*function_)(*it_); }
+
+        Iterator& operator++() {
+            ++it_;
+            return *this;
+        }
+
+        void operator++(int) { ++it_; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.it_ == b.it_; }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.it_ != b.it_; }
+
+    private:
+        friend class TransformView;
+
+        Inner it_;
+        Function* function_;
+
+        Iterator(Inner it, Function* function) : it_(it), function_(function) {}
+    };
+
+    TransformView(Range&& range, Function function)
+        : range_(std::forward<Range>(range)), function_(std::move(function)) {}
+
+    Iterator begin() { return Iterator(range_.begin(), &function_); }
+    Iterator end() { return Iterator(range_.end(), &function_); }
+};
+
+// 앞에서부터 최대 count개 (count개를 내보낸 뒤에는 안쪽 범위를 더 당기지 않음)
+template<typename Range>
+class TakeView {
+private:
+    Range range_;
+    size_t count_;
+
+    using Inner = detail::InnerIterator<Range>;
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename std::iterator_traits<Inner>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<Inner>::pointer;
+        using reference = typename std::iterator_traits<Inner>::reference;
+
+        Iterator() : remaining_(0) {}
+
+        reference operator*() const { return *it_; }
+
+        // 마지막 요소를 지나면 안쪽 반복자는 그대로 두고 끝 상태가 됨
+        Iterator& operator++() {
+            if (--remaining_ > 0) {
+                ++it_;
+            }
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            bool a_done = a.done();
+            bool b_done = b.done();
+            return a_done || b_done ? a_done == b_done : a.it_ == b.it_;
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return !(a == b); }
+
+    private:
+        friend class TakeView;
+
+        Inner it_;
+        Inner end_;
+        size_t remaining_;
+
+        Iterator(Inner it, Inner end, size_t remaining) : it_(it), end_(end), remaining_(remaining) {}
+
+        bool done() const { return remaining_ == 0 || it_ == end_; }
+    };
+
+    TakeView(Range&& range, size_t count) : range_(std::forward<Range>(range)), count_(count) {}
+
+    Iterator begin() {
+        if (count_ == 0) {
+            return end();
+        }
+        Inner first = range_.begin();
+        return Iterator(first, range_.end(), count_);
+    }
+
+    Iterator end() {
+        Inner last = range_.end();
+        return Iterator(last, last, 0);
+    }
+};
+
+// 조건이 처음 거짓이 되는 요소 앞까지 (그 뒤는 당기지 않음)
+template<typename Range, typename Predicate>
+class TakeWhileView {
+private:
+    Range range_;
+    Predicate predicate_;
+
+    using Inner = detail::InnerIterator<Range>;
+
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = typename std::iterator_traits<Inner>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<Inner>::pointer;
+        using reference = typename std::iterator_traits<Inner>::reference;
+
+        Iterator() : predicate_(nullptr), stopped_(true) {}
+
+        reference operator*() const { return *it_; }
+
+        Iterator& operator++() {
+            ++it_;
+            check();
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            bool a_done = a.done();
+            bool b_done = b.done();
+            return a_done || b_done ? a_done == b_done : a.it_ == b.it_;
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return !(a == b); }
+
+    private:
+        friend class TakeWhileView;
+
+        Inner it_;
+        Inner end_;
+        Predicate* predicate_;
+        bool stopped_;
+
+        Iterator(Inner it, Inner end, Predicate* predicate)
+            : it_(it), end_(end), predicate_(predicate), stopped_(false) {
+            check();
+        }
+
+        void check() {
+            stopped_ = it_ == end_ || !(*predicate_)(*it_);
+        }
+
+        bool done() const { return stopped_; }
+    };
+
+    TakeWhileView(Range&& range, Predicate predicate)
+        : range_(std::forward<Range>(range)), predicate_(std::move(predicate)) {}
+
+    Iterator begin() {
+        Inner first = range_.begin();
+        return Iterator(first, range_.end(), &predicate_);
+    }
+
+    Iterator end() { return Iterator(); }
+};
+
+// 파이프(|) 오른쪽에 오는 어댑터 객체
+template<typename Predicate>
+struct FilterAdaptor {
+    Predicate predicate;
+};
+
+template<typename Function>
+struct TransformAdaptor {
+    Function function;
+};
+
+struct TakeAdaptor {
+    size_t count;
+};
+
+template<typename Predicate>
+struct TakeWhileAdaptor {
+    Predicate predicate;
+};
+
+template<typename Predicate>
+FilterAdaptor<Predicate> filter(Predicate predicate) {
+    return { std::move(predicate) };
+}
+
+template<typename Function>
+TransformAdaptor<Function> transform(Function function) {
+    return { std::move(function) };
+}
+
+inline TakeAdaptor take(size_t count) {
+    return { count };
+}
+
+template<typename Predicate>
+TakeWhileAdaptor<Predicate> take_while(Predicate predicate) {
+    return { std::move(predicate) };
+}
+
+template<typename Range, typename Predicate>
+FilterView<Range, Predicate> operator|(Range&& range, FilterAdaptor<Predicate> adaptor) {
+    return FilterView<Range, Predicate>(std::forward<Range>(range), std::move(adaptor.predicate));
+}
+
+template<typename Range, typename Function>
+TransformView<Range, Function> operator|(Range&& range, TransformAdaptor<Function> adaptor) {
+    return TransformView<Range, Function>(std::forward<Range>(range), std::move(adaptor.function));
+}
+
+template<typename Range>
+TakeView<Range> operator|(Range&& range, TakeAdaptor adaptor) {
+    return TakeView<Range>(std::forward<Range>(range), adaptor.count);
+}
+
+template<typename Range, typename Predicate>
+TakeWhileView<Range, Predicate> operator|(Range&& range, TakeWhileAdaptor<Predicate> adaptor) {
+    return TakeWhileView<Range, Predicate>(std::forward<Range>(range), std::move(adaptor.predicate));
+}
+
+}  // namespace tree_views
+
+#endif // TREE_RANGE_HPP
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include "adjacency_list.h"
+#include "adjacency_matrix.h"
+#include "array_stack.h"
+#include "binary_search_tree.h"
+#include "binary_tree.h"
+#include "chaining_hash_table.h"
+#include "circular_queue.h"
+#include "dynamic_programming.h"
+#include "linked_queue.h"
+#include "linkedlist_stack.h"
+#include "open_addressing_hash_table.h"
+#include "priority_queue.h"
+#include "sequential_search.h"
+#include "sort.h"
+#include "splay_tree.h"
+#include "string_search.h"
+
+/* 모든 ds_* 라이브러리 동시 링크 검사
+ * - 모든 공개 헤더를 한 번역 단위에 포함 (타입/열거 상수 이름 충돌 검사)
+ * - CMake에서 모든 라이브러리를 하나의 실행 파일로 링크 (전역 심볼 충돌 검사,
+ *   GNU 링커에서는 --whole-archive 로 모든 오브젝트를 강제로 포함)
+ * - 모듈마다 API를 하나씩 호출하여 실제로 함께 동작하는지 확인
+ */
+
+static int failures = 0;
+
+static void check(bool condition, const char* name) {
+    if (!condition) {
+        printf("FAIL: %s\n", name);
+        failures++;
+    }
+}
+
+int main(void) {
+    ArrayStack* astack = astack_create();
+    check(astack != NULL && astack_push(astack, 1) == ASTACK_OK && astack_size(astack) == 1, "array stack");
+    astack_destroy(astack);
+
+    LinkedStack* lstack = lstack_create();
+    check(lstack != NULL && lstack_push(lstack, 1) == LSTACK_OK && lstack_size(lstack) == 1, "linked list stack");
+    lstack_destroy(lstack);
+
+    CircularQueue* cqueue = cqueue_create();
+    check(cqueue != NULL && cqueue_enqueue(cqueue, 1) == CQUEUE_OK && cqueue_size(cqueue) == 1, "circular queue");
+    cqueue_destroy(cqueue);
+
+    LinkedQueue* lqueue = lqueue_create();
+    check(lqueue != NULL && lqueue_enqueue(lqueue, 1) == LQUEUE_OK && lqueue_size(lqueue) == 1, "linked queue");
+    lqueue_destroy(lqueue);
+
+    PriorityQueue pqueue;
+    pqueue_init(&pqueue);
+    check(pqueue_insert_max(&pqueue, 1) && pqueue_size(&pqueue) == 1, "priority queue");
+
+    MaxHeap heap;
+    maxheap_init(&heap);
+    check(maxheap_insert(&heap, 1) && maxheap_verify(&heap), "max heap");
+
+    BinaryTree* btree = btree_create();
+    check(btree != NULL && btree_insert_left(btree, NULL, 1) == BTREE_OK && btree_size(btree) == 1, "binary tree");
+    btree_destroy(btree);
+
+    BSTree* bst = bst_create();
+    check(bst != NULL && bst_insert(bst, 1) == BST_OK && bst_search(bst, 1), "binary search tree");
+    bst_destroy(bst);
+
+    SplayTree* splay = splay_create();
+    check(splay != NULL && splay_insert(splay, 1) == BST_OK && splay_search(splay, 1), "splay tree");
+    splay_destroy(splay);
+
+    int value = 0;
+    ChainedHashTable* chash = chash_create(16);
+    check(chash != NULL && chash_insert(chash, "key", 1) && chash_get(chash, "key", &value) && value == 1, "chaining hash table");
+    chash_destroy(chash);
+
+    value = 0;
+    OpenHashTable* ohash = ohash_create(16, PROBE_LINEAR);
+    check(ohash != NULL && ohash_insert(ohash, "key", 1) && ohash_get(ohash, "key", &value) && value == 1, "open addressing hash table");
+    ohash_destroy(ohash);
+
+    MatrixGraph* mgraph = mgraph_create(2);
+    check(mgraph != NULL && mgraph_add_edge(mgraph, 0, 1, 1, false) && mgraph_has_edge(mgraph, 1, 0), "adjacency matrix");
+    mgraph_destroy(mgraph);
+
+    ListGraph* lgraph = lgraph_create(2);
+    check(lgraph != NULL && lgraph_add_edge(lgraph, 0, 1, 1, false) && lgraph_has_edge(lgraph, 1, 0), "adjacency list");
+    lgraph_destroy(lgraph);
+
+    SortElement sorted[] = { 3, 1, 2 };
+    bubble_sort_basic(sorted, 3);
+    check(sorted[0] == 1 && sorted[2] == 3, "sort");
+
+    SearchElement items[] = { 5, 7, 9 };
+    check(sequential_search_basic(items, 3, 9) == 2, "sequential search");
+
+    SearchResult* found = kmp_search("abcabc", "bc", false);
+    check(found != NULL && found->count == 2, "string search");
+    destroy_result(found);
+
+    check(fib_tabulation(10, false) == 55, "dynamic programming");
+
+    if (failures == 0) {
+        printf("All libraries linked and working\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -13,6 +13,7 @@ enum class MenuOption {
     Print,            // 리스트 전체 출력
     Size,             // 리스트 크기 확인
     IsEmpty,          // 리스트 공백 상태 확인
+    PrintReverse,     // 역방향 반복자로 출력
     Exit              // 프로그램 종료
 };
 
@@ -34,7 +35,8 @@ void printMenu() {
               << "7. Print List    - 리스트 전체 출력\n"
               << "8. Get Size      - 리스트 크기 확인\n"
               << "9. Check Empty   - 리스트 공백 상태 확인\n"
-              << "10. Exit         - 프로그램 종료\n"
+              << "10. Reverse      - 역방향 반복자로 출력\n"
+              << "11. Exit         - 프로그램 종료\n"
               << "메뉴 선택: ";
 }
 
@@ -104,6 +106,14 @@ int main() {
                     std::cout << "리스트 상태: " << (list.empty() ? "비어있음" : "비어있지 않음") << "\n";
                     break;
 
+                case MenuOption::PrintReverse:
+                    std::cout << "역순 출력: ";
+                    for (auto it = list.rbegin(); it != list.rend(); ++it) {
+                        std::cout << *it << " ";
+                    }
+                    std::cout << "\n";
+                    break;
+
                 case MenuOption::Exit:
                     std::cout << "프로그램을 종료합니다.\n";
                     break;
@@ -17,6 +17,7 @@ enum class MenuOption {
     Print,            // 리스트 전체 출력
     Size,             // 리스트 크기 확인
     IsEmpty,          // 리스트 공백 상태 확인
+    Iterate,          // 반복자로 전체 순회
     Exit              // 프로그램 종료
 };
 
@@ -38,7 +39,8 @@ void printMenu() {
               << "7. Print List    - 리스트 전체 출력\n"
               << "8. Get Size      - 리스트 크기 확인\n"
               << "9. Check Empty   - 리스트 공백 상태 확인\n"
-              << "10. Exit         - 프로그램 종료\n"
+              << "10. Iterate      - 반복자로 전체 순회\n"
+              << "11. Exit         - 프로그램 종료\n"
               << "메뉴 선택: ";
 }
 
@@ -109,6 +111,15 @@ int main() {
                     std::cout << "리스트 상태: " << (list.empty() ? "비어있음" : "비어있지 않음") << "\n";
                     break;
 
+                case MenuOption::Iterate:
+                    // 인덱스 접근(at) 없이 O(n)으로 순회
+                    std::cout << "반복자 순회: ";
+                    for (const int& element : list) {
+                        std::cout << element << " ";
+                    }
+                    std::cout << "\n";
+                    break;
+
                 case MenuOption::Exit:
                     std::cout << "프로그램을 종료합니다.\n";
                     break;
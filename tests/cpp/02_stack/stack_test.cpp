@@ -2,6 +2,10 @@
 #include <limits>
 #include "array_stack.hpp"
 #include "linked_stack.hpp"
+#include "small_array_stack.hpp"
+#include "concurrent_linked_stack.hpp"
+#include "segmented_stack.hpp"
+#include "any_stack.hpp"
 
 // 사용자 메뉴 선택을 위한 열거형
 enum class MenuOption {
@@ -20,9 +24,23 @@ enum class MenuOption {
 // 스택 구현 방식을 위한 열거형
 enum class StackType {
     Array,          // 배열 기반 스택
-    Linked          // 연결 리스트 기반 스택
+    Linked,         // 연결 리스트 기반 스택
+    Small,          // 인라인 버퍼(SBO) 배열 기반 스택
+    Concurrent,     // lock-free 연결 리스트 기반 스택
+    Segmented       // 세그먼트 연결 기반 스택
 };
 
+// 구현 방식 이름 반환
+const char* stackTypeName(StackType type) {
+    switch (type) {
+        case StackType::Array:      return "Array-based";
+        case StackType::Linked:     return "Linked-list-based";
+        case StackType::Small:      return "Small-buffer array-based";
+        case StackType::Concurrent: return "Lock-free linked-list-based";
+        default:                    return "Segmented";
+    }
+}
+
 // 입력 버퍼 비우기 함수
 void clearInputBuffer() {
     std::cin.clear();
@@ -32,7 +50,7 @@ void clearInputBuffer() {
 // 메뉴 출력 함수
 void printMenu(StackType type) {
     std::cout << "\n=== Stack Test Menu (" 
-              << (type == StackType::Array ? "Array-based" : "Linked-list-based")
+              << stackTypeName(type)
               << ") ===\n"
               << "1. Push        - 스택에 데이터 추가\n"
               << "2. Pop         - 스택에서 데이터 제거\n"
@@ -47,9 +65,8 @@ void printMenu(StackType type) {
               << "메뉴 선택: ";
 }
 
-// 테스트 실행 함수 템플릿
-template<typename Stack>
-void runStackTest(Stack& stack, StackType type) {
+// 테스트 실행 함수 (구현 방식과 무관하게 AnyStack 하나로 처리)
+void runStackTest(AnyStack<int>& stack, StackType type) {
     int choice;
     int value;
 
@@ -67,8 +84,8 @@ void runStackTest(Stack& stack, StackType type) {
                     break;
 
                 case MenuOption::Pop:
-                    stack.pop();
-                    std::cout << "스택 최상단 요소가 제거됨\n";
+                    value = stack.pop_value();
+                    std::cout << "스택 최상단 요소 " << value << " 이(가) 제거됨\n";
                     break;
 
                 case MenuOption::Peek:
@@ -125,26 +142,34 @@ void runStackTest(Stack& stack, StackType type) {
 }
 
 int main() {
-    ArrayStack<int> array_stack;
-    LinkedStack<int> linked_stack;
+    // StackType 순서대로 배치 (인라인 슬롯을 넘기는 동작을 확인하기 쉽도록 SmallArrayStack은 8개)
+    AnyStack<int> stacks[] = {
+        AnyStack<int>(std::in_place_type<ArrayStack<int>>),
+        AnyStack<int>(std::in_place_type<LinkedStack<int>>),
+        AnyStack<int>(std::in_place_type<SmallArrayStack<int, 8>>),
+        AnyStack<int>(std::in_place_type<ConcurrentLinkedStack<int>>),
+        AnyStack<int>(std::in_place_type<SegmentedStack<int>>),
+    };
+    const int stack_count = sizeof(stacks) / sizeof(stacks[0]);
     StackType current_type = StackType::Array;
 
     std::cout << "스택 테스트 프로그램을 시작합니다.\n";
 
     while (true) {
-        if (current_type == StackType::Array) {
-            runStackTest(array_stack, current_type);
-            current_type = StackType::Linked;
-        } else {
-            runStackTest(linked_stack, current_type);
-            current_type = StackType::Array;
-        }
+        runStackTest(stacks[static_cast<int>(current_type)], current_type);
+        current_type = static_cast<StackType>((static_cast<int>(current_type) + 1) % stack_count);
 
         std::cout << "\n구현 방식이 ";
         if (current_type == StackType::Array) {
             std::cout << "배열 기반";
-        } else {
+        } else if (current_type == StackType::Linked) {
             std::cout << "연결 리스트 기반";
+        } else if (current_type == StackType::Small) {
+            std::cout << "인라인 버퍼 배열 기반";
+        } else if (current_type == StackType::Concurrent) {
+            std::cout << "lock-free 연결 리스트 기반";
+        } else {
+            std::cout << "세그먼트 연결 기반";
         }
         std::cout << "으로 변경되었습니다.\n";
     }
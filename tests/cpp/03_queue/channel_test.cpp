@@ -0,0 +1,318 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "channel.hpp"
+
+// 사용자 메뉴 선택을 위한 열거형
+enum class MenuOption {
+    Exit = 0,       // 프로그램 종료
+    Enqueue,        // 데이터 추가 (가득 찼으면 실패, 대기하지 않음)
+    Dequeue,        // 데이터 꺼내기 (비어있으면 실패, 대기하지 않음)
+    Status,         // 크기/용량/닫힘 상태 확인
+    Close,          // 채널 닫기
+    StressTest,     // 다중 생산자/소비자 정확히 한 번 전달 검사
+    TimeoutTest,    // 빈 채널에서 dequeue_batch 시간 초과 검사
+    CloseTest,      // close()가 양쪽 대기자를 모두 깨우고 남은 요소를 꺼내는지 검사
+    WakeTest        // 한 칸만 비어도 잠든 생산자가 깨어나는지 검사
+};
+
+// 입력 버퍼 비우기 함수
+void clearInputBuffer() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 메뉴 출력 함수
+void printMenu() {
+    std::cout << "\n=== Channel Test Menu ===\n"
+              << "1. Enqueue      - 데이터 추가 (대기하지 않음)\n"
+              << "2. Dequeue      - 데이터 꺼내기 (대기하지 않음)\n"
+              << "3. Status       - 크기/용량/닫힘 상태 확인\n"
+              << "4. Close        - 채널 닫기\n"
+              << "5. Stress Test  - 다중 생산자/소비자 정확히 한 번 전달 검사\n"
+              << "6. Timeout Test - 빈 채널에서 dequeue_batch 시간 초과 검사\n"
+              << "7. Close Test   - close()가 대기자를 깨우고 남은 요소를 꺼내는지 검사\n"
+              << "8. Wake Test    - 한 칸만 비어도 잠든 생산자가 깨어나는지 검사\n"
+              << "0. Exit         - 프로그램 종료\n"
+              << "메뉴 선택: ";
+}
+
+/**
+ * @brief 다중 생산자/소비자 스트레스 테스트
+ * 생산자들이 0..items-1을 나누어 보내고, 소비자들이 요소 단위/묶음 단위로 번갈아 꺼냄
+ * - 용량을 작게 두어 생산자와 소비자 모두 자주 잠들도록 함
+ * - 모든 값이 정확히 한 번씩만 꺼내졌는지 확인
+ * @return 모든 값이 한 번씩 꺼내졌으면 true
+ */
+bool runStressTest(int producers, int consumers, int items) {
+    Channel<int> channel(16);
+    std::unique_ptr<std::atomic<int>[]> seen(new std::atomic<int>[items]);
+    for (int i = 0; i < items; ++i) {
+        seen[i].store(0, std::memory_order_relaxed);
+    }
+
+    std::vector<std::thread> workers;
+    for (int p = 0; p < producers; ++p) {
+        workers.emplace_back([&, p] {
+            for (int value = p; value < items; value += producers) {
+                channel.enqueue(value);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        workers.emplace_back([&, c] {
+            int values[8];
+            for (;;) {
+                size_t n;
+                if (c % 2 == 0) {
+                    n = channel.dequeue(values[0]) ? 1 : 0;
+                } else {
+                    n = channel.dequeue_batch(values, 8);
+                }
+                if (n == 0) {
+                    return;     // 닫혔고 비어있음
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    seen[values[i]].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (int p = 0; p < producers; ++p) {
+        workers[p].join();
+    }
+    channel.close();
+    for (size_t t = producers; t < workers.size(); ++t) {
+        workers[t].join();
+    }
+
+    int missing = 0;
+    int duplicated = 0;
+    for (int i = 0; i < items; ++i) {
+        int count = seen[i].load(std::memory_order_relaxed);
+        if (count == 0) {
+            ++missing;
+        } else if (count > 1) {
+            ++duplicated;
+        }
+    }
+    std::cout << "누락: " << missing << ", 중복: " << duplicated << "\n";
+    return missing == 0 && duplicated == 0;
+}
+
+/**
+ * @brief 빈 채널에서 dequeue_batch(timeout)이 0을 반환하고 최소 timeout만큼 기다리는지 확인
+ * 닫히지 않은 상태이므로 is_closed()는 false여야 함
+ */
+bool runTimeoutTest() {
+    Channel<int> channel(4);
+    int values[4];
+    auto timeout = std::chrono::milliseconds(50);
+    auto start = std::chrono::steady_clock::now();
+    size_t n = channel.dequeue_batch(values, 4, timeout);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+    std::cout << "반환값: " << n << ", 대기 시간: " << elapsed_ms << "ms\n";
+
+    // 시간 안에 들어온 요소는 바로 받음
+    channel.enqueue(7);
+    size_t ready = channel.dequeue_batch(values, 4, timeout);
+    return n == 0 && elapsed >= timeout && !channel.is_closed() && ready == 1 && values[0] == 7;
+}
+
+/**
+ * @brief close() 검사
+ * - 빈 채널에서 잠든 소비자들이 close()로 깨어나 false를 반환하는지
+ * - 가득 찬 채널에서 잠든 생산자들이 close()로 깨어나 false를 반환하는지
+ * - 닫힌 뒤에도 남아있던 요소는 모두 꺼낼 수 있고, 그 뒤 dequeue는 false인지
+ */
+bool runCloseTest() {
+    const int waiters = 3;
+    bool passed = true;
+
+    // 잠든 소비자 깨우기
+    Channel<int> empty_channel(4);
+    std::atomic<int> consumers_failed(0);
+    std::vector<std::thread> consumers;
+    for (int i = 0; i < waiters; ++i) {
+        consumers.emplace_back([&] {
+            int value = 0;
+            if (!empty_channel.dequeue(value)) {
+                consumers_failed.fetch_add(1);
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    empty_channel.close();
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+    std::cout << "깨어난 소비자: " << consumers_failed.load() << "/" << waiters << "\n";
+    passed = passed && consumers_failed.load() == waiters;
+
+    // 잠든 생산자 깨우기 + 남은 요소 꺼내기
+    const int capacity = 4;
+    Channel<int> full_channel(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        full_channel.enqueue(i);
+    }
+    std::atomic<int> producers_failed(0);
+    std::vector<std::thread> producers;
+    for (int i = 0; i < waiters; ++i) {
+        producers.emplace_back([&, i] {
+            if (!full_channel.enqueue(100 + i)) {
+                producers_failed.fetch_add(1);
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    full_channel.close();
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    std::cout << "깨어난 생산자: " << producers_failed.load() << "/" << waiters << "\n";
+    passed = passed && producers_failed.load() == waiters;
+
+    int value = 0;
+    int drained = 0;
+    bool in_order = true;
+    while (full_channel.dequeue(value)) {
+        in_order = in_order && value == drained;
+        ++drained;
+    }
+    std::cout << "닫힌 뒤 꺼낸 요소: " << drained << "/" << capacity << "\n";
+    passed = passed && drained == capacity && in_order && !full_channel.try_enqueue(1);
+    return passed;
+}
+
+/**
+ * @brief 가득 찬 채널에서 한 칸만 비워도 잠든 생산자가 깨어나는지 확인
+ * 소비자가 그 생산자의 전송 완료를 기다린 뒤에야 더 꺼내는 경우에도 교착되지 않아야 함
+ */
+bool runWakeTest() {
+    const int capacity = 8;
+    Channel<int> channel(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        channel.enqueue(i);
+    }
+    std::atomic<bool> sent(false);
+    std::thread producer([&] {
+        channel.enqueue(capacity);
+        sent.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    int value = 0;
+    channel.dequeue(value);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!sent.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    bool woke = sent.load();
+    if (!woke) {
+        channel.close();    // 생산자를 풀어주고 종료
+    }
+    producer.join();
+    std::cout << "생산자 " << (woke ? "깨어남" : "깨어나지 않음") << "\n";
+    return woke;
+}
+
+void runChannelTest(Channel<int>& channel) {
+    int choice;
+    int value;
+
+    do {
+        printMenu();
+        std::cin >> choice;
+
+        try {
+            switch (static_cast<MenuOption>(choice)) {
+                case MenuOption::Enqueue:
+                    std::cout << "추가할 값 입력: ";
+                    std::cin >> value;
+                    if (channel.try_enqueue(value)) {
+                        std::cout << "값 " << value << " 이(가) 추가됨\n";
+                    } else {
+                        std::cout << "채널이 가득 찼거나 닫혔습니다.\n";
+                    }
+                    break;
+
+                case MenuOption::Dequeue:
+                    if (channel.try_dequeue(value)) {
+                        std::cout << "요소 " << value << " 을(를) 꺼냄\n";
+                    } else {
+                        std::cout << "채널이 비어있습니다.\n";
+                    }
+                    break;
+
+                case MenuOption::Status:
+                    std::cout << "크기: " << channel.size() << ", 용량: " << channel.capacity()
+                              << ", 닫힘: " << (channel.is_closed() ? "예" : "아니오") << "\n";
+                    break;
+
+                case MenuOption::Close:
+                    channel.close();
+                    std::cout << "채널을 닫았습니다. 남은 요소는 계속 꺼낼 수 있습니다.\n";
+                    break;
+
+                case MenuOption::StressTest: {
+                    int producers;
+                    int consumers;
+                    int items;
+                    std::cout << "생산자 수 입력: ";
+                    std::cin >> producers;
+                    std::cout << "소비자 수 입력: ";
+                    std::cin >> consumers;
+                    std::cout << "전달할 값 수 입력: ";
+                    std::cin >> items;
+                    if (producers < 1 || consumers < 1 || items < 1) {
+                        std::cout << "1 이상의 값을 입력하세요.\n";
+                        break;
+                    }
+                    bool passed = runStressTest(producers, consumers, items);
+                    std::cout << "스트레스 테스트 " << (passed ? "통과" : "실패") << "\n";
+                    break;
+                }
+
+                case MenuOption::TimeoutTest:
+                    std::cout << "시간 초과 테스트 " << (runTimeoutTest() ? "통과" : "실패") << "\n";
+                    break;
+
+                case MenuOption::CloseTest:
+                    std::cout << "닫기 테스트 " << (runCloseTest() ? "통과" : "실패") << "\n";
+                    break;
+
+                case MenuOption::WakeTest:
+                    std::cout << "생산자 깨우기 테스트 " << (runWakeTest() ? "통과" : "실패") << "\n";
+                    break;
+
+                case MenuOption::Exit:
+                    std::cout << "프로그램을 종료합니다.\n";
+                    return;
+
+                default:
+                    std::cout << "잘못된 메뉴 선택입니다.\n";
+            }
+        }
+        catch (const std::exception& e) {
+            std::cout << "오류 발생: " << e.what() << "\n";
+        }
+
+        clearInputBuffer();
+
+    } while (true);
+}
+
+int main() {
+    // 가득 찬 상태를 확인하기 쉽도록 용량은 4
+    Channel<int> channel(4);
+
+    std::cout << "채널 테스트 프로그램을 시작합니다.\n";
+    runChannelTest(channel);
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "mpmc_bounded_queue.hpp"
+
+// 사용자 메뉴 선택을 위한 열거형
+enum class MenuOption {
+    Exit = 0,       // 프로그램 종료
+    Push,           // 데이터 추가 (가득 찼으면 실패, 대기하지 않음)
+    Pop,            // 데이터 꺼내기 (비어있으면 실패, 대기하지 않음)
+    Status,         // 크기/용량 확인
+    StressTest,     // 다중 생산자/소비자 정확히 한 번 전달 검사
+    WakeTest        // 가득 찬 큐/빈 큐에서 잠든 스레드가 깨어나는지 검사
+};
+
+// 입력 버퍼 비우기 함수
+void clearInputBuffer() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 메뉴 출력 함수
+void printMenu() {
+    std::cout << "\n=== MPMC Bounded Queue Test Menu ===\n"
+              << "1. Push         - 데이터 추가 (대기하지 않음)\n"
+              << "2. Pop          - 데이터 꺼내기 (대기하지 않음)\n"
+              << "3. Status       - 크기/용량 확인\n"
+              << "4. Stress Test  - 다중 생산자/소비자 정확히 한 번 전달 검사\n"
+              << "5. Wake Test    - 잠든 생산자/소비자가 깨어나는지 검사\n"
+              << "0. Exit         - 프로그램 종료\n"
+              << "메뉴 선택: ";
+}
+
+/**
+ * @brief 다중 생산자/소비자 스트레스 테스트
+ * 생산자들이 0..items-1을 나누어 넣고, 소비자들이 모두 합쳐 items개를 꺼냄
+ * - 짝수 번호 스레드는 블로킹 push/pop, 홀수 번호 스레드는 try_push/try_pop 반복
+ * - 용량을 작게 두어 블로킹 경로(대기자 등록 → 재확인 → 대기)를 자주 지나도록 함
+ * - 모든 값이 정확히 한 번씩만 꺼내졌는지 확인
+ * @return 모든 값이 한 번씩 꺼내졌으면 true
+ */
+bool runStressTest(int producers, int consumers, int items) {
+    MpmcBoundedQueue<int> queue(8);
+    std::unique_ptr<std::atomic<int>[]> seen(new std::atomic<int>[items]);
+    for (int i = 0; i < items; ++i) {
+        seen[i].store(0, std::memory_order_relaxed);
+    }
+    std::atomic<int> claimed(0);    // 소비자들이 꺼내기로 예약한 개수
+
+    std::vector<std::thread> workers;
+    for (int p = 0; p < producers; ++p) {
+        workers.emplace_back([&, p] {
+            for (int value = p; value < items; value += producers) {
+                if (p % 2 == 0) {
+                    queue.push(value);
+                } else {
+                    while (!queue.try_push(value)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        workers.emplace_back([&, c] {
+            // 예약한 만큼만 꺼내므로 블로킹 pop이 영원히 기다리지 않음
+            while (claimed.fetch_add(1, std::memory_order_relaxed) < items) {
+                int value = 0;
+                if (c % 2 == 0) {
+                    queue.pop(value);
+                } else {
+                    while (!queue.try_pop(value)) {
+                        std::this_thread::yield();
+                    }
+                }
+                seen[value].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    int missing = 0;
+    int duplicated = 0;
+    for (int i = 0; i < items; ++i) {
+        int count = seen[i].load(std::memory_order_relaxed);
+        if (count == 0) {
+            ++missing;
+        } else if (count > 1) {
+            ++duplicated;
+        }
+    }
+    std::cout << "누락: " << missing << ", 중복: " << duplicated
+              << ", 남은 요소: " << queue.size() << "\n";
+    return missing == 0 && duplicated == 0 && queue.empty();
+}
+
+// flag가 deadline 전에 true가 되는지 기다림
+bool waitFor(const std::atomic<bool>& flag) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!flag.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return flag.load();
+}
+
+/**
+ * @brief 잠든 스레드 깨우기 검사
+ * - 가득 찬 큐에서 push로 잠든 생산자가 try_pop 한 번으로 깨어나는지
+ * - 빈 큐에서 pop으로 잠든 소비자가 try_push 한 번으로 깨어나는지
+ * 깨어나지 않으면 남은 스레드를 풀어준 뒤 실패로 처리
+ */
+bool runWakeTest() {
+    MpmcBoundedQueue<int> queue(2);
+    const int capacity = static_cast<int>(queue.capacity());
+    for (int i = 0; i < capacity; ++i) {
+        queue.try_push(i);
+    }
+
+    std::atomic<bool> pushed(false);
+    std::thread producer([&] {
+        queue.push(capacity);
+        pushed.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    int value = 0;
+    queue.try_pop(value);
+    bool producer_woke = waitFor(pushed);
+    if (!producer_woke) {
+        queue.try_pop(value);   // 생산자를 풀어주고 종료
+    }
+    producer.join();
+    std::cout << "생산자 " << (producer_woke ? "깨어남" : "깨어나지 않음") << "\n";
+
+    while (queue.try_pop(value)) {
+    }
+    std::atomic<bool> popped(false);
+    int received = -1;
+    std::thread consumer([&] {
+        queue.pop(received);
+        popped.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    queue.try_push(42);
+    bool consumer_woke = waitFor(popped);
+    if (!consumer_woke) {
+        queue.try_push(42);     // 소비자를 풀어주고 종료
+    }
+    consumer.join();
+    std::cout << "소비자 " << (consumer_woke ? "깨어남" : "깨어나지 않음") << "\n";
+
+    return producer_woke && consumer_woke && received == 42;
+}
+
+void runMpmcTest(MpmcBoundedQueue<int>& queue) {
+    int choice;
+    int value;
+
+    do {
+        printMenu();
+        std::cin >> choice;
+
+        try {
+            switch (static_cast<MenuOption>(choice)) {
+                case MenuOption::Push:
+                    std::cout << "추가할 값 입력: ";
+                    std::cin >> value;
+                    if (queue.try_push(value)) {
+                        std::cout << "값 " << value << " 이(가) 추가됨\n";
+                    } else {
+                        std::cout << "큐가 가득 찼습니다.\n";
+                    }
+                    break;
+
+                case MenuOption::Pop:
+                    if (queue.try_pop(value)) {
+                        std::cout << "요소 " << value << " 을(를) 꺼냄\n";
+                    } else {
+                        std::cout << "큐가 비어있습니다.\n";
+                    }
+                    break;
+
+                case MenuOption::Status:
+                    std::cout << "크기: " << queue.size() << ", 용량: " << queue.capacity() << "\n";
+                    break;
+
+                case MenuOption::StressTest: {
+                    int producers;
+                    int consumers;
+                    int items;
+                    std::cout << "생산자 수 입력: ";
+                    std::cin >> producers;
+                    std::cout << "소비자 수 입력: ";
+                    std::cin >> consumers;
+                    std::cout << "전달할 값 수 입력: ";
+                    std::cin >> items;
+                    if (producers < 1 || consumers < 1 || items < 1) {
+                        std::cout << "1 이상의 값을 입력하세요.\n";
+                        break;
+                    }
+                    bool passed = runStressTest(producers, consumers, items);
+                    std::cout << "스트레스 테스트 " << (passed ? "통과" : "실패") << "\n";
+                    break;
+                }
+
+                case MenuOption::WakeTest:
+                    std::cout << "깨우기 테스트 " << (runWakeTest() ? "통과" : "실패") << "\n";
+                    break;
+
+                case MenuOption::Exit:
+                    std::cout << "프로그램을 종료합니다.\n";
+                    return;
+
+                default:
+                    std::cout << "잘못된 메뉴 선택입니다.\n";
+            }
+        }
+        catch (const std::exception& e) {
+            std::cout << "오류 발생: " << e.what() << "\n";
+        }
+
+        clearInputBuffer();
+
+    } while (true);
+}
+
+int main() {
+    // 가득 찬 상태를 확인하기 쉽도록 용량은 4
+    MpmcBoundedQueue<int> queue(4);
+
+    std::cout << "MPMC 큐 테스트 프로그램을 시작합니다.\n";
+    runMpmcTest(queue);
+    return 0;
+}
@@ -0,0 +1,173 @@
+#include <iostream>
+#include <limits>
+#include <memory>
+#include "array_queue.hpp"
+#include "linked_queue.hpp"
+#include "deque.hpp"
+
+// 사용자 메뉴 선택을 위한 열거형
+enum class MenuOption {
+    Exit = 0,       // 프로그램 종료
+    Push,           // 큐에 데이터 추가
+    Pop,            // 큐에서 데이터 제거
+    Front,          // 맨 앞 데이터 확인
+    Back,           // 맨 뒤 데이터 확인
+    Print,          // 큐 전체 출력
+    Size,           // 큐 크기 확인
+    Capacity,       // 큐 용량 확인
+    Clear,          // 큐 초기화
+    Empty,          // 큐 공백 상태 확인
+    ChangeImpl      // 큐 구현 방식 변경
+};
+
+// 큐 구현 방식을 위한 열거형
+enum class QueueType {
+    Array,          // 배열 기반 원형 큐
+    Linked,         // 연결 리스트 기반 큐
+    Deque           // 블록 기반 덱
+};
+
+// 구현 방식 이름 반환
+const char* queueTypeName(QueueType type) {
+    switch (type) {
+        case QueueType::Array:  return "Array-based ring buffer";
+        case QueueType::Linked: return "Linked-list-based";
+        default:                return "Block-based deque";
+    }
+}
+
+// 입력 버퍼 비우기 함수
+void clearInputBuffer() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 메뉴 출력 함수
+void printMenu(QueueType type) {
+    std::cout << "\n=== Queue Test Menu ("
+              << queueTypeName(type)
+              << ") ===\n"
+              << "1. Push        - 큐에 데이터 추가\n"
+              << "2. Pop         - 큐에서 데이터 제거\n"
+              << "3. Front       - 맨 앞 데이터 확인\n"
+              << "4. Back        - 맨 뒤 데이터 확인\n"
+              << "5. Print       - 큐 전체 출력\n"
+              << "6. Size        - 큐 크기 확인\n"
+              << "7. Capacity    - 큐 용량 확인\n"
+              << "8. Clear       - 큐 초기화\n"
+              << "9. Empty       - 큐 공백 상태 확인\n"
+              << "10. Change Impl - 큐 구현 방식 변경\n"
+              << "0. Exit        - 프로그램 종료\n"
+              << "메뉴 선택: ";
+}
+
+// 테스트 실행 함수 (구현 방식과 무관하게 IQueue 인터페이스로 처리)
+void runQueueTest(IQueue<int>& queue, QueueType type) {
+    int choice;
+    int value;
+
+    do {
+        printMenu(type);
+        std::cin >> choice;
+
+        try {
+            switch (static_cast<MenuOption>(choice)) {
+                case MenuOption::Push:
+                    std::cout << "추가할 값 입력: ";
+                    std::cin >> value;
+                    queue.push(value);
+                    std::cout << "값 " << value << " 이(가) 큐에 추가됨\n";
+                    break;
+
+                case MenuOption::Pop:
+                    value = queue.pop_value();
+                    std::cout << "큐 맨 앞 요소 " << value << " 이(가) 제거됨\n";
+                    break;
+
+                case MenuOption::Front:
+                    value = queue.front();
+                    std::cout << "큐 맨 앞 값: " << value << "\n";
+                    break;
+
+                case MenuOption::Back:
+                    value = queue.back();
+                    std::cout << "큐 맨 뒤 값: " << value << "\n";
+                    break;
+
+                case MenuOption::Print:
+                    queue.print();
+                    break;
+
+                case MenuOption::Size:
+                    std::cout << "큐 크기: " << queue.size() << "\n";
+                    break;
+
+                case MenuOption::Capacity:
+                    std::cout << "큐 용량: ";
+                    if (queue.capacity() == size_t(-1)) {
+                        std::cout << "무제한\n";
+                    } else {
+                        std::cout << queue.capacity() << "\n";
+                    }
+                    break;
+
+                case MenuOption::Clear:
+                    queue.clear();
+                    std::cout << "큐가 초기화됨\n";
+                    break;
+
+                case MenuOption::Empty:
+                    std::cout << "큐 상태: "
+                             << (queue.empty() ? "비어있음" : "비어있지 않음")
+                             << "\n";
+                    break;
+
+                case MenuOption::ChangeImpl:
+                    return;  // 현재 테스트 종료
+
+                case MenuOption::Exit:
+                    std::cout << "프로그램을 종료합니다.\n";
+                    exit(0);
+
+                default:
+                    std::cout << "잘못된 메뉴 선택입니다.\n";
+            }
+        }
+        catch (const std::exception& e) {
+            std::cout << "오류 발생: " << e.what() << "\n";
+        }
+
+        clearInputBuffer();
+
+    } while (true);
+}
+
+int main() {
+    // QueueType 순서대로 배치 (블록 경계를 확인하기 쉽도록 Deque는 블록당 4개)
+    std::unique_ptr<IQueue<int>> queues[] = {
+        std::make_unique<ArrayQueue<int>>(),
+        std::make_unique<LinkedQueue<int>>(),
+        std::make_unique<Deque<int, 4>>(),
+    };
+    const int queue_count = sizeof(queues) / sizeof(queues[0]);
+    QueueType current_type = QueueType::Array;
+
+    std::cout << "큐 테스트 프로그램을 시작합니다.\n";
+
+    while (true) {
+        runQueueTest(*queues[static_cast<int>(current_type)], current_type);
+        current_type = static_cast<QueueType>((static_cast<int>(current_type) + 1) % queue_count);
+
+        std::cout << "\n구현 방식이 ";
+        if (current_type == QueueType::Array) {
+            std::cout << "배열 기반 원형 큐";
+        } else if (current_type == QueueType::Linked) {
+            std::cout << "연결 리스트 기반 큐";
+        } else {
+            std::cout << "블록 기반 덱";
+        }
+        std::cout << "으로 변경되었습니다.\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,257 @@
+#include <atomic>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "spsc_ring_buffer.hpp"
+
+// 사용자 메뉴 선택을 위한 열거형
+enum class MenuOption {
+    Exit = 0,       // 프로그램 종료
+    Push,           // 데이터 추가 (가득 찼으면 실패)
+    Pop,            // 데이터 꺼내기 (비어있으면 실패)
+    Status,         // 크기/용량 확인
+    OrderTest,      // 생산자/소비자 스레드 순서 보존 검사
+    ThrowTest,      // try_pop_n 도중 이동이 예외를 던질 때의 상태 검사
+    CapacityTest    // 용량 올림 오버플로 시 std::length_error 검사
+};
+
+// 입력 버퍼 비우기 함수
+void clearInputBuffer() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 메뉴 출력 함수
+void printMenu() {
+    std::cout << "\n=== SPSC Ring Buffer Test Menu ===\n"
+              << "1. Push          - 데이터 추가\n"
+              << "2. Pop           - 데이터 꺼내기\n"
+              << "3. Status        - 크기/용량 확인\n"
+              << "4. Order Test    - 생산자/소비자 스레드 순서 보존 검사\n"
+              << "5. Throw Test    - try_pop_n 이동 중 예외 처리 검사\n"
+              << "6. Capacity Test - 용량 오버플로 검사\n"
+              << "0. Exit          - 프로그램 종료\n"
+              << "메뉴 선택: ";
+}
+
+/**
+ * @brief 생산자/소비자 스레드 순서 보존 검사
+ * 생산자는 0..items-1을 단건/묶음으로 번갈아 넣고, 소비자도 단건/묶음으로 번갈아 꺼냄
+ * - 용량을 작게 두어 가득 참/비어 있음 경계를 자주 지나도록 함
+ * - 꺼낸 값이 정확히 0, 1, 2, ... 순서인지 확인
+ * @return 모든 값이 순서대로 한 번씩 꺼내졌으면 true
+ */
+bool runOrderTest(int items, size_t capacity) {
+    SpscRingBuffer<int> buffer(capacity);
+
+    std::thread producer([&] {
+        int batch[16];
+        int next = 0;
+        while (next < items) {
+            if (next % 3 == 0) {
+                if (buffer.try_push(next)) {
+                    ++next;
+                }
+                continue;
+            }
+            int count = 0;
+            while (count < 16 && next + count < items) {
+                batch[count] = next + count;
+                ++count;
+            }
+            next += static_cast<int>(buffer.try_push_n(batch, static_cast<size_t>(count)));
+        }
+    });
+
+    int expected = 0;
+    bool in_order = true;
+    int values[16];
+    bool single = true;
+    while (expected < items) {
+        size_t n;
+        if (single) {
+            n = buffer.try_pop(values[0]) ? 1 : 0;
+        } else {
+            n = buffer.try_pop_n(values, 16);
+        }
+        single = !single;
+        for (size_t i = 0; i < n; ++i) {
+            if (values[i] != expected) {
+                in_order = false;
+            }
+            ++expected;
+        }
+    }
+    producer.join();
+
+    std::cout << "꺼낸 값: " << expected << "/" << items
+              << ", 순서: " << (in_order ? "유지" : "깨짐") << "\n";
+    return in_order && expected == items && buffer.empty();
+}
+
+// 이동 대입 시 값이 POISON이면 예외를 던지는 타입 (살아있는 객체 수를 셈)
+struct Fragile {
+    static constexpr int POISON = -1;
+    static int alive;
+    int value;
+
+    explicit Fragile(int v = 0) : value(v) { ++alive; }
+    Fragile(const Fragile& other) : value(other.value) { ++alive; }
+    Fragile& operator=(Fragile&& other) {
+        if (other.value == POISON) {
+            throw std::runtime_error("poisoned move");
+        }
+        value = other.value;
+        return *this;
+    }
+    ~Fragile() { --alive; }
+};
+
+int Fragile::alive = 0;
+
+/**
+ * @brief try_pop_n 도중 이동이 예외를 던질 때의 상태 검사
+ * 0, 1, 2, POISON, 4, 5 를 넣고 6개를 한 번에 꺼냄
+ * - 앞의 3개는 꺼내진 것으로 처리되어야 함 (head 공개)
+ * - 예외가 난 요소부터는 그대로 남아 front()로 볼 수 있어야 함
+ * - 모두 정리한 뒤 살아있는 객체 수가 0이어야 함 (이중 소멸/누수 없음)
+ */
+bool runThrowTest() {
+    bool passed = true;
+    {
+        SpscRingBuffer<Fragile> buffer(8);
+        const int inputs[] = { 0, 1, 2, Fragile::POISON, 4, 5 };
+        for (int input : inputs) {
+            buffer.try_emplace(input);
+        }
+
+        std::vector<Fragile> out(6);
+        bool threw = false;
+        try {
+            buffer.try_pop_n(out.begin(), out.size());
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        const Fragile* front = buffer.front();
+        std::cout << "예외 발생: " << (threw ? "예" : "아니오")
+                  << ", 남은 요소: " << buffer.size()
+                  << ", 맨 앞: " << (front != nullptr ? front->value : 0) << "\n";
+        passed = threw && buffer.size() == 3 && front != nullptr && front->value == Fragile::POISON
+                 && out[0].value == 0 && out[1].value == 1 && out[2].value == 2;
+
+        // 남은 요소는 소멸자가 정리
+    }
+    std::cout << "살아있는 객체: " << Fragile::alive << "\n";
+    return passed && Fragile::alive == 0;
+}
+
+/**
+ * @brief 용량을 2의 거듭제곱으로 올리다 size_t를 넘으면 std::length_error를 던지는지 확인
+ * 할당 전에 실패해야 하므로 메모리를 쓰지 않음
+ */
+bool runCapacityTest() {
+    bool passed = true;
+    const size_t huge_counts[] = {
+        std::numeric_limits<size_t>::max(),
+        std::numeric_limits<size_t>::max() / 2 + 2,
+        std::numeric_limits<size_t>::max() / sizeof(long long) + 1
+    };
+    for (size_t count : huge_counts) {
+        bool threw = false;
+        try {
+            SpscRingBuffer<long long> buffer(count);
+        } catch (const std::length_error& e) {
+            threw = true;
+            std::cout << "요청 " << count << ": " << e.what() << "\n";
+        }
+        passed = passed && threw;
+    }
+
+    SpscRingBuffer<int> small(3);
+    std::cout << "요청 3 → 용량 " << small.capacity() << "\n";
+    return passed && small.capacity() == 4;
+}
+
+void runSpscTest(SpscRingBuffer<int>& buffer) {
+    int choice;
+    int value;
+
+    do {
+        printMenu();
+        std::cin >> choice;
+
+        try {
+            switch (static_cast<MenuOption>(choice)) {
+                case MenuOption::Push:
+                    std::cout << "추가할 값 입력: ";
+                    std::cin >> value;
+                    if (buffer.try_push(value)) {
+                        std::cout << "값 " << value << " 이(가) 추가됨\n";
+                    } else {
+                        std::cout << "버퍼가 가득 찼습니다.\n";
+                    }
+                    break;
+
+                case MenuOption::Pop:
+                    if (buffer.try_pop(value)) {
+                        std::cout << "요소 " << value << " 을(를) 꺼냄\n";
+                    } else {
+                        std::cout << "버퍼가 비어있습니다.\n";
+                    }
+                    break;
+
+                case MenuOption::Status:
+                    std::cout << "크기: " << buffer.size() << ", 용량: " << buffer.capacity() << "\n";
+                    break;
+
+                case MenuOption::OrderTest: {
+                    int items;
+                    size_t capacity;
+                    std::cout << "전달할 값 수 입력: ";
+                    std::cin >> items;
+                    std::cout << "버퍼 용량 입력: ";
+                    std::cin >> capacity;
+                    if (items < 1 || capacity < 1) {
+                        std::cout << "1 이상의 값을 입력하세요.\n";
+                        break;
+                    }
+                    bool passed = runOrderTest(items, capacity);
+                    std::cout << "순서 테스트 " << (passed ? "통과" : "실패") << "\n";
+                    break;
+                }
+
+                case MenuOption::ThrowTest:
+                    std::cout << "예외 테스트 " << (runThrowTest() ? "통과" : "실패") << "\n";
+                    break;
+
+                case MenuOption::CapacityTest:
+                    std::cout << "용량 테스트 " << (runCapacityTest() ? "통과" : "실패") << "\n";
+                    break;
+
+                case MenuOption::Exit:
+                    std::cout << "프로그램을 종료합니다.\n";
+                    return;
+
+                default:
+                    std::cout << "잘못된 메뉴 선택입니다.\n";
+            }
+        }
+        catch (const std::exception& e) {
+            std::cout << "오류 발생: " << e.what() << "\n";
+        }
+
+        clearInputBuffer();
+
+    } while (true);
+}
+
+int main() {
+    // 가득 찬 상태를 확인하기 쉽도록 용량은 4
+    SpscRingBuffer<int> buffer(4);
+
+    std::cout << "SPSC 링 버퍼 테스트 프로그램을 시작합니다.\n";
+    runSpscTest(buffer);
+    return 0;
+}
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include "work_stealing_deque.hpp"
+
+// 사용자 메뉴 선택을 위한 열거형
+enum class MenuOption {
+    Exit = 0,       // 프로그램 종료
+    Push,           // 아래쪽에 데이터 추가 (owner)
+    Pop,            // 아래쪽에서 데이터 제거 (owner)
+    Steal,          // 위쪽에서 데이터 훔치기 (thief)
+    Print,          // 덱 전체 출력
+    Size,           // 덱 크기 확인
+    Capacity,       // 덱 용량 확인
+    StressTest      // 다중 스레드 훔치기 스트레스 테스트
+};
+
+// 입력 버퍼 비우기 함수
+void clearInputBuffer() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 메뉴 출력 함수
+void printMenu() {
+    std::cout << "\n=== Work-Stealing Deque Test Menu ===\n"
+              << "1. Push        - 아래쪽에 데이터 추가 (owner)\n"
+              << "2. Pop         - 아래쪽에서 데이터 제거 (owner)\n"
+              << "3. Steal       - 위쪽에서 데이터 훔치기 (thief)\n"
+              << "4. Print       - 덱 전체 출력\n"
+              << "5. Size        - 덱 크기 확인\n"
+              << "6. Capacity    - 덱 용량 확인\n"
+              << "7. Stress Test - 다중 스레드 훔치기 스트레스 테스트\n"
+              << "0. Exit        - 프로그램 종료\n"
+              << "메뉴 선택: ";
+}
+
+/**
+ * @brief 훔치기 위주 스트레스 테스트
+ * owner 하나가 0..items-1을 push 하면서 가끔만 pop 하고, thief 스레드들이 계속 훔쳐감
+ * - 초기 용량을 최소로 두어 thief가 읽는 도중에도 배열 확장이 반복되도록 함
+ * - 모든 값이 정확히 한 번씩만 꺼내졌는지 확인
+ * @return 모든 값이 한 번씩 꺼내졌으면 true
+ */
+bool runStressTest(int thieves, int items) {
+    WorkStealingDeque<int> deque(2);
+    std::unique_ptr<std::atomic<int>[]> seen(new std::atomic<int>[items]);
+    for (int i = 0; i < items; ++i) {
+        seen[i].store(0, std::memory_order_relaxed);
+    }
+    std::atomic<int> taken(0);
+    std::atomic<bool> done(false);
+    std::vector<int> stolen_counts(thieves, 0);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < thieves; ++t) {
+        workers.emplace_back([&, t] {
+            int value;
+            while (!done.load(std::memory_order_acquire)) {
+                if (deque.try_steal(value)) {
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                    taken.fetch_add(1, std::memory_order_relaxed);
+                    ++stolen_counts[t];
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // owner: 무작위 길이로 몰아서 push 하고 가끔 조금씩 pop
+    std::mt19937 rng(12345);
+    int popped = 0;
+    int next = 0;
+    int value;
+    while (next < items) {
+        int burst = std::min(items - next, static_cast<int>(rng() % 64) + 1);
+        for (int i = 0; i < burst; ++i) {
+            deque.push(next++);
+        }
+        if (rng() % 4 == 0) {
+            int pops = static_cast<int>(rng() % 4);
+            for (int i = 0; i < pops && deque.try_pop(value); ++i) {
+                seen[value].fetch_add(1, std::memory_order_relaxed);
+                taken.fetch_add(1, std::memory_order_relaxed);
+                ++popped;
+            }
+        }
+    }
+    // 남은 작업은 owner와 thief가 함께 비움
+    while (taken.load(std::memory_order_relaxed) < items) {
+        if (deque.try_pop(value)) {
+            seen[value].fetch_add(1, std::memory_order_relaxed);
+            taken.fetch_add(1, std::memory_order_relaxed);
+            ++popped;
+        }
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    int missing = 0;
+    int duplicated = 0;
+    for (int i = 0; i < items; ++i) {
+        int count = seen[i].load(std::memory_order_relaxed);
+        if (count == 0) {
+            ++missing;
+        } else if (count > 1) {
+            ++duplicated;
+        }
+    }
+
+    std::cout << "owner pop: " << popped << ", 훔친 수:";
+    for (int count : stolen_counts) {
+        std::cout << " " << count;
+    }
+    std::cout << "\n최종 용량: " << deque.capacity()
+              << ", 누락: " << missing << ", 중복: " << duplicated << "\n";
+    return missing == 0 && duplicated == 0;
+}
+
+// 테스트 실행 함수 (메뉴의 push/pop/steal은 모두 현재 스레드에서 실행)
+void runDequeTest(WorkStealingDeque<int>& deque) {
+    int choice;
+    int value;
+
+    do {
+        printMenu();
+        std::cin >> choice;
+
+        try {
+            switch (static_cast<MenuOption>(choice)) {
+                case MenuOption::Push:
+                    std::cout << "추가할 값 입력: ";
+                    std::cin >> value;
+                    deque.push(value);
+                    std::cout << "값 " << value << " 이(가) 아래쪽에 추가됨\n";
+                    break;
+
+                case MenuOption::Pop:
+                    if (deque.try_pop(value)) {
+                        std::cout << "아래쪽 요소 " << value << " 이(가) 제거됨\n";
+                    } else {
+                        std::cout << "덱이 비어있습니다.\n";
+                    }
+                    break;
+
+                case MenuOption::Steal:
+                    if (deque.try_steal(value)) {
+                        std::cout << "위쪽 요소 " << value << " 을(를) 훔침\n";
+                    } else {
+                        std::cout << "덱이 비어있습니다.\n";
+                    }
+                    break;
+
+                case MenuOption::Print:
+                    deque.print();
+                    break;
+
+                case MenuOption::Size:
+                    std::cout << "덱 크기: " << deque.size() << "\n";
+                    break;
+
+                case MenuOption::Capacity:
+                    std::cout << "덱 용량: " << deque.capacity() << "\n";
+                    break;
+
+                case MenuOption::StressTest: {
+                    int thieves;
+                    int items;
+                    std::cout << "thief 스레드 수 입력: ";
+                    std::cin >> thieves;
+                    std::cout << "작업 수 입력: ";
+                    std::cin >> items;
+                    if (thieves < 1 || items < 1) {
+                        std::cout << "1 이상의 값을 입력하세요.\n";
+                        break;
+                    }
+                    bool passed = runStressTest(thieves, items);
+                    std::cout << "스트레스 테스트 " << (passed ? "통과" : "실패") << "\n";
+                    break;
+                }
+
+                case MenuOption::Exit:
+                    std::cout << "프로그램을 종료합니다.\n";
+                    return;
+
+                default:
+                    std::cout << "잘못된 메뉴 선택입니다.\n";
+            }
+        }
+        catch (const std::exception& e) {
+            std::cout << "오류 발생: " << e.what() << "\n";
+        }
+
+        clearInputBuffer();
+
+    } while (true);
+}
+
+int main() {
+    // 확장 동작을 확인하기 쉽도록 초기 용량은 4
+    WorkStealingDeque<int> deque(4);
+
+    std::cout << "작업 훔치기 덱 테스트 프로그램을 시작합니다.\n";
+    runDequeTest(deque);
+    return 0;
+}
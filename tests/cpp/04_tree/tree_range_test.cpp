@@ -0,0 +1,286 @@
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+#include "binary_search_tree.h"
+#include "binary_tree.h"
+#include "tree_range.hpp"
+
+// 사용자 메뉴 선택을 위한 열거형
+enum class MenuOption {
+    Exit = 0,       // 프로그램 종료
+    Insert,         // 값 삽입
+    InsertRandom,   // 무작위 값 여러 개 삽입
+    Traverse,       // 지정한 순서로 전체 순회
+    Pipeline,       // 중위 순회 → 짝수만 → 제곱 → 앞의 k개
+    TakeWhile,      // 레벨 순서로 한계값 미만인 동안만 순회
+    SelfCheck       // 재귀 순회와 비교 + 편향 트리 + 지연 평가 확인
+};
+
+static const char* ORDER_NAMES[] = { "전위", "중위", "후위", "레벨" };
+
+// 입력 버퍼 비우기 함수
+void clearInputBuffer() {
+    std::cin.clear();
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
+
+// 메뉴 출력 함수
+void printMenu() {
+    std::cout << "\n=== Tree Range Test Menu ===\n"
+              << "1. Insert        - 값 삽입\n"
+              << "2. Insert Random - 무작위 값 여러 개 삽입\n"
+              << "3. Traverse      - 순회 (0: 전위, 1: 중위, 2: 후위, 3: 레벨)\n"
+              << "4. Pipeline      - 중위 | 짝수만 | 제곱 | 앞의 k개\n"
+              << "5. Take While    - 레벨 순서로 한계값 미만인 동안만\n"
+              << "6. Self Check    - 재귀 순회와 비교, 편향 트리, 지연 평가 확인\n"
+              << "0. Exit          - 프로그램 종료\n"
+              << "메뉴 선택: ";
+}
+
+// 재귀로 만든 기준 순회 결과
+void referenceTraversal(const BstNode* node, TraversalOrder order, std::vector<int>& out) {
+    if (node == nullptr) {
+        return;
+    }
+    if (order == TRAVERSE_PREORDER) {
+        out.push_back(node->data);
+    }
+    referenceTraversal(node->left, order, out);
+    if (order == TRAVERSE_INORDER) {
+        out.push_back(node->data);
+    }
+    referenceTraversal(node->right, order, out);
+    if (order == TRAVERSE_POSTORDER) {
+        out.push_back(node->data);
+    }
+}
+
+// 큐로 만든 기준 레벨 순서 결과
+void referenceLevelOrder(const BstNode* root, std::vector<int>& out) {
+    std::vector<const BstNode*> queue;
+    if (root != nullptr) {
+        queue.push_back(root);
+    }
+    for (size_t i = 0; i < queue.size(); ++i) {
+        out.push_back(queue[i]->data);
+        if (queue[i]->left != nullptr) {
+            queue.push_back(queue[i]->left);
+        }
+        if (queue[i]->right != nullptr) {
+            queue.push_back(queue[i]->right);
+        }
+    }
+}
+
+/**
+ * @brief 커서/범위 어댑터 자가 검사
+ * - 무작위 트리에서 네 가지 순서가 재귀(기준) 결과와 같은지
+ * - 정렬된 입력으로 만든 편향 트리(높이 = n)를 호출 스택 넘침 없이 순회하는지
+ * - take(k) 파이프라인이 안쪽 범위에서 정확히 k개만 당겨오는지
+ * - 같은 프로그램에서 일반 이진 트리(BinaryTree)도 순회되는지 (두 트리 헤더/라이브러리 동시 사용)
+ * @return 모두 통과하면 true
+ */
+bool runSelfCheck() {
+    bool passed = true;
+    std::mt19937 rng(42);
+
+    BSTree* random_tree = bst_create();
+    for (int i = 0; i < 2000; ++i) {
+        bst_insert(random_tree, static_cast<int>(rng() % 100000));
+    }
+    for (int order = TRAVERSE_PREORDER; order <= TRAVERSE_LEVEL_ORDER; ++order) {
+        std::vector<int> expected;
+        if (order == TRAVERSE_LEVEL_ORDER) {
+            referenceLevelOrder(random_tree->root, expected);
+        } else {
+            referenceTraversal(random_tree->root, static_cast<TraversalOrder>(order), expected);
+        }
+        std::vector<int> actual;
+        for (const BstNode& node : traverse(random_tree, static_cast<TraversalOrder>(order))) {
+            actual.push_back(node.data);
+        }
+        bool same = actual == expected;
+        std::cout << ORDER_NAMES[order] << " 순회 (" << actual.size() << "개): " << (same ? "일치" : "불일치") << "\n";
+        passed = passed && same;
+    }
+
+    // 같은 범위를 다시 순회하면 처음부터 다시 시작
+    auto inorder = traverse(random_tree, TRAVERSE_INORDER);
+    size_t first_pass = static_cast<size_t>(std::distance(inorder.begin(), inorder.end()));
+    size_t second_pass = static_cast<size_t>(std::distance(inorder.begin(), inorder.end()));
+    bool restart = first_pass == bst_size(random_tree) && second_pass == first_pass;
+    std::cout << "재순회: " << (restart ? "통과" : "실패") << "\n";
+    passed = passed && restart;
+
+    // 당겨온 횟수를 세어 지연 평가 확인
+    size_t pulled = 0;
+    std::vector<int> firsts;
+    auto counted = traverse(random_tree, TRAVERSE_INORDER)
+        | tree_views::filter([&pulled](const BstNode&) { ++pulled; return true; })
+        | tree_views::transform([](const BstNode& node) { return node.data; })
+        | tree_views::take(5);
+    std::copy(counted.begin(), counted.end(), std::back_inserter(firsts));
+    bool lazy = pulled == 5 && firsts.size() == 5 && std::is_sorted(firsts.begin(), firsts.end());
+    std::cout << "지연 평가 (take 5 → " << pulled << "개 당김): " << (lazy ? "통과" : "실패") << "\n";
+    passed = passed && lazy;
+    bst_destroy(random_tree);
+
+    const int skewed_size = 20000;
+    BSTree* skewed_tree = bst_create();
+    for (int i = 0; i < skewed_size; ++i) {
+        bst_insert(skewed_tree, i);
+    }
+    bool skewed = true;
+    for (int order = TRAVERSE_PREORDER; order <= TRAVERSE_LEVEL_ORDER; ++order) {
+        int count = 0;
+        for (const BstNode& node : traverse(skewed_tree, static_cast<TraversalOrder>(order))) {
+            int expected = order == TRAVERSE_POSTORDER ? skewed_size - 1 - count : count;
+            skewed = skewed && node.data == expected;
+            ++count;
+        }
+        skewed = skewed && count == skewed_size;
+    }
+    std::cout << "편향 트리 (높이 " << bst_height(skewed_tree) << "): " << (skewed ? "통과" : "실패") << "\n";
+    passed = passed && skewed;
+    bst_destroy(skewed_tree);
+
+    // 번호 i 노드의 자식이 2i, 2i+1 인 완전 이진 트리 → 레벨 순서는 1..n
+    const int complete_size = 1000;
+    BinaryTree* binary_tree = btree_create();
+    std::vector<BTreeNode*> nodes(complete_size + 1, nullptr);
+    btree_insert_left(binary_tree, nullptr, 1);
+    nodes[1] = binary_tree->root;
+    for (int i = 2; i <= complete_size; ++i) {
+        BTreeNode* parent = nodes[i / 2];
+        if (i % 2 == 0) {
+            btree_insert_left(binary_tree, parent, i);
+            nodes[i] = parent->left;
+        } else {
+            btree_insert_right(binary_tree, parent, i);
+            nodes[i] = parent->right;
+        }
+    }
+    int expected_value = 1;
+    bool level_order = true;
+    for (const BTreeNode& node : traverse(binary_tree, TRAVERSE_LEVEL_ORDER)) {
+        level_order = level_order && node.data == expected_value++;
+    }
+    level_order = level_order && expected_value == complete_size + 1;
+    std::cout << "이진 트리 레벨 순서: " << (level_order ? "통과" : "실패") << "\n";
+    passed = passed && level_order;
+    btree_destroy(binary_tree);
+
+    return passed;
+}
+
+void runTreeRangeTest(BSTree* tree) {
+    int choice;
+    int value;
+
+    do {
+        printMenu();
+        std::cin >> choice;
+
+        try {
+            switch (static_cast<MenuOption>(choice)) {
+                case MenuOption::Insert:
+                    std::cout << "삽입할 값 입력: ";
+                    std::cin >> value;
+                    if (bst_insert(tree, value) == BST_OK) {
+                        std::cout << "값 " << value << " 이(가) 삽입됨\n";
+                    } else {
+                        std::cout << "삽입 실패 (중복 또는 메모리 부족)\n";
+                    }
+                    break;
+
+                case MenuOption::InsertRandom: {
+                    int count;
+                    std::cout << "삽입할 개수 입력: ";
+                    std::cin >> count;
+                    std::mt19937 rng(std::random_device{}());
+                    for (int i = 0; i < count; ++i) {
+                        bst_insert(tree, static_cast<int>(rng() % 1000));
+                    }
+                    std::cout << "트리 크기: " << bst_size(tree) << "\n";
+                    break;
+                }
+
+                case MenuOption::Traverse: {
+                    int order;
+                    std::cout << "순회 순서 입력 (0-3): ";
+                    std::cin >> order;
+                    if (order < TRAVERSE_PREORDER || order > TRAVERSE_LEVEL_ORDER) {
+                        std::cout << "잘못된 순서입니다.\n";
+                        break;
+                    }
+                    std::cout << ORDER_NAMES[order] << " 순회: ";
+                    for (const BstNode& node : traverse(tree, static_cast<TraversalOrder>(order))) {
+                        std::cout << node.data << " ";
+                    }
+                    std::cout << "\n";
+                    break;
+                }
+
+                case MenuOption::Pipeline: {
+                    size_t k;
+                    std::cout << "k 입력: ";
+                    std::cin >> k;
+                    auto squares = traverse(tree, TRAVERSE_INORDER)
+                        | tree_views::filter([](const BstNode& node) { return node.data % 2 == 0; })
+                        | tree_views::transform([](const BstNode& node) { return static_cast<long long>(node.data) * node.data; })
+                        | tree_views::take(k);
+                    std::cout << "짝수 제곱: ";
+                    for (long long square : squares) {
+                        std::cout << square << " ";
+                    }
+                    std::cout << "\n";
+                    break;
+                }
+
+                case MenuOption::TakeWhile: {
+                    std::cout << "한계값 입력: ";
+                    std::cin >> value;
+                    std::cout << "레벨 순서 (" << value << " 미만인 동안): ";
+                    for (const BstNode& node : traverse(tree, TRAVERSE_LEVEL_ORDER)
+                             | tree_views::take_while([value](const BstNode& node) { return node.data < value; })) {
+                        std::cout << node.data << " ";
+                    }
+                    std::cout << "\n";
+                    break;
+                }
+
+                case MenuOption::SelfCheck:
+                    std::cout << "자가 검사 " << (runSelfCheck() ? "통과" : "실패") << "\n";
+                    break;
+
+                case MenuOption::Exit:
+                    std::cout << "프로그램을 종료합니다.\n";
+                    return;
+
+                default:
+                    std::cout << "잘못된 메뉴 선택입니다.\n";
+            }
+        }
+        catch (const std::exception& e) {
+            std::cout << "오류 발생: " << e.what() << "\n";
+        }
+
+        clearInputBuffer();
+
+    } while (true);
+}
+
+int main() {
+    BSTree* tree = bst_create();
+    if (tree == nullptr) {
+        std::cout << "트리 생성 실패\n";
+        return 1;
+    }
+
+    std::cout << "트리 순회 범위 테스트 프로그램을 시작합니다.\n";
+    runTreeRangeTest(tree);
+    bst_destroy(tree);
+    return 0;
+}